@@ -27,6 +27,7 @@
 #include "omrprofiler.h"
 
 void ex_omr_checkSampleStack(OMR_VMThread *omrVMThread, const void *context);
+void ex_omr_sampleAllocationStack(OMR_VMThread *omrVMThread, const void *context);
 void ex_omr_insertMethodEntryInMethodDictionary(OMR_VM *omrVM, const void *method);
 
 static void ex_omr_sampleStack(OMR_VMThread *omrVMThread, const void *context);
@@ -118,6 +119,27 @@ ex_omr_checkSampleStack(OMR_VMThread *omrVMThread, const void *context)
 	}
 }
 
+/**
+ * This is an example of how the language runtime can attribute sampled allocations to their allocation site.
+ *
+ * This function should be called by the listener the language runtime registers with the OMR memory manager
+ * hook interface for J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE (enabled with -Xgc:allocationSamplingInterval=<size>).
+ * The hook is triggered by the allocating thread once the sampled object is initialized, so the callstack of the
+ * current thread is the allocation site. Each sample stands for about samplingInterval bytes of allocation, and the
+ * listener may also record the class of the sampled object. The context parameter represents a language-specific
+ * data structure containing the current callstack, such as the current thread.
+ *
+ * This function is only an example, and may be completely customized by the language runtime. It
+ * may be omitted if allocation profiling is not implemented.
+ */
+void
+ex_omr_sampleAllocationStack(OMR_VMThread *omrVMThread, const void *context)
+{
+	if (omr_ras_sampleStackEnabled()) {
+		ex_omr_sampleStack(omrVMThread, context);
+	}
+}
+
 /**
  * This is an example of how the language runtime can insert a method entry into the method
  * dictionary.
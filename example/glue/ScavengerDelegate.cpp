@@ -110,6 +110,22 @@ MM_ScavengerDelegate::getObjectScanner(MM_EnvironmentStandard *env, omrobjectptr
 	return objectScanner;
 }
 
+const uintptr_t *
+MM_ScavengerDelegate::getHotFieldOffsets(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t *hotFieldCount)
+{
+	/* Example objects are all of the same shape (a header slot followed by reference slots) and tend to be built
+	 * as lists and trees hanging off their first slot, so that slot stands in for a per-type hot field list.
+	 */
+	static const uintptr_t firstSlotOffset[] = { sizeof(fomrobject_t) };
+
+	*hotFieldCount = 0;
+	if (_extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr) > sizeof(fomrobject_t)) {
+		*hotFieldCount = 1;
+		return firstSlotOffset;
+	}
+	return NULL;
+}
+
 void
 MM_ScavengerDelegate::flushReferenceObjects(MM_EnvironmentStandard *env)
 {
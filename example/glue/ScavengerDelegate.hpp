@@ -136,6 +136,19 @@ public:
 	 */
 	GC_ObjectScanner *getObjectScanner(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, void *allocSpace, uintptr_t flags);
 
+	/**
+	 * When hot field copying is enabled (-Xgc:scavengerHotFieldCopy) the scavenger calls this method for each object
+	 * it copies, and copies the objects referenced from the returned fields right behind it, in the order given, so
+	 * that the references the mutator is expected to follow first stay within the same cache lines after the scavenge.
+	 * The list is typically a per-type property of the object, and must only contain offsets of reference slots.
+	 *
+	 * @param[in] env The environment for the calling thread.
+	 * @param[in] objectPtr The object that has just been copied
+	 * @param[out] hotFieldCount The number of entries in the returned list
+	 * @return Ordered list of byte offsets, from the object header, of the object's hot reference fields, or NULL if there are none
+	 */
+	const uintptr_t *getHotFieldOffsets(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t *hotFieldCount);
+
 	/**
 	 * Scavenger calls this method when required to force GC threads to flush any locally-held references into
 	 * associated global buffers.
@@ -29,7 +29,6 @@
 
 #include "Base.hpp"
 #include "EnvironmentStandard.hpp"
-#include "ForwardedHeader.hpp"
 #include "Scavenger.hpp"
 #include "SublistFragment.hpp"
 
@@ -113,9 +112,9 @@ public:
 				ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(omrVM->objectTable, &state);
 				while (NULL != objectEntry) {
 					if (_scavenger->isObjectInEvacuateMemory(objectEntry->objPtr)) {
-						MM_ForwardedHeader fwdHeader(objectEntry->objPtr);
-						if (fwdHeader.isForwardedPointer()) {
-							objectEntry->objPtr = fwdHeader.getForwardedObject();
+						omrobjectptr_t forwardedObject = _scavenger->getForwardedObject(objectEntry->objPtr);
+						if (NULL != forwardedObject) {
+							objectEntry->objPtr = forwardedObject;
 						} else {
 							omrmem_free_memory((void *)objectEntry->name);
 							objectEntry->name = NULL;
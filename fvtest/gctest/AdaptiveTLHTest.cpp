@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "GCConfigTest.hpp"
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "mmprivatehook.h"
+#include "omrgc.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+#include "ObjectAllocationModel.hpp"
+
+/**
+ * Checks adaptive TLH sizing (-Xgc:tlhAdaptiveSizing): each refresh requests a TLH which lasts
+ * tlhAdaptiveRefreshInterval at the reported allocation rate of the thread, so a thread allocating
+ * in a tight loop gets much larger TLHs than the same thread once it allocates slowly.
+ */
+class AdaptiveTLHTest : public GCConfigTest
+{
+protected:
+	struct RefreshState {
+		uintptr_t count;
+		uintptr_t mismatches;
+		uintptr_t lastRefreshCount;
+		uintptr_t lastRefreshSize;
+		uintptr_t lastAllocationRate;
+	};
+
+	static void hookCacheRefreshed(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+};
+
+static const uintptr_t ADAPTIVE_TLH_TEST_OBJECT_SIZE = 256;
+static const uintptr_t ADAPTIVE_TLH_TEST_FAST_REFRESHES = 64;
+static const uintptr_t ADAPTIVE_TLH_TEST_SLOW_BYTES_PER_MILLI = 8 * 1024;
+static const uintptr_t ADAPTIVE_TLH_TEST_MAX_SLEEPS = 4000;
+
+void
+AdaptiveTLHTest::hookCacheRefreshed(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	MM_CacheRefreshedEvent *event = (MM_CacheRefreshedEvent *)eventData;
+	RefreshState *state = (RefreshState *)userData;
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(event->currentThread->_vm);
+
+	/* the next refresh must last tlhAdaptiveRefreshInterval at the reported rate, within the TLH size bounds */
+	uintptr_t expected = (uintptr_t)(((uint64_t)event->allocationRate * extensions->tlhAdaptiveRefreshInterval) / 1000);
+	expected = MM_Math::roundToCeiling(extensions->tlhIncrementSize, expected);
+	expected = OMR_MIN(OMR_MAX(expected, extensions->tlhInitialSize), extensions->tlhMaximumSize);
+	if (expected != event->refreshSize) {
+		state->mismatches += 1;
+	}
+	state->count += 1;
+	state->lastRefreshCount = event->refreshCount;
+	state->lastRefreshSize = event->refreshSize;
+	state->lastAllocationRate = event->allocationRate;
+}
+
+TEST_P(AdaptiveTLHTest, refreshSizeFollowsAllocationRate)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_TRUE(extensions->tlhAdaptiveSizing) << "Configuration did not enable adaptive TLH sizing.";
+
+	RefreshState state = { 0, 0, 0, 0, 0 };
+	J9HookInterface **privateHooks = J9_HOOK_INTERFACE(extensions->privateHookInterface);
+	ASSERT_EQ(0, (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_CACHE_REFRESHED, hookCacheRefreshed, OMR_GET_CALLSITE(), &state));
+
+	/* allocate in a tight loop: the rate is high, so TLHs grow towards the maximum size */
+	uintptr_t fastRefreshSize = 0;
+	uintptr_t fastAllocationRate = 0;
+	while (state.count < ADAPTIVE_TLH_TEST_FAST_REFRESHES) {
+		MM_ObjectAllocationModel allocationModel(env, ADAPTIVE_TLH_TEST_OBJECT_SIZE, 0);
+		ASSERT_TRUE(NULL != OMR_GC_AllocateObject(exampleVM->_omrVMThread, &allocationModel)) << "Failed to allocate an object.";
+		fastRefreshSize = OMR_MAX(fastRefreshSize, state.lastRefreshSize);
+		fastAllocationRate = OMR_MAX(fastAllocationRate, state.lastAllocationRate);
+	}
+	uintptr_t fastRefreshes = state.count;
+
+	/* allocate about ADAPTIVE_TLH_TEST_SLOW_BYTES_PER_MILLI per millisecond: TLHs shrink back towards the smallest size */
+	uintptr_t slowRefreshSize = OMR_MAX(extensions->tlhInitialSize, extensions->tlhIncrementSize);
+	uintptr_t sleeps = 0;
+	while ((state.lastRefreshSize > slowRefreshSize) && (sleeps < ADAPTIVE_TLH_TEST_MAX_SLEEPS)) {
+		for (uintptr_t bytes = 0; bytes < ADAPTIVE_TLH_TEST_SLOW_BYTES_PER_MILLI; bytes += ADAPTIVE_TLH_TEST_OBJECT_SIZE) {
+			MM_ObjectAllocationModel allocationModel(env, ADAPTIVE_TLH_TEST_OBJECT_SIZE, 0);
+			ASSERT_TRUE(NULL != OMR_GC_AllocateObject(exampleVM->_omrVMThread, &allocationModel)) << "Failed to allocate an object.";
+		}
+		omrthread_sleep(1);
+		sleeps += 1;
+	}
+
+	(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_CACHE_REFRESHED, hookCacheRefreshed, &state);
+
+	gcTestEnv->log("Adaptive TLH sizing: %zu refreshes, up to %zu bytes at %zu bytes/ms allocating fast, %zu bytes at %zu bytes/ms after %zu slow refreshes\n",
+		state.count, fastRefreshSize, fastAllocationRate, state.lastRefreshSize, state.lastAllocationRate, state.count - fastRefreshes);
+	ASSERT_EQ((uintptr_t)0, state.mismatches) << "Refresh sizes do not follow the reported allocation rate.";
+	ASSERT_LE(state.count, state.lastRefreshCount) << "The refresh count of the thread is not reported.";
+	ASSERT_LT(extensions->tlhInitialSize, fastRefreshSize) << "TLHs did not grow for a thread allocating in a tight loop.";
+	ASSERT_LT(state.lastAllocationRate, fastAllocationRate) << "The allocation rate of the thread did not decrease.";
+	ASSERT_GE(slowRefreshSize, state.lastRefreshSize) << "TLHs did not shrink for a thread allocating slowly.";
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, AdaptiveTLHTest,
+        ::testing::Values("fvtest/gctest/configuration/scavenger_GC_adaptivetlh_config.xml"));
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
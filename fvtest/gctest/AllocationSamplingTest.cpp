@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCConfigTest.hpp"
+
+#include "mmomrhook.h"
+#include "omrgc.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ObjectAllocationModel.hpp"
+
+/**
+ * Checks that allocation sampling (-Xgc:allocationSamplingInterval=) reports about one object per sampling
+ * interval of allocated bytes, for objects allocated one at a time, in batches and out of line, and that the
+ * reported object is the initialized object returned to the allocating thread.
+ */
+class AllocationSamplingTest : public GCConfigTest
+{
+protected:
+	struct SampleState {
+		uintptr_t count;
+		uintptr_t bytes;
+		omrobjectptr_t lastObject;
+		uintptr_t lastSize;
+	};
+
+	static void hookObjectAllocationSample(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+};
+
+static const uintptr_t ALLOCATION_SAMPLING_TEST_BYTES = 64 * 1024 * 1024;
+static const uintptr_t ALLOCATION_SAMPLING_TEST_BATCH = 64;
+
+void
+AllocationSamplingTest::hookObjectAllocationSample(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	MM_ObjectAllocationSampleEvent *event = (MM_ObjectAllocationSampleEvent *)eventData;
+	SampleState *state = (SampleState *)userData;
+	state->count += 1;
+	state->bytes += event->size;
+	state->lastObject = event->object;
+	state->lastSize = event->size;
+}
+
+TEST_P(AllocationSamplingTest, sampleAllocatedBytes)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t interval = extensions->allocationSamplingInterval;
+	ASSERT_LT((uintptr_t)0, interval) << "Configuration did not enable allocation sampling.";
+
+	SampleState state = { 0, 0, NULL, 0 };
+	J9HookInterface **omrHooks = J9_HOOK_INTERFACE(extensions->omrHookInterface);
+	ASSERT_EQ(0, (*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE, hookObjectAllocationSample, OMR_GET_CALLSITE(), &state));
+
+	omrobjectptr_t objects[ALLOCATION_SAMPLING_TEST_BATCH];
+	uintptr_t allocatedBytes = 0;
+	uintptr_t i = 0;
+	while (allocatedBytes < ALLOCATION_SAMPLING_TEST_BYTES) {
+		uintptr_t samples = state.count;
+		if (0 == (i % 1024)) {
+			/* larger than a TLH, allocated out of line */
+			MM_ObjectAllocationModel allocationModel(env, 256 * 1024, 0);
+			omrobjectptr_t object = OMR_GC_AllocateObject(exampleVM->_omrVMThread, &allocationModel);
+			ASSERT_TRUE(NULL != object) << "Failed to allocate a large object.";
+			allocatedBytes += extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+			if (samples != state.count) {
+				ASSERT_EQ(object, state.lastObject) << "The sampled object is not the allocated object.";
+			}
+		} else if (0 == (i % 2)) {
+			MM_ObjectAllocationModel allocationModel(env, 32 + ((i * 40) % 800), 0);
+			omrobjectptr_t object = OMR_GC_AllocateObject(exampleVM->_omrVMThread, &allocationModel);
+			ASSERT_TRUE(NULL != object) << "Failed to allocate an object.";
+			allocatedBytes += extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+			if (samples != state.count) {
+				ASSERT_EQ(samples + 1, state.count);
+				ASSERT_EQ(object, state.lastObject) << "The sampled object is not the allocated object.";
+			}
+		} else {
+			MM_ObjectAllocationModel allocationModel(env, 48 + ((i * 24) % 400), 0);
+			uintptr_t count = OMR_GC_AllocateObjects(exampleVM->_omrVMThread, &allocationModel, objects, ALLOCATION_SAMPLING_TEST_BATCH);
+			ASSERT_LT((uintptr_t)0, count) << "Failed to allocate a batch of objects.";
+			bool found = (samples == state.count);
+			for (uintptr_t j = 0; j < count; j++) {
+				allocatedBytes += extensions->objectModel.getConsumedSizeInBytesWithHeader(objects[j]);
+				found = found || (objects[j] == state.lastObject);
+			}
+			ASSERT_TRUE(found) << "The sampled object is not one of the allocated objects.";
+		}
+		i += 1;
+	}
+
+	(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE, hookObjectAllocationSample, &state);
+
+	/* the number of samples is about Poisson distributed around the allocated bytes over the interval */
+	uintptr_t expected = allocatedBytes / interval;
+	gcTestEnv->log("Allocation sampling: %zu bytes allocated, %zu samples (%zu expected), %zu sampled bytes\n", allocatedBytes, state.count, expected, state.bytes);
+	EXPECT_LT((expected * 4) / 5, state.count) << "Too few allocations were sampled.";
+	EXPECT_GT((expected * 6) / 5, state.count) << "Too many allocations were sampled.";
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, AllocationSamplingTest,
+        ::testing::Values("fvtest/gctest/configuration/global_GC_allocationsampling_config.xml"));
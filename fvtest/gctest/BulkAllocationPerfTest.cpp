@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCConfigTest.hpp"
+
+#include "omrgc.h"
+
+#include "EnvironmentBase.hpp"
+#include "ObjectAllocationModel.hpp"
+
+/**
+ * Microbenchmark for batched allocation: a mutator allocates small objects of a single size, once one
+ * at a time through OMR_GC_AllocateObject() and once in batches through OMR_GC_AllocateObjects().
+ * The objects are not rooted, so they are recovered by the collections the allocations trigger.
+ * Run as part of the perftest suite (omrgctest --gtest_filter="perfTest*").
+ */
+class BulkAllocationPerfTest : public GCConfigTest
+{
+protected:
+	uint64_t allocateSingle(uintptr_t size, uintptr_t objectCount);
+	uint64_t allocateBatched(uintptr_t size, uintptr_t objectCount, uintptr_t batchSize, uintptr_t *contiguous);
+};
+
+static const uintptr_t BULK_ALLOCATION_OBJECTS = 1000000;
+static const uintptr_t BULK_ALLOCATION_BATCH = 256;
+
+/**
+ * Allocate objectCount objects one at a time.
+ * @return elapsed time in microseconds, or 0 on failure
+ */
+uint64_t
+BulkAllocationPerfTest::allocateSingle(uintptr_t size, uintptr_t objectCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	OMR_VMThread *omrVMThread = exampleVM->_omrVMThread;
+
+	uint64_t startTime = omrtime_hires_clock();
+	for (uintptr_t i = 0; i < objectCount; i++) {
+		MM_ObjectAllocationModel allocationModel(env, size, 0);
+		if (NULL == OMR_GC_AllocateObject(omrVMThread, &allocationModel)) {
+			return 0;
+		}
+	}
+	uint64_t endTime = omrtime_hires_clock();
+
+	return OMR_MAX(omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS), 1);
+}
+
+/**
+ * Allocate objectCount objects in batches of batchSize, checking that each batch is initialized.
+ * @param contiguous[out] number of objects that directly follow the previous object of their batch
+ * @return elapsed time in microseconds, or 0 on failure
+ */
+uint64_t
+BulkAllocationPerfTest::allocateBatched(uintptr_t size, uintptr_t objectCount, uintptr_t batchSize, uintptr_t *contiguous)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	OMR_VMThread *omrVMThread = exampleVM->_omrVMThread;
+	GC_ObjectModel *objectModel = &env->getExtensions()->objectModel;
+	uintptr_t adjustedSize = objectModel->adjustSizeInBytes(size);
+	omrobjectptr_t objects[BULK_ALLOCATION_BATCH];
+
+	*contiguous = 0;
+	uint64_t elapsed = 0;
+	uintptr_t allocated = 0;
+	while (allocated < objectCount) {
+		uint64_t startTime = omrtime_hires_clock();
+		MM_ObjectAllocationModel allocationModel(env, size, 0);
+		uintptr_t count = OMR_GC_AllocateObjects(omrVMThread, &allocationModel, objects, OMR_MIN(batchSize, objectCount - allocated));
+		elapsed += omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (0 == count) {
+			return 0;
+		}
+		for (uintptr_t i = 0; i < count; i++) {
+			if (adjustedSize != objectModel->getConsumedSizeInBytesWithHeader(objects[i])) {
+				return 0;
+			}
+			if ((0 < i) && (((uintptr_t)objects[i - 1] + adjustedSize) == (uintptr_t)objects[i])) {
+				*contiguous += 1;
+			}
+		}
+		allocated += count;
+	}
+
+	return OMR_MAX(elapsed, 1);
+}
+
+TEST_P(BulkAllocationPerfTest, allocate)
+{
+	uintptr_t sizes[] = {16, 32, 64, 128};
+
+	gcTestEnv->log("\n+++++++++++++++++++++++Bulk allocation+++++++++++++++++++++++\n");
+	gcTestEnv->log("%8s %16s %16s %12s\n", "size", "single objs/s", "batched objs/s", "contiguous");
+	for (uintptr_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+		uintptr_t contiguous = 0;
+		uint64_t singleTime = allocateSingle(sizes[i], BULK_ALLOCATION_OBJECTS);
+		uint64_t batchedTime = allocateBatched(sizes[i], BULK_ALLOCATION_OBJECTS, BULK_ALLOCATION_BATCH, &contiguous);
+		ASSERT_NE((uint64_t)0, singleTime) << "Single allocation of " << sizes[i] << " byte objects failed.";
+		ASSERT_NE((uint64_t)0, batchedTime) << "Batched allocation of " << sizes[i] << " byte objects failed.";
+
+		gcTestEnv->log("%8zu %16llu %16llu %11zu%%\n", sizes[i],
+				((uint64_t)BULK_ALLOCATION_OBJECTS * 1000000) / singleTime,
+				((uint64_t)BULK_ALLOCATION_OBJECTS * 1000000) / batchedTime,
+				(contiguous * 100) / BULK_ALLOCATION_OBJECTS);
+	}
+}
+
+INSTANTIATE_TEST_CASE_P(perfTest, BulkAllocationPerfTest,
+        ::testing::Values("perftest/gctest/configuration/bulkAllocation_perf_config.xml"));
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "GCConfigTest.hpp"
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "omrgc.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ObjectAllocationModel.hpp"
+
+/**
+ * Checks batched allocation (OMR_GC_AllocateObjects()) in a generational heap: nursery batches are served in runs
+ * from the TLH, tenured batches one object per call, each run allowed to collect on failure.
+ */
+class BulkAllocationTest : public GCConfigTest
+{
+protected:
+	uintptr_t allocateBatches(uintptr_t flags, uintptr_t *calls, uintptr_t *oldCount);
+};
+
+static const uintptr_t BULK_ALLOCATION_TEST_OBJECTS = 4096;
+static const uintptr_t BULK_ALLOCATION_TEST_BATCH = 64;
+static const uintptr_t BULK_ALLOCATION_TEST_SIZE = 48;
+
+/**
+ * Allocate BULK_ALLOCATION_TEST_OBJECTS objects in batches.
+ * @param calls[out] number of calls that allocated at least one object
+ * @param oldCount[out] number of objects allocated in old space
+ * @return number of objects allocated
+ */
+uintptr_t
+BulkAllocationTest::allocateBatches(uintptr_t flags, uintptr_t *calls, uintptr_t *oldCount)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	omrobjectptr_t objects[BULK_ALLOCATION_TEST_BATCH];
+
+	*calls = 0;
+	*oldCount = 0;
+	uintptr_t allocated = 0;
+	while (allocated < BULK_ALLOCATION_TEST_OBJECTS) {
+		MM_ObjectAllocationModel allocationModel(env, BULK_ALLOCATION_TEST_SIZE, flags);
+		uintptr_t count = OMR_GC_AllocateObjects(exampleVM->_omrVMThread, &allocationModel, objects,
+				OMR_MIN(BULK_ALLOCATION_TEST_BATCH, BULK_ALLOCATION_TEST_OBJECTS - allocated));
+		if (0 == count) {
+			break;
+		}
+		for (uintptr_t i = 0; i < count; i++) {
+			if (extensions->isOld(objects[i])) {
+				*oldCount += 1;
+			}
+		}
+		*calls += 1;
+		allocated += count;
+	}
+
+	return allocated;
+}
+
+TEST_P(BulkAllocationTest, nurseryAndTenured)
+{
+	uintptr_t calls = 0;
+	uintptr_t oldCount = 0;
+
+	/* nursery batches come in runs, so they take fewer calls than objects */
+	uintptr_t allocated = allocateBatches(0, &calls, &oldCount);
+	ASSERT_EQ(BULK_ALLOCATION_TEST_OBJECTS, allocated) << "Nursery batches failed.";
+	EXPECT_GT(allocated, calls) << "Nursery batches were not allocated in runs.";
+	EXPECT_EQ((uintptr_t)0, oldCount) << "Nursery batches were allocated in old space.";
+
+	/* tenured batches stop after their first object, which is allowed to collect */
+	uintptr_t tenured = MM_ObjectAllocationModel::selectObjectAllocationFlags(false, true, false, false);
+	allocated = allocateBatches(tenured, &calls, &oldCount);
+	ASSERT_EQ(BULK_ALLOCATION_TEST_OBJECTS, allocated) << "Tenured batches failed.";
+	EXPECT_EQ(allocated, calls) << "Tenured batches did not allocate one object per call.";
+	EXPECT_EQ(allocated, oldCount) << "Tenured batches were not allocated in old space.";
+
+	/* a tenured batch that may not collect allocates nothing */
+	uintptr_t tenuredNoGc = MM_ObjectAllocationModel::selectObjectAllocationFlags(false, true, false, true);
+	omrobjectptr_t objects[BULK_ALLOCATION_TEST_BATCH];
+	MM_ObjectAllocationModel noGc(env, BULK_ALLOCATION_TEST_SIZE, tenuredNoGc);
+	EXPECT_EQ((uintptr_t)0, OMR_GC_AllocateObjects(exampleVM->_omrVMThread, &noGc, objects, BULK_ALLOCATION_TEST_BATCH));
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, BulkAllocationTest,
+        ::testing::Values("fvtest/gctest/configuration/scavenger_GC_config.xml"));
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCConfigTest.hpp"
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+#include "ConcurrentCardTable.hpp"
+#include "EnvironmentBase.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "omrgc.h"
+
+/**
+ * Checks that card cleaning driven by the card table summary finds exactly the cards, and therefore cleans
+ * exactly the objects, that a flat scan of the card table does.
+ */
+class CardTableSummaryTest : public GCConfigTest
+{
+protected:
+	omrobjectptr_t allocateUnrooted(uintptr_t size);
+};
+
+static const uintptr_t CARD_SUMMARY_TEST_OBJECTS = 16384;
+
+omrobjectptr_t
+CardTableSummaryTest::allocateUnrooted(uintptr_t size)
+{
+	/* the objects are only used as card table addresses, so no GC is allowed to move or free them */
+	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+	MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+			MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+	return OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
+}
+
+TEST_P(CardTableSummaryTest, cleanSameObjects)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_ConcurrentCardTable *cardTable = (MM_ConcurrentCardTable *)extensions->cardTable;
+	ASSERT_TRUE(NULL != cardTable) << "Configuration did not create a card table.";
+	ASSERT_TRUE(cardTable->hasCardSummary()) << "Configuration did not enable the card table summary.";
+
+	omrobjectptr_t *objects = (omrobjectptr_t *)omrmem_allocate_memory(sizeof(omrobjectptr_t) * CARD_SUMMARY_TEST_OBJECTS, OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != objects) << "Failed to allocate native memory.";
+
+	/* keep a concurrent cycle from starting, and clearing cards, while the table is being inspected */
+	bool savedKickoffEnabled = extensions->concurrentKickoffEnabled;
+	extensions->concurrentKickoffEnabled = false;
+
+	uintptr_t objectCount = 0;
+	uintptr_t lowAddress = UINTPTR_MAX;
+	uintptr_t highAddress = 0;
+	for (; objectCount < CARD_SUMMARY_TEST_OBJECTS; objectCount++) {
+		/* vary the size so that objects straddle cards at different offsets */
+		uintptr_t size = 32 + ((objectCount * 24) % 480);
+		omrobjectptr_t object = allocateUnrooted(size);
+		if (NULL == object) {
+			break;
+		}
+		objects[objectCount] = object;
+		lowAddress = OMR_MIN(lowAddress, (uintptr_t)object);
+		highAddress = OMR_MAX(highAddress, (uintptr_t)object + extensions->objectModel.getConsumedSizeInBytesWithHeader(object));
+	}
+	ASSERT_LT((uintptr_t)CARD_SUMMARY_TEST_OBJECTS / 2, objectCount) << "Too few objects could be allocated.";
+
+	/* start from the state concurrent initialization leaves behind: no dirty cards and an empty summary */
+	cardTable->initializeCardCleaning(env);
+	cardTable->clearCardsInRange(env, (void *)lowAddress, (void *)highAddress);
+
+	/* Dirty through the write barrier paths: a sparse random subset of the objects in the first quarter,
+	 * nothing in the second quarter so that whole summary blocks stay clean, and every object's card in
+	 * the third quarter. The last quarter is dirtied as a range.
+	 */
+	uintptr_t seed = 0x9e3779b9;
+	uintptr_t quarter = objectCount / 4;
+	for (uintptr_t i = 0; i < quarter; i++) {
+		seed = (seed * 1103515245) + 12345;
+		if (0 == ((seed >> 16) % 61)) {
+			cardTable->dirtyCard(env, objects[i]);
+		}
+	}
+	for (uintptr_t i = 2 * quarter; i < 3 * quarter; i += 3) {
+		cardTable->dirtyCard(env, objects[i]);
+	}
+	cardTable->dirtyCardRange(env, (void *)objects[(3 * quarter) + (quarter / 2)], (void *)objects[objectCount - 1]);
+
+	/* flat mode: every card byte is inspected */
+	Card *firstCard = cardTable->heapAddrToCardAddr(env, (void *)lowAddress);
+	Card *topCard = cardTable->heapAddrToCardAddr(env, (void *)(highAddress - 1)) + 1;
+	uintptr_t cardCount = topCard - firstCard;
+	uint8_t *flat = (uint8_t *)omrmem_allocate_memory(cardCount, OMRMEM_CATEGORY_MM);
+	uint8_t *summary = (uint8_t *)omrmem_allocate_memory(cardCount, OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE((NULL != flat) && (NULL != summary)) << "Failed to allocate native memory.";
+	memset(summary, 0, cardCount);
+	uintptr_t flatDirtyCards = 0;
+	for (uintptr_t i = 0; i < cardCount; i++) {
+		flat[i] = ((Card)CARD_CLEAN != firstCard[i]) ? 1 : 0;
+		flatDirtyCards += flat[i];
+	}
+
+	/* the summary blocks overlapping the range which hold no dirty card */
+	uintptr_t cleanBlocks = 0;
+	Card *cardTableStart = cardTable->getCardTableStart();
+	uintptr_t firstBlock = (uintptr_t)(firstCard - cardTableStart) / CARDS_PER_CARD_SUMMARY_BIT;
+	uintptr_t topBlock = ((uintptr_t)(topCard - cardTableStart) + CARDS_PER_CARD_SUMMARY_BIT - 1) / CARDS_PER_CARD_SUMMARY_BIT;
+	for (uintptr_t block = firstBlock; block < topBlock; block++) {
+		uintptr_t blockStart = OMR_MAX((block * CARDS_PER_CARD_SUMMARY_BIT), (uintptr_t)(firstCard - cardTableStart)) - (uintptr_t)(firstCard - cardTableStart);
+		uintptr_t blockTop = OMR_MIN(((block + 1) * CARDS_PER_CARD_SUMMARY_BIT), (uintptr_t)(topCard - cardTableStart)) - (uintptr_t)(firstCard - cardTableStart);
+		bool clean = true;
+		for (uintptr_t i = blockStart; clean && (i < blockTop); i++) {
+			clean = (0 == flat[i]);
+		}
+		cleanBlocks += clean ? 1 : 0;
+	}
+
+	/* summary mode: the cleaner's view, skipping undirtied blocks and clean words in bulk */
+	env->_cardCleaningStats.clear();
+	uintptr_t summaryDirtyCards = 0;
+	Card *card = cardTable->findFirstUncleanCard(env, firstCard, topCard);
+	while (card < topCard) {
+		ASSERT_NE((Card)CARD_CLEAN, *card) << "Clean card " << (void *)card << " was reported as unclean.";
+		summary[card - firstCard] = 1;
+		summaryDirtyCards += 1;
+		card = cardTable->findFirstUncleanCard(env, card + 1, topCard);
+	}
+
+	EXPECT_LT((uintptr_t)0, flatDirtyCards);
+	EXPECT_EQ(flatDirtyCards, summaryDirtyCards);
+	/* every undirtied block is skipped once, without reading its cards */
+	EXPECT_LT((uintptr_t)0, cleanBlocks) << "The objects do not span a whole undirtied summary block.";
+	EXPECT_EQ(cleanBlocks, env->_cardCleaningStats._cardSummaryBlocksSkipped);
+
+	uintptr_t cleanedObjects = 0;
+	for (uintptr_t i = 0; i < objectCount; i++) {
+		uintptr_t index = cardTable->heapAddrToCardAddr(env, objects[i]) - firstCard;
+		EXPECT_EQ(flat[index], summary[index]) << "Object " << (void *)objects[i] << " is cleaned in one mode only.";
+		cleanedObjects += summary[index];
+	}
+	gcTestEnv->log("Card table summary: %zu objects, %zu cards, %zu unclean cards, %zu objects to clean, %zu of %zu summary blocks skipped\n",
+			objectCount, cardCount, summaryDirtyCards, cleanedObjects, env->_cardCleaningStats._cardSummaryBlocksSkipped, topBlock - firstBlock);
+
+	/* leave no dirty cards behind for the collection done at tear down */
+	cardTable->clearCardsInRange(env, (void *)lowAddress, (void *)highAddress);
+	extensions->concurrentKickoffEnabled = savedKickoffEnabled;
+
+	omrmem_free_memory(summary);
+	omrmem_free_memory(flat);
+	omrmem_free_memory(objects);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, CardTableSummaryTest,
+        ::testing::Values("fvtest/gctest/configuration/optavgpause_GC_cardsummary_config.xml"));
+
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCConfigTest.hpp"
+
+#include "omrgc.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "HeapWalker.hpp"
+#include "MarkingScheme.hpp"
+#include "MarkMap.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "ParallelGlobalGC.hpp"
+
+/**
+ * Checks that heap walks done while mutators clear the mark map (-Xgc:concurrentClearMarkMap) do not use the
+ * mark map, so that serial and parallel walks visit the same objects right after a collection and while the
+ * clearing is in progress, and that the clearing leaves no walked object marked.
+ */
+class ClearMarkMapTest : public GCConfigTest
+{
+protected:
+	struct WalkState {
+		volatile uintptr_t count;
+		volatile uintptr_t addressSum;
+		MM_MarkMap *markMap;
+		volatile uintptr_t markedCount;
+	};
+
+	static void countObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData);
+	void walkHeap(MM_HeapWalker *heapWalker, MM_MarkMap *markMap, WalkState *serial, WalkState *parallel);
+};
+
+static const uintptr_t CLEAR_MARK_MAP_TEST_NEW_OBJECTS = 4096;
+
+void
+ClearMarkMapTest::countObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	/* called from all GC threads */
+	WalkState *state = (WalkState *)userData;
+	MM_AtomicOperations::add(&state->count, 1);
+	MM_AtomicOperations::add(&state->addressSum, (uintptr_t)object);
+	if (state->markMap->isBitSet(object)) {
+		MM_AtomicOperations::add(&state->markedCount, 1);
+	}
+}
+
+void
+ClearMarkMapTest::walkHeap(MM_HeapWalker *heapWalker, MM_MarkMap *markMap, WalkState *serial, WalkState *parallel)
+{
+	WalkState initial = { 0, 0, markMap, 0 };
+	*serial = initial;
+	*parallel = initial;
+
+	env->acquireExclusiveVMAccess();
+	heapWalker->allObjectsDo(env, countObject, serial, 0, false, false);
+	heapWalker->allObjectsDo(env, countObject, parallel, 0, true, false);
+	env->releaseExclusiveVMAccess();
+}
+
+TEST_P(ClearMarkMapTest, walkWhileClearing)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_TRUE(extensions->concurrentClearMarkMap) << "Configuration did not enable concurrent mark map clearing.";
+
+	/* build the object graph of the configuration, with its garbage */
+	pugi::xml_node configNode = doc.select_node("/gc-config").node();
+	ASSERT_EQ(0, iniXMLStr(configNode.attribute("style").value())) << "Invalid XML input.";
+	pugi::xml_node allocationNode = configNode.child("allocation");
+	ASSERT_EQ(0, parseGarbagePolicy(allocationNode.child(xs.garbagePolicy))) << "Failed to parse garbage policy.";
+	pugi::xpath_node_set objectNodes = allocationNode.select_nodes(xs.object);
+	for (pugi::xpath_node_set::const_iterator it = objectNodes.begin(); it != objectNodes.end(); ++it) {
+		ASSERT_EQ(0, allocationWalker(it->node())) << "Failed to perform allocation.";
+	}
+
+	MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)extensions->getGlobalCollector();
+	MM_HeapWalker *heapWalker = globalCollector->getHeapWalker();
+	MM_MarkMap *markMap = globalCollector->getMarkingScheme()->getMarkMap();
+	WalkState serial;
+	WalkState parallel;
+
+	/* right after the collection the mark map still holds its marks, but is handed over to the mutators */
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_IMPLICIT_GC_DEFAULT));
+	ASSERT_FALSE(markMap->isMarkMapValid()) << "The mark map is still valid for heap walks.";
+	ASSERT_TRUE(markMap->isClearChunksPending()) << "The mutators were not given the mark map to clear.";
+	walkHeap(heapWalker, markMap, &serial, &parallel);
+	EXPECT_LT((uintptr_t)0, serial.count);
+	EXPECT_EQ(serial.count, parallel.count) << "The parallel walk after the collection did not visit the same number of objects.";
+	EXPECT_EQ(serial.addressSum, parallel.addressSum) << "The parallel walk after the collection did not visit the same objects.";
+
+	/* mutators clear parts of the mark map as they allocate */
+	for (uintptr_t i = 0; i < CLEAR_MARK_MAP_TEST_NEW_OBJECTS; i++) {
+		uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+		MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+				MM_ObjectAllocationModel(env, 32 + ((i * 40) % 800), MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+		if (NULL == OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc)) {
+			break;
+		}
+	}
+	uintptr_t walkedAfterCollect = serial.count;
+	walkHeap(heapWalker, markMap, &serial, &parallel);
+	EXPECT_LE(walkedAfterCollect, serial.count);
+	EXPECT_EQ(serial.count, parallel.count) << "The parallel walk while clearing did not visit the same number of objects.";
+	EXPECT_EQ(serial.addressSum, parallel.addressSum) << "The parallel walk while clearing did not visit the same objects.";
+
+	/* once every chunk is claimed, no object is left marked */
+	markMap->clearChunks(env, UDATA_MAX);
+	walkHeap(heapWalker, markMap, &serial, &parallel);
+	EXPECT_EQ((uintptr_t)0, serial.markedCount) << "Objects are still marked after the mark map was cleared.";
+
+	/* the next collection marks from a clean map */
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_IMPLICIT_GC_DEFAULT));
+	walkHeap(heapWalker, markMap, &serial, &parallel);
+	EXPECT_LT((uintptr_t)0, serial.markedCount) << "The second collection did not mark the surviving objects.";
+	EXPECT_EQ(serial.count, parallel.count) << "The parallel walk after the second collection did not visit the same number of objects.";
+	EXPECT_EQ(serial.addressSum, parallel.addressSum) << "The parallel walk after the second collection did not visit the same objects.";
+	gcTestEnv->log("Clear mark map: %zu objects walked\n", serial.count);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, ClearMarkMapTest,
+        ::testing::Values("fvtest/gctest/configuration/global_GC_clearmarkmap_config.xml"));
@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "GCConfigTest.hpp"
+
+#include "ConcurrentScavengerPacing.hpp"
+
+/**
+ * Checks the model behind the Concurrent Scavenger pacing controller (-Xgc:concurrentScavengerPacing): the rates
+ * derived from the measurements of a cycle, the weighting of blocked cycles, the background thread count selected,
+ * and the predicted concurrent phase and survivor reserve. The model is pure arithmetic, so it is checked on its own
+ * rather than through Concurrent Scavenger cycles.
+ */
+class ConcurrentScavengerPacingTest : public GCConfigTest
+{
+};
+
+static const uintptr_t PACING_TEST_MB = 1024 * 1024;
+static const double PACING_TEST_TOLERANCE = 1024.0;
+
+TEST_P(ConcurrentScavengerPacingTest, rates)
+{
+	MM_ConcurrentScavengerPacing pacing;
+
+	/* 8MB scanned by 2 threads in 4ms is 1MB/ms per thread, 6MB allocated in 3ms is 2MB/ms */
+	pacing.cycleCompleted(8 * PACING_TEST_MB, 4000, 2, 6 * PACING_TEST_MB, 3000, 32 * PACING_TEST_MB, 10 * PACING_TEST_MB, false);
+	EXPECT_EQ(PACING_TEST_MB, pacing.getCopyRate());
+	/* the allocation rate and copied bytes start from 0 and are weighted from the first cycle, like the survivor tilt */
+	EXPECT_NEAR(0.3 * 2 * PACING_TEST_MB, (double)pacing.getAllocationRate(), PACING_TEST_TOLERANCE);
+	EXPECT_NEAR(0.3 * 10 * PACING_TEST_MB, (double)pacing.getCopyBytes(), PACING_TEST_TOLERANCE);
+	EXPECT_EQ(32 * PACING_TEST_MB, pacing.getFree());
+
+	/* a cycle without concurrent scan time leaves the copy rate alone */
+	pacing.cycleCompleted(0, 0, 2, 6 * PACING_TEST_MB, 3000, 32 * PACING_TEST_MB, 10 * PACING_TEST_MB, false);
+	EXPECT_EQ(PACING_TEST_MB, pacing.getCopyRate());
+
+	/* no thread count or window length does not divide by zero */
+	pacing.cycleCompleted(8 * PACING_TEST_MB, 4000, 0, 0, 0, 32 * PACING_TEST_MB, 10 * PACING_TEST_MB, false);
+	EXPECT_NEAR((0.7 * 1 + 0.3 * 2) * PACING_TEST_MB, (double)pacing.getCopyRate(), PACING_TEST_TOLERANCE);
+}
+
+TEST_P(ConcurrentScavengerPacingTest, blockedCyclesWeighMore)
+{
+	MM_ConcurrentScavengerPacing finished;
+	MM_ConcurrentScavengerPacing blocked;
+
+	/* same history, then the copy rate halves */
+	finished.cycleCompleted(4 * PACING_TEST_MB, 1000, 1, PACING_TEST_MB, 1000, 16 * PACING_TEST_MB, 4 * PACING_TEST_MB, false);
+	blocked.cycleCompleted(4 * PACING_TEST_MB, 1000, 1, PACING_TEST_MB, 1000, 16 * PACING_TEST_MB, 4 * PACING_TEST_MB, false);
+	finished.cycleCompleted(2 * PACING_TEST_MB, 1000, 1, PACING_TEST_MB, 1000, 16 * PACING_TEST_MB, 4 * PACING_TEST_MB, false);
+	blocked.cycleCompleted(2 * PACING_TEST_MB, 1000, 1, PACING_TEST_MB, 1000, 16 * PACING_TEST_MB, 4 * PACING_TEST_MB, true);
+
+	/* the history keeps 70% of its weight after a cycle that finished concurrently, 30% after a blocked one */
+	EXPECT_NEAR((0.7 * 4 + 0.3 * 2) * PACING_TEST_MB, (double)finished.getCopyRate(), PACING_TEST_TOLERANCE);
+	EXPECT_NEAR((0.3 * 4 + 0.7 * 2) * PACING_TEST_MB, (double)blocked.getCopyRate(), PACING_TEST_TOLERANCE);
+}
+
+TEST_P(ConcurrentScavengerPacingTest, backgroundThreads)
+{
+	/* copying 8MB at 1MB/ms per thread while mutators allocate 1MB/ms, with 16MB free: 8MB of headroom */
+	MM_ConcurrentScavengerPacing pacing;
+	for (uintptr_t i = 0; i < 50; i++) {
+		pacing.cycleCompleted(PACING_TEST_MB, 1000, 1, PACING_TEST_MB, 1000, 16 * PACING_TEST_MB, 8 * PACING_TEST_MB, false);
+	}
+	/* N threads take 8/N ms, during which mutators allocate 1.1 * 8/N MB, which fits 8MB from N = 1.1 */
+	EXPECT_EQ((uintptr_t)2, pacing.selectBackgroundThreads(8));
+	EXPECT_EQ((uintptr_t)1, pacing.selectBackgroundThreads(1));
+	EXPECT_EQ((uintptr_t)1, pacing.selectBackgroundThreads(0));
+
+	/* 4 times the allocation rate needs 4.4 threads */
+	for (uintptr_t i = 0; i < 50; i++) {
+		pacing.cycleCompleted(PACING_TEST_MB, 1000, 1, 4 * PACING_TEST_MB, 1000, 16 * PACING_TEST_MB, 8 * PACING_TEST_MB, false);
+	}
+	EXPECT_EQ((uintptr_t)5, pacing.selectBackgroundThreads(8));
+	EXPECT_EQ((uintptr_t)4, pacing.selectBackgroundThreads(4));
+
+	/* no headroom left after copying: all threads */
+	MM_ConcurrentScavengerPacing full;
+	full.cycleCompleted(PACING_TEST_MB, 1000, 1, PACING_TEST_MB, 1000, PACING_TEST_MB, 4 * PACING_TEST_MB, false);
+	EXPECT_EQ((uintptr_t)8, full.selectBackgroundThreads(8));
+
+	/* no copy rate known yet: all threads */
+	MM_ConcurrentScavengerPacing unknown;
+	unknown.cycleCompleted(0, 0, 1, PACING_TEST_MB, 1000, 16 * PACING_TEST_MB, 4 * PACING_TEST_MB, false);
+	EXPECT_EQ((uintptr_t)8, unknown.selectBackgroundThreads(8));
+}
+
+TEST_P(ConcurrentScavengerPacingTest, predictionAndSurvivorReserve)
+{
+	/* copying 9MB at 1MB/ms per thread while mutators allocate 4MB/ms, with 18MB free */
+	MM_ConcurrentScavengerPacing pacing;
+	for (uintptr_t i = 0; i < 50; i++) {
+		pacing.cycleCompleted(PACING_TEST_MB, 1000, 1, 4 * PACING_TEST_MB, 1000, 18 * PACING_TEST_MB, 9 * PACING_TEST_MB, false);
+	}
+
+	/* with 4 threads, 2.25ms to copy and 9MB allocated meanwhile: 9 + 1.1 * 9 - 18 = 0.9MB short */
+	pacing.predict(4);
+	EXPECT_EQ((uintptr_t)2, pacing.getPredictedConcurrentTime());
+	EXPECT_NEAR(9.0 * PACING_TEST_MB, (double)pacing.getPredictedAllocationBytes(), PACING_TEST_TOLERANCE);
+	EXPECT_NEAR(0.9 * PACING_TEST_MB, (double)pacing.getSurvivorReserve(), PACING_TEST_TOLERANCE);
+
+	/* with 8 threads, 1.125ms and 4.5MB allocated fit in the 9MB left after copying, so nothing is reserved */
+	pacing.predict(8);
+	EXPECT_EQ((uintptr_t)1, pacing.getPredictedConcurrentTime());
+	EXPECT_NEAR(4.5 * PACING_TEST_MB, (double)pacing.getPredictedAllocationBytes(), PACING_TEST_TOLERANCE);
+	EXPECT_EQ((uintptr_t)0, pacing.getSurvivorReserve());
+
+	/* without a copy rate there is no prediction, only the copied bytes that do not fit are reserved */
+	MM_ConcurrentScavengerPacing unknown;
+	unknown.cycleCompleted(0, 0, 1, PACING_TEST_MB, 1000, PACING_TEST_MB, 10 * PACING_TEST_MB, false);
+	unknown.predict(4);
+	EXPECT_EQ((uintptr_t)0, unknown.getPredictedConcurrentTime());
+	EXPECT_EQ((uintptr_t)0, unknown.getPredictedAllocationBytes());
+	EXPECT_NEAR((0.3 * 10 - 1) * PACING_TEST_MB, (double)unknown.getSurvivorReserve(), PACING_TEST_TOLERANCE);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, ConcurrentScavengerPacingTest,
+        ::testing::Values("fvtest/gctest/configuration/global_GC_config.xml"));
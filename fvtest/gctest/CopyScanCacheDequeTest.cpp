@@ -0,0 +1,226 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCConfigTest.hpp"
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "AtomicOperations.hpp"
+#include "CopyScanCacheDeque.hpp"
+#include "EnvironmentBase.hpp"
+
+/**
+ * Checks the work-stealing scan cache deque of the Scavenger (-Xgc:scavengerWorkStealing): the owner pops in
+ * LIFO order, thieves steal in FIFO order, and when thieves race with the owner every pushed cache is taken
+ * exactly once. The deque never dereferences its entries, so the test pushes tagged indices instead of caches.
+ */
+class CopyScanCacheDequeTest : public GCConfigTest
+{
+protected:
+	struct RaceState {
+		MM_CopyScanCacheDeque *deque;
+		volatile uintptr_t *takenCounts;
+		uintptr_t entryCount;
+		omrthread_monitor_t monitor;
+		volatile uintptr_t startedThieves;
+		volatile uintptr_t finishedThieves;
+		volatile uintptr_t stolenCount;
+		volatile bool ownerDone;
+	};
+
+	static MMINLINE MM_CopyScanCacheStandard *entryForIndex(uintptr_t index) { return (MM_CopyScanCacheStandard *)((index + 1) << 3); }
+	static MMINLINE uintptr_t indexForEntry(MM_CopyScanCacheStandard *entry) { return ((uintptr_t)entry >> 3) - 1; }
+	static void take(RaceState *state, MM_CopyScanCacheStandard *entry);
+	static int J9THREAD_PROC thiefThread(void *entryArg);
+};
+
+static const uintptr_t COPY_SCAN_CACHE_DEQUE_TEST_CAPACITY = 16;
+static const uintptr_t COPY_SCAN_CACHE_DEQUE_TEST_ENTRIES = 1000000;
+static const uintptr_t COPY_SCAN_CACHE_DEQUE_TEST_THIEVES = 3;
+
+void
+CopyScanCacheDequeTest::take(RaceState *state, MM_CopyScanCacheStandard *entry)
+{
+	uintptr_t index = indexForEntry(entry);
+	if (index < state->entryCount) {
+		MM_AtomicOperations::add(&state->takenCounts[index], 1);
+	}
+}
+
+int J9THREAD_PROC
+CopyScanCacheDequeTest::thiefThread(void *entryArg)
+{
+	RaceState *state = (RaceState *)entryArg;
+
+	omrthread_monitor_enter(state->monitor);
+	state->startedThieves += 1;
+	omrthread_monitor_notify_all(state->monitor);
+	omrthread_monitor_exit(state->monitor);
+
+	uintptr_t stolen = 0;
+	while (!state->ownerDone || !state->deque->isEmpty()) {
+		MM_CopyScanCacheStandard *entry = state->deque->steal();
+		if (NULL != entry) {
+			take(state, entry);
+			stolen += 1;
+		} else {
+			omrthread_yield();
+		}
+	}
+	MM_AtomicOperations::add(&state->stolenCount, stolen);
+
+	omrthread_monitor_enter(state->monitor);
+	state->finishedThieves += 1;
+	omrthread_monitor_notify_all(state->monitor);
+	omrthread_monitor_exit(state->monitor);
+
+	return 0;
+}
+
+TEST_P(CopyScanCacheDequeTest, singleThreaded)
+{
+	MM_CopyScanCacheDeque deque;
+	/* the capacity is rounded up to a power of 2 */
+	ASSERT_TRUE(deque.initialize(env, COPY_SCAN_CACHE_DEQUE_TEST_CAPACITY - 3));
+
+	EXPECT_TRUE(deque.isEmpty());
+	EXPECT_TRUE(NULL == deque.pop());
+	EXPECT_TRUE(NULL == deque.steal());
+
+	/* fill the deque, wrapping around the buffer on the second round */
+	for (uintptr_t round = 0; round < 2; round++) {
+		for (uintptr_t i = 0; i < COPY_SCAN_CACHE_DEQUE_TEST_CAPACITY; i++) {
+			ASSERT_TRUE(deque.push(entryForIndex(i))) << "Push " << i << " failed before the deque was full.";
+		}
+		EXPECT_FALSE(deque.push(entryForIndex(COPY_SCAN_CACHE_DEQUE_TEST_CAPACITY))) << "Push succeeded on a full deque.";
+		EXPECT_FALSE(deque.isEmpty());
+
+		/* thieves take the oldest entries, the owner the newest */
+		EXPECT_EQ(entryForIndex(0), deque.steal());
+		EXPECT_EQ(entryForIndex(1), deque.steal());
+		EXPECT_EQ(entryForIndex(COPY_SCAN_CACHE_DEQUE_TEST_CAPACITY - 1), deque.pop());
+		EXPECT_EQ(entryForIndex(COPY_SCAN_CACHE_DEQUE_TEST_CAPACITY - 2), deque.pop());
+		for (uintptr_t i = 2; i < (COPY_SCAN_CACHE_DEQUE_TEST_CAPACITY - 2); i++) {
+			EXPECT_EQ(entryForIndex(i), deque.steal());
+		}
+		EXPECT_TRUE(deque.isEmpty());
+		EXPECT_TRUE(NULL == deque.pop());
+		EXPECT_TRUE(NULL == deque.steal());
+	}
+
+	/* the last entry can be taken by the owner */
+	ASSERT_TRUE(deque.push(entryForIndex(7)));
+	EXPECT_EQ(entryForIndex(7), deque.pop());
+	EXPECT_TRUE(NULL == deque.pop());
+	EXPECT_TRUE(deque.isEmpty());
+
+	deque.tearDown(env);
+}
+
+TEST_P(CopyScanCacheDequeTest, pushPopStealRace)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_CopyScanCacheDeque deque;
+	ASSERT_TRUE(deque.initialize(env, COPY_SCAN_CACHE_DEQUE_TEST_CAPACITY));
+
+	RaceState state;
+	state.deque = &deque;
+	state.entryCount = COPY_SCAN_CACHE_DEQUE_TEST_ENTRIES;
+	state.takenCounts = (volatile uintptr_t *)omrmem_allocate_memory(sizeof(uintptr_t) * state.entryCount, OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != state.takenCounts) << "Failed to allocate native memory.";
+	memset((void *)state.takenCounts, 0, sizeof(uintptr_t) * state.entryCount);
+	state.monitor = NULL;
+	state.startedThieves = 0;
+	state.finishedThieves = 0;
+	state.stolenCount = 0;
+	state.ownerDone = false;
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&state.monitor, 0, "CopyScanCacheDequeTest"));
+
+	uintptr_t thieves = 0;
+	for (; thieves < COPY_SCAN_CACHE_DEQUE_TEST_THIEVES; thieves++) {
+		omrthread_t handle = NULL;
+		if (0 != omrthread_create(&handle, 0, J9THREAD_PRIORITY_NORMAL, 0, thiefThread, &state)) {
+			break;
+		}
+	}
+	ASSERT_LT((uintptr_t)0, thieves) << "No thief thread could be started.";
+	omrthread_monitor_enter(state.monitor);
+	while (state.startedThieves < thieves) {
+		omrthread_monitor_wait(state.monitor);
+	}
+	omrthread_monitor_exit(state.monitor);
+
+	/* The owner keeps the deque short, so that its pops often race the thieves for the last entry,
+	 * and pops to make room whenever the deque is full.
+	 */
+	uintptr_t popped = 0;
+	for (uintptr_t i = 0; i < state.entryCount; i++) {
+		while (!deque.push(entryForIndex(i))) {
+			MM_CopyScanCacheStandard *entry = deque.pop();
+			if (NULL != entry) {
+				take(&state, entry);
+				popped += 1;
+			}
+		}
+		if (0 != (i % 3)) {
+			MM_CopyScanCacheStandard *entry = deque.pop();
+			if (NULL != entry) {
+				take(&state, entry);
+				popped += 1;
+			}
+		}
+		if (0 == (i % 64)) {
+			/* let the thieves in while entries are left, even on a single CPU */
+			omrthread_yield();
+		}
+	}
+	MM_CopyScanCacheStandard *entry = NULL;
+	while (NULL != (entry = deque.pop())) {
+		take(&state, entry);
+		popped += 1;
+	}
+	state.ownerDone = true;
+
+	omrthread_monitor_enter(state.monitor);
+	while (state.finishedThieves < thieves) {
+		omrthread_monitor_wait(state.monitor);
+	}
+	omrthread_monitor_exit(state.monitor);
+	omrthread_monitor_destroy(state.monitor);
+
+	EXPECT_TRUE(deque.isEmpty());
+	EXPECT_EQ(state.entryCount, popped + state.stolenCount) << "Entries were lost or taken twice.";
+	for (uintptr_t i = 0; i < state.entryCount; i++) {
+		ASSERT_EQ((uintptr_t)1, state.takenCounts[i]) << "Entry " << i << " was not taken exactly once.";
+	}
+	gcTestEnv->log("Copy scan cache deque: %zu popped, %zu stolen by %zu threads\n", popped, state.stolenCount, thieves);
+
+	omrmem_free_memory((void *)state.takenCounts);
+	deque.tearDown(env);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, CopyScanCacheDequeTest,
+        ::testing::Values("fvtest/gctest/configuration/scavenger_GC_workstealing_config.xml"));
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
@@ -43,12 +43,31 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_lockfree_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_prefetch_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_clearmarkmap_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_sizeclassfreelist_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_predictivesizing_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_metadatapages_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_objectstartindex_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_allocationsampling_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_adaptivethreads_config.xml"
+#if defined(OMR_GC_SEGREGATED_HEAP)
+                        , "fvtest/gctest/configuration/segregated_GC_refillbatch_config.xml"
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_cardsummary_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_workstealing_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_adaptivetlh_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_hotfield_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_rememberedset_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_forwardingtable_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_numanursery_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "GCConfigTest.hpp"
+
+#include "HeapMapScanner.hpp"
+
+/**
+ * Checks each vectorized heap map scanner supported by the running processor against the scalar one, on runs of
+ * random words with the first mismatch anywhere (or nowhere) and with every alignment of both ends of the run.
+ */
+class HeapMapScannerTest : public GCConfigTest
+{
+protected:
+	uint64_t _seed;
+
+	uintptr_t
+	nextRandom()
+	{
+		/* xorshift64, so that failures reproduce */
+		_seed ^= _seed << 13;
+		_seed ^= _seed >> 7;
+		_seed ^= _seed << 17;
+		return (uintptr_t)_seed;
+	}
+
+	/**
+	 * Fill [start, top) with pattern, optionally differing from it at mismatch, and poison the words around the run
+	 * so that a scanner reading outside of it would stop early.
+	 */
+	void fillRun(uintptr_t *buffer, uintptr_t *bufferTop, uintptr_t *start, uintptr_t *top, uintptr_t pattern, uintptr_t *mismatch, uintptr_t mismatchWord);
+	void checkRun(uintptr_t *start, uintptr_t *top, uintptr_t pattern);
+};
+
+static const uintptr_t HEAPMAP_SCANNER_TEST_MAX_WORDS = 300;
+static const uintptr_t HEAPMAP_SCANNER_TEST_MAX_OFFSET = 16;
+static const uintptr_t HEAPMAP_SCANNER_TEST_BUFFER_WORDS = HEAPMAP_SCANNER_TEST_MAX_OFFSET + HEAPMAP_SCANNER_TEST_MAX_WORDS + 16;
+static const uintptr_t HEAPMAP_SCANNER_TEST_RANDOM_RUNS = 20000;
+
+void
+HeapMapScannerTest::fillRun(uintptr_t *buffer, uintptr_t *bufferTop, uintptr_t *start, uintptr_t *top, uintptr_t pattern, uintptr_t *mismatch, uintptr_t mismatchWord)
+{
+	for (uintptr_t *word = buffer; word < bufferTop; word++) {
+		*word = ((word < start) || (word >= top)) ? ~pattern : pattern;
+	}
+	if (NULL != mismatch) {
+		*mismatch = mismatchWord;
+	}
+}
+
+void
+HeapMapScannerTest::checkRun(uintptr_t *start, uintptr_t *top, uintptr_t pattern)
+{
+	MM_HeapMapScanner::FindWordFunction scalar = MM_HeapMapScanner::getImplementation(MM_HeapMapScanner::implementation_scalar);
+	uintptr_t *expected = scalar(start, top, pattern);
+
+	for (intptr_t implementation = MM_HeapMapScanner::implementation_sse2; implementation < MM_HeapMapScanner::implementation_count; implementation++) {
+		MM_HeapMapScanner::FindWordFunction function = MM_HeapMapScanner::getImplementation((MM_HeapMapScanner::Implementation)implementation);
+		if (NULL != function) {
+			ASSERT_EQ(expected, function(start, top, pattern))
+				<< "Implementation " << implementation << " disagrees with the scalar scan of " << (top - start)
+				<< " words from offset " << (((uintptr_t)start & 63) / sizeof(uintptr_t)) << " for pattern " << std::hex << pattern;
+		}
+	}
+
+	/* the inline entry point must agree too */
+	if (0 == pattern) {
+		ASSERT_EQ(expected, MM_HeapMapScanner::skipEmptyWords(start, top));
+	}
+}
+
+TEST_P(HeapMapScannerTest, compareWithScalar)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	ASSERT_TRUE(NULL != MM_HeapMapScanner::getImplementation(MM_HeapMapScanner::implementation_scalar));
+
+	uintptr_t implementations = 0;
+	for (intptr_t implementation = MM_HeapMapScanner::implementation_sse2; implementation < MM_HeapMapScanner::implementation_count; implementation++) {
+		if (NULL != MM_HeapMapScanner::getImplementation((MM_HeapMapScanner::Implementation)implementation)) {
+			implementations += 1;
+		}
+	}
+	gcTestEnv->log("Heap map scanner: %zu vectorized implementations supported\n", implementations);
+
+	/* 64 byte alignment, so that each offset exercises the same alignment for every vector width */
+	uintptr_t *allocation = (uintptr_t *)omrmem_allocate_memory((HEAPMAP_SCANNER_TEST_BUFFER_WORDS * sizeof(uintptr_t)) + 64, OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != allocation) << "Failed to allocate native memory.";
+	uintptr_t *buffer = (uintptr_t *)(((uintptr_t)allocation + 63) & ~(uintptr_t)63);
+	uintptr_t *bufferTop = buffer + HEAPMAP_SCANNER_TEST_BUFFER_WORDS;
+	uintptr_t patterns[] = { 0, UDATA_MAX };
+	_seed = 0x9E3779B97F4A7C15ULL;
+
+	for (uintptr_t p = 0; p < 2; p++) {
+		uintptr_t pattern = patterns[p];
+		/* edge and tail cases: every alignment and every short length, with the mismatch in each position or absent */
+		for (uintptr_t offset = 0; offset < HEAPMAP_SCANNER_TEST_MAX_OFFSET; offset++) {
+			uintptr_t *start = buffer + offset;
+			for (uintptr_t length = 0; length <= 40; length++) {
+				uintptr_t *top = start + length;
+				fillRun(buffer, bufferTop, start, top, pattern, NULL, 0);
+				checkRun(start, top, pattern);
+				for (uintptr_t position = 0; position < length; position++) {
+					/* a single differing bit, low or high, must be found */
+					uintptr_t bit = (0 == (position & 1)) ? 1 : ((uintptr_t)1 << ((sizeof(uintptr_t) * 8) - 1));
+					fillRun(buffer, bufferTop, start, top, pattern, start + position, pattern ^ bit);
+					checkRun(start, top, pattern);
+				}
+				if (HasFatalFailure()) {
+					goto done;
+				}
+			}
+		}
+
+		/* random runs with random words at random positions */
+		for (uintptr_t run = 0; run < HEAPMAP_SCANNER_TEST_RANDOM_RUNS; run++) {
+			uintptr_t *start = buffer + (nextRandom() % HEAPMAP_SCANNER_TEST_MAX_OFFSET);
+			uintptr_t length = nextRandom() % (HEAPMAP_SCANNER_TEST_MAX_WORDS + 1);
+			uintptr_t *top = start + length;
+			uintptr_t *mismatch = NULL;
+			uintptr_t kind = nextRandom() % 4;
+			if ((0 < length) && (0 != kind)) {
+				/* first, last or any word */
+				uintptr_t position = (1 == kind) ? 0 : ((2 == kind) ? (length - 1) : (nextRandom() % length));
+				mismatch = start + position;
+			}
+			uintptr_t mismatchWord = nextRandom();
+			if (pattern == mismatchWord) {
+				mismatchWord ^= 1;
+			}
+			fillRun(buffer, bufferTop, start, top, pattern, mismatch, mismatchWord);
+			/* random words beyond the first mismatch must not matter */
+			if (NULL != mismatch) {
+				for (uintptr_t *word = mismatch + 1; word < top; word++) {
+					if (0 == (nextRandom() % 8)) {
+						*word = nextRandom();
+					}
+				}
+			}
+			checkRun(start, top, pattern);
+			if (HasFatalFailure()) {
+				goto done;
+			}
+		}
+	}
+
+done:
+	omrmem_free_memory(allocation);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, HeapMapScannerTest,
+        ::testing::Values("fvtest/gctest/configuration/global_GC_config.xml"));
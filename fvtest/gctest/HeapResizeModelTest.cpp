@@ -0,0 +1,136 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCConfigTest.hpp"
+
+#include "HeapResizeModel.hpp"
+
+/**
+ * Checks the predictive heap resize model (-Xgc:predictiveHeapSizing): the smoothed GC time ratio, the free space
+ * predicted to bring it back to the middle of the threshold band, the -Xminf/-Xmaxf bounds and the hysteresis
+ * against oscillation. The model is pure arithmetic, so it is checked on its own rather than through heap resizes.
+ */
+class HeapResizeModelTest : public GCConfigTest
+{
+};
+
+static const uintptr_t RESIZE_MODEL_TEST_MB = 1024 * 1024;
+static const double RESIZE_MODEL_TEST_TOLERANCE = 1024.0;
+static const double RESIZE_MODEL_TEST_WEIGHT = 0.3;
+static const uintptr_t RESIZE_MODEL_TEST_CONTRACT_THRESHOLD = 5;
+static const uintptr_t RESIZE_MODEL_TEST_EXPAND_THRESHOLD = 13;
+static const uintptr_t RESIZE_MODEL_TEST_MIN_FREE = 30;
+static const uintptr_t RESIZE_MODEL_TEST_MAX_FREE = 60;
+
+static intptr_t
+predict(MM_HeapResizeModel *model, uintptr_t heapSize, uintptr_t freeBytes, uintptr_t stabilizationCount, uintptr_t deadBand)
+{
+	return model->predictResize(heapSize, freeBytes, RESIZE_MODEL_TEST_WEIGHT, RESIZE_MODEL_TEST_CONTRACT_THRESHOLD, RESIZE_MODEL_TEST_EXPAND_THRESHOLD,
+		RESIZE_MODEL_TEST_MIN_FREE, RESIZE_MODEL_TEST_MAX_FREE, stabilizationCount, deadBand);
+}
+
+TEST_P(HeapResizeModelTest, gcPercentage)
+{
+	MM_HeapResizeModel model;
+	EXPECT_EQ(0.0, model.getGCPercentage());
+
+	/* the first cycle is taken as is, later ones are weighted */
+	model.recordCycle(20, 80, RESIZE_MODEL_TEST_WEIGHT);
+	EXPECT_DOUBLE_EQ(20.0, model.getGCPercentage());
+	model.recordCycle(60, 40, RESIZE_MODEL_TEST_WEIGHT);
+	EXPECT_DOUBLE_EQ((0.7 * 20 + 0.3 * 60), model.getGCPercentage());
+	EXPECT_EQ((uintptr_t)2, model.getCycles());
+}
+
+TEST_P(HeapResizeModelTest, ratioResize)
+{
+	/* 50% of the time in GC with 20MB of 100MB free: the ratio is inversely proportional to free space, so 9% needs 50/9 times the free space */
+	MM_HeapResizeModel expand;
+	expand.recordCycle(50, 50, RESIZE_MODEL_TEST_WEIGHT);
+	intptr_t resize = predict(&expand, 100 * RESIZE_MODEL_TEST_MB, 20 * RESIZE_MODEL_TEST_MB, 1, 0);
+	EXPECT_NEAR((80.0 + (20.0 * 50.0 / 9.0) - 100.0) * RESIZE_MODEL_TEST_MB, (double)resize, RESIZE_MODEL_TEST_TOLERANCE);
+	EXPECT_EQ(HEAP_RESIZE_MODEL_GC_RATIO, expand.getLastReason());
+
+	/* 1% of the time in GC with 50MB of 100MB free: contract, but keep -Xminf free */
+	MM_HeapResizeModel contract;
+	contract.recordCycle(1, 99, RESIZE_MODEL_TEST_WEIGHT);
+	resize = predict(&contract, 100 * RESIZE_MODEL_TEST_MB, 50 * RESIZE_MODEL_TEST_MB, 1, 0);
+	EXPECT_NEAR(((50.0 / 0.7) - 100.0) * RESIZE_MODEL_TEST_MB, (double)resize, RESIZE_MODEL_TEST_TOLERANCE);
+	EXPECT_EQ(HEAP_RESIZE_MODEL_GC_RATIO, contract.getLastReason());
+
+	/* inside the threshold band, with free space between -Xminf and -Xmaxf, the heap is left alone */
+	MM_HeapResizeModel inBand;
+	inBand.recordCycle(9, 91, RESIZE_MODEL_TEST_WEIGHT);
+	EXPECT_EQ(0, predict(&inBand, 100 * RESIZE_MODEL_TEST_MB, 40 * RESIZE_MODEL_TEST_MB, 1, 0));
+	EXPECT_EQ(HEAP_RESIZE_MODEL_NONE, inBand.getLastReason());
+}
+
+TEST_P(HeapResizeModelTest, freeBounds)
+{
+	/* no cycle recorded yet: 90MB live in a 100MB heap needs 90/0.7MB to keep -Xminf free */
+	MM_HeapResizeModel tooLow;
+	intptr_t resize = predict(&tooLow, 100 * RESIZE_MODEL_TEST_MB, 10 * RESIZE_MODEL_TEST_MB, 1, 0);
+	EXPECT_NEAR(((90.0 / 0.7) - 100.0) * RESIZE_MODEL_TEST_MB, (double)resize, RESIZE_MODEL_TEST_TOLERANCE);
+	EXPECT_EQ(HEAP_RESIZE_MODEL_FREE_TOO_LOW, tooLow.getLastReason());
+
+	/* 20MB live in a 100MB heap keeps at most 20/0.4MB with -Xmaxf */
+	MM_HeapResizeModel tooHigh;
+	resize = predict(&tooHigh, 100 * RESIZE_MODEL_TEST_MB, 80 * RESIZE_MODEL_TEST_MB, 1, 0);
+	EXPECT_NEAR(((20.0 / 0.4) - 100.0) * RESIZE_MODEL_TEST_MB, (double)resize, RESIZE_MODEL_TEST_TOLERANCE);
+	EXPECT_EQ(HEAP_RESIZE_MODEL_FREE_TOO_HIGH, tooHigh.getLastReason());
+
+	/* after a drop in live bytes, contraction is sized from the smoothed live bytes: 0.7 * 40MB + 0.3 * 10MB live */
+	MM_HeapResizeModel burst;
+	EXPECT_EQ(0, predict(&burst, 100 * RESIZE_MODEL_TEST_MB, 60 * RESIZE_MODEL_TEST_MB, 1, 0));
+	resize = predict(&burst, 100 * RESIZE_MODEL_TEST_MB, 90 * RESIZE_MODEL_TEST_MB, 1, 0);
+	EXPECT_NEAR(31.0 * RESIZE_MODEL_TEST_MB, burst.getLiveBytes(), RESIZE_MODEL_TEST_TOLERANCE);
+	EXPECT_NEAR(((31.0 / 0.4) - 100.0) * RESIZE_MODEL_TEST_MB, (double)resize, RESIZE_MODEL_TEST_TOLERANCE);
+}
+
+TEST_P(HeapResizeModelTest, hysteresis)
+{
+	/* a resize must be predicted in the same direction for stabilizationCount cycles */
+	MM_HeapResizeModel model;
+	model.recordCycle(50, 50, RESIZE_MODEL_TEST_WEIGHT);
+	EXPECT_EQ(0, predict(&model, 100 * RESIZE_MODEL_TEST_MB, 40 * RESIZE_MODEL_TEST_MB, 2, 0));
+	EXPECT_EQ(HEAP_RESIZE_MODEL_NONE, model.getLastReason());
+	EXPECT_LT(0, predict(&model, 100 * RESIZE_MODEL_TEST_MB, 40 * RESIZE_MODEL_TEST_MB, 2, 0));
+	EXPECT_EQ(HEAP_RESIZE_MODEL_GC_RATIO, model.getLastReason());
+
+	/* a change of direction starts over */
+	model.recordCycle(1, 999, 1.0);
+	EXPECT_EQ(0, predict(&model, 100 * RESIZE_MODEL_TEST_MB, 50 * RESIZE_MODEL_TEST_MB, 2, 0));
+	EXPECT_GT(0, predict(&model, 100 * RESIZE_MODEL_TEST_MB, 50 * RESIZE_MODEL_TEST_MB, 2, 0));
+
+	/* expanding to keep -Xminf free does not wait */
+	MM_HeapResizeModel urgent;
+	EXPECT_LT(0, predict(&urgent, 100 * RESIZE_MODEL_TEST_MB, 10 * RESIZE_MODEL_TEST_MB, 2, 0));
+	EXPECT_EQ(HEAP_RESIZE_MODEL_FREE_TOO_LOW, urgent.getLastReason());
+
+	/* resizes smaller than the dead band are ignored */
+	MM_HeapResizeModel small;
+	EXPECT_EQ(0, predict(&small, 100 * RESIZE_MODEL_TEST_MB, 28 * RESIZE_MODEL_TEST_MB, 1, 4 * RESIZE_MODEL_TEST_MB));
+	EXPECT_LT(0, predict(&small, 100 * RESIZE_MODEL_TEST_MB, 28 * RESIZE_MODEL_TEST_MB, 1, RESIZE_MODEL_TEST_MB));
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, HeapResizeModelTest,
+        ::testing::Values("fvtest/gctest/configuration/global_GC_config.xml"));
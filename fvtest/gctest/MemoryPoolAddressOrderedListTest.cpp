@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "GCConfigTest.hpp"
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+
+#include "AllocateDescription.hpp"
+#include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "MemoryPoolAddressOrderedList.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
+
+/**
+ * Checks the address ordered list pool of the tenure space: free entries removed by address range (as when
+ * the large object area is resized) must not be reachable through the allocation hints of the pool.
+ */
+class MemoryPoolAddressOrderedListTest : public GCConfigTest
+{
+};
+
+static const uintptr_t AOL_TEST_SMALL_SIZE = 1024;
+static const uintptr_t AOL_TEST_SMALL_COUNT = 2 * (J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK + 4);
+static const uintptr_t AOL_TEST_LARGE_SIZE = 16 * 1024;
+
+TEST_P(MemoryPoolAddressOrderedListTest, removeRangeDropsHints)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->largeObjectArea || extensions->sizeClassFreeListPool || (1 < extensions->splitFreeListSplitAmount)) {
+		gcTestEnv->log("Address ordered list: the tenure pool of this configuration is not an address ordered list\n");
+		return;
+	}
+	MM_MemoryPoolAddressOrderedList *pool = (MM_MemoryPoolAddressOrderedList *)extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace()->getMemoryPool();
+	ASSERT_TRUE(NULL != pool) << "The tenure space has no memory pool.";
+
+	/* carve a run of small objects, and free every other one: a larger allocation then walks more than
+	 * J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK small free entries and leaves a hint at the last of them
+	 */
+	uint8_t *objects[AOL_TEST_SMALL_COUNT];
+	for (uintptr_t i = 0; i < AOL_TEST_SMALL_COUNT; i++) {
+		MM_AllocateDescription allocDescription(AOL_TEST_SMALL_SIZE, 0, false, true);
+		objects[i] = (uint8_t *)pool->allocateObject(env, &allocDescription);
+		ASSERT_TRUE(NULL != objects[i]) << "Failed to allocate " << AOL_TEST_SMALL_SIZE << " bytes from the tenure pool.";
+		if (0 < i) {
+			ASSERT_EQ(objects[i - 1] + AOL_TEST_SMALL_SIZE, objects[i]) << "Small objects were not allocated from a single free entry.";
+		}
+	}
+	for (uintptr_t i = 0; i < AOL_TEST_SMALL_COUNT; i += 2) {
+		pool->expandWithRange(env, AOL_TEST_SMALL_SIZE, objects[i], objects[i] + AOL_TEST_SMALL_SIZE, false);
+	}
+	MM_AllocateDescription largeDescription(AOL_TEST_LARGE_SIZE, 0, false, true);
+	uint8_t *large = (uint8_t *)pool->allocateObject(env, &largeDescription);
+	ASSERT_TRUE(NULL != large) << "Failed to allocate " << AOL_TEST_LARGE_SIZE << " bytes from the tenure pool.";
+	ASSERT_LT(objects[AOL_TEST_SMALL_COUNT - 1], large) << "The large object was not allocated past the small free entries.";
+
+	/* remove the upper half of the small free entries, where the hint is, and the start of the free entry after them */
+	uint8_t *lowAddress = objects[AOL_TEST_SMALL_COUNT / 2];
+	uint8_t *highAddress = large + (4 * AOL_TEST_LARGE_SIZE);
+	MM_HeapLinkedFreeHeader *removedHead = NULL;
+	MM_HeapLinkedFreeHeader *removedTail = NULL;
+	uintptr_t removedCount = 0;
+	uintptr_t removedSize = 0;
+	ASSERT_TRUE(pool->removeFreeEntriesWithinRange(env, lowAddress, highAddress, AOL_TEST_SMALL_SIZE, removedHead, removedTail, removedCount, removedSize))
+			<< "No free entries were found in the range.";
+	ASSERT_EQ((AOL_TEST_SMALL_COUNT / 4) + 1, removedCount);
+
+	/* the next large allocation must come from a free entry the pool still owns */
+	uint8_t *next = (uint8_t *)pool->allocateObject(env, &largeDescription);
+	ASSERT_TRUE(NULL != next) << "Failed to allocate " << AOL_TEST_LARGE_SIZE << " bytes from the tenure pool.";
+	EXPECT_TRUE((next < lowAddress) || (next >= highAddress)) << "Allocated " << (void *)next << " from the removed range ["
+			<< (void *)lowAddress << ", " << (void *)highAddress << ").";
+	gcTestEnv->log("Address ordered list: %zu free entries (%zu bytes) removed, next large object at offset %zd from the range end\n",
+			removedCount, removedSize, (intptr_t)(next - highAddress));
+
+	/* return the removed entries, and leave the allocated memory as holes for the walks done at shutdown */
+	pool->addFreeEntries(env, removedHead, removedTail, removedCount, removedSize);
+	for (uintptr_t i = 1; i < AOL_TEST_SMALL_COUNT; i += 2) {
+		pool->abandonHeapChunk(objects[i], objects[i] + AOL_TEST_SMALL_SIZE);
+	}
+	pool->abandonHeapChunk(large, large + AOL_TEST_LARGE_SIZE);
+	if ((next < lowAddress) || (next >= highAddress)) {
+		pool->abandonHeapChunk(next, next + AOL_TEST_LARGE_SIZE);
+	}
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, MemoryPoolAddressOrderedListTest,
+        ::testing::Values("fvtest/gctest/configuration/global_GC_config.xml"));
+
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
@@ -0,0 +1,242 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "GCConfigTest.hpp"
+
+#include "omrgc.h"
+
+#include "AllocateDescription.hpp"
+#include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "MemoryPoolSizeClassFreeList.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
+
+/**
+ * Checks the size class free list pool (-Xgc:sizeClassFreeListPool): the mapping of sizes to bins, the
+ * address based operations (coalescing expansion, contraction and address ordered walks) on a pool that owns
+ * a native buffer rather than part of the heap, and that the tenure pool of the configuration allocates from
+ * the smallest bin that fits after a collection.
+ */
+class MemoryPoolSizeClassFreeListTest : public GCConfigTest
+{
+protected:
+	static MMINLINE uintptr_t binMinimumSize(uintptr_t bin, uintptr_t subBin) { return (SIZECLASS_FREELIST_SUB_BIN_COUNT + subBin) << bin; }
+	static MMINLINE uintptr_t binIndex(uintptr_t size)
+	{
+		uintptr_t bin = 0;
+		uintptr_t subBin = 0;
+		MM_MemoryPoolSizeClassFreeList::mapSizeToBin(size, &bin, &subBin);
+		return (bin * SIZECLASS_FREELIST_SUB_BIN_COUNT) + subBin;
+	}
+	void checkSizeMapping(uintptr_t size);
+	void checkAddressOrder(MM_MemoryPoolSizeClassFreeList *pool);
+};
+
+static const uintptr_t SIZECLASS_FREELIST_TEST_UNIT = 4096;
+static const uintptr_t SIZECLASS_FREELIST_TEST_UNITS = 32;
+
+void
+MemoryPoolSizeClassFreeListTest::checkSizeMapping(uintptr_t size)
+{
+	uintptr_t bin = 0;
+	uintptr_t subBin = 0;
+
+	/* the bin holding a size spans it */
+	MM_MemoryPoolSizeClassFreeList::mapSizeToBin(size, &bin, &subBin);
+	ASSERT_GT((uintptr_t)SIZECLASS_FREELIST_BIN_COUNT, bin) << "Size " << size;
+	ASSERT_GT((uintptr_t)SIZECLASS_FREELIST_SUB_BIN_COUNT, subBin) << "Size " << size;
+	ASSERT_LE(binMinimumSize(bin, subBin), size) << "Size " << size << " is below its bin " << bin << "/" << subBin;
+	ASSERT_GT(binMinimumSize(bin, subBin) + ((uintptr_t)1 << bin), size) << "Size " << size << " is above its bin " << bin << "/" << subBin;
+
+	/* the fitting bin is the lowest one whose entries are all large enough */
+	MM_MemoryPoolSizeClassFreeList::mapSizeToFittingBin(size, &bin, &subBin);
+	ASSERT_GT((uintptr_t)SIZECLASS_FREELIST_BIN_COUNT, bin) << "Size " << size;
+	ASSERT_LE(size, binMinimumSize(bin, subBin)) << "Fitting bin " << bin << "/" << subBin << " may not fit size " << size;
+	uintptr_t previousBinMinimumSize = (0 != subBin) ? binMinimumSize(bin, subBin - 1) : binMinimumSize(bin - 1, SIZECLASS_FREELIST_SUB_BIN_COUNT - 1);
+	ASSERT_GT(size, previousBinMinimumSize) << "Fitting bin " << bin << "/" << subBin << " is not the lowest to fit size " << size;
+}
+
+void
+MemoryPoolSizeClassFreeListTest::checkAddressOrder(MM_MemoryPoolSizeClassFreeList *pool)
+{
+	uintptr_t freeBytes = 0;
+	uintptr_t freeCount = 0;
+	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
+	MM_HeapLinkedFreeHeader *currentFreeEntry = (MM_HeapLinkedFreeHeader *)pool->getFirstFreeStartingAddr(env);
+	while (NULL != currentFreeEntry) {
+		if (NULL != previousFreeEntry) {
+			ASSERT_LE(previousFreeEntry->afterEnd(), currentFreeEntry) << "Free entries are not walked in address order.";
+		}
+		freeBytes += currentFreeEntry->getSize();
+		freeCount += 1;
+		previousFreeEntry = currentFreeEntry;
+		currentFreeEntry = (MM_HeapLinkedFreeHeader *)pool->getNextFreeStartingAddr(env, currentFreeEntry);
+	}
+	ASSERT_EQ(pool->getActualFreeMemorySize(), freeBytes);
+	ASSERT_EQ(pool->getActualFreeEntryCount(), freeCount);
+}
+
+TEST_P(MemoryPoolSizeClassFreeListTest, sizeToBin)
+{
+	/* every size of the first bins, then sizes around each power of two */
+	for (uintptr_t size = 2 * SIZECLASS_FREELIST_SUB_BIN_COUNT; size < 65536; size += sizeof(uintptr_t)) {
+		checkSizeMapping(size);
+		if (HasFatalFailure()) {
+			return;
+		}
+	}
+	for (uintptr_t shift = 16; shift < (J9BITS_BITS_IN_SLOT - 2); shift++) {
+		uintptr_t powerOfTwo = (uintptr_t)1 << shift;
+		for (intptr_t delta = -3; delta <= 3; delta++) {
+			checkSizeMapping(powerOfTwo + (delta * (intptr_t)sizeof(uintptr_t)));
+			checkSizeMapping(powerOfTwo + (powerOfTwo / 2) + (delta * (intptr_t)sizeof(uintptr_t)));
+			if (HasFatalFailure()) {
+				return;
+			}
+		}
+	}
+}
+
+TEST_P(MemoryPoolSizeClassFreeListTest, coalesceAndContract)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	const uintptr_t unit = SIZECLASS_FREELIST_TEST_UNIT;
+	uint8_t *base = (uint8_t *)omrmem_allocate_memory(unit * SIZECLASS_FREELIST_TEST_UNITS, OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != base) << "Failed to allocate native memory.";
+	MM_MemoryPoolSizeClassFreeList *pool = MM_MemoryPoolSizeClassFreeList::newInstance(env, env->getExtensions()->tlhMinimumSize, "SizeClassFreeListTest");
+	ASSERT_TRUE(NULL != pool) << "Failed to create the memory pool.";
+
+	/* two separate ranges, then the range between them fuses all three */
+	pool->expandWithRange(env, 4 * unit, base, base + (4 * unit), true);
+	pool->expandWithRange(env, 4 * unit, base + (8 * unit), base + (12 * unit), true);
+	EXPECT_EQ((uintptr_t)2, pool->getActualFreeEntryCount());
+	pool->expandWithRange(env, 4 * unit, base + (4 * unit), base + (8 * unit), true);
+	EXPECT_EQ((uintptr_t)1, pool->getActualFreeEntryCount());
+	EXPECT_EQ(12 * unit, pool->getActualFreeMemorySize());
+	EXPECT_EQ((void *)base, pool->getFirstFreeStartingAddr(env));
+	EXPECT_EQ(12 * unit, ((MM_HeapLinkedFreeHeader *)base)->getSize());
+	EXPECT_TRUE(NULL == pool->getNextFreeStartingAddr(env, base));
+	EXPECT_EQ((void *)base, pool->findFreeEntryEndingAtAddr(env, base + (12 * unit)));
+	EXPECT_EQ((void *)(base + (12 * unit)), pool->findFreeEntryTopStartingAtAddr(env, base));
+
+	/* contracting the middle of the entry leaves both ends in the pool */
+	EXPECT_EQ((void *)(base + (4 * unit)), pool->contractWithRange(env, 2 * unit, base + (4 * unit), base + (6 * unit)));
+	EXPECT_EQ((uintptr_t)2, pool->getActualFreeEntryCount());
+	EXPECT_EQ(10 * unit, pool->getActualFreeMemorySize());
+	EXPECT_TRUE(NULL == pool->findFreeEntryEndingAtAddr(env, base + (12 * unit - sizeof(uintptr_t))));
+	EXPECT_EQ((void *)(base + (6 * unit)), pool->findFreeEntryEndingAtAddr(env, base + (12 * unit)));
+	checkAddressOrder(pool);
+
+	/* entries of decreasing size at increasing addresses, so that bin order is the reverse of address order */
+	pool->expandWithRange(env, 5 * unit, base + (13 * unit), base + (18 * unit), true);
+	pool->expandWithRange(env, 3 * unit, base + (19 * unit), base + (22 * unit), true);
+	pool->expandWithRange(env, 2 * unit, base + (23 * unit), base + (25 * unit), true);
+	pool->expandWithRange(env, 1 * unit, base + (26 * unit), base + (27 * unit), true);
+	EXPECT_EQ((uintptr_t)6, pool->getActualFreeEntryCount());
+	checkAddressOrder(pool);
+
+	/* fill the gaps below and above the 3 unit entry, fusing three entries into one */
+	pool->expandWithRange(env, unit, base + (18 * unit), base + (19 * unit), true);
+	pool->expandWithRange(env, unit, base + (22 * unit), base + (23 * unit), true);
+	EXPECT_EQ((uintptr_t)4, pool->getActualFreeEntryCount());
+	EXPECT_EQ((void *)(base + (25 * unit)), pool->findFreeEntryTopStartingAtAddr(env, base + (13 * unit)));
+	EXPECT_EQ(12 * unit, ((MM_HeapLinkedFreeHeader *)(base + (13 * unit)))->getSize());
+	checkAddressOrder(pool);
+
+	/* without coalescing the adjacent ranges stay separate entries */
+	pool->expandWithRange(env, unit, base + (27 * unit), base + (28 * unit), false);
+	EXPECT_EQ((uintptr_t)5, pool->getActualFreeEntryCount());
+	checkAddressOrder(pool);
+	EXPECT_EQ(24 * unit, pool->getActualFreeMemorySize());
+
+	pool->kill(env);
+	omrmem_free_memory(base);
+}
+
+TEST_P(MemoryPoolSizeClassFreeListTest, tenureAllocatesFromSmallestBin)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_TRUE(extensions->sizeClassFreeListPool) << "Configuration did not enable the size class free list pool.";
+	ASSERT_FALSE(extensions->largeObjectArea) << "The size class free list pool is not used with the large object area.";
+
+	/* build the object graph of the configuration, with its garbage, and collect it to leave holes in the heap */
+	pugi::xml_node configNode = doc.select_node("/gc-config").node();
+	ASSERT_EQ(0, iniXMLStr(configNode.attribute("style").value())) << "Invalid XML input.";
+	pugi::xml_node allocationNode = configNode.child("allocation");
+	ASSERT_EQ(0, parseGarbagePolicy(allocationNode.child(xs.garbagePolicy))) << "Failed to parse garbage policy.";
+	pugi::xpath_node_set objectNodes = allocationNode.select_nodes(xs.object);
+	for (pugi::xpath_node_set::const_iterator it = objectNodes.begin(); it != objectNodes.end(); ++it) {
+		ASSERT_EQ(0, allocationWalker(it->node())) << "Failed to perform allocation.";
+	}
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_IMPLICIT_GC_DEFAULT));
+
+	MM_MemoryPoolSizeClassFreeList *pool = (MM_MemoryPoolSizeClassFreeList *)extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace()->getMemoryPool();
+	ASSERT_TRUE(NULL != pool) << "The tenure space has no memory pool.";
+	checkAddressOrder(pool);
+	if (HasFatalFailure()) {
+		return;
+	}
+
+	/* request the size of the smallest free entry: an address ordered pool would take the lowest entry that fits,
+	 * the size class pool takes an entry from a bin no higher than the lowest one guaranteed to fit
+	 */
+	uintptr_t smallestSize = UDATA_MAX;
+	uintptr_t largestSize = 0;
+	MM_HeapLinkedFreeHeader *freeEntry = (MM_HeapLinkedFreeHeader *)pool->getFirstFreeStartingAddr(env);
+	while (NULL != freeEntry) {
+		smallestSize = OMR_MIN(smallestSize, freeEntry->getSize());
+		largestSize = OMR_MAX(largestSize, freeEntry->getSize());
+		freeEntry = (MM_HeapLinkedFreeHeader *)pool->getNextFreeStartingAddr(env, freeEntry);
+	}
+	ASSERT_LT((uintptr_t)0, largestSize) << "The collection left no free memory.";
+	uintptr_t fittingBin = 0;
+	uintptr_t fittingSubBin = 0;
+	MM_MemoryPoolSizeClassFreeList::mapSizeToFittingBin(smallestSize, &fittingBin, &fittingSubBin);
+	uintptr_t fittingBinIndex = (fittingBin * SIZECLASS_FREELIST_SUB_BIN_COUNT) + fittingSubBin;
+
+	uintptr_t freeCount = pool->getActualFreeEntryCount();
+	MM_AllocateDescription allocDescription(smallestSize, 0, false, true);
+	void *addr = pool->allocateObject(env, &allocDescription);
+	ASSERT_TRUE(NULL != addr) << "Failed to allocate " << smallestSize << " bytes from the tenure pool.";
+	/* the allocated entry is gone from the pool, or was split leaving its remainder in the pool */
+	uintptr_t allocatedSize = smallestSize;
+	void *remainder = (uint8_t *)addr + smallestSize;
+	if (freeCount == pool->getActualFreeEntryCount()) {
+		allocatedSize = (uintptr_t)pool->findFreeEntryTopStartingAtAddr(env, remainder) - (uintptr_t)addr;
+	}
+	EXPECT_GE(OMR_MAX(binIndex(smallestSize), fittingBinIndex), binIndex(allocatedSize))
+			<< "Allocating " << smallestSize << " bytes took a free entry of " << allocatedSize << " bytes.";
+	if (largestSize > smallestSize) {
+		EXPECT_GT(largestSize, allocatedSize) << "Allocating " << smallestSize << " bytes took the largest free entry.";
+	}
+	checkAddressOrder(pool);
+	gcTestEnv->log("Size class free list: %zu bytes allocated from a free entry of %zu bytes, largest free entry %zu bytes\n",
+			smallestSize, allocatedSize, largestSize);
+
+	/* leave the allocated memory as a hole for the walks done at shutdown */
+	pool->abandonHeapChunk(addr, remainder);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, MemoryPoolSizeClassFreeListTest,
+        ::testing::Values("fvtest/gctest/configuration/global_GC_sizeclassfreelist_config.xml"));
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCConfigTest.hpp"
+
+#include "omrgc.h"
+
+#include "MarkingScheme.hpp"
+#include "MarkMap.hpp"
+#include "MemoryManager.hpp"
+#include "ParallelGlobalGC.hpp"
+
+/**
+ * Checks the page size of GC metadata (-Xgc:gcmetadataPageSize): every metadata reservation uses the page size
+ * resolved for the request of the configuration, and when the request falls back to the default page size the
+ * mark map starts on a boundary of the requested size, so that transparent huge pages can back it.
+ */
+class MetadataPagesTest : public GCConfigTest
+{
+};
+
+/* gcmetadataPageSize of the configuration */
+static const uintptr_t METADATA_PAGES_TEST_REQUESTED_PAGE_SIZE = 2 * 1024 * 1024;
+
+TEST_P(MetadataPagesTest, reservationsUseRequestedPages)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_MemoryManager *memoryManager = extensions->memoryManager;
+	ASSERT_NE((uintptr_t)0, extensions->gcmetadataPageSize) << "No metadata page size was resolved.";
+
+	bool largePages = (METADATA_PAGES_TEST_REQUESTED_PAGE_SIZE == extensions->gcmetadataPageSize);
+	if (!largePages) {
+#if defined(LINUX)
+		ASSERT_EQ(METADATA_PAGES_TEST_REQUESTED_PAGE_SIZE, extensions->gcmetadataHugePageAlignment) << "The fallback to default pages did not align metadata for transparent huge pages.";
+#endif /* defined(LINUX) */
+	}
+
+	/* collect once, so that the structures created on first use have reserved their memory too */
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_IMPLICIT_GC_DEFAULT));
+
+	MM_MetadataReservation *markMapReservation = NULL;
+	ASSERT_LT((uintptr_t)0, memoryManager->getMetadataReservationCount()) << "No metadata reservation was recorded.";
+	for (uintptr_t i = 0; i < memoryManager->getMetadataReservationCount(); i++) {
+		MM_MetadataReservation *reservation = memoryManager->getMetadataReservation(i);
+		EXPECT_EQ(extensions->gcmetadataPageSize, reservation->pageSize) << "Metadata " << reservation->name << " does not use the metadata page size.";
+		if (largePages || (reservation->size < extensions->gcmetadataHugePageAlignment)) {
+			EXPECT_EQ((uintptr_t)0, reservation->hugePageAlignment) << "Metadata " << reservation->name << " was aligned for transparent huge pages.";
+		} else {
+			EXPECT_EQ(extensions->gcmetadataHugePageAlignment, reservation->hugePageAlignment) << "Metadata " << reservation->name << " was not aligned for transparent huge pages.";
+		}
+		if (0 == strcmp("markMap", reservation->name)) {
+			markMapReservation = reservation;
+		}
+	}
+	ASSERT_TRUE(NULL != markMapReservation) << "The mark map reservation was not recorded.";
+
+	/* the mark map of the configuration's heap is large enough to be aligned */
+	ASSERT_LE(METADATA_PAGES_TEST_REQUESTED_PAGE_SIZE, markMapReservation->size) << "The heap of the configuration is too small.";
+	MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)extensions->getGlobalCollector();
+	uintptr_t markMapBits = (uintptr_t)globalCollector->getMarkingScheme()->getMarkMap()->getHeapMapBits();
+	EXPECT_EQ((uintptr_t)0, markMapBits % METADATA_PAGES_TEST_REQUESTED_PAGE_SIZE) << "The mark map does not start on a page of the requested size.";
+	gcTestEnv->log("Metadata pages: %zu reservations, page size 0x%zx, huge page alignment 0x%zx\n",
+			memoryManager->getMetadataReservationCount(), extensions->gcmetadataPageSize, extensions->gcmetadataHugePageAlignment);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, MetadataPagesTest,
+        ::testing::Values("fvtest/gctest/configuration/global_GC_metadatapages_config.xml"));
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCConfigTest.hpp"
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "omrgc.h"
+
+#include "EnvironmentBase.hpp"
+#include "ObjectAllocationModel.hpp"
+
+/**
+ * Checks the NUMA aware nursery (-Xgc:numaAwareNursery) with the simulated nodes of the configuration: the nursery
+ * is striped over the nodes, and the TLHs of a thread are carved from the stripes of its own node while they
+ * have free memory.
+ */
+class NumaNurseryTest : public GCConfigTest
+{
+};
+
+static const uintptr_t NUMA_NURSERY_TEST_OBJECT_SIZE = 200;
+
+TEST_P(NumaNurseryTest, allocateFromLocalStripes)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_TRUE(extensions->numaAwareNursery) << "Configuration did not enable the NUMA aware nursery.";
+	ASSERT_LT((uintptr_t)1, extensions->numaAwareNurseryNodeCount) << "The nursery was not striped over the simulated nodes.";
+	ASSERT_LT((uintptr_t)0, extensions->numaAwareNurseryStripeSize);
+
+	uintptr_t node = env->getNurseryNumaNode();
+	ASSERT_LE((uintptr_t)1, node) << "The thread has no nursery node.";
+	ASSERT_GE(extensions->numaAwareNurseryNodeCount, node);
+
+	/* without collecting, allocate until the nursery is exhausted: objects come from local stripes, and the remote
+	 * stripes are only used once the local ones are full (but for the ends of local stripes too short for a TLH)
+	 */
+	uintptr_t allocatedBytes = 0;
+	uintptr_t localBytes = 0;
+	uintptr_t firstRemoteBytes = 0;
+	for (;;) {
+		uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+		MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+				MM_ObjectAllocationModel(env, NUMA_NURSERY_TEST_OBJECT_SIZE, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+		omrobjectptr_t object = OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
+		if ((NULL == object) || extensions->isOld(object)) {
+			break;
+		}
+		if (node == extensions->getNurseryNumaNode(object)) {
+			localBytes += NUMA_NURSERY_TEST_OBJECT_SIZE;
+		} else if (0 == firstRemoteBytes) {
+			firstRemoteBytes = allocatedBytes + NUMA_NURSERY_TEST_OBJECT_SIZE;
+		}
+		allocatedBytes += NUMA_NURSERY_TEST_OBJECT_SIZE;
+	}
+	ASSERT_LT(extensions->numaAwareNurseryStripeSize * extensions->numaAwareNurseryNodeCount, allocatedBytes) << "The nursery filled up before the test could allocate.";
+	EXPECT_LT((uintptr_t)0, localBytes) << "No object was allocated from a local stripe.";
+	if (0 != firstRemoteBytes) {
+		EXPECT_LT(localBytes - (localBytes / 8), firstRemoteBytes) << "An object was allocated from a remote stripe while local stripes had free memory.";
+	}
+	gcTestEnv->log("NUMA nursery: node %zu of %zu, %zu of %zu bytes allocated locally, first remote object after %zu bytes\n",
+			node, extensions->numaAwareNurseryNodeCount, localBytes, allocatedBytes, firstRemoteBytes);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, NumaNurseryTest,
+        ::testing::Values("fvtest/gctest/configuration/scavenger_GC_numanursery_config.xml"));
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCConfigTest.hpp"
+
+#include "omrgc.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
+#include "HeapRegionManager.hpp"
+#include "HeapWalker.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "ObjectModelBase.hpp"
+#include "ObjectStartIndex.hpp"
+#include "ParallelGlobalGC.hpp"
+
+/**
+ * Checks that a parallel heap walk split by the object start index (-Xgc:objectStartIndex) visits exactly
+ * the objects of a single threaded walk, including objects allocated after the sweep that recorded the index,
+ * that every recorded object is the start of an object, and that entries do not outlive a wraparound of the epoch.
+ */
+class ObjectStartIndexTest : public GCConfigTest
+{
+protected:
+	struct WalkState {
+		volatile uintptr_t count;
+		volatile uintptr_t addressSum;
+		omrobjectptr_t *objects;
+		uintptr_t objectsSize;
+	};
+
+	static void countObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData);
+	static void recordObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData);
+	static bool containsObject(WalkState *state, omrobjectptr_t object);
+};
+
+static const uintptr_t OBJECT_START_INDEX_TEST_NEW_OBJECTS = 2048;
+/* number of distinct 16 bit epochs (0 is never used) */
+static const uintptr_t OBJECT_START_INDEX_TEST_EPOCHS = 65535;
+
+void
+ObjectStartIndexTest::countObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	/* called from all GC threads */
+	WalkState *state = (WalkState *)userData;
+	MM_AtomicOperations::add(&state->count, 1);
+	MM_AtomicOperations::add(&state->addressSum, (uintptr_t)object);
+}
+
+void
+ObjectStartIndexTest::recordObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	/* single threaded, in address order */
+	WalkState *state = (WalkState *)userData;
+	if (state->count < state->objectsSize) {
+		state->objects[state->count] = object;
+	}
+	state->count += 1;
+	state->addressSum += (uintptr_t)object;
+}
+
+bool
+ObjectStartIndexTest::containsObject(WalkState *state, omrobjectptr_t object)
+{
+	uintptr_t low = 0;
+	uintptr_t high = state->count;
+	while (low < high) {
+		uintptr_t middle = low + ((high - low) / 2);
+		if (state->objects[middle] < object) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+	return (low < state->count) && (object == state->objects[low]);
+}
+
+TEST_P(ObjectStartIndexTest, walkSameObjects)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_ObjectStartIndex *objectStartIndex = extensions->objectStartIndex;
+	ASSERT_TRUE(NULL != objectStartIndex) << "Configuration did not enable the object start index.";
+
+	/* build the object graph of the configuration, with its garbage */
+	pugi::xml_node configNode = doc.select_node("/gc-config").node();
+	ASSERT_EQ(0, iniXMLStr(configNode.attribute("style").value())) << "Invalid XML input.";
+	pugi::xml_node allocationNode = configNode.child("allocation");
+	ASSERT_EQ(0, parseGarbagePolicy(allocationNode.child(xs.garbagePolicy))) << "Failed to parse garbage policy.";
+	pugi::xpath_node_set objectNodes = allocationNode.select_nodes(xs.object);
+	for (pugi::xpath_node_set::const_iterator it = objectNodes.begin(); it != objectNodes.end(); ++it) {
+		ASSERT_EQ(0, allocationWalker(it->node())) << "Failed to perform allocation.";
+	}
+
+	/* the sweep of this collection records the index */
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_IMPLICIT_GC_DEFAULT));
+	ASSERT_TRUE(objectStartIndex->isValid()) << "The index was not recorded by the collection.";
+
+	/* objects allocated after the sweep are not recorded, but must still be walked */
+	for (uintptr_t i = 0; i < OBJECT_START_INDEX_TEST_NEW_OBJECTS; i++) {
+		uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+		MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+				MM_ObjectAllocationModel(env, 32 + ((i * 40) % 800), MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+		if (NULL == OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc)) {
+			break;
+		}
+	}
+
+	MM_HeapWalker *heapWalker = ((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getHeapWalker();
+	uintptr_t objectsSize = extensions->heap->getActiveMemorySize() / OMR_MINIMUM_OBJECT_SIZE;
+	WalkState serial = { 0, 0, NULL, 0 };
+	serial.objects = (omrobjectptr_t *)omrmem_allocate_memory(sizeof(omrobjectptr_t) * objectsSize, OMRMEM_CATEGORY_MM);
+	serial.objectsSize = objectsSize;
+	ASSERT_TRUE(NULL != serial.objects) << "Failed to allocate native memory.";
+	WalkState parallel = { 0, 0, NULL, 0 };
+
+	env->acquireExclusiveVMAccess();
+	heapWalker->allObjectsDo(env, recordObject, &serial, 0, false, false);
+	uintptr_t walkChunksStarted = objectStartIndex->getWalkChunksStarted();
+	heapWalker->allObjectsDo(env, countObject, &parallel, 0, true, false);
+	walkChunksStarted = objectStartIndex->getWalkChunksStarted() - walkChunksStarted;
+	env->releaseExclusiveVMAccess();
+
+	ASSERT_GE(objectsSize, serial.count);
+	EXPECT_LT((uintptr_t)0, serial.count);
+	EXPECT_EQ(serial.count, parallel.count) << "The parallel walk did not visit the same number of objects.";
+	EXPECT_EQ(serial.addressSum, parallel.addressSum) << "The parallel walk did not visit the same objects.";
+	EXPECT_LT((uintptr_t)0, walkChunksStarted) << "The parallel walk was not split at recorded objects.";
+
+	/* every recorded object is an object of the heap */
+	uintptr_t recordedObjects = 0;
+	MM_HeapRegionManager *regionManager = extensions->heap->getHeapRegionManager();
+	GC_HeapRegionIterator regionIterator(regionManager);
+	MM_HeapRegionDescriptor *region = NULL;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		omrobjectptr_t object = objectStartIndex->findObjectStart(region->getLowAddress(), region->getHighAddress());
+		while (NULL != object) {
+			ASSERT_TRUE(containsObject(&serial, object)) << "Recorded object " << (void *)object << " is not an object of the heap.";
+			ASSERT_TRUE(objectStartIndex->isObjectStart(object));
+			recordedObjects += 1;
+			object = objectStartIndex->findObjectStart((void *)((uintptr_t)object + 1), region->getHighAddress());
+		}
+	}
+	EXPECT_LT((uintptr_t)1, recordedObjects) << "Too few objects were recorded to split the walk.";
+	gcTestEnv->log("Object start index: %zu objects walked, %zu recorded, %zu walk chunks started at recorded objects\n", serial.count, recordedObjects, walkChunksStarted);
+
+	omrmem_free_memory(serial.objects);
+}
+
+TEST_P(ObjectStartIndexTest, epochWraparound)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_ObjectStartIndex *objectStartIndex = extensions->objectStartIndex;
+	ASSERT_TRUE(NULL != objectStartIndex) << "Configuration did not enable the object start index.";
+
+	/* a rooted object in tenure, recorded by the sweep */
+	pugi::xml_node configNode = doc.select_node("/gc-config").node();
+	ASSERT_EQ(0, iniXMLStr(configNode.attribute("style").value())) << "Invalid XML input.";
+	pugi::xml_node allocationNode = configNode.child("allocation");
+	ASSERT_EQ(0, parseGarbagePolicy(allocationNode.child(xs.garbagePolicy))) << "Failed to parse garbage policy.";
+	pugi::xpath_node_set objectNodes = allocationNode.select_nodes(xs.object);
+	for (pugi::xpath_node_set::const_iterator it = objectNodes.begin(); it != objectNodes.end(); ++it) {
+		ASSERT_EQ(0, allocationWalker(it->node())) << "Failed to perform allocation.";
+	}
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_IMPLICIT_GC_DEFAULT));
+	ASSERT_TRUE(objectStartIndex->isValid()) << "The index was not recorded by the collection.";
+
+	omrobjectptr_t recorded = NULL;
+	GC_HeapRegionIterator regionIterator(extensions->heap->getHeapRegionManager());
+	MM_HeapRegionDescriptor *region = NULL;
+	while ((NULL == recorded) && (NULL != (region = regionIterator.nextRegion()))) {
+		recorded = objectStartIndex->findObjectStart(region->getLowAddress(), region->getHighAddress());
+	}
+	ASSERT_TRUE(NULL != recorded) << "No object was recorded.";
+	ASSERT_TRUE(objectStartIndex->isObjectStart(recorded));
+
+	/* Sweeps that record nothing until the epoch comes back to the one that recorded the object. Its entry must
+	 * not be taken for an entry of the current sweep.
+	 */
+	for (uintptr_t i = 0; i < OBJECT_START_INDEX_TEST_EPOCHS; i++) {
+		objectStartIndex->startRecording(env);
+	}
+	EXPECT_FALSE(objectStartIndex->isObjectStart(recorded)) << "An entry recorded before the epoch wrapped around was returned.";
+	EXPECT_TRUE(NULL == objectStartIndex->findObjectStart(region->getLowAddress(), region->getHighAddress()));
+
+	/* the next collection records the index again */
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_IMPLICIT_GC_DEFAULT));
+	ASSERT_TRUE(objectStartIndex->isValid()) << "The index was not recorded by the collection.";
+	EXPECT_TRUE(NULL != objectStartIndex->findObjectStart(region->getLowAddress(), region->getHighAddress()));
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, ObjectStartIndexTest,
+        ::testing::Values("fvtest/gctest/configuration/global_GC_objectstartindex_config.xml"));
@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCConfigTest.hpp"
+
+#include "omrvm.h"
+
+#include "EnvironmentBase.hpp"
+#include "Packet.hpp"
+#include "WorkPacketsStandard.hpp"
+
+/**
+ * Microbenchmark for the work packet lists: a set of mutator threads exchange packets through a shared
+ * MM_WorkPackets as fast as they can, once with the lock protected lists and once with the lock-free lists.
+ * Run as part of the perftest suite (omrgctest --gtest_filter="perfTest*").
+ */
+class PacketListPerfTest : public GCConfigTest
+{
+protected:
+	struct ExchangeThreadArgs {
+		OMR_VM *omrVM;
+		MM_WorkPackets *workPackets;
+		omrthread_monitor_t monitor;
+		uintptr_t iterations;
+		volatile uintptr_t readyCount;
+		volatile uintptr_t doneCount;
+		volatile bool go;
+		volatile bool failed;
+	};
+
+	static int J9THREAD_PROC exchangeThread(void *entryArg);
+
+	uint64_t runExchange(bool lockFree, uintptr_t threadCount, uintptr_t iterations);
+};
+
+static const uintptr_t PACKET_EXCHANGE_ITERATIONS = 100000;
+
+int J9THREAD_PROC
+PacketListPerfTest::exchangeThread(void *entryArg)
+{
+	ExchangeThreadArgs *args = (ExchangeThreadArgs *)entryArg;
+	OMR_VMThread *omrVMThread = NULL;
+
+	if (OMR_ERROR_NONE != OMR_Thread_Init(args->omrVM, NULL, &omrVMThread, "PacketListPerfTest")) {
+		args->failed = true;
+	}
+
+	omrthread_monitor_enter(args->monitor);
+	args->readyCount += 1;
+	omrthread_monitor_notify_all(args->monitor);
+	while (!args->go) {
+		omrthread_monitor_wait(args->monitor);
+	}
+	omrthread_monitor_exit(args->monitor);
+
+	if (NULL != omrVMThread) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		MM_WorkPackets *workPackets = args->workPackets;
+
+		for (uintptr_t i = 0; i < args->iterations; i++) {
+			/* publish a packet with work in it, then pick up whichever packet is available for input */
+			MM_Packet *packet = workPackets->getOutputPacket(env);
+			if (NULL == packet) {
+				args->failed = true;
+				break;
+			}
+			packet->push(env, (void *)args, (void *)args);
+			workPackets->putOutputPacket(env, packet);
+
+			packet = workPackets->getInputPacketNoWait(env);
+			if (NULL != packet) {
+				while (NULL != packet->pop(env)) {}
+				workPackets->putPacket(env, packet);
+			}
+		}
+		workPackets->flushPacketCache(env);
+
+		OMR_Thread_Free(omrVMThread);
+	}
+
+	omrthread_monitor_enter(args->monitor);
+	args->doneCount += 1;
+	omrthread_monitor_notify_all(args->monitor);
+	omrthread_monitor_exit(args->monitor);
+
+	return 0;
+}
+
+/**
+ * Exchange packets on threadCount threads.
+ * @return elapsed time in microseconds, or 0 on failure
+ */
+uint64_t
+PacketListPerfTest::runExchange(bool lockFree, uintptr_t threadCount, uintptr_t iterations)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uint64_t elapsed = 0;
+
+	bool savedLockFree = extensions->packetListLockFree;
+	extensions->packetListLockFree = lockFree;
+	MM_WorkPackets *workPackets = MM_WorkPacketsStandard::newInstance(env);
+	extensions->packetListLockFree = savedLockFree;
+	if (NULL == workPackets) {
+		return 0;
+	}
+
+	ExchangeThreadArgs args;
+	args.omrVM = exampleVM->_omrVM;
+	args.workPackets = workPackets;
+	args.monitor = NULL;
+	args.iterations = iterations;
+	args.readyCount = 0;
+	args.doneCount = 0;
+	args.go = false;
+	args.failed = false;
+
+	if (0 == omrthread_monitor_init_with_name(&args.monitor, 0, "PacketListPerfTest")) {
+		uintptr_t started = 0;
+		for (; started < threadCount; started++) {
+			omrthread_t handle = NULL;
+			if (0 != omrthread_create(&handle, 0, J9THREAD_PRIORITY_NORMAL, 0, exchangeThread, &args)) {
+				args.failed = true;
+				break;
+			}
+		}
+
+		omrthread_monitor_enter(args.monitor);
+		while (args.readyCount < started) {
+			omrthread_monitor_wait(args.monitor);
+		}
+		uint64_t startTime = omrtime_hires_clock();
+		args.go = true;
+		omrthread_monitor_notify_all(args.monitor);
+		while (args.doneCount < started) {
+			omrthread_monitor_wait(args.monitor);
+		}
+		uint64_t endTime = omrtime_hires_clock();
+		omrthread_monitor_exit(args.monitor);
+		omrthread_monitor_destroy(args.monitor);
+
+		if (!args.failed) {
+			elapsed = OMR_MAX(omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS), 1);
+		}
+	}
+
+	workPackets->kill(env);
+
+	return elapsed;
+}
+
+TEST_P(PacketListPerfTest, exchange)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	uintptr_t maxThreads = OMR_MAX(omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE), 4);
+
+	gcTestEnv->log("\n+++++++++++++++++++++++Packet list exchange+++++++++++++++++++++++\n");
+	gcTestEnv->log("%8s %16s %16s\n", "threads", "locked pkts/s", "lock-free pkts/s");
+	for (uintptr_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+		uint64_t lockedTime = runExchange(false, threadCount, PACKET_EXCHANGE_ITERATIONS);
+		uint64_t lockFreeTime = runExchange(true, threadCount, PACKET_EXCHANGE_ITERATIONS);
+		ASSERT_NE((uint64_t)0, lockedTime) << "Locked packet exchange failed with " << threadCount << " threads.";
+		ASSERT_NE((uint64_t)0, lockFreeTime) << "Lock-free packet exchange failed with " << threadCount << " threads.";
+
+		/* each iteration moves two packets: one output and one input */
+		uint64_t packets = (uint64_t)threadCount * PACKET_EXCHANGE_ITERATIONS * 2;
+		gcTestEnv->log("%8zu %16llu %16llu\n", threadCount, (packets * 1000000) / lockedTime, (packets * 1000000) / lockFreeTime);
+	}
+}
+
+INSTANTIATE_TEST_CASE_P(perfTest, PacketListPerfTest,
+        ::testing::Values("perftest/gctest/configuration/packetList_perf_config.xml"));
@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCConfigTest.hpp"
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include <stdlib.h>
+
+#include "omrgc.h"
+
+#include "SublistIterator.hpp"
+#include "SublistPool.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
+
+/**
+ * Checks the remembered set of a generational heap scanned in slot ranges (-Xgc:scavengerRememberedSetRanges)
+ * and deduplicated when a global collection compacts it (-Xgc:rememberedSetDeduplicate): the scavenges of the
+ * configuration remember old objects once each, and duplicates added to the remembered set are gone after the
+ * next global collection.
+ */
+class RememberedSetTest : public GCConfigTest
+{
+protected:
+	struct Entries {
+		uintptr_t *entries;
+		uintptr_t count;
+		uintptr_t duplicateCount;
+		uintptr_t youngCount;
+	};
+
+	static int compareEntries(const void *left, const void *right);
+	void collectEntries(uintptr_t *buffer, uintptr_t bufferCount, Entries *result);
+};
+
+int
+RememberedSetTest::compareEntries(const void *left, const void *right)
+{
+	uintptr_t leftEntry = *(const uintptr_t *)left;
+	uintptr_t rightEntry = *(const uintptr_t *)right;
+	return (leftEntry < rightEntry) ? -1 : ((leftEntry > rightEntry) ? 1 : 0);
+}
+
+/**
+ * Copy the non-NULL entries of the remembered set (at most bufferCount of them) to buffer, sorted, and count
+ * the duplicate entries and the entries that are not in the old area.
+ */
+void
+RememberedSetTest::collectEntries(uintptr_t *buffer, uintptr_t bufferCount, Entries *result)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	result->entries = buffer;
+	result->count = 0;
+	result->duplicateCount = 0;
+	result->youngCount = 0;
+
+	GC_SublistIterator puddleIterator(&extensions->rememberedSet);
+	MM_SublistPuddle *puddle = NULL;
+	while (NULL != (puddle = puddleIterator.nextList())) {
+		GC_SublistSlotIterator slotIterator(puddle);
+		uintptr_t *slot = NULL;
+		while (NULL != (slot = (uintptr_t *)slotIterator.nextSlot())) {
+			if (0 != *slot) {
+				ASSERT_GT(bufferCount, result->count) << "The remembered set has more entries than it counts.";
+				buffer[result->count] = *slot;
+				result->count += 1;
+			}
+		}
+	}
+
+	qsort(buffer, result->count, sizeof(uintptr_t), compareEntries);
+	for (uintptr_t i = 0; i < result->count; i++) {
+		if ((0 < i) && (buffer[i - 1] == buffer[i])) {
+			result->duplicateCount += 1;
+		}
+		if (!extensions->isOld((omrobjectptr_t)buffer[i])) {
+			result->youngCount += 1;
+		}
+	}
+}
+
+TEST_P(RememberedSetTest, deduplicateOnGlobalCollect)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_TRUE(extensions->scavengerRememberedSetRanges) << "Configuration did not enable remembered set slot ranges.";
+	ASSERT_TRUE(extensions->rememberedSetDeduplicate) << "Configuration did not enable remembered set deduplication.";
+
+	/* build the object graph of the configuration: its scavenges tenure parents of young objects, and remember them */
+	pugi::xml_node configNode = doc.select_node("/gc-config").node();
+	ASSERT_EQ(0, iniXMLStr(configNode.attribute("style").value())) << "Invalid XML input.";
+	pugi::xml_node allocationNode = configNode.child("allocation");
+	ASSERT_EQ(0, parseGarbagePolicy(allocationNode.child(xs.garbagePolicy))) << "Failed to parse garbage policy.";
+	pugi::xpath_node_set objectNodes = allocationNode.select_nodes(xs.object);
+	for (pugi::xpath_node_set::const_iterator it = objectNodes.begin(); it != objectNodes.end(); ++it) {
+		ASSERT_EQ(0, allocationWalker(it->node())) << "Failed to perform allocation.";
+	}
+
+	/* the pool count may lag behind entries in fragments of threads, so entries are counted by walking the pool */
+	uintptr_t bufferCount = 2 * (extensions->rememberedSet.countElements() + 1024);
+	uintptr_t *buffer = (uintptr_t *)omrmem_allocate_memory(bufferCount * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != buffer) << "Failed to allocate native memory.";
+
+	/* the scavenges, scanning the remembered set in slot ranges, remembered each old object once */
+	Entries scavenged;
+	collectEntries(buffer, bufferCount, &scavenged);
+	if (HasFatalFailure()) {
+		omrmem_free_memory(buffer);
+		return;
+	}
+	uintptr_t rememberedCount = scavenged.count;
+	EXPECT_LT((uintptr_t)0, rememberedCount) << "The scavenges did not remember any object.";
+	EXPECT_EQ((uintptr_t)0, scavenged.duplicateCount) << "An object was remembered twice.";
+	EXPECT_EQ((uintptr_t)0, scavenged.youngCount) << "A young object was remembered.";
+
+	/* remember every object a second time */
+	for (uintptr_t i = 0; i < scavenged.count; i++) {
+		uintptr_t *slot = extensions->rememberedSet.allocateElementNoContention(env);
+		ASSERT_TRUE(NULL != slot) << "Failed to allocate a remembered set element.";
+		*slot = scavenged.entries[i];
+	}
+	extensions->rememberedSet.incrementCount(scavenged.count);
+
+	/* the global collection compacts the remembered set, dropping the duplicates */
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_IMPLICIT_GC_DEFAULT));
+	Entries collected;
+	collectEntries(buffer, bufferCount, &collected);
+	if (HasFatalFailure()) {
+		omrmem_free_memory(buffer);
+		return;
+	}
+	EXPECT_GE(rememberedCount, collected.count) << "The remembered set grew across the global collection.";
+	EXPECT_EQ((uintptr_t)0, collected.duplicateCount) << "Duplicate entries were left in the remembered set.";
+	EXPECT_EQ((uintptr_t)0, collected.youngCount) << "A young object is remembered.";
+	gcTestEnv->log("Remembered set: %zu objects remembered by scavenges, %zu after deduplication\n", rememberedCount, collected.count);
+
+	omrmem_free_memory(buffer);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, RememberedSetTest,
+        ::testing::Values("fvtest/gctest/configuration/scavenger_GC_rememberedset_config.xml"));
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCConfigTest.hpp"
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "Heap.hpp"
+#include "ScavengerForwardingTable.hpp"
+
+/**
+ * Checks the side table of Scavenger forwarding pointers (-Xgc:scavengerForwardingTable) over the nursery of the
+ * configuration: the first copy installed for an object wins, forwarded objects are found in address order,
+ * and a reset clears every forwarding pointer of the cycle. Objects are addresses in the heap that are never
+ * dereferenced.
+ */
+class ScavengerForwardingTableTest : public GCConfigTest
+{
+};
+
+static const uintptr_t FORWARDING_TABLE_TEST_STRIDE = 37;
+static const uintptr_t FORWARDING_TABLE_TEST_OBJECTS = 1000;
+
+TEST_P(ScavengerForwardingTableTest, forwardAndReset)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_TRUE(extensions->scavengerForwardingTable) << "Configuration did not enable the forwarding table.";
+	ASSERT_TRUE(MM_ScavengerForwardingTable::canEncodeHeap(env)) << "The heap of the configuration is too large for the forwarding table.";
+
+	MM_ScavengerForwardingTable *forwardingTable = MM_ScavengerForwardingTable::newInstance(env);
+	ASSERT_TRUE(NULL != forwardingTable) << "Failed to create the forwarding table.";
+
+	/* the lower half of the nursery is the evacuate space, copies go to the bottom of the heap */
+	uintptr_t alignment = env->getObjectAlignmentInBytes();
+	uint8_t *heapBase = (uint8_t *)extensions->heap->getHeapBase();
+	uint8_t *heapTop = (uint8_t *)extensions->heap->getHeapTop();
+	uint8_t *evacuateBase = heapTop - extensions->maxNewSpaceSize;
+	uint8_t *evacuateTop = evacuateBase + (extensions->maxNewSpaceSize / 2);
+	ASSERT_GE((uintptr_t)(evacuateTop - evacuateBase), FORWARDING_TABLE_TEST_STRIDE * FORWARDING_TABLE_TEST_OBJECTS * alignment);
+	EXPECT_FALSE(forwardingTable->startCycle(env, heapBase, evacuateTop)) << "A range below the nursery was accepted.";
+
+	for (uintptr_t cycle = 0; cycle < 2; cycle++) {
+		ASSERT_TRUE(forwardingTable->startCycle(env, evacuateBase, evacuateTop)) << "Failed to commit the forwarding table.";
+
+		/* forward objects from the top of the evacuate space down, each twice, and leave their neighbours alone */
+		for (uintptr_t i = 0; i < FORWARDING_TABLE_TEST_OBJECTS; i++) {
+			uintptr_t granule = (FORWARDING_TABLE_TEST_OBJECTS - 1 - i) * FORWARDING_TABLE_TEST_STRIDE;
+			omrobjectptr_t object = (omrobjectptr_t)(evacuateBase + (granule * alignment));
+			omrobjectptr_t copy = (omrobjectptr_t)(heapBase + (((cycle * FORWARDING_TABLE_TEST_OBJECTS) + granule) * alignment));
+			omrobjectptr_t otherCopy = (omrobjectptr_t)((uint8_t *)copy + alignment);
+			ASSERT_TRUE(NULL == forwardingTable->getForwardedObject(object)) << "Object " << granule << " was forwarded before the cycle.";
+			ASSERT_EQ(copy, forwardingTable->setForwardedObject(object, copy));
+			ASSERT_EQ(copy, forwardingTable->setForwardedObject(object, otherCopy)) << "A second copy replaced the first one.";
+			ASSERT_EQ(copy, forwardingTable->getForwardedObject(object));
+			ASSERT_TRUE(NULL == forwardingTable->getForwardedObject((omrobjectptr_t)((uint8_t *)object + alignment)));
+		}
+
+		uintptr_t cursor = 0;
+		uintptr_t found = 0;
+		omrobjectptr_t copy = NULL;
+		omrobjectptr_t object = NULL;
+		while (NULL != (object = forwardingTable->nextForwardedObject(&cursor, &copy))) {
+			uintptr_t granule = found * FORWARDING_TABLE_TEST_STRIDE;
+			ASSERT_EQ((omrobjectptr_t)(evacuateBase + (granule * alignment)), object) << "Forwarded objects were not found in address order.";
+			ASSERT_EQ((omrobjectptr_t)(heapBase + (((cycle * FORWARDING_TABLE_TEST_OBJECTS) + granule) * alignment)), copy);
+			found += 1;
+		}
+		EXPECT_EQ(FORWARDING_TABLE_TEST_OBJECTS, found);
+
+		/* the next cycle starts from an empty table */
+		forwardingTable->resetCycle(env);
+		cursor = 0;
+		EXPECT_TRUE(NULL == forwardingTable->nextForwardedObject(&cursor, &copy)) << "A forwarding pointer survived the reset.";
+		for (uintptr_t i = 0; i < FORWARDING_TABLE_TEST_OBJECTS; i++) {
+			object = (omrobjectptr_t)(evacuateBase + (i * FORWARDING_TABLE_TEST_STRIDE * alignment));
+			ASSERT_TRUE(NULL == forwardingTable->getForwardedObject(object)) << "Object " << i << " is still forwarded after the reset.";
+		}
+	}
+
+	forwardingTable->kill(env);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, ScavengerForwardingTableTest,
+        ::testing::Values("fvtest/gctest/configuration/scavenger_GC_forwardingtable_config.xml"));
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCConfigTest.hpp"
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "omrgc.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "ObjectModel.hpp"
+#include "ScavengerStats.hpp"
+#include "SlotObject.hpp"
+#include "StandardWriteBarrier.hpp"
+
+/**
+ * Checks the copy order of hot fields (-Xgc:scavengerHotFieldCopy): the example delegate reports the
+ * first slot of every object as hot, so a scavenge copies the objects of a list linked through that slot
+ * next to each other, even though each object also refers to a leaf object that is found first by a
+ * breadth first scan.
+ */
+class ScavengerHotFieldTest : public GCConfigTest
+{
+protected:
+	uintptr_t copyAndCountAdjacentLinks(uintptr_t hotFieldCopyDepth);
+};
+
+static const char *HOT_FIELD_TEST_ROOT_NAME = "hotFieldListHead";
+static const uintptr_t HOT_FIELD_TEST_LIST_LENGTH = 256;
+static const uintptr_t HOT_FIELD_TEST_NODE_SLOTS = 4;
+static const uintptr_t HOT_FIELD_TEST_LEAF_SLOTS = 2;
+static const uintptr_t HOT_FIELD_TEST_GARBAGE_SIZE = 1024;
+
+/**
+ * Builds a rooted list of HOT_FIELD_TEST_LIST_LENGTH nodes, each linked to the next node through its first
+ * slot and to a leaf through its second slot, scavenges it with the given hot field copy depth and returns
+ * the number of list links whose referent was copied right behind its parent.
+ */
+uintptr_t
+ScavengerHotFieldTest::copyAndCountAdjacentLinks(uintptr_t hotFieldCopyDepth)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	GC_ObjectModel *objectModel = &extensions->objectModel;
+	uintptr_t nodeSize = sizeof(omrobjectptr_t) + (HOT_FIELD_TEST_NODE_SLOTS * sizeof(fomrobject_t));
+	uintptr_t leafSize = sizeof(omrobjectptr_t) + (HOT_FIELD_TEST_LEAF_SLOTS * sizeof(fomrobject_t));
+	uintptr_t noGcFlags = MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true);
+
+	/* the list is built without collecting, so that nodes which are not reachable yet cannot be lost */
+	omrobjectptr_t head = NULL;
+	for (uintptr_t i = 0; i < HOT_FIELD_TEST_LIST_LENGTH; i++) {
+		MM_ObjectAllocationModel nodeModel(env, nodeSize, noGcFlags);
+		omrobjectptr_t node = OMR_GC_AllocateObject(exampleVM->_omrVMThread, &nodeModel);
+		MM_ObjectAllocationModel leafModel(env, leafSize, noGcFlags);
+		omrobjectptr_t leaf = OMR_GC_AllocateObject(exampleVM->_omrVMThread, &leafModel);
+		EXPECT_TRUE((NULL != node) && (NULL != leaf)) << "Failed to allocate a list node.";
+		if ((NULL == node) || (NULL == leaf)) {
+			return 0;
+		}
+		fomrobject_t *firstSlot = (fomrobject_t *)node + 1;
+		standardWriteBarrierStore(exampleVM->_omrVMThread, node, firstSlot + 1, leaf);
+		if (NULL != head) {
+			standardWriteBarrierStore(exampleVM->_omrVMThread, node, firstSlot, head);
+		}
+		head = node;
+	}
+
+	RootEntry rootEntry;
+	rootEntry.name = HOT_FIELD_TEST_ROOT_NAME;
+	rootEntry.rootPtr = head;
+	EXPECT_TRUE(NULL != hashTableAdd(exampleVM->rootTable, &rootEntry)) << "Failed to add the list head to the root table.";
+
+	/* allocate garbage until the nursery is scavenged */
+	uintptr_t savedHotFieldCopyDepth = extensions->scavengerHotFieldCopyDepth;
+	extensions->scavengerHotFieldCopyDepth = hotFieldCopyDepth;
+	uintptr_t gcCount = extensions->scavengerStats._gcCount;
+	uintptr_t garbageLimit = 2 * extensions->maxNewSpaceSize;
+	for (uintptr_t allocated = 0; (gcCount == extensions->scavengerStats._gcCount) && (allocated < garbageLimit); allocated += HOT_FIELD_TEST_GARBAGE_SIZE) {
+		MM_ObjectAllocationModel garbageModel(env, HOT_FIELD_TEST_GARBAGE_SIZE, 0);
+		OMR_GC_AllocateObject(exampleVM->_omrVMThread, &garbageModel);
+	}
+	extensions->scavengerHotFieldCopyDepth = savedHotFieldCopyDepth;
+	EXPECT_LT(gcCount, extensions->scavengerStats._gcCount) << "The nursery was not scavenged.";
+
+	RootEntry *foundEntry = (RootEntry *)hashTableFind(exampleVM->rootTable, &rootEntry);
+	EXPECT_TRUE(NULL != foundEntry) << "The list head is missing from the root table.";
+	if (NULL == foundEntry) {
+		return 0;
+	}
+
+	uintptr_t nodes = 0;
+	uintptr_t adjacentLinks = 0;
+	for (omrobjectptr_t node = foundEntry->rootPtr; NULL != node; nodes++) {
+		GC_SlotObject slotObject(exampleVM->_omrVM, (fomrobject_t *)node + 1);
+		omrobjectptr_t next = slotObject.readReferenceFromSlot();
+		if ((uint8_t *)next == ((uint8_t *)node + objectModel->getConsumedSizeInBytesWithHeader(node))) {
+			adjacentLinks += 1;
+		}
+		node = next;
+	}
+	EXPECT_EQ(HOT_FIELD_TEST_LIST_LENGTH, nodes) << "The list was not copied intact.";
+
+	hashTableRemove(exampleVM->rootTable, foundEntry);
+	return adjacentLinks;
+}
+
+TEST_P(ScavengerHotFieldTest, hotFieldsAreCopiedBehindTheirParents)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_TRUE(extensions->scavengerHotFieldCopy) << "Configuration did not enable hot field copying.";
+	ASSERT_LT((uintptr_t)0, extensions->scavengerHotFieldCopyDepth) << "Configuration did not allow hot field referents to be copied.";
+
+	uintptr_t links = HOT_FIELD_TEST_LIST_LENGTH - 1;
+	uintptr_t coldAdjacentLinks = copyAndCountAdjacentLinks(0);
+	uintptr_t hotAdjacentLinks = copyAndCountAdjacentLinks(extensions->scavengerHotFieldCopyDepth);
+
+	/* each hot copy chain ends at the copy depth, and the next node starts a new chain when its parent is scanned */
+	uintptr_t expectedAdjacentLinks = (links * extensions->scavengerHotFieldCopyDepth) / (extensions->scavengerHotFieldCopyDepth + 1);
+
+	gcTestEnv->log("Hot field copy: %zu of %zu list links copied adjacent with depth %zu, %zu without copying hot fields\n",
+		hotAdjacentLinks, links, extensions->scavengerHotFieldCopyDepth, coldAdjacentLinks);
+	ASSERT_LT(coldAdjacentLinks, hotAdjacentLinks) << "Hot field referents were not copied behind their parents.";
+	ASSERT_LE(expectedAdjacentLinks / 2, hotAdjacentLinks) << "Too few hot field referents were copied behind their parents.";
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, ScavengerHotFieldTest,
+        ::testing::Values("fvtest/gctest/configuration/scavenger_GC_hotfield_config.xml"));
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
@@ -0,0 +1,216 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCConfigTest.hpp"
+
+#include "omrgc.h"
+#include "omrvm.h"
+
+#include "EnvironmentBase.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "SizeClasses.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * Microbenchmark for the segregated allocation caches: a set of mutator threads allocate objects of every small
+ * size class in turn, once with cache refills taken from a single free range of a region and once with batched
+ * refills (-Xgc:allocationCacheRefillBatchCells), which take fewer region locks and reuse the cells left in the
+ * caches at GC without locking.
+ * The allocations of a run fit in the heap: the mutators do not hold VM access, so they must not trigger a GC.
+ * The objects are not rooted, so they are recovered by the system GC that follows each run.
+ * Run as part of the perftest suite (omrgctest --gtest_filter="perfTest*").
+ */
+class SegregatedAllocationPerfTest : public GCConfigTest
+{
+protected:
+	struct AllocationThreadArgs {
+		OMR_VM *omrVM;
+		omrthread_monitor_t monitor;
+		uintptr_t *cellSizes;
+		uintptr_t sizeClassCount;
+		uintptr_t objectCount;
+		volatile uintptr_t readyCount;
+		volatile uintptr_t doneCount;
+		volatile bool go;
+		volatile bool failed;
+	};
+
+	static int J9THREAD_PROC allocationThread(void *entryArg);
+
+	uint64_t runAllocation(uintptr_t refillBatchCells, uintptr_t threadCount, uintptr_t objectsPerThread);
+};
+
+static const uintptr_t SEGREGATED_ALLOCATION_RUN_BYTES = 16 * 1024 * 1024;
+static const uintptr_t SEGREGATED_ALLOCATION_ROUNDS = 4;
+static const uintptr_t SEGREGATED_ALLOCATION_BATCH_CELLS = 64;
+
+int J9THREAD_PROC
+SegregatedAllocationPerfTest::allocationThread(void *entryArg)
+{
+	AllocationThreadArgs *args = (AllocationThreadArgs *)entryArg;
+	OMR_VMThread *omrVMThread = NULL;
+
+	if (OMR_ERROR_NONE != OMR_Thread_Init(args->omrVM, NULL, &omrVMThread, "SegregatedAllocationPerfTest")) {
+		args->failed = true;
+	}
+
+	omrthread_monitor_enter(args->monitor);
+	uintptr_t threadIndex = args->readyCount;
+	args->readyCount += 1;
+	omrthread_monitor_notify_all(args->monitor);
+	while (!args->go) {
+		omrthread_monitor_wait(args->monitor);
+	}
+	omrthread_monitor_exit(args->monitor);
+
+	if (NULL != omrVMThread) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+
+		/* start each thread on a different size class so that the threads compete for all of them */
+		for (uintptr_t i = 0; i < args->objectCount; i++) {
+			MM_ObjectAllocationModel allocationModel(env, args->cellSizes[(i + threadIndex) % args->sizeClassCount], 0);
+			if (NULL == OMR_GC_AllocateObject(omrVMThread, &allocationModel)) {
+				args->failed = true;
+				break;
+			}
+		}
+
+		OMR_Thread_Free(omrVMThread);
+	}
+
+	omrthread_monitor_enter(args->monitor);
+	args->doneCount += 1;
+	omrthread_monitor_notify_all(args->monitor);
+	omrthread_monitor_exit(args->monitor);
+
+	return 0;
+}
+
+/**
+ * Allocate objectsPerThread objects on each of threadCount threads, over SEGREGATED_ALLOCATION_ROUNDS rounds
+ * separated by system GCs.
+ * @return elapsed time in microseconds, or 0 on failure
+ */
+uint64_t
+SegregatedAllocationPerfTest::runAllocation(uintptr_t refillBatchCells, uintptr_t threadCount, uintptr_t objectsPerThread)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_SizeClasses *sizeClasses = extensions->defaultSizeClasses;
+	uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL];
+	uintptr_t sizeClassCount = 0;
+	uint64_t elapsed = 0;
+
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		cellSizes[sizeClassCount] = sizeClasses->getCellSize(sizeClass);
+		sizeClassCount += 1;
+	}
+
+	extensions->allocationCacheRefillBatchCells = refillBatchCells;
+
+	for (uintptr_t round = 0; round < SEGREGATED_ALLOCATION_ROUNDS; round++) {
+		/* start each round from an empty heap, this also drops the cells returned at GC when batching is disabled */
+		if (OMR_ERROR_NONE != OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC)) {
+			return 0;
+		}
+
+		AllocationThreadArgs args;
+		args.omrVM = exampleVM->_omrVM;
+		args.monitor = NULL;
+		args.cellSizes = cellSizes;
+		args.sizeClassCount = sizeClassCount;
+		args.objectCount = objectsPerThread;
+		args.readyCount = 0;
+		args.doneCount = 0;
+		args.go = false;
+		args.failed = false;
+
+		if (0 != omrthread_monitor_init_with_name(&args.monitor, 0, "SegregatedAllocationPerfTest")) {
+			return 0;
+		}
+
+		uintptr_t started = 0;
+		for (; started < threadCount; started++) {
+			omrthread_t handle = NULL;
+			if (0 != omrthread_create(&handle, 0, J9THREAD_PRIORITY_NORMAL, 0, allocationThread, &args)) {
+				args.failed = true;
+				break;
+			}
+		}
+
+		omrthread_monitor_enter(args.monitor);
+		while (args.readyCount < started) {
+			omrthread_monitor_wait(args.monitor);
+		}
+		uint64_t startTime = omrtime_hires_clock();
+		args.go = true;
+		omrthread_monitor_notify_all(args.monitor);
+		while (args.doneCount < started) {
+			omrthread_monitor_wait(args.monitor);
+		}
+		uint64_t endTime = omrtime_hires_clock();
+		omrthread_monitor_exit(args.monitor);
+		omrthread_monitor_destroy(args.monitor);
+
+		if (args.failed) {
+			return 0;
+		}
+		elapsed += omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	}
+
+	return OMR_MAX(elapsed, 1);
+}
+
+TEST_P(SegregatedAllocationPerfTest, allocate)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_TRUE(extensions->isSegregatedHeap()) << "The benchmark requires GCPolicy=segregated.";
+
+	uintptr_t maxThreads = OMR_MAX(omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE), 4);
+	uintptr_t bytesPerRound = 0;
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		bytesPerRound += extensions->defaultSizeClasses->getCellSize(sizeClass);
+	}
+	uintptr_t savedRefillBatchCells = extensions->allocationCacheRefillBatchCells;
+
+	gcTestEnv->log("\n+++++++++++++++++++++++Segregated allocation+++++++++++++++++++++++\n");
+	gcTestEnv->log("%8s %16s %16s\n", "threads", "single objs/s", "batched objs/s");
+	for (uintptr_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+		/* the same total amount of memory is allocated for every thread count, over all the size classes */
+		uintptr_t objectsPerThread = ((SEGREGATED_ALLOCATION_RUN_BYTES / bytesPerRound) * OMR_SIZECLASSES_NUM_SMALL) / threadCount;
+		uint64_t singleTime = runAllocation(0, threadCount, objectsPerThread);
+		uint64_t batchedTime = runAllocation(SEGREGATED_ALLOCATION_BATCH_CELLS, threadCount, objectsPerThread);
+		extensions->allocationCacheRefillBatchCells = savedRefillBatchCells;
+		ASSERT_NE((uint64_t)0, singleTime) << "Allocation with single range refills failed with " << threadCount << " threads.";
+		ASSERT_NE((uint64_t)0, batchedTime) << "Allocation with batched refills failed with " << threadCount << " threads.";
+
+		uint64_t objects = (uint64_t)threadCount * objectsPerThread * SEGREGATED_ALLOCATION_ROUNDS;
+		gcTestEnv->log("%8zu %16llu %16llu\n", threadCount, (objects * 1000000) / singleTime, (objects * 1000000) / batchedTime);
+	}
+}
+
+INSTANTIATE_TEST_CASE_P(perfTest, SegregatedAllocationPerfTest,
+        ::testing::Values("perftest/gctest/configuration/segregatedAllocation_perf_config.xml"));
+
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
@@ -91,8 +91,14 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+						_useSegregatedGC = true;
+#else
+						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=segregated ignored, requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, optavgpause or segregated): %s\n", attr.value());
 						result = false;
 					}
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
@@ -101,12 +107,79 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+				} else if (0 == strcmp(attr.name(), "cardTableSummary")) {
+					extensions->cardTableSummary = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerWorkStealing")) {
+					extensions->scavengerWorkStealing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerWorkStealingDequeSize")) {
+					extensions->scavengerWorkStealingDequeSize = (uintptr_t)atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerHotFieldCopy")) {
+					extensions->scavengerHotFieldCopy = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerHotFieldCopyDepth")) {
+					extensions->scavengerHotFieldCopyDepth = (uintptr_t)atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerRememberedSetRanges")) {
+					extensions->scavengerRememberedSetRanges = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerRememberedSetRangeSize")) {
+					extensions->scavengerRememberedSetRangeSize = (uintptr_t)atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "rememberedSetDeduplicate")) {
+					extensions->rememberedSetDeduplicate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerForwardingTable")) {
+					extensions->scavengerForwardingTable = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "numaAwareNursery")) {
+					extensions->numaAwareNursery = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodeCount")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest((uintptr_t)atoi(attr.value()));
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+				} else if (0 == strcmp(attr.name(), "packetListLockFree")) {
+					extensions->packetListLockFree = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "workPacketCache")) {
+					extensions->workPacketCache = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "markingPrefetchDepth")) {
+					extensions->markingPrefetchDepth = (uintptr_t)atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "parallelClearMarkMap")) {
+					extensions->parallelClearMarkMap = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentClearMarkMap")) {
+					extensions->concurrentClearMarkMap = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "sizeClassFreeListPool")) {
+					extensions->sizeClassFreeListPool = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveSizing")) {
+					extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveRefreshInterval")) {
+					extensions->tlhAdaptiveRefreshInterval = (uintptr_t)atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "predictiveHeapSizing")) {
+					extensions->predictiveHeapSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "predictiveHeapSizingStabilizationCount")) {
+					extensions->predictiveHeapSizingStabilizationCount = (uintptr_t)atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "gcmetadataPageSize")) {
+					extensions->setGCMetadataPageSize((uintptr_t)atoi(attr.value()) * unitSize);
+				} else if (0 == strcmp(attr.name(), "objectStartIndex")) {
+					extensions->enableObjectStartIndex = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "allocationSamplingInterval")) {
+					extensions->allocationSamplingInterval = (uintptr_t)atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "asyncLogging")) {
+					extensions->asyncLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asyncLoggingBufferSize")) {
+					extensions->asyncLoggingBufferSize = (uintptr_t)atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "binaryLogging")) {
+					extensions->binaryLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "allocationCacheRefillBatchCells")) {
+					extensions->allocationCacheRefillBatchCells = (uintptr_t)atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "gcThreadCount")) {
+					extensions->gcThreadCount = (uintptr_t)atoi(attr.value());
+					extensions->gcThreadCountForced = true;
+				} else if (0 == strcmp(attr.name(), "adaptiveGCThreading")) {
+					extensions->adaptiveGCThreading = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveGCThreadingWorkPerThread")) {
+					extensions->adaptiveGCThreadingWorkPerThread = (uintptr_t)atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "gcThreadSpinCount")) {
+					extensions->gcThreadSpinCount = (uintptr_t)atoi(attr.value());
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
 					gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized option: %s\n", attr.name());
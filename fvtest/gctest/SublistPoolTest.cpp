@@ -0,0 +1,229 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "GCConfigTest.hpp"
+
+#include "SublistIterator.hpp"
+#include "SublistPool.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
+
+static const uintptr_t SUBLIST_POOL_TEST_BASE = 0x100000;
+static const uintptr_t SUBLIST_POOL_TEST_PUDDLE_SLOTS = 64;
+static const uintptr_t SUBLIST_POOL_TEST_ENTRIES = 1000;
+static const uintptr_t SUBLIST_POOL_TEST_DISTINCT = 300;
+static const uintptr_t SUBLIST_POOL_TEST_MAX_PUDDLES = 32;
+
+/**
+ * Checks the remembered set operations of MM_SublistPool: deduplication on compaction
+ * (-Xgc:rememberedSetDeduplicate) and processing in slot ranges (-Xgc:scavengerRememberedSetRanges).
+ * Entries are fake object addresses, which the pool never dereferences.
+ */
+class SublistPoolTest : public GCConfigTest
+{
+protected:
+	MM_SublistPool _pool;
+	uintptr_t _alignment;
+
+	virtual void
+	SetUp()
+	{
+		GCConfigTest::SetUp();
+		_alignment = env->getExtensions()->getObjectAlignmentInBytes();
+		ASSERT_TRUE(_pool.initialize(env, OMR::GC::AllocationCategory::REMEMBERED_SET));
+		_pool.setGrowSize(SUBLIST_POOL_TEST_PUDDLE_SLOTS * sizeof(uintptr_t));
+	}
+
+	virtual void
+	TearDown()
+	{
+		_pool.tearDown(env);
+		GCConfigTest::TearDown();
+	}
+
+	MMINLINE uintptr_t entryForIndex(uintptr_t index) { return SUBLIST_POOL_TEST_BASE + (index * _alignment); }
+	MMINLINE uintptr_t indexForEntry(uintptr_t entry) { return (entry - SUBLIST_POOL_TEST_BASE) / _alignment; }
+	void add(uintptr_t entry);
+	uintptr_t countEntries(uintptr_t *visits, uintptr_t visitCount);
+
+};
+
+void
+SublistPoolTest::add(uintptr_t entry)
+{
+	uintptr_t *slot = _pool.allocateElementNoContention(env);
+	ASSERT_TRUE(NULL != slot) << "Failed to allocate a sublist element.";
+	*slot = entry;
+}
+
+/**
+ * Count the non-NULL entries of the pool, and the number of times each entry below visitCount appears.
+ */
+uintptr_t
+SublistPoolTest::countEntries(uintptr_t *visits, uintptr_t visitCount)
+{
+	uintptr_t count = 0;
+	memset(visits, 0, visitCount * sizeof(uintptr_t));
+	GC_SublistIterator puddleIterator(&_pool);
+	MM_SublistPuddle *puddle = NULL;
+	while (NULL != (puddle = puddleIterator.nextList())) {
+		GC_SublistSlotIterator slotIterator(puddle);
+		uintptr_t *slot = NULL;
+		while (NULL != (slot = (uintptr_t *)slotIterator.nextSlot())) {
+			if (0 != *slot) {
+				count += 1;
+				uintptr_t index = indexForEntry(*slot);
+				if (index < visitCount) {
+					visits[index] += 1;
+				}
+			}
+		}
+	}
+	return count;
+}
+
+TEST_P(SublistPoolTest, deduplicate)
+{
+	uintptr_t visits[SUBLIST_POOL_TEST_DISTINCT * 2];
+
+	/* duplicates spread over all puddles, with NULL entries in between */
+	for (uintptr_t i = 0; i < SUBLIST_POOL_TEST_ENTRIES; i++) {
+		add((0 == (i % 17)) ? 0 : entryForIndex((i * 7) % SUBLIST_POOL_TEST_DISTINCT));
+		ASSERT_FALSE(HasFatalFailure());
+	}
+	_pool.compact(env, true);
+	EXPECT_EQ(SUBLIST_POOL_TEST_DISTINCT, countEntries(visits, SUBLIST_POOL_TEST_DISTINCT));
+	for (uintptr_t i = 0; i < SUBLIST_POOL_TEST_DISTINCT; i++) {
+		ASSERT_EQ((uintptr_t)1, visits[i]) << "Entry " << i << " is not held exactly once.";
+	}
+
+	/* the second compaction spans more entries, so the bitmap kept from the first one has to grow */
+	for (uintptr_t i = 0; i < SUBLIST_POOL_TEST_ENTRIES; i++) {
+		add(entryForIndex((i * 7) % (SUBLIST_POOL_TEST_DISTINCT * 2)));
+		ASSERT_FALSE(HasFatalFailure());
+	}
+	_pool.compact(env, true);
+	EXPECT_EQ(SUBLIST_POOL_TEST_DISTINCT * 2, countEntries(visits, SUBLIST_POOL_TEST_DISTINCT * 2));
+	for (uintptr_t i = 0; i < (SUBLIST_POOL_TEST_DISTINCT * 2); i++) {
+		ASSERT_EQ((uintptr_t)1, visits[i]) << "Entry " << i << " is not held exactly once after the second compaction.";
+	}
+
+	/* entries too far apart for a bitmap: only the NULL entries are removed */
+	_pool.clear(env);
+	uintptr_t farEntry = SUBLIST_POOL_TEST_BASE + ((UDATA_MAX / 2) & ~(_alignment - 1));
+	for (uintptr_t i = 0; i < 10; i++) {
+		add(entryForIndex(0));
+		add(0);
+		add(farEntry);
+		ASSERT_FALSE(HasFatalFailure());
+	}
+	_pool.compact(env, true);
+	EXPECT_EQ((uintptr_t)20, countEntries(visits, 1));
+	EXPECT_EQ((uintptr_t)10, visits[0]);
+
+	/* without deduplication the entries are left alone */
+	_pool.clear(env);
+	for (uintptr_t i = 0; i < 10; i++) {
+		add(entryForIndex(0));
+		ASSERT_FALSE(HasFatalFailure());
+	}
+	_pool.compact(env, false);
+	EXPECT_EQ((uintptr_t)10, countEntries(visits, 1));
+}
+
+TEST_P(SublistPoolTest, slotRanges)
+{
+	uintptr_t visits[SUBLIST_POOL_TEST_ENTRIES];
+	uintptr_t *puddleBases[SUBLIST_POOL_TEST_MAX_PUDDLES];
+	uintptr_t *puddleTops[SUBLIST_POOL_TEST_MAX_PUDDLES];
+	uintptr_t puddleCount = 0;
+
+	/* nothing to claim: the (empty) previous list is returned at once */
+	_pool.startProcessingSublist();
+	_pool.startProcessingSlotRanges(7);
+	MM_SublistPuddle *cursor = NULL;
+	uintptr_t cursorFirstRange = 0;
+	uintptr_t *rangeTop = NULL;
+	EXPECT_TRUE(NULL == _pool.popPreviousSlotRange(&cursor, &cursorFirstRange, &rangeTop));
+
+	for (uintptr_t i = 0; i < SUBLIST_POOL_TEST_ENTRIES; i++) {
+		add(entryForIndex(i));
+		ASSERT_FALSE(HasFatalFailure());
+	}
+	GC_SublistIterator puddleIterator(&_pool);
+	MM_SublistPuddle *puddle = NULL;
+	while (NULL != (puddle = puddleIterator.nextList())) {
+		ASSERT_GT(SUBLIST_POOL_TEST_MAX_PUDDLES, puddleCount);
+		GC_SublistSlotIterator slotIterator(puddle);
+		puddleBases[puddleCount] = (uintptr_t *)slotIterator.nextSlot();
+		puddleTops[puddleCount] = puddleBases[puddleCount] + (puddle->consumedSize() / sizeof(uintptr_t));
+		puddleCount += 1;
+	}
+	ASSERT_LT((uintptr_t)1, puddleCount);
+
+	/* 7 does not divide the puddle size, so the last range of each puddle is short and must not run into the next puddle.
+	 * Two cursors take turns, as two threads would.
+	 */
+	_pool.startProcessingSublist();
+	_pool.startProcessingSlotRanges(7);
+	memset(visits, 0, sizeof(visits));
+	MM_SublistPuddle *cursors[2] = { NULL, NULL };
+	uintptr_t cursorFirstRanges[2] = { 0, 0 };
+	uintptr_t ranges = 0;
+	uintptr_t *rangeBase = NULL;
+	while (NULL != (rangeBase = _pool.popPreviousSlotRange(&cursors[ranges & 1], &cursorFirstRanges[ranges & 1], &rangeTop))) {
+		ASSERT_LT(rangeBase, rangeTop);
+		ASSERT_GE((uintptr_t)7, (uintptr_t)(rangeTop - rangeBase));
+		bool withinPuddle = false;
+		for (uintptr_t p = 0; p < puddleCount; p++) {
+			withinPuddle |= (rangeBase >= puddleBases[p]) && (rangeTop <= puddleTops[p]);
+		}
+		ASSERT_TRUE(withinPuddle) << "Range " << ranges << " straddles a puddle boundary.";
+		for (uintptr_t *slot = rangeBase; slot < rangeTop; slot++) {
+			visits[indexForEntry(*slot)] += 1;
+		}
+		ranges += 1;
+		/* the puddles are only handed back once the last range is complete */
+		_pool.completePreviousSlotRange();
+	}
+	for (uintptr_t i = 0; i < SUBLIST_POOL_TEST_ENTRIES; i++) {
+		ASSERT_EQ((uintptr_t)1, visits[i]) << "Slot of entry " << i << " was not in exactly one range.";
+	}
+	EXPECT_EQ(SUBLIST_POOL_TEST_ENTRIES, countEntries(visits, SUBLIST_POOL_TEST_ENTRIES)) << "The puddles were not returned to the pool.";
+
+	/* the puddles can be processed again */
+	_pool.startProcessingSublist();
+	_pool.startProcessingSlotRanges(SUBLIST_POOL_TEST_PUDDLE_SLOTS);
+	ranges = 0;
+	cursor = NULL;
+	cursorFirstRange = 0;
+	while (NULL != _pool.popPreviousSlotRange(&cursor, &cursorFirstRange, &rangeTop)) {
+		ranges += 1;
+		_pool.completePreviousSlotRange();
+	}
+	EXPECT_EQ(puddleCount, ranges);
+	EXPECT_EQ(SUBLIST_POOL_TEST_ENTRIES, countEntries(visits, SUBLIST_POOL_TEST_ENTRIES));
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, SublistPoolTest,
+        ::testing::Values("fvtest/gctest/configuration/global_GC_config.xml"));
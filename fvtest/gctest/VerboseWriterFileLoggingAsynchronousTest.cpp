@@ -0,0 +1,264 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCConfigTest.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "omrgc.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseWriter.hpp"
+#include "VerboseWriterChain.hpp"
+
+/**
+ * Checks that the asynchronous verbose GC writer (-Xgc:asyncLogging) writes every cycle once the streams are
+ * closed, rotating between files at the end of the cycles, in XML or in the binary format (-Xgc:binaryLogging).
+ * The configuration without rotation uses a small buffer, so that some cycles may be dropped: these must be
+ * accounted for in comments and leave the XML well formed.
+ */
+class VerboseWriterFileLoggingAsynchronousTest : public GCConfigTest
+{
+protected:
+	bool decodeBinaryLog(const char *fileName, std::string *xml);
+	pugi::xml_parse_result loadLog(const char *fileName, pugi::xml_document *verboseDoc, unsigned int options);
+	uintptr_t countExclusiveEnds(pugi::xml_document *verboseDoc);
+	void verifyXMLFiles(uintptr_t gcCount);
+	void verifyDroppedCycles(uintptr_t gcCount);
+};
+
+static const uintptr_t ASYNCHRONOUS_LOGGING_TEST_GCS = 3;
+static const uintptr_t ASYNCHRONOUS_LOGGING_TEST_DROPPING_GCS = 1000;
+/* numOfCycles of global_GC_asynclogging_config.xml */
+static const uintptr_t ASYNCHRONOUS_LOGGING_TEST_CYCLES_PER_FILE = 2;
+
+/**
+ * Decode a binary log as the perftest decoder does, see VerboseBinaryFormat.hpp.
+ */
+bool
+VerboseWriterFileLoggingAsynchronousTest::decodeBinaryLog(const char *fileName, std::string *xml)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+
+	int64_t fileLength = omrfile_length(fileName);
+	if (fileLength < VERBOSEGC_BINARY_MAGIC_LENGTH) {
+		return false;
+	}
+	std::vector<uint8_t> contents((size_t)fileLength);
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0444);
+	intptr_t bytesRead = -1;
+	if (-1 != fd) {
+		bytesRead = omrfile_read(fd, &contents[0], (intptr_t)fileLength);
+		omrfile_close(fd);
+	}
+	if ((bytesRead != fileLength) || (0 != memcmp(&contents[0], VERBOSEGC_BINARY_MAGIC, VERBOSEGC_BINARY_MAGIC_LENGTH))) {
+		return false;
+	}
+
+	std::vector<std::string> formats;
+	uintptr_t offset = VERBOSEGC_BINARY_MAGIC_LENGTH;
+	while ((offset + sizeof(VerboseGCBinaryRecordHeader)) <= contents.size()) {
+		VerboseGCBinaryRecordHeader header;
+		memcpy(&header, &contents[offset], sizeof(header));
+		offset += sizeof(header);
+		const uint8_t *payload = &contents[offset];
+		uint32_t ids[2];
+		if (VERBOSEGC_BINARY_RECORD_TEXT == header.type) {
+			xml->append((const char *)payload, header.length);
+		} else if (VERBOSEGC_BINARY_RECORD_FORMAT == header.type) {
+			memcpy(ids, payload, sizeof(uint32_t));
+			/* each file defines its formats in order */
+			EXPECT_EQ(formats.size(), ids[0]);
+			formats.push_back(std::string((const char *)payload + sizeof(uint32_t), header.length - sizeof(uint32_t)));
+		} else if (VERBOSEGC_BINARY_RECORD_LINE == header.type) {
+			memcpy(ids, payload, sizeof(ids));
+			if (ids[0] >= formats.size()) {
+				return false;
+			}
+			const char *format = formats[ids[0]].c_str();
+			uintptr_t lineLength = MM_VerboseBinaryFormat::formatLine(gcTestEnv->portLib, NULL, 0, ids[1], format, payload + sizeof(ids), header.length - sizeof(ids));
+			std::vector<char> line(lineLength + 1);
+			MM_VerboseBinaryFormat::formatLine(gcTestEnv->portLib, &line[0], line.size(), ids[1], format, payload + sizeof(ids), header.length - sizeof(ids));
+			xml->append(&line[0], lineLength);
+		} else {
+			return false;
+		}
+		offset += header.length;
+	}
+	return offset == contents.size();
+}
+
+pugi::xml_parse_result
+VerboseWriterFileLoggingAsynchronousTest::loadLog(const char *fileName, pugi::xml_document *verboseDoc, unsigned int options)
+{
+	if (env->getExtensions()->binaryLogging) {
+		std::string xml;
+		if (!decodeBinaryLog(fileName, &xml)) {
+			pugi::xml_parse_result result;
+			result.status = pugi::status_io_error;
+			return result;
+		}
+		return verboseDoc->load_buffer(xml.c_str(), xml.length(), options);
+	}
+	return verboseDoc->load_file(fileName, options);
+}
+
+uintptr_t
+VerboseWriterFileLoggingAsynchronousTest::countExclusiveEnds(pugi::xml_document *verboseDoc)
+{
+	return verboseDoc->select_nodes("/verbosegc/exclusive-end").size();
+}
+
+void
+VerboseWriterFileLoggingAsynchronousTest::verifyXMLFiles(uintptr_t gcCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	uintptr_t gcs = 0;
+
+	for (uintptr_t seq = 1; seq <= numOfFiles; seq++) {
+		char currentVerboseFile[1024];
+		omrstr_printf(currentVerboseFile, sizeof(currentVerboseFile), "%s.%03zu", verboseFile, seq);
+		pugi::xml_document verboseDoc;
+		pugi::xml_parse_result result = loadLog(currentVerboseFile, &verboseDoc, pugi::parse_default);
+		ASSERT_TRUE(result) << "Failed to parse " << currentVerboseFile << ": " << result.description();
+		ASSERT_TRUE(verboseDoc.select_node("/verbosegc").node()) << currentVerboseFile << " has no verbosegc element.";
+
+		/* the cycles fill the files in order */
+		uintptr_t expected = OMR_MIN(gcCount - gcs, ASYNCHRONOUS_LOGGING_TEST_CYCLES_PER_FILE);
+		EXPECT_EQ(expected, countExclusiveEnds(&verboseDoc)) << "Unexpected number of cycles in " << currentVerboseFile;
+		gcs += expected;
+	}
+	EXPECT_EQ(gcCount, gcs);
+}
+
+void
+VerboseWriterFileLoggingAsynchronousTest::verifyDroppedCycles(uintptr_t gcCount)
+{
+	pugi::xml_document verboseDoc;
+	pugi::xml_parse_result result = loadLog(verboseFile, &verboseDoc, pugi::parse_default | pugi::parse_comments);
+	ASSERT_TRUE(result) << "Failed to parse " << verboseFile << ": " << result.description();
+	ASSERT_TRUE(verboseDoc.select_node("/verbosegc").node()) << verboseFile << " has no verbosegc element.";
+
+	/* <!-- n verbose GC cycles dropped --> */
+	uintptr_t droppedCycles = 0;
+	pugi::xpath_node_set comments = verboseDoc.select_nodes("/verbosegc/comment()");
+	for (pugi::xpath_node_set::const_iterator it = comments.begin(); it != comments.end(); ++it) {
+		const char *text = it->node().value();
+		if (NULL != strstr(text, "verbose GC cycles dropped")) {
+			droppedCycles += (uintptr_t)strtoul(text, NULL, 10);
+		}
+	}
+	uintptr_t cycles = countExclusiveEnds(&verboseDoc);
+	gcTestEnv->log("Asynchronous logging: %zu of %zu cycles dropped\n", droppedCycles, gcCount);
+	EXPECT_LT((uintptr_t)0, cycles) << "No cycle was written.";
+	EXPECT_EQ(gcCount, cycles + droppedCycles) << "Cycles are missing from the log.";
+}
+
+TEST_P(VerboseWriterFileLoggingAsynchronousTest, writeLog)
+{
+	MM_VerboseWriter *writer = verboseManager->getWriterChain()->getFirstWriter();
+	ASSERT_TRUE(NULL != writer);
+	ASSERT_EQ(VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS, writer->getType()) << "Configuration did not enable asynchronous logging.";
+
+	/* without rotation the log holds enough cycles to fill the buffer */
+	uintptr_t gcCount = (0 == numOfFiles) ? ASYNCHRONOUS_LOGGING_TEST_DROPPING_GCS : ASYNCHRONOUS_LOGGING_TEST_GCS;
+	for (uintptr_t i = 0; i < gcCount; i++) {
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	}
+
+	/* writes the records still queued and closes the current file */
+	verboseManager->closeStreams(env);
+
+	if (0 == numOfFiles) {
+		verifyDroppedCycles(gcCount);
+	} else {
+		verifyXMLFiles(gcCount);
+	}
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, VerboseWriterFileLoggingAsynchronousTest,
+        ::testing::Values("fvtest/gctest/configuration/global_GC_asynclogging_config.xml",
+                          "fvtest/gctest/configuration/global_GC_asynclogging_droppedcycles_config.xml",
+                          "fvtest/gctest/configuration/global_GC_binarylogging_config.xml"));
+
+/**
+ * Format a line in the pause as MM_VerboseWriterChain does, and from its encoded arguments as the asynchronous
+ * writer and the binary log decoder do, and check that both give the same text.
+ */
+static void
+verifyDeferredFormatting(uintptr_t indent, const char *format, ...)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	char expected[256];
+	char actual[256];
+	va_list args;
+
+	va_start(args, format);
+	uintptr_t expectedLength = 0;
+	for (uintptr_t i = 0; i < indent; ++i) {
+		expectedLength += omrstr_printf(expected + expectedLength, sizeof(expected) - expectedLength, "  ");
+	}
+	expectedLength += omrstr_vprintf(expected + expectedLength, sizeof(expected) - expectedLength, format, args);
+	expectedLength += omrstr_printf(expected + expectedLength, sizeof(expected) - expectedLength, "\n");
+
+	uintptr_t argumentsLength = MM_VerboseBinaryFormat::getEncodedArgumentsLength(format, args);
+	ASSERT_NE(UDATA_MAX, argumentsLength) << format;
+	std::vector<uint8_t> arguments(argumentsLength + 1);
+	MM_VerboseBinaryFormat::encodeArguments(format, args, &arguments[0]);
+	va_end(args);
+
+	uintptr_t actualLength = MM_VerboseBinaryFormat::formatLine(gcTestEnv->portLib, actual, sizeof(actual), indent, format, &arguments[0], argumentsLength);
+	EXPECT_EQ(expectedLength, actualLength) << format;
+	EXPECT_STREQ(expected, actual) << format;
+	EXPECT_EQ(actualLength, MM_VerboseBinaryFormat::formatLine(gcTestEnv->portLib, NULL, 0, indent, format, &arguments[0], argumentsLength)) << format;
+}
+
+static uintptr_t
+getEncodedArgumentsLength(const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	uintptr_t length = MM_VerboseBinaryFormat::getEncodedArgumentsLength(format, args);
+	va_end(args);
+	return length;
+}
+
+TEST(VerboseBinaryFormatTest, deferredFormatting)
+{
+	verifyDeferredFormatting(0, "<gc-start id=\"%zu\" type=\"%s\" contextid=\"%zu\" timestamp=\"%s\">", (size_t)4, "global", (size_t)3, "2019-01-01T00:00:00.000");
+	verifyDeferredFormatting(2, "<mem type=\"%s\" free=\"%zu\" total=\"%zu\" percent=\"%zu\" />", "tenure", (size_t)1048576, (size_t)4194304, (size_t)25);
+	verifyDeferredFormatting(1, "<gc-op timems=\"%llu.%03.3llu\" address=\"%p\" flags=\"%zx\" />", (uint64_t)12, (uint64_t)7, (void *)0x1234, (size_t)0xbeef);
+	verifyDeferredFormatting(1, "<ratio value=\"%.3f\" delta=\"%d\" count=\"%lu\" mark=\"%c\" />", 0.125, -3, (unsigned long)42, 'x');
+	verifyDeferredFormatting(0, "<!-- 100%% of %s, %s -->", "", (const char *)NULL);
+	verifyDeferredFormatting(3, "</gc-end>");
+
+	/* these are formatted in the pause */
+	EXPECT_EQ(UDATA_MAX, getEncodedArgumentsLength("%*d", 4, 1));
+	EXPECT_EQ(UDATA_MAX, getEncodedArgumentsLength("%1$d", 1));
+	EXPECT_EQ(UDATA_MAX, getEncodedArgumentsLength("%jd", (intmax_t)1));
+	EXPECT_EQ(UDATA_MAX, getEncodedArgumentsLength("100%"));
+}
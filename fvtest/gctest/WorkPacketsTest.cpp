@@ -0,0 +1,189 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "GCConfigTest.hpp"
+
+#include "omrmodroncore.h"
+
+#include "AtomicOperations.hpp"
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
+#include "Packet.hpp"
+#include "ParallelTask.hpp"
+#include "WorkPacketsStandard.hpp"
+
+/**
+ * Checks the lock-free work packet lists (-Xgc:packetListLockFree) and the per-thread packet cache
+ * (-Xgc:workPacketCache): GC threads exchange tagged entries through the packets, each thread keeps the
+ * packet it just filled or emptied instead of returning it to the shared lists, and every entry comes out
+ * of the packets exactly once.
+ */
+class WorkPacketsTest : public GCConfigTest
+{
+protected:
+	struct ExchangeState {
+		MM_WorkPackets *workPackets;
+		uintptr_t iterations;
+		volatile uintptr_t pushedCount;
+		volatile uintptr_t pushedSum;
+		volatile uintptr_t poppedCount;
+		volatile uintptr_t poppedSum;
+		volatile uintptr_t fullPacketsCached;
+		volatile uintptr_t emptyPacketsCached;
+		volatile uintptr_t threadCount;
+		volatile bool failed;
+	};
+
+	class ExchangeTask : public MM_ParallelTask
+	{
+	private:
+		ExchangeState *_state;
+
+	public:
+		virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_MARK; }
+		virtual void run(MM_EnvironmentBase *env);
+
+		ExchangeTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, ExchangeState *state)
+			: MM_ParallelTask(env, dispatcher)
+			, _state(state)
+		{
+			_typeId = __FUNCTION__;
+		}
+	};
+};
+
+static const uintptr_t WORK_PACKETS_TEST_ITERATIONS = 2000;
+
+void
+WorkPacketsTest::ExchangeTask::run(MM_EnvironmentBase *env)
+{
+	MM_WorkPackets *workPackets = _state->workPackets;
+	/* tags are unique across threads, and never look like NULL */
+	uintptr_t tag = ((env->getSlaveID() * _state->iterations * 1024) + 1) * sizeof(uintptr_t);
+	uintptr_t pushedCount = 0;
+	uintptr_t pushedSum = 0;
+	uintptr_t poppedCount = 0;
+	uintptr_t poppedSum = 0;
+	uintptr_t fullPacketsCached = 0;
+	uintptr_t emptyPacketsCached = 0;
+
+	for (uintptr_t i = 0; i < _state->iterations; i++) {
+		MM_Packet *packet = workPackets->getOutputPacket(env);
+		if (NULL == packet) {
+			_state->failed = true;
+			break;
+		}
+
+		/* alternate between full packets, which the thread keeps as its next input, and packets with a single
+		 * entry, which go to the shared lists for any thread to take
+		 */
+		do {
+			packet->push(env, (void *)tag);
+			pushedCount += 1;
+			pushedSum += tag;
+			tag += sizeof(uintptr_t);
+		} while ((0 == (i % 2)) && !packet->isFull(env));
+		bool full = packet->isFull(env);
+		workPackets->putOutputPacket(env, packet);
+		if (full && (packet == env->_cachedFullPacket)) {
+			fullPacketsCached += 1;
+		}
+
+		packet = workPackets->getInputPacketNoWait(env);
+		if (NULL != packet) {
+			void *entry = NULL;
+			while (NULL != (entry = packet->pop(env))) {
+				poppedCount += 1;
+				poppedSum += (uintptr_t)entry;
+			}
+			uintptr_t emptyPacketCount = workPackets->getEmptyPacketCount();
+			workPackets->putPacket(env, packet);
+			if ((packet == env->_cachedEmptyPacket) && (emptyPacketCount == workPackets->getEmptyPacketCount())) {
+				emptyPacketsCached += 1;
+			}
+		}
+	}
+	workPackets->flushPacketCache(env);
+
+	MM_AtomicOperations::add(&_state->pushedCount, pushedCount);
+	MM_AtomicOperations::add(&_state->pushedSum, pushedSum);
+	MM_AtomicOperations::add(&_state->poppedCount, poppedCount);
+	MM_AtomicOperations::add(&_state->poppedSum, poppedSum);
+	MM_AtomicOperations::add(&_state->fullPacketsCached, fullPacketsCached);
+	MM_AtomicOperations::add(&_state->emptyPacketsCached, emptyPacketsCached);
+	MM_AtomicOperations::add(&_state->threadCount, 1);
+}
+
+TEST_P(WorkPacketsTest, exchangeThroughCache)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_TRUE(extensions->packetListLockFree) << "Configuration did not enable lock-free packet lists.";
+	ASSERT_TRUE(extensions->workPacketCache) << "Configuration did not enable the work packet cache.";
+
+	MM_WorkPackets *workPackets = MM_WorkPacketsStandard::newInstance(env);
+	ASSERT_TRUE(NULL != workPackets) << "Failed to create the work packets.";
+
+	ExchangeState state;
+	state.workPackets = workPackets;
+	state.iterations = WORK_PACKETS_TEST_ITERATIONS;
+	state.pushedCount = 0;
+	state.pushedSum = 0;
+	state.poppedCount = 0;
+	state.poppedSum = 0;
+	state.fullPacketsCached = 0;
+	state.emptyPacketsCached = 0;
+	state.threadCount = 0;
+	state.failed = false;
+
+	env->acquireExclusiveVMAccess();
+	ExchangeTask exchangeTask(env, extensions->dispatcher, &state);
+	extensions->dispatcher->run(env, &exchangeTask);
+	env->releaseExclusiveVMAccess();
+
+	/* entries left in the shared lists once every thread stopped taking input */
+	MM_Packet *packet = NULL;
+	while (NULL != (packet = workPackets->getInputPacketNoWait(env))) {
+		void *entry = NULL;
+		while (NULL != (entry = packet->pop(env))) {
+			state.poppedCount += 1;
+			state.poppedSum += (uintptr_t)entry;
+		}
+		workPackets->putPacket(env, packet);
+	}
+
+	ASSERT_FALSE(state.failed) << "A GC thread could not get an output packet.";
+	EXPECT_EQ(state.pushedCount, state.poppedCount) << "Entries were lost or taken twice.";
+	EXPECT_EQ(state.pushedSum, state.poppedSum) << "Entries were lost or taken twice.";
+	EXPECT_TRUE(workPackets->isAllPacketsEmpty()) << "Packets were not returned to the empty list.";
+
+	/* a thread keeps every full packet it puts while no thread waits for input */
+	uintptr_t fullPackets = state.threadCount * ((state.iterations + 1) / 2);
+	EXPECT_EQ(fullPackets, state.fullPacketsCached) << "Full packets were not kept in the packet cache.";
+	EXPECT_LT((uintptr_t)0, state.emptyPacketsCached) << "Empty packets were not kept in the packet cache.";
+	gcTestEnv->log("Work packets: %zu threads, %zu entries, %zu full and %zu empty packets cached\n",
+			state.threadCount, state.pushedCount, state.fullPacketsCached, state.emptyPacketsCached);
+
+	workPackets->kill(env);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, WorkPacketsTest,
+        ::testing::Values("fvtest/gctest/configuration/global_GC_lockfree_config.xml"));
@@ -74,6 +74,7 @@ protected:
 	bool  _collectAndClimb;
 	bool  _climb;				/* indicates that current attempt to allocate should try parent, if current subspace failed */
 	bool  _completedFromTlh;
+	void *_sampledAllocation; /**< heap bytes of the object picked by allocation sampling, NULL if no object was sampled */
 
 public:
 
@@ -207,6 +208,26 @@ public:
 	MMINLINE bool isCompletedFromTlh() { return _completedFromTlh; }
 	MMINLINE void completedFromTlh() { _completedFromTlh = true; }
 
+	MMINLINE void *getSampledAllocation() { return _sampledAllocation; }
+	MMINLINE void setSampledAllocation(void *heapBytes) { _sampledAllocation = heapBytes; }
+
+	/**
+	 * Clear the outcome of a previous allocation so that the description can be reused for
+	 * another allocation of the same size.
+	 */
+	MMINLINE void
+	resetAllocationResult()
+	{
+		_allocationSucceeded = false;
+		_allocationTaxSize = 0;
+		_tlhAllocation = false;
+		_nurseryAllocation = false;
+		_loaAllocation = false;
+		_climb = false;
+		_completedFromTlh = false;
+		_sampledAllocation = NULL;
+	}
+
 	/**
 	 * Set whether the allocation succeeded
 	 * @param suceeded - true if the allocation succeeded, false otherwise
@@ -245,6 +266,7 @@ public:
 		, _collectAndClimb(collectAndClimb)
 		, _climb(false)
 		, _completedFromTlh(false)
+		, _sampledAllocation(NULL)
 	{}
 };
 
@@ -230,6 +230,9 @@ public:
 					_allocateDescription.payAllocationTax(env);
 					env->restoreObjects(&objectPtr);
 #endif /* OMR_GC_ALLOCATION_TAX */
+					if (NULL != _allocateDescription.getSampledAllocation()) {
+						env->reportObjectAllocationSampled(objectPtr, _allocateDescription.getContiguousBytes());
+					}
 				}
 			}
 		}
@@ -245,6 +248,114 @@ public:
 		return objectPtr;
 	}
 
+	/**
+	 * Batch allocator and initializer for objects of the requested size. Objects are allocated
+	 * in contiguous runs carved from the thread's allocation cache (TLH), refreshing it as needed,
+	 * and each run is zeroed at once and then initialized object by object through
+	 * GC_ObjectModel::initializeAllocation(), as for allocateAndInitializeObject().
+	 *
+	 * The allocated objects are not reachable by the collector until the caller links them, so
+	 * only the allocation of the first run may start a garbage collection cycle. Later runs are
+	 * allocated without collecting (and, when allocation tax is paid, only from the current cache),
+	 * so fewer than count objects may be returned; the caller should link the objects it received
+	 * before asking for more. Indexable objects are not supported.
+	 *
+	 * @param[in] omrVMThread the calling thread
+	 * @param[out] objects receives the allocated objects, in address order within each run
+	 * @param[in] count number of objects to allocate
+	 * @return number of objects allocated and initialized
+	 */
+	MMINLINE uintptr_t
+	allocateAndInitializeObjects(OMR_VMThread *omrVMThread, omrobjectptr_t *objects, uintptr_t count)
+	{
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		GC_ObjectModel *objectModel = &(extensions->objectModel);
+
+		uintptr_t vmState = env->pushVMstate(OMRVMSTATE_GC_ALLOCATE_OBJECT);
+
+		Assert_MM_true(_allocateDescription.shouldCollectAndClimb() == isGCAllowed());
+		Assert_MM_true(!isIndexable());
+
+		if (isAllocatable()) {
+			setAllocatable(isGCAllowed() || env->_objectAllocationInterface->cachedAllocationsEnabled(env));
+		}
+
+		uintptr_t allocated = 0;
+		if (isAllocatable()) {
+			_allocateDescription.setBytesRequested(objectModel->adjustSizeInBytes(_allocateDescription.getBytesRequested()));
+			uintptr_t objectSize = _allocateDescription.getContiguousBytes();
+			bool initializationFailed = false;
+
+			while (!initializationFailed && (allocated < count)) {
+				bool firstRun = (0 == allocated);
+				uintptr_t runCount = 0;
+
+				_allocateDescription.resetAllocationResult();
+				uint8_t *heapBytes = (uint8_t *)env->_objectAllocationInterface->allocateObjects(env, &_allocateDescription,
+						_allocateDescription.getMemorySpace(), count - allocated, &runCount,
+						firstRun && isGCAllowed(), !firstRun && extensions->payAllocationTax);
+				if (NULL == heapBytes) {
+					break;
+				}
+
+				/* wipe the whole run at once if requested and allowed (NON_ZERO_TLH flag set inhibits zeroing) */
+				if (shouldZeroMemory(env)) {
+					OMRZeroMemory(heapBytes, runCount * objectSize);
+				}
+
+				omrobjectptr_t objectPtr = NULL;
+				uintptr_t sampledIndex = count;
+				for (uintptr_t i = 0; i < runCount; i++) {
+					void *objectBytes = (void *)(heapBytes + (i * objectSize));
+#if defined(OMR_VALGRIND_MEMCHECK)
+					valgrindMempoolAlloc(extensions, (uintptr_t)objectBytes, objectSize);
+#endif /* defined(OMR_VALGRIND_MEMCHECK) */
+					objectModel->setObjectFlags((omrobjectptr_t)objectBytes, OMR_OBJECT_METADATA_FLAGS_MASK, _allocateDescription.getObjectFlags());
+					objectPtr = objectModel->initializeAllocation(env, objectBytes, this);
+					/* if object model initialization fails the rest of the run will become floating garbage to be recovered in next GC */
+					if (NULL == objectPtr) {
+						initializationFailed = true;
+						break;
+					}
+					if (objectBytes == _allocateDescription.getSampledAllocation()) {
+						sampledIndex = allocated;
+					}
+					objects[allocated] = objectPtr;
+					allocated += 1;
+				}
+
+				/* in case the objects escape to another thread... */
+				MM_AtomicOperations::writeBarrier();
+
+#if defined(OMR_GC_ALLOCATION_TAX)
+				if (firstRun && (0 < allocated) && (0 != _allocateDescription.getAllocationTaxSize())) {
+					/* a run that incurred tax holds a single object (see MM_TLHAllocationSupport::allocateObjectsFromTLH()) - save it in case of GC */
+					Assert_MM_true(!extensions->payAllocationTax || (1 == runCount));
+					env->saveObjects(objects[0]);
+					_allocateDescription.payAllocationTax(env);
+					env->restoreObjects(&objects[0]);
+				}
+#endif /* OMR_GC_ALLOCATION_TAX */
+
+				if (sampledIndex < allocated) {
+					env->reportObjectAllocationSampled(objects[sampledIndex], objectSize);
+				}
+			}
+			_allocateDescription.setAllocationSucceeded(0 != allocated);
+		}
+
+		if (isGCAllowed()) {
+			/* issue Allocation Failure Report if required */
+			env->allocationFailureEndReportIfRequired(&_allocateDescription);
+			/* Done allocation - successful or not */
+			env->unwindExclusiveVMAccessForGC();
+		}
+		env->popVMstate(vmState);
+
+		return allocated;
+	}
+
 	/**
 	 * Constructor. Properties set here are used to preset defaults in the
 	 * MM_AllocationDescription instance that will be passed to the allocation
@@ -29,6 +29,7 @@
 #include "GCExtensionsBase.hpp"
 #include "EnvironmentBase.hpp"
 #include "Heap.hpp"
+#include "HeapMapScanner.hpp"
 #include "HeapRegionManager.hpp"
 #include "MemoryManager.hpp"
 #include "HeapRegionDescriptor.hpp"
@@ -47,7 +48,7 @@ MM_CardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 	
 	/* Instantiate the Virtual Memory object for the card table */
 	MM_MemoryManager *memoryManager = extensions->memoryManager;
-	if (memoryManager->createVirtualMemoryForMetadata(env, &_cardTableMemoryHandle, extensions->heapAlignment, cardTableSizeRequired)) {
+	if (memoryManager->createVirtualMemoryForMetadata(env, &_cardTableMemoryHandle, extensions->heapAlignment, cardTableSizeRequired, "cardTable")) {
 		_cardTableStart = (Card *)(memoryManager->getHeapBase(&_cardTableMemoryHandle));
 		/* Initialize _heapbase; we will reset _heapAlloc in heapAddRange()/heapRemoveRange() as heap changes */
 		_heapBase = (void *)heap->getHeapBase();
@@ -71,6 +72,32 @@ MM_CardTable::tearDown(MM_EnvironmentBase *env)
 	MM_MemoryManager *memoryManager = extensions->memoryManager;
 	/* Get rid of the virtual memory allocated for card table */
 	memoryManager->destroyVirtualMemory(env, &_cardTableMemoryHandle);
+
+	if (NULL != _cardSummary) {
+		env->getForge()->free(_cardSummary);
+		_cardSummary = NULL;
+	}
+}
+
+bool
+MM_CardTable::initializeCardSummary(MM_EnvironmentBase *env, uintptr_t cardTableSize)
+{
+	/* the summary is scanned a slot at a time, so round up to whole slots */
+	uintptr_t summaryBits = MM_Math::roundToCeiling(CARDS_PER_CARD_SUMMARY_BIT, cardTableSize / sizeof(Card)) >> CARD_SUMMARY_SHIFT;
+	_cardSummarySize = (MM_Math::roundToCeiling(J9BITS_BITS_IN_SLOT, summaryBits) / J9BITS_BITS_IN_SLOT) * sizeof(uintptr_t);
+	_cardSummary = (uintptr_t *)env->getForge()->allocate(_cardSummarySize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != _cardSummary) {
+		memset((void *)_cardSummary, 0, _cardSummarySize);
+	}
+	return NULL != _cardSummary;
+}
+
+void
+MM_CardTable::clearCardSummary(MM_EnvironmentBase *env)
+{
+	if (NULL != _cardSummary) {
+		memset((void *)_cardSummary, 0, _cardSummarySize);
+	}
 }
 
 uintptr_t
@@ -257,6 +284,7 @@ MM_CardTable::dirtyCardWithValue(MM_EnvironmentBase *env, omrobjectptr_t objectR
 			Assert_MM_true((CARD_DIRTY == newValue) || (CARD_CLEAN == oldValue));
 			*card = newValue;
 		}
+		dirtyCardSummary(card);
 	}
 }
 
@@ -271,6 +299,7 @@ MM_CardTable::dirtyCardRange(MM_EnvironmentBase *env, void *heapAddrFrom, void *
 		if ((Card)CARD_DIRTY != *card) {
 			*card = (Card)CARD_DIRTY;
 		}
+		dirtyCardSummary(card);
 	}
 }
 
@@ -386,6 +415,77 @@ MM_CardTable::clearCardsInRange(MM_EnvironmentBase *env, void* heapBase, void* h
 	return sizeToClear;
 }
 
+Card *
+MM_CardTable::skipCleanCardSummaryBlocks(Card *card, Card *topCard)
+{
+	uintptr_t blockIndex = ((uintptr_t)(card - _cardTableStart)) >> CARD_SUMMARY_SHIFT;
+	uintptr_t *summarySlot = &_cardSummary[blockIndex / J9BITS_BITS_IN_SLOT];
+	uintptr_t bitIndex = blockIndex % J9BITS_BITS_IN_SLOT;
+	uintptr_t summaryBits = *summarySlot;
+
+	if (0 != (summaryBits & ((uintptr_t)1 << bitIndex))) {
+		/* the block containing card has been dirtied */
+		return card;
+	}
+
+	/* look for a later dirtied block in this slot, then skip empty slots in bulk */
+	summaryBits &= ~(((uintptr_t)1 << bitIndex) - 1);
+	if (0 == summaryBits) {
+		uintptr_t topBlockIndex = (((uintptr_t)(topCard - _cardTableStart)) + CARDS_PER_CARD_SUMMARY_BIT - 1) >> CARD_SUMMARY_SHIFT;
+		uintptr_t *topSummarySlot = &_cardSummary[(topBlockIndex + J9BITS_BITS_IN_SLOT - 1) / J9BITS_BITS_IN_SLOT];
+		summarySlot = MM_HeapMapScanner::skipEmptyWords(summarySlot + 1, topSummarySlot);
+		if (summarySlot >= topSummarySlot) {
+			return topCard;
+		}
+		summaryBits = *summarySlot;
+	}
+
+	blockIndex = ((uintptr_t)(summarySlot - _cardSummary) * J9BITS_BITS_IN_SLOT) + MM_Bits::leadingZeroes(summaryBits);
+	Card *blockCard = _cardTableStart + (blockIndex << CARD_SUMMARY_SHIFT);
+	return (blockCard < topCard) ? blockCard : topCard;
+}
+
+Card *
+MM_CardTable::findFirstUncleanCard(MM_EnvironmentBase *env, Card *card, Card *topCard)
+{
+	while (card < topCard) {
+		Card *scanTop = topCard;
+		if (NULL != _cardSummary) {
+			uintptr_t blockIndex = ((uintptr_t)(card - _cardTableStart)) >> CARD_SUMMARY_SHIFT;
+			card = skipCleanCardSummaryBlocks(card, topCard);
+			if (card >= topCard) {
+				uintptr_t topBlockIndex = ((uintptr_t)(topCard - _cardTableStart) + CARDS_PER_CARD_SUMMARY_BIT - 1) >> CARD_SUMMARY_SHIFT;
+				env->_cardCleaningStats._cardSummaryBlocksSkipped += topBlockIndex - blockIndex;
+				break;
+			}
+			env->_cardCleaningStats._cardSummaryBlocksSkipped += (((uintptr_t)(card - _cardTableStart)) >> CARD_SUMMARY_SHIFT) - blockIndex;
+			/* only scan to the end of this block so the next block's summary bit gets a chance to skip it */
+			Card *blockTop = _cardTableStart + MM_Math::roundToCeiling(CARDS_PER_CARD_SUMMARY_BIT, (uintptr_t)(card + 1 - _cardTableStart));
+			scanTop = (blockTop < topCard) ? blockTop : topCard;
+		}
+
+		/* card at a time up to a slot boundary... */
+		while ((card < scanTop) && ((Card)CARD_CLEAN == *card) && (0 != ((uintptr_t)card % sizeof(uintptr_t)))) {
+			card += 1;
+		}
+		if ((card < scanTop) && ((Card)CARD_CLEAN == *card)) {
+			/* ...then a slot of cards at a time (CARD_CLEAN is 0) and card at a time for the remainder */
+			uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)scanTop);
+			card = (Card *)MM_HeapMapScanner::skipEmptyWords((uintptr_t *)card, lastSlot);
+			while ((card < scanTop) && ((Card)CARD_CLEAN == *card)) {
+				card += 1;
+			}
+		}
+
+		if (card < scanTop) {
+			return card;
+		}
+		card = scanTop;
+	}
+
+	return topCard;
+}
+
 void
 MM_CardTable::kill(MM_EnvironmentBase *env)
 {
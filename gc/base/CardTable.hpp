@@ -33,7 +33,9 @@
 #include "omrmodroncore.h"
 #include "modronbase.h"
 
+#include "AtomicOperations.hpp"
 #include "BaseVirtual.hpp"
+#include "Bits.hpp"
 #include "MemoryManager.hpp"
 
 class MM_EnvironmentBase;
@@ -46,6 +48,17 @@ class MM_HeapRegionDescriptor;
  * @ingroup GC_Base
  */
 
+/**
+ * @ingroup GC_Base
+ * @name Card summary constants
+ * @{
+ */
+#define CARD_SUMMARY_SHIFT 9 /**< log2 of the number of cards described by one card summary bit */
+#define CARDS_PER_CARD_SUMMARY_BIT ((uintptr_t)1 << CARD_SUMMARY_SHIFT)
+/**
+ * @}
+ */
+
 /**
  * @todo Provide class documentation
  * @warn All card table functions assume EXCLUSIVE ranges, ie they take a base and top card where base card
@@ -62,7 +75,14 @@ private:
 	Card *_cardTableStart;
 	Card *_cardTableVirtualStart;
 	void *_heapBase; 
+	uintptr_t *_cardSummary; /**< one bit per CARDS_PER_CARD_SUMMARY_BIT cards, set when any of those cards is dirtied (NULL if there is no summary) */
+	uintptr_t _cardSummarySize; /**< size of _cardSummary in bytes */
 
+	/**
+	 * Find the first card in [card, topCard) whose summary bit is set.
+	 * @return card if its own summary bit is set, otherwise the first card of the next block with its summary bit set or topCard
+	 */
+	Card *skipCleanCardSummaryBlocks(Card *card, Card *topCard);
 
 public:
 
@@ -206,6 +226,22 @@ public:
 	 * @return true if memory might be released 
 	 */
 	bool canMemoryBeReleased(MM_EnvironmentBase *env, void *low, void *high);
+
+	/**
+	 * Find the first card in [card, topCard) which is not clean. Runs of clean cards are skipped a word at a time
+	 * using the bulk heap map scanner, and if the card table has a summary, whole blocks of cards which have not
+	 * been dirtied since the summary was last cleared are skipped without reading their cards.
+	 * @param[in] env The current thread, whose card cleaning stats count the skipped blocks
+	 * @param[in] card The first card to examine
+	 * @param[in] topCard The card after the last card to examine
+	 * @return The first card in the range with a value other than CARD_CLEAN, or topCard if there is none
+	 */
+	Card *findFirstUncleanCard(MM_EnvironmentBase *env, Card *card, Card *topCard);
+
+	/**
+	 * @return true if the card table maintains a summary of dirtied card blocks
+	 */
+	bool hasCardSummary() { return NULL != _cardSummary; };
 	
 	/**
 	 * Free the card table instance.
@@ -257,6 +293,42 @@ protected:
 	 * @return false if the decommit failed
 	 */
 	bool decommitCardTableMemory(MM_EnvironmentBase *env, Card *lowCard, Card *highCard, Card *lowValidCard, Card *highValidCard);
+
+	/**
+	 * Allocate the card summary, one bit for every CARDS_PER_CARD_SUMMARY_BIT cards of the card table.
+	 * Once the summary exists every path which dirties a card must also call dirtyCardSummary().
+	 * @param[in] env The thread initializing the card table
+	 * @param[in] cardTableSize The size, in bytes, of the card table for the maximum heap size
+	 * @return false if the summary could not be allocated
+	 */
+	bool initializeCardSummary(MM_EnvironmentBase *env, uintptr_t cardTableSize);
+
+	/**
+	 * Clear the whole card summary. Blocks dirtied afterwards will set their bits again.
+	 * @note The caller must ensure that cards which are dirty at this point are not needed, or are cleared as well
+	 */
+	void clearCardSummary(MM_EnvironmentBase *env);
+
+	/**
+	 * Record in the card summary that a card in the block containing card has been dirtied.
+	 * The summary bit is only tested after the card itself has been stored, and is updated only if it is
+	 * not already set, so repeated stores into a dirtied block cost a single load.
+	 * @param[in] card The card which has been dirtied
+	 */
+	MMINLINE void
+	dirtyCardSummary(Card *card)
+	{
+		if (NULL != _cardSummary) {
+			uintptr_t blockIndex = ((uintptr_t)(card - _cardTableStart)) >> CARD_SUMMARY_SHIFT;
+			volatile uintptr_t *summarySlot = &_cardSummary[blockIndex / J9BITS_BITS_IN_SLOT];
+			uintptr_t summaryBit = (uintptr_t)1 << (blockIndex % J9BITS_BITS_IN_SLOT);
+			uintptr_t oldValue = *summarySlot;
+			while (0 == (oldValue & summaryBit)) {
+				MM_AtomicOperations::lockCompareExchange(summarySlot, oldValue, oldValue | summaryBit);
+				oldValue = *summarySlot;
+			}
+		}
+	}
 	
 	/**
 	 * Create a CardTable object.
@@ -268,6 +340,8 @@ protected:
 		, _cardTableStart(NULL)
 		, _cardTableVirtualStart(NULL)
 		, _heapBase(NULL)
+		, _cardSummary(NULL)
+		, _cardSummarySize(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -215,6 +215,11 @@ public:
 
 	virtual void scanThread(MM_EnvironmentBase* env) {};
 
+	/**
+	 * Called by the environment once it holds exclusive access for a GC, just before the allocation caches are flushed.
+	 */
+	virtual void preFlushCachesForGC(MM_EnvironmentBase* env) {};
+
 	virtual void payAllocationTax(MM_EnvironmentBase* env, MM_MemorySubSpace* subspace,
 								  MM_MemorySubSpace* baseSubSpace, MM_AllocateDescription* allocDescription);
 
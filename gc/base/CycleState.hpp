@@ -92,6 +92,37 @@ public:
 
 	uintptr_t _referenceObjectOptions; /**< A bitmask controlling how Reference objects are treated during marking */
 
+	enum {
+		dispatchRecordMaximum = 8 /**< number of dispatched tasks recorded per cycle for verbose GC */
+	};
+
+	/**
+	 * Thread count chosen for a task dispatched during the cycle, with adaptive GC threading.
+	 */
+	struct DispatchRecord {
+		const char *_taskName; /**< type of the task */
+		uintptr_t _estimatedWork; /**< bytes of work the task estimated, or 0 if it could not */
+		uintptr_t _availableThreads; /**< threads the task would have used without an estimate */
+		uintptr_t _threadCount; /**< threads the task was dispatched to */
+	} _dispatchRecords[dispatchRecordMaximum];
+	uintptr_t _dispatchRecordCount; /**< number of valid entries in _dispatchRecords */
+
+	/**
+	 * Record the thread count chosen for a task, unless dispatchRecordMaximum tasks were already recorded in the cycle.
+	 */
+	void
+	recordDispatch(const char *taskName, uintptr_t estimatedWork, uintptr_t availableThreads, uintptr_t threadCount)
+	{
+		if (_dispatchRecordCount < dispatchRecordMaximum) {
+			DispatchRecord *record = &_dispatchRecords[_dispatchRecordCount];
+			record->_taskName = taskName;
+			record->_estimatedWork = estimatedWork;
+			record->_availableThreads = availableThreads;
+			record->_threadCount = threadCount;
+			_dispatchRecordCount += 1;
+		}
+	}
+
 public:
 	MM_CycleState()
 		: _gcCode(J9MMCONSTANT_IMPLICIT_GC_DEFAULT)
@@ -110,6 +141,7 @@ public:
 		, _type(OMR_GC_CYCLE_TYPE_DEFAULT)
 		, _verboseContextID(0)
 		, _referenceObjectOptions(references_default)
+		, _dispatchRecordCount(0)
 	{
 	}
 };
@@ -119,6 +119,38 @@ MM_EnvironmentBase::initialize(MM_GCExtensionsBase *extensions)
 	return _delegate.initialize(this);
 }
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+uintptr_t
+MM_EnvironmentBase::getNurseryNumaNode()
+{
+	if (UDATA_MAX == _nurseryNumaNode) {
+		MM_GCExtensionsBase *extensions = getExtensions();
+		uintptr_t nodeCount = extensions->numaAwareNurseryNodeCount;
+
+		_nurseryNumaNode = 0;
+		if (0 != nodeCount) {
+			if (extensions->_numaManager.isPhysicalNUMASupported()) {
+				/* find the affinity leader the thread is bound to, if any */
+				uintptr_t j9NodeNumber = (NULL != _omrVMThread) ? getNumaAffinity() : 0;
+				if (0 != j9NodeNumber) {
+					uintptr_t leaderCount = 0;
+					J9MemoryNodeDetail const *leaders = extensions->_numaManager.getAffinityLeaders(&leaderCount);
+					for (uintptr_t i = 0; i < OMR_MIN(leaderCount, nodeCount); i++) {
+						if (leaders[i].j9NodeNumber == j9NodeNumber) {
+							_nurseryNumaNode = i + 1;
+							break;
+						}
+					}
+				}
+			} else {
+				_nurseryNumaNode = (getEnvironmentId() % nodeCount) + 1;
+			}
+		}
+	}
+	return _nurseryNumaNode;
+}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
 void
 MM_EnvironmentBase::tearDown(MM_GCExtensionsBase *extensions)
 {
@@ -269,6 +301,24 @@ MM_EnvironmentBase::allocationFailureStartReportIfRequired(MM_AllocateDescriptio
 	}
 }
 
+void
+MM_EnvironmentBase::reportObjectAllocationSampled(omrobjectptr_t object, uintptr_t size)
+{
+	MM_GCExtensionsBase *extensions = getExtensions();
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	Trc_OMRMM_ObjectAllocationSampled(getOmrVMThread(), object, size);
+	_objectAllocationInterface->getAllocationStats()->_allocationSampleCount += 1;
+
+	TRIGGER_J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE(
+		extensions->omrHookInterface,
+		getOmrVMThread(),
+		omrtime_hires_clock(),
+		object,
+		size,
+		extensions->allocationSamplingInterval);
+}
+
 void
 MM_EnvironmentBase::allocationFailureEndReportIfRequired(MM_AllocateDescription *allocDescription)
 {
@@ -438,6 +488,7 @@ MM_EnvironmentBase::acquireExclusiveVMAccessForGC(MM_Collector *collector, bool
 	collector->incrementExclusiveAccessCount();
 
 	if (flushCaches) {
+		collector->preFlushCachesForGC(this);
 		GC_OMRVMInterface::flushCachesForGC(this);
 	}
 
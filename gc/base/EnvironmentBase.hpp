@@ -30,6 +30,7 @@
 
 #include "BaseVirtual.hpp"
 #include "CardCleaningStats.hpp"
+#include "AllocationRateEstimator.hpp"
 #include "CycleState.hpp"
 #include "CompactStats.hpp"
 #include "EnvironmentDelegate.hpp"
@@ -81,6 +82,7 @@ private:
 #endif /* defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS) */
 	uintptr_t _slaveID;
 	uintptr_t _environmentId;
+	uintptr_t _nurseryNumaNode; /**< NUMA node (starting from 1) whose nursery stripes this thread allocates from, 0 for no preference, UDATA_MAX until resolved */
 
 protected:
 	OMR_VM *_omrVM;
@@ -131,6 +133,8 @@ public:
 	MM_ObjectAllocationInterface *_objectAllocationInterface; /**< Per-thread interface that guides object allocation decisions */
 
 	MM_WorkStack _workStack;
+	MM_Packet *_cachedEmptyPacket; /**< empty work packet retained by this thread (see GCExtensionsBase::workPacketCache) */
+	MM_Packet *_cachedFullPacket; /**< full work packet retained by this thread as its next input packet (see GCExtensionsBase::workPacketCache) */
 
 	ThreadType  _threadType;
 	MM_CycleState *_cycleState;	/**< The current GC cycle that this thread is operating on */
@@ -148,6 +152,8 @@ public:
 
 	uintptr_t _oolTraceAllocationBytes; /**< Tracks the bytes allocated since the last ool object trace */
 
+	MM_AllocationRateEstimator _tlhAllocationRate; /**< TLH refresh count and allocation rate of this thread, drives adaptive TLH sizing */
+
 	uintptr_t approxScanCacheCount; /**< Local copy of approximate entries in global Cache Scan List. Updated upon allocation of new cache. */
 
 	MM_Validator *_activeValidator; /**< Used to identify and report crashes inside Validators */
@@ -362,6 +368,16 @@ public:
 	 */
 	MMINLINE uintptr_t getEnvironmentId() { return _environmentId; }
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/**
+	 * Determine the NUMA node whose nursery stripes TLHs and survivor copies of this thread should come from
+	 * (see MM_GCExtensionsBase::numaAwareNurseryStripeSize). The node is resolved on first use: the thread's
+	 * affinity if NUMA is physical, otherwise (simulated NUMA) the environment id spread over the nodes.
+	 * @return the node, starting from 1, or 0 if the thread has no preference
+	 */
+	uintptr_t getNurseryNumaNode();
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
 	/**
 	 * Set the vmState to that supplied, and return the previous
 	 * state so it can be restored later
@@ -415,6 +431,13 @@ public:
 	 */
 	void allocationFailureEndReportIfRequired(MM_AllocateDescription *allocDescription);
 
+	/**
+	 * Report an object picked by allocation sampling (-Xgc:allocationSamplingInterval=) to J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE.
+	 * @param object the initialized object
+	 * @param size size of the object in bytes
+	 */
+	void reportObjectAllocationSampled(omrobjectptr_t object, uintptr_t size);
+
 	/**
 	 * Acquires shared VM access.
 	 */
@@ -614,6 +637,7 @@ public:
 #endif /* defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS) */
 		,_slaveID(0)
 		,_environmentId(0)
+		,_nurseryNumaNode(UDATA_MAX)
 		,_omrVM(omrVMThread->_vm)
 		,_omrVMThread(omrVMThread)
 		,_portLibrary(omrVMThread->_vm->_runtime->_portLibrary)
@@ -638,6 +662,8 @@ public:
 #endif /* OMR_GC_SEGREGATED_HEAP */
 		,_objectAllocationInterface(NULL)
 		,_workStack()
+		,_cachedEmptyPacket(NULL)
+		,_cachedFullPacket(NULL)
 		,_threadType(MUTATOR_THREAD)
 		,_cycleState(NULL)
 		,_isInNoGCAllocationCall(false)
@@ -646,6 +672,7 @@ public:
 		,_slaveThreadCpuTimeNanos(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
+		,_tlhAllocationRate()
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
@@ -667,6 +694,7 @@ public:
 #endif /* defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS) */
 		,_slaveID(0)
 		,_environmentId(0)
+		,_nurseryNumaNode(UDATA_MAX)
 		,_omrVM(omrVM)
 		,_omrVMThread(NULL)
 		,_portLibrary(omrVM->_runtime->_portLibrary)
@@ -690,6 +718,8 @@ public:
 #endif /* OMR_GC_SEGREGATED_HEAP */
 		,_objectAllocationInterface(NULL)
 		,_workStack()
+		,_cachedEmptyPacket(NULL)
+		,_cachedFullPacket(NULL)
 		,_threadType(MUTATOR_THREAD)
 		,_cycleState(NULL)
 		,_isInNoGCAllocationCall(false)
@@ -698,6 +728,7 @@ public:
 		,_slaveThreadCpuTimeNanos(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
+		,_tlhAllocationRate()
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
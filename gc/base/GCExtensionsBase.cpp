@@ -218,6 +218,28 @@ MM_GCExtensionsBase::validateDefaultPageParameters(uintptr_t pageSize, uintptr_t
 	return result;
 }
 
+void
+MM_GCExtensionsBase::setGCMetadataPageSize(uintptr_t requestedPageSize)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+	uintptr_t pageSize = requestedPageSize;
+	uintptr_t pageFlags = OMRPORT_VMEM_PAGE_FLAG_NOT_USED;
+	BOOLEAN isSizeSupported = FALSE;
+
+	omrvmem_find_valid_page_size(OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE, &pageSize, &pageFlags, &isSizeSupported);
+
+	gcmetadataPageSize = pageSize;
+	gcmetadataPageFlags = pageFlags;
+	gcmetadataHugePageAlignment = 0;
+
+#if defined(LINUX)
+	/* no large page of the requested size: let THP back the default page reservations instead */
+	if ((pageSize == omrvmem_supported_page_sizes()[0]) && (requestedPageSize > pageSize) && (0 == (requestedPageSize & (requestedPageSize - 1)))) {
+		gcmetadataHugePageAlignment = requestedPageSize;
+	}
+#endif /* defined(LINUX) */
+}
+
 void
 MM_GCExtensionsBase::tearDown(MM_EnvironmentBase* env)
 {
@@ -76,6 +76,7 @@ class MM_RememberedSetSATB;
 #if defined(OMR_GC_MODRON_SCAVENGER)
 class MM_Scavenger;
 #endif /* OMR_GC_MODRON_SCAVENGER */
+class MM_ObjectStartIndex;
 class MM_SizeClasses;
 class MM_SweepHeapSectioning;
 class MM_SweepPoolManager;
@@ -261,6 +262,7 @@ public:
 	uintptr_t requestedPageFlags;
 	uintptr_t gcmetadataPageSize;
 	uintptr_t gcmetadataPageFlags;
+	uintptr_t gcmetadataHugePageAlignment; /**< if non zero, default page GC metadata reservations of at least this size are aligned to it so that transparent huge pages can back them */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_SublistPool rememberedSet;
@@ -292,6 +294,7 @@ public:
 	uintptr_t frequentObjectAllocationSamplingRate; /**< # bytes to sample / # bytes allocated */
 	MM_FrequentObjectsStats* frequentObjectsStats;
 	uint32_t frequentObjectAllocationSamplingDepth; /**< # of frequent objects we'd like to report */
+	uintptr_t allocationSamplingInterval; /**< mean bytes allocated by a thread between objects reported to J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE, 0 to disable sampling */
 
 	uint32_t estimateFragmentation; /**< Enable estimate fragmentation, NO_ESTIMATE_FRAGMENTATION, LOCALGC_ESTIMATE_FRAGMENTATION, GLOBALGC_ESTIMATE_FRAGMENTATION(default) */
 	bool processLargeAllocateStats; /**< Enable process LargeObjectAllocateStats */
@@ -320,6 +323,8 @@ public:
 	uintptr_t tlhMaximumSize;
 	uintptr_t tlhInitialSize;
 	uintptr_t tlhIncrementSize;
+	bool tlhAdaptiveSizing; /**< size each thread's TLH from its allocation rate rather than growing it by tlhIncrementSize on each refresh */
+	uintptr_t tlhAdaptiveRefreshInterval; /**< with tlhAdaptiveSizing, the time (in microseconds) a TLH should last at the thread's allocation rate */
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 
@@ -331,6 +336,7 @@ public:
 	uintptr_t splitFreeListSplitAmount;
 	uintptr_t splitFreeListNumberChunksPrepared; /**< Used in MPSAOL postProcess. Shared for all MPSAOLs. Do not overwrite during postProcess for any MPSAOL. */
 	bool enableHybridMemoryPool;
+	bool sizeClassFreeListPool; /**< use MM_MemoryPoolSizeClassFreeList for the tenure pool (ignored with the large object area or concurrent sweep) */
 
 	bool largeObjectArea;
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
@@ -369,6 +375,9 @@ public:
 	uintptr_t heapContractionGCTimeThreshold; /**< min percentage of time spent in gc before contraction */
 	uintptr_t heapExpansionStabilizationCount; /**< GC count required before the heap is allowed to expand due to excessvie time after last heap expansion */
 	uintptr_t heapContractionStabilizationCount; /**< GC count required before the heap is allowed to contract due to excessvie time after last heap expansion */
+	bool predictiveHeapSizing; /**< resize the heap with MM_HeapResizeModel rather than the free ratio and GC time ratio thresholds */
+	double predictiveHeapSizingWeight; /**< with predictiveHeapSizing, weight of the last GC in the smoothed GC time and live bytes (set through -Xgc:predictiveHeapSizingWeight= as a percentage) */
+	uintptr_t predictiveHeapSizingStabilizationCount; /**< with predictiveHeapSizing, consecutive GCs that must predict a resize in the same direction before it is done */
 
 	float heapSizeStartupHintConservativeFactor; /**< Use only a fraction of hints stored in SC */
 	float heapSizeStartupHintWeightNewValue;		/**< Learn slowly by historic averaging of stored hints */	
@@ -377,9 +386,14 @@ public:
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool packetListLockFree; /**< if true, the shared work packet lists are lock-free stacks rather than lock protected lists */
+	bool workPacketCache; /**< if true, each GC thread retains one empty and one full work packet rather than returning them to the shared lists */
 	
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
+	uintptr_t markingPrefetchDepth; /**< number of popped objects prefetched ahead of scanning in the marking scheme (0 to scan objects as soon as they are popped) */
+	bool parallelClearMarkMap; /**< if true, the mark map is cleared by a dedicated NUMA aware task before a global mark rather than by the mark task itself */
+	bool concurrentClearMarkMap; /**< if true, mutators clear the mark map (as allocation tax) after a global collection completes, leaving only the remainder to parallelClearMarkMap. Ignored in configurations that read the mark map between global collections */
 
 	bool rootScannerStatsEnabled; /**< Enable/disable recording of performance statistics for the root scanner.  Defaults to false. */
 	bool rootScannerStatsUsed; /**< Flag that indicates if rootScannerStats are used for in the last increment (by any thread, for any of its roots) */
@@ -434,6 +448,9 @@ public:
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
+	bool adaptiveGCThreading; /**< if true, each parallel task only wakes as many GC threads as its estimated work needs, and idle GC threads spin then park between tasks */
+	uintptr_t adaptiveGCThreadingWorkPerThread; /**< estimated bytes of work that justify one more GC thread for a task, with adaptive GC threading */
+	uintptr_t gcThreadSpinCount; /**< number of times an idle GC thread polls for its next task before parking, with adaptive GC threading */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
@@ -442,6 +459,17 @@ public:
 	};
 	ScavengerScanOrdering scavengerScanOrdering; /**< scan ordering in Scavenger */
 #if defined(OMR_GC_MODRON_SCAVENGER)
+	bool scavengerWorkStealing; /**< if true, GC threads exchange scan caches through per-thread work-stealing deques rather than the shared scan list */
+	uintptr_t scavengerWorkStealingDequeSize; /**< capacity of each per-thread scan cache deque (rounded up to a power of 2); caches that do not fit go to the shared scan list */
+	bool scavengerHotFieldCopy; /**< if true, the referents of the hot fields reported by the scavenger delegate are copied right behind the object that refers to them */
+	uintptr_t scavengerHotFieldCopyDepth; /**< maximum number of levels of hot field referents copied ahead of scanning */
+	bool scavengerRememberedSetRanges; /**< if true, the remembered set is scanned in fixed size slot ranges claimed by GC threads, rather than a puddle at a time */
+	uintptr_t scavengerRememberedSetRangeSize; /**< number of remembered set slots in each range claimed when scavengerRememberedSetRanges is enabled */
+	bool rememberedSetDeduplicate; /**< if true, NULL and duplicate entries are removed when the remembered set is compacted */
+	bool scavengerForwardingTable; /**< if true, stop-the-world scavenges record forwarding pointers in a side table instead of the headers of evacuated objects */
+	bool numaAwareNursery; /**< if true, the nursery is split in stripes across the NUMA affinity leaders and TLHs and survivor copies are carved from the stripes of the thread's node */
+	uintptr_t numaAwareNurseryStripeSize; /**< size of the address aligned nursery stripes assigned round robin to the nodes, 0 if the nursery is not striped (set at startup when numaAwareNursery is honoured) */
+	uintptr_t numaAwareNurseryNodeCount; /**< number of nodes the nursery stripes are spread over, 0 if the nursery is not striped */
 	uintptr_t scvTenureRatioHigh;
 	uintptr_t scvTenureRatioLow;
 	uintptr_t scvTenureFixedTenureAge; /**< The tenure age to use for the Fixed scavenger tenure strategy. */
@@ -462,6 +490,7 @@ public:
 	bool concurrentScavengerBackgroundThreadsForced; /**< true if concurrentScavengerBackgroundThreads set via command line option */
 	uintptr_t concurrentScavengerSlack; /**< amount of bytes added on top of avearge allocated bytes during concurrent cycle, in calcualtion for survivor size */
 	float concurrentScavengerAllocDeviationBoost; /**< boost factor for allocate rate and its deviation, used for tilt calcuation in Concurrent Scavenger */
+	bool concurrentScavengerPacing; /**< if true, the background thread count and survivor reserve of Concurrent Scavenger are derived from the observed copy and allocation rates */
 #endif	/* OMR_GC_CONCURRENT_SCAVENGER */
 	uintptr_t scavengerFailedTenureThreshold;
 	uintptr_t maxScavengeBeforeGlobal;
@@ -518,6 +547,8 @@ public:
 	MM_MemoryManager* memoryManager; /**< memory manager used to access to virtual memory instances */
 	uintptr_t aggressive;
 	MM_SweepHeapSectioning* sweepHeapSectioning; /**< Reference to the SweepHeapSectioning to Compact can share the backing store */
+	bool enableObjectStartIndex; /**< if true, the sweep records the first live object of each 4KB card so that heap walks can be split into byte ranges outside of a GC */
+	MM_ObjectStartIndex* objectStartIndex; /**< the object start index, NULL unless enableObjectStartIndex is set */
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 	uintptr_t compactOnGlobalGC;
@@ -541,6 +572,7 @@ public:
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
+	bool cardTableSummary; /**< if true, the concurrent card table keeps a summary bit per block of cards so card cleaning can skip blocks which were not dirtied (requires all card dirtying to go through MM_CardTable) */
 
 	UDATA fvtest_concurrentCardTablePreparationDelay; /**< Delay for concurrent card table preparation in milliseconds */
 
@@ -643,6 +675,7 @@ public:
 	uintptr_t allocationCacheMaximumSize;
 	uintptr_t allocationCacheInitialSize;
 	uintptr_t allocationCacheIncrementSize;
+	uintptr_t allocationCacheRefillBatchCells; /**< Minimum number of cells a segregated allocation cache refill takes from a region in one go, over several free ranges if needed (0 refills from a single range) */
 	bool nonDeterministicSweep;
 /* OMR_GC_REALTIME (in for all) */
 
@@ -655,6 +688,9 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool asyncLogging; /**< Enabled by -Xgc:asyncLogging.  Queue verbose:gc output in a ring buffer and write it to a file on a background thread */
+	uintptr_t asyncLoggingBufferSize; /**< size in bytes of the ring buffer used by -Xgc:asyncLogging, set by -Xgc:asyncLoggingBufferSize= */
+	bool binaryLogging; /**< Enabled by -Xgc:binaryLogging.  Write verbose:gc files in the binary format of VerboseBinaryFormat.hpp (implies -Xgc:asyncLogging) */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -837,6 +873,16 @@ public:
 	 */
 	MMINLINE static MM_GCExtensionsBase* getExtensions(OMR_VM* omrVM) { return (MM_GCExtensionsBase*)omrVM->_gcOmrVMExtensions; }
 
+	/**
+	 * Select the page size used for GC metadata (mark map, card table, sweep chunks, ...).
+	 * The request is resolved with omrvmem_find_valid_page_size(). If it falls back to the default page size
+	 * on Linux, metadata reservations are aligned to the requested size instead, so that transparent huge pages
+	 * can back them when THP is enabled.
+	 *
+	 * @param[in] requestedPageSize requested page size
+	 */
+	void setGCMetadataPageSize(uintptr_t requestedPageSize);
+
 	MMINLINE OMR_VM* getOmrVM() { return _omrVM; }
 	MMINLINE void setOmrVM(OMR_VM* omrVM) { _omrVM = omrVM; }
 
@@ -878,6 +924,22 @@ public:
 	MMINLINE MM_GlobalCollector* getGlobalCollector() { return _globalCollector; }
 	MMINLINE void setGlobalCollector(MM_GlobalCollector* collector) { _globalCollector = collector; }
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/**
+	 * @param address[in] an address in the nursery
+	 * @return the NUMA node (starting from 1) of the nursery stripe containing address, 0 if the nursery is not striped
+	 */
+	MMINLINE uintptr_t
+	getNurseryNumaNode(void *address)
+	{
+		uintptr_t node = 0;
+		if (0 != numaAwareNurseryNodeCount) {
+			node = ((((uintptr_t)address) / numaAwareNurseryStripeSize) % numaAwareNurseryNodeCount) + 1;
+		}
+		return node;
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
 	MMINLINE uintptr_t getLastGlobalGCFreeBytes(){ return lastGlobalGCFreeBytes; }
 	MMINLINE void setLastGlobalGCFreeBytes(uintptr_t globalGCFreeBytes){ lastGlobalGCFreeBytes = globalGCFreeBytes;}
 
@@ -1358,6 +1420,7 @@ public:
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, gcmetadataHugePageAlignment(0)
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		, rememberedSet()
 		, oldHeapSizeOnLastGlobalGC(UDATA_MAX)
@@ -1381,6 +1444,7 @@ public:
 		, frequentObjectAllocationSamplingRate(100)
 		, frequentObjectsStats(NULL)
 		, frequentObjectAllocationSamplingDepth(0)
+		, allocationSamplingInterval(0)
 		, estimateFragmentation(GLOBALGC_ESTIMATE_FRAGMENTATION)
 		, processLargeAllocateStats(true) /* turn on processLargeAllocateStats by default */
 		, largeObjectAllocationProfilingThreshold(512)
@@ -1402,6 +1466,8 @@ public:
 		, tlhMaximumSize(131072)
 		, tlhInitialSize(2048)
 		, tlhIncrementSize(4096)
+		, tlhAdaptiveSizing(false)
+		, tlhAdaptiveRefreshInterval(100)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
 		, allocationStats()
@@ -1411,6 +1477,7 @@ public:
 		, splitFreeListSplitAmount(0)
 		, splitFreeListNumberChunksPrepared(0)
 		, enableHybridMemoryPool(false)
+		, sizeClassFreeListPool(false)
 		, largeObjectArea(false)
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 		, largeObjectMinimumSize(64 * 1024)
@@ -1439,14 +1506,22 @@ public:
 		, heapContractionGCTimeThreshold(5)
 		, heapExpansionStabilizationCount(0)
 		, heapContractionStabilizationCount(3)
+		, predictiveHeapSizing(false)
+		, predictiveHeapSizingWeight(0.3)
+		, predictiveHeapSizingStabilizationCount(2)
 		, heapSizeStartupHintConservativeFactor((float)0.7)
 		, heapSizeStartupHintWeightNewValue((float)0.8)	
 		, useGCStartupHints(true)	
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
 		, cacheListSplit(0)
+		, packetListLockFree(false)
+		, workPacketCache(false)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
+		, markingPrefetchDepth(0)
+		, parallelClearMarkMap(false)
+		, concurrentClearMarkMap(false)
 		, rootScannerStatsEnabled(false)
 		, rootScannerStatsUsed(false)
 		, fvtest_forceOldResize(0)
@@ -1491,10 +1566,24 @@ public:
 #endif /* OMR_GC_BATCH_CLEAR_TLH */
 		, gcThreadCount(0)
 		, gcThreadCountForced(false)
+		, adaptiveGCThreading(false)
+		, adaptiveGCThreadingWorkPerThread(256 * 1024)
+		, gcThreadSpinCount(4096)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL)
 #endif /* OMR_GC_MODRON_SCAVENGER || OMR_GC_VLHGC */
 #if defined(OMR_GC_MODRON_SCAVENGER)
+		, scavengerWorkStealing(false)
+		, scavengerWorkStealingDequeSize(1024)
+		, scavengerHotFieldCopy(false)
+		, scavengerHotFieldCopyDepth(4)
+		, scavengerRememberedSetRanges(false)
+		, scavengerRememberedSetRangeSize(256)
+		, rememberedSetDeduplicate(false)
+		, scavengerForwardingTable(false)
+		, numaAwareNursery(false)
+		, numaAwareNurseryStripeSize(0)
+		, numaAwareNurseryNodeCount(0)
 		, scvTenureRatioHigh(OMR_SCV_TENURE_RATIO_HIGH)
 		, scvTenureRatioLow(OMR_SCV_TENURE_RATIO_LOW)
 		, scvTenureFixedTenureAge(OBJECT_HEADER_AGE_MAX)
@@ -1515,6 +1604,7 @@ public:
 		, concurrentScavengerBackgroundThreadsForced(false)
 		, concurrentScavengerSlack(0)
 		, concurrentScavengerAllocDeviationBoost(2.0)
+		, concurrentScavengerPacing(false)
 #endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 		, scavengerFailedTenureThreshold(0)
 		, maxScavengeBeforeGlobal(0)
@@ -1560,6 +1650,8 @@ public:
 		, memoryManager(NULL)
 		, aggressive(0)
 		, sweepHeapSectioning(0)
+		, enableObjectStartIndex(false)
+		, objectStartIndex(NULL)
 #if defined(OMR_GC_MODRON_COMPACTION)
 		, compactOnGlobalGC(0) /* By default we will only compact on triggers, no forced compactions */
 		, noCompactOnGlobalGC(0)
@@ -1580,6 +1672,7 @@ public:
 		, concurrentSlack(0)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
+		, cardTableSummary(false)
 		, fvtest_concurrentCardTablePreparationDelay(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailure(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailureCounter(0)
@@ -1657,6 +1750,7 @@ public:
 		, allocationCacheMaximumSize(16384)
 		, allocationCacheInitialSize(256)
 		, allocationCacheIncrementSize(256)
+		, allocationCacheRefillBatchCells(0)
 		, nonDeterministicSweep(false)
 		, configuration(NULL)
 		, verboseGCManager(NULL)
@@ -1664,6 +1758,9 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, asyncLogging(false)
+		, asyncLoggingBufferSize(1024 * 1024)
+		, binaryLogging(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
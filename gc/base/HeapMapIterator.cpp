@@ -24,6 +24,7 @@
 #include "Bits.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapMap.hpp"
+#include "HeapMapScanner.hpp"
 #include "Math.hpp"
 #include "ObjectModel.hpp"
 
@@ -131,6 +132,17 @@ MM_HeapMapIterator::nextObject()
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
 			_heapMapSlotValue = *_heapMapSlotCurrent;
+			if (J9MODRON_HMI_SLOT_EMPTY == _heapMapSlotValue) {
+				/* Skip the rest of an empty run in bulk rather than a slot at a time */
+				uintptr_t *heapMapSlotTop = _heapMapSlotCurrent
+					+ ((_heapChunkTop - _heapSlotCurrent) + J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT - 1) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT;
+				uintptr_t *heapMapSlotNext = MM_HeapMapScanner::skipEmptyWords(_heapMapSlotCurrent, heapMapSlotTop);
+				_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (heapMapSlotNext - _heapMapSlotCurrent);
+				_heapMapSlotCurrent = heapMapSlotNext;
+				if(_heapSlotCurrent < _heapChunkTop) {
+					_heapMapSlotValue = *_heapMapSlotCurrent;
+				}
+			}
 		}
 	}
 
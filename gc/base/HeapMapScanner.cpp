@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/* The vector scanners are compiled for their own instruction set with target attributes and only called once the
+ * processor has been found to support it, so the rest of the GC does not need to be built for AVX.
+ */
+#include <immintrin.h>
+#define HEAPMAP_SCANNER_X86
+#define HEAPMAP_SCANNER_TARGET(isa) __attribute__((target(isa)))
+#endif /* __GNUC__ && (__x86_64__ || __i386__) */
+
+#include "HeapMapScanner.hpp"
+
+MM_HeapMapScanner::FindWordFunction MM_HeapMapScanner::_findWordNotEqual = MM_HeapMapScanner::selectAndFindWordNotEqual;
+
+static uintptr_t *
+findWordNotEqualScalar(uintptr_t *current, uintptr_t *top, uintptr_t pattern)
+{
+	while ((current < top) && (pattern == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+#if defined(HEAPMAP_SCANNER_X86)
+
+/**
+ * Advance word by word until current is aligned on alignment bytes (or a mismatch or top is found).
+ */
+static MMINLINE uintptr_t *
+alignScan(uintptr_t *current, uintptr_t *top, uintptr_t pattern, uintptr_t alignment)
+{
+	while ((current < top) && (0 != ((uintptr_t)current & (alignment - 1))) && (pattern == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+HEAPMAP_SCANNER_TARGET("sse2")
+static uintptr_t *
+findWordNotEqualSSE2(uintptr_t *current, uintptr_t *top, uintptr_t pattern)
+{
+	const uintptr_t wordsPerVector = sizeof(__m128i) / sizeof(uintptr_t);
+	/* patterns are uniform (all zero or all one bits) so a byte broadcast matches them at any word size */
+	const __m128i patternVector = _mm_set1_epi8((char)pattern);
+
+	current = alignScan(current, top, pattern, sizeof(__m128i));
+	if ((current < top) && (pattern == *current)) {
+		/* two vectors per iteration: 256 bits of heap map */
+		while ((uintptr_t)(top - current) >= (2 * wordsPerVector)) {
+			__m128i low = _mm_cmpeq_epi8(_mm_load_si128((__m128i *)current), patternVector);
+			__m128i high = _mm_cmpeq_epi8(_mm_load_si128((__m128i *)(current + wordsPerVector)), patternVector);
+			if (0xFFFF != _mm_movemask_epi8(_mm_and_si128(low, high))) {
+				break;
+			}
+			current += 2 * wordsPerVector;
+		}
+	}
+	return findWordNotEqualScalar(current, top, pattern);
+}
+
+HEAPMAP_SCANNER_TARGET("avx2")
+static uintptr_t *
+findWordNotEqualAVX2(uintptr_t *current, uintptr_t *top, uintptr_t pattern)
+{
+	const uintptr_t wordsPerVector = sizeof(__m256i) / sizeof(uintptr_t);
+	const __m256i patternVector = _mm256_set1_epi8((char)pattern);
+
+	current = alignScan(current, top, pattern, sizeof(__m256i));
+	if ((current < top) && (pattern == *current)) {
+		/* two vectors per iteration: 512 bits of heap map */
+		while ((uintptr_t)(top - current) >= (2 * wordsPerVector)) {
+			__m256i low = _mm256_cmpeq_epi8(_mm256_load_si256((__m256i *)current), patternVector);
+			__m256i high = _mm256_cmpeq_epi8(_mm256_load_si256((__m256i *)(current + wordsPerVector)), patternVector);
+			if (-1 != _mm256_movemask_epi8(_mm256_and_si256(low, high))) {
+				break;
+			}
+			current += 2 * wordsPerVector;
+		}
+	}
+	_mm256_zeroupper();
+	return findWordNotEqualScalar(current, top, pattern);
+}
+
+HEAPMAP_SCANNER_TARGET("avx512f")
+static uintptr_t *
+findWordNotEqualAVX512(uintptr_t *current, uintptr_t *top, uintptr_t pattern)
+{
+	const uintptr_t wordsPerVector = sizeof(__m512i) / sizeof(uintptr_t);
+	const __m512i patternVector = _mm512_set1_epi32((int)pattern);
+
+	current = alignScan(current, top, pattern, sizeof(__m512i));
+	if ((current < top) && (pattern == *current)) {
+		/* two vectors per iteration: 1024 bits of heap map */
+		while ((uintptr_t)(top - current) >= (2 * wordsPerVector)) {
+			__mmask16 low = _mm512_cmpneq_epi32_mask(_mm512_load_si512((void *)current), patternVector);
+			__mmask16 high = _mm512_cmpneq_epi32_mask(_mm512_load_si512((void *)(current + wordsPerVector)), patternVector);
+			if (0 != (low | high)) {
+				break;
+			}
+			current += 2 * wordsPerVector;
+		}
+	}
+	_mm256_zeroupper();
+	return findWordNotEqualScalar(current, top, pattern);
+}
+
+#endif /* HEAPMAP_SCANNER_X86 */
+
+MM_HeapMapScanner::FindWordFunction
+MM_HeapMapScanner::getImplementation(Implementation implementation)
+{
+	FindWordFunction function = NULL;
+
+	switch (implementation) {
+	case implementation_scalar:
+		function = findWordNotEqualScalar;
+		break;
+#if defined(HEAPMAP_SCANNER_X86)
+	case implementation_sse2:
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("sse2")) {
+			function = findWordNotEqualSSE2;
+		}
+		break;
+	case implementation_avx2:
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2")) {
+			function = findWordNotEqualAVX2;
+		}
+		break;
+	case implementation_avx512:
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f")) {
+			function = findWordNotEqualAVX512;
+		}
+		break;
+#endif /* HEAPMAP_SCANNER_X86 */
+	default:
+		break;
+	}
+
+	return function;
+}
+
+uintptr_t *
+MM_HeapMapScanner::selectAndFindWordNotEqual(uintptr_t *current, uintptr_t *top, uintptr_t pattern)
+{
+	/* use the widest vectors supported, the scalar implementation is always available */
+	FindWordFunction function = NULL;
+	for (intptr_t implementation = implementation_count - 1; NULL == function; implementation--) {
+		function = getImplementation((Implementation)implementation);
+	}
+
+	/* any thread racing through here makes the same choice, so the unsynchronized store is benign */
+	_findWordNotEqual = function;
+
+	return function(current, top, pattern);
+}
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPMAPSCANNER_HPP_)
+#define HEAPMAPSCANNER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+/**
+ * Number of heap map words examined inline before handing a search over to the bulk scanner.
+ */
+#define HEAPMAP_SCANNER_INLINE_WORDS 4
+
+/**
+ * Bulk scanning of heap map words. Searches for the end of a run of empty (no bits set) or full (all bits set) words
+ * using the widest vector instructions the running processor supports (AVX-512, AVX2 or SSE2 on x86), falling back
+ * to a scalar loop elsewhere. The implementation is selected on first use.
+ * @ingroup GC_Base
+ */
+class MM_HeapMapScanner
+{
+public:
+	typedef uintptr_t *(*FindWordFunction)(uintptr_t *current, uintptr_t *top, uintptr_t pattern);
+
+	/**
+	 * Implementations of the bulk scan, from the most portable to the widest vectors.
+	 */
+	enum Implementation {
+		implementation_scalar = 0,
+		implementation_sse2,
+		implementation_avx2,
+		implementation_avx512,
+		implementation_count
+	};
+
+private:
+	static FindWordFunction _findWordNotEqual; /**< Implementation of findWordNotEqual() selected for the running processor */
+
+	static uintptr_t *selectAndFindWordNotEqual(uintptr_t *current, uintptr_t *top, uintptr_t pattern);
+
+	/**
+	 * Find the first word in [current, top) which is not equal to pattern.
+	 * Short runs are resolved inline, only longer runs are handed to the bulk scanner.
+	 * @note pattern must have all of its bytes equal (0 or UDATA_MAX)
+	 */
+	static MMINLINE uintptr_t *
+	findWordNotEqual(uintptr_t *current, uintptr_t *top, uintptr_t pattern)
+	{
+		uintptr_t *inlineTop = ((top - current) > HEAPMAP_SCANNER_INLINE_WORDS) ? (current + HEAPMAP_SCANNER_INLINE_WORDS) : top;
+		while ((current < inlineTop) && (pattern == *current)) {
+			current += 1;
+		}
+		if ((current == inlineTop) && (current < top)) {
+			current = _findWordNotEqual(current, top, pattern);
+		}
+		return current;
+	}
+
+public:
+	/**
+	 * Get an implementation of the bulk scan by name, so that the implementations can be checked against each other.
+	 * The implementation returned finds the first word in [current, top) which is not equal to pattern, which must
+	 * be 0 or UDATA_MAX.
+	 * @param implementation[in] the implementation to get
+	 * @return the implementation, or NULL if it is not built for this platform or not supported by the running processor
+	 */
+	static FindWordFunction getImplementation(Implementation implementation);
+
+	/**
+	 * Skip a run of heap map words with no bits set.
+	 * @param current[in] the first word to examine
+	 * @param top[in] the word after the last word to examine
+	 * @return the first word in [current, top) with a bit set, or top if there is none
+	 */
+	static MMINLINE uintptr_t *
+	skipEmptyWords(uintptr_t *current, uintptr_t *top)
+	{
+		return findWordNotEqual(current, top, 0);
+	}
+};
+
+#endif /* HEAPMAPSCANNER_HPP_ */
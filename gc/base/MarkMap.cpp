@@ -28,6 +28,12 @@
 #include "omrcfg.h"
 #include "omr.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MARKMAP_NON_TEMPORAL_CLEAR
+#endif /* __SSE2__ || _M_X64 */
+
+#include "AtomicOperations.hpp"
 #include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -36,6 +42,8 @@
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "MarkMap.hpp"
+#include "Math.hpp"
+#include "ModronAssertions.h"
 #include "Task.hpp"
 
 
@@ -57,9 +65,47 @@ MM_MarkMap::newInstance(MM_EnvironmentBase *env, uintptr_t maxHeapSize)
 	return markMap;
 }
 
+void
+MM_MarkMap::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _clearChunks) {
+		env->getForge()->free(_clearChunks);
+		_clearChunks = NULL;
+		_clearChunksCapacity = 0;
+	}
+	if (NULL != _clearNodeEnd) {
+		env->getForge()->free(_clearNodeEnd);
+		_clearNodeEnd = NULL;
+		_clearNodeNext = NULL;
+		_clearNodeCount = 0;
+	}
+	_clearChunksPending = false;
+
+	MM_HeapMap::tearDown(env);
+}
+
+bool
+MM_MarkMap::heapAddRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress)
+{
+	/* newly committed mark map memory is not described by any prepared chunk */
+	cancelClearChunks();
+	return MM_HeapMap::heapAddRange(env, size, lowAddress, highAddress);
+}
+
+bool
+MM_MarkMap::heapRemoveRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
+{
+	/* prepared chunks may describe mark map memory which is about to be decommitted */
+	cancelClearChunks();
+	return MM_HeapMap::heapRemoveRange(env, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+}
+
 void
 MM_MarkMap::initializeMarkMap(MM_EnvironmentBase *env)
 {
+	/* the mark map is about to be reused, any pending chunk clearing no longer describes what is dirty */
+	cancelClearChunks();
+
 	/* TODO: The multiplier should really be some constant defined globally */
 	const uintptr_t MODRON_PARALLEL_MULTIPLIER = 32;
 	uintptr_t heapAlignment = _extensions->heapAlignment;
@@ -112,3 +158,169 @@ MM_MarkMap::initializeMarkMap(MM_EnvironmentBase *env)
 		}
 	}
 }
+
+bool
+MM_MarkMap::prepareClearChunks(MM_EnvironmentBase *env, uintptr_t threadCount)
+{
+	const uintptr_t MODRON_PARALLEL_MULTIPLIER = 32;
+	uintptr_t heapAlignment = _extensions->heapAlignment;
+
+	_clearChunksPending = false;
+
+	/* Size the chunks as initializeMarkMap() does, but never larger than MARKMAP_CLEAR_CHUNK_MAXIMUM_HEAP_SIZE so
+	 * that there is still some work to balance across nodes (and a small unit of work for a mutator) with few threads.
+	 */
+	uintptr_t heapClearUnitFactor = ((threadCount <= 1) ? 1 : threadCount * MODRON_PARALLEL_MULTIPLIER);
+	uintptr_t heapClearUnitSize = _extensions->heap->getMemorySize() / heapClearUnitFactor;
+	heapClearUnitSize = OMR_MIN(heapClearUnitSize, MARKMAP_CLEAR_CHUNK_MAXIMUM_HEAP_SIZE);
+	heapClearUnitSize = MM_Math::roundToCeiling(heapAlignment, OMR_MAX(heapClearUnitSize, 1));
+
+	MM_Heap *heap = _extensions->getHeap();
+	MM_HeapRegionManager *regionManager = heap->getHeapRegionManager();
+	uintptr_t nodeCount = _extensions->_numaManager.getMaximumNodeNumber() + 1;
+
+	/* Count the chunks, and the chunks per node */
+	uintptr_t chunkCount = 0;
+	MM_HeapRegionDescriptor *region = NULL;
+	GC_HeapRegionIterator countIterator(regionManager);
+	while (NULL != (region = countIterator.nextRegion())) {
+		if (region->isCommitted()) {
+			chunkCount += MM_Math::roundToCeiling(heapClearUnitSize, region->getSize()) / heapClearUnitSize;
+			nodeCount = OMR_MAX(nodeCount, region->getNumaNode() + 1);
+		}
+	}
+
+	if (chunkCount > _clearChunksCapacity) {
+		if (NULL != _clearChunks) {
+			env->getForge()->free(_clearChunks);
+		}
+		_clearChunksCapacity = 0;
+		_clearChunks = (ClearChunk *)env->getForge()->allocate(sizeof(ClearChunk) * chunkCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _clearChunks) {
+			return false;
+		}
+		_clearChunksCapacity = chunkCount;
+	}
+
+	if (nodeCount > _clearNodeCount) {
+		if (NULL != _clearNodeEnd) {
+			env->getForge()->free(_clearNodeEnd);
+		}
+		_clearNodeCount = 0;
+		_clearNodeNext = NULL;
+		/* one allocation holds both the end and the next arrays */
+		_clearNodeEnd = (uintptr_t *)env->getForge()->allocate(sizeof(uintptr_t) * nodeCount * 2, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _clearNodeEnd) {
+			return false;
+		}
+		_clearNodeNext = _clearNodeEnd + nodeCount;
+		_clearNodeCount = nodeCount;
+	}
+
+	/* Fill the table one node at a time so that each node owns a contiguous range of chunks */
+	uintptr_t chunkIndex = 0;
+	for (uintptr_t node = 0; node < _clearNodeCount; node++) {
+		_clearNodeNext[node] = chunkIndex;
+		GC_HeapRegionIterator regionIterator(regionManager);
+		while (NULL != (region = regionIterator.nextRegion())) {
+			if (region->isCommitted() && (node == region->getNumaNode())) {
+				uint8_t *heapClearAddress = (uint8_t *)region->getLowAddress();
+				uintptr_t heapClearSizeRemaining = region->getSize();
+				while (0 != heapClearSizeRemaining) {
+					uintptr_t heapCurrentClearSize = OMR_MIN(heapClearUnitSize, heapClearSizeRemaining);
+					/* see initializeMarkMap() for why the index and size are derived from the low and high offsets */
+					uintptr_t heapClearOffset = ((uintptr_t)heapClearAddress) - _heapMapBaseDelta;
+					uintptr_t heapMapClearIndex = convertHeapIndexToHeapMapIndex(env, heapClearOffset, sizeof(uintptr_t));
+					Assert_MM_true(chunkIndex < chunkCount);
+					_clearChunks[chunkIndex].heapMapIndex = heapMapClearIndex;
+					_clearChunks[chunkIndex].heapMapSize =
+						convertHeapIndexToHeapMapIndex(env, heapClearOffset + heapCurrentClearSize, sizeof(uintptr_t))
+						- heapMapClearIndex;
+					chunkIndex += 1;
+
+					heapClearAddress += heapCurrentClearSize;
+					heapClearSizeRemaining -= heapCurrentClearSize;
+				}
+			}
+		}
+		_clearNodeEnd[node] = chunkIndex;
+	}
+	Assert_MM_true(chunkIndex == chunkCount);
+
+	/* the table must be complete before any thread can see that chunks are pending */
+	MM_AtomicOperations::storeSync();
+	_clearChunksPending = true;
+
+	return true;
+}
+
+uintptr_t
+MM_MarkMap::clearChunks(MM_EnvironmentBase *env, uintptr_t maxChunks)
+{
+	uintptr_t bytesCleared = 0;
+	uintptr_t chunksCleared = 0;
+
+	if (_clearChunksPending) {
+		MM_AtomicOperations::loadSync();
+
+		/* Start with the node the thread is bound to, if any. Unbound threads spread their starting node by slave ID
+		 * so that they do not all compete for the same node's chunks.
+		 */
+		uintptr_t homeNode = 0;
+		if (_clearNodeCount > 1) {
+			homeNode = env->getNumaAffinity();
+			if ((0 == homeNode) || (homeNode >= _clearNodeCount)) {
+				homeNode = env->getSlaveID() % _clearNodeCount;
+			}
+		}
+
+		for (uintptr_t i = 0; (i < _clearNodeCount) && (chunksCleared < maxChunks); i++) {
+			uintptr_t node = (homeNode + i) % _clearNodeCount;
+			uintptr_t end = _clearNodeEnd[node];
+			while ((chunksCleared < maxChunks) && (_clearNodeNext[node] < end)) {
+				uintptr_t chunkIndex = MM_AtomicOperations::add(&_clearNodeNext[node], 1) - 1;
+				if (chunkIndex >= end) {
+					break;
+				}
+				clearChunk(&_clearChunks[chunkIndex]);
+				bytesCleared += _clearChunks[chunkIndex].heapMapSize;
+				chunksCleared += 1;
+			}
+		}
+
+#if defined(MARKMAP_NON_TEMPORAL_CLEAR)
+		if (0 != chunksCleared) {
+			/* order the streaming stores before anything that follows, such as publishing completion of the work */
+			_mm_sfence();
+		}
+#endif /* MARKMAP_NON_TEMPORAL_CLEAR */
+	}
+
+	return bytesCleared;
+}
+
+void
+MM_MarkMap::clearChunk(ClearChunk *chunk)
+{
+	uint8_t *address = ((uint8_t *)_heapMapBits) + chunk->heapMapIndex;
+	uintptr_t size = chunk->heapMapSize;
+
+#if defined(MARKMAP_NON_TEMPORAL_CLEAR)
+	/* The mark map is not read again before marking sets bits in it, so bypass the cache rather than evicting
+	 * the working set with lines which are only being zeroed.
+	 */
+	uint8_t *alignedStart = (uint8_t *)MM_Math::roundToCeiling(sizeof(__m128i), (uintptr_t)address);
+	uint8_t *alignedEnd = (uint8_t *)MM_Math::roundToFloor(sizeof(__m128i), (uintptr_t)(address + size));
+	if (alignedStart < alignedEnd) {
+		OMRZeroMemory(address, alignedStart - address);
+		__m128i zero = _mm_setzero_si128();
+		for (__m128i *cursor = (__m128i *)alignedStart; cursor < (__m128i *)alignedEnd; cursor++) {
+			_mm_stream_si128(cursor, zero);
+		}
+		OMRZeroMemory(alignedEnd, (address + size) - alignedEnd);
+		return;
+	}
+#endif /* MARKMAP_NON_TEMPORAL_CLEAR */
+
+	OMRZeroMemory(address, size);
+}
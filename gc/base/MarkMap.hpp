@@ -39,21 +39,73 @@
 
 #define BITS_PER_BYTE 8
 
+#define MARKMAP_CLEAR_CHUNK_MAXIMUM_HEAP_SIZE ((uintptr_t)4 * 1024 * 1024)
+
 class MM_EnvironmentBase;
 
 class MM_MarkMap : public MM_HeapMap
 {
 private:
+	/**
+	 * A range of the mark map to be cleared as a single unit of work by clearChunks().
+	 */
+	struct ClearChunk {
+		uintptr_t heapMapIndex; /**< byte offset of the range in the mark map */
+		uintptr_t heapMapSize; /**< size of the range in bytes */
+	};
+
 	bool _isMarkMapValid; /** < Is this mark map valid */
-	
+	ClearChunk *_clearChunks; /**< Chunks of the committed mark map, grouped by the NUMA node of the heap they describe */
+	uintptr_t _clearChunksCapacity; /**< Number of entries allocated in _clearChunks */
+	uintptr_t *_clearNodeEnd; /**< For each NUMA node, the index in _clearChunks after its last chunk */
+	volatile uintptr_t *_clearNodeNext; /**< For each NUMA node, the index in _clearChunks of its next unclaimed chunk */
+	uintptr_t _clearNodeCount; /**< Number of entries in _clearNodeEnd and _clearNodeNext (maximum NUMA node number + 1) */
+	volatile bool _clearChunksPending; /**< True if prepareClearChunks() has been called and the unclaimed chunks are the only dirty part of the mark map */
+
+	void clearChunk(ClearChunk *chunk);
+
 public:
 	MMINLINE bool isMarkMapValid() const { return _isMarkMapValid; }
 	MMINLINE void setMarkMapValid(bool isMarkMapValid) {  _isMarkMapValid = isMarkMapValid; }
 
  	static MM_MarkMap *newInstance(MM_EnvironmentBase *env, uintptr_t maxHeapSize);
+ 	virtual void tearDown(MM_EnvironmentBase *env);
+
+	virtual bool heapAddRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress);
+	virtual bool heapRemoveRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
  	
  	void initializeMarkMap(MM_EnvironmentBase *env);
 
+	/**
+	 * Split the committed mark map into chunks and group them by the NUMA node of the heap they describe, in
+	 * preparation for clearing with clearChunks(). Must be called by a single thread while no chunks are being cleared.
+	 * @param env[in] the current thread
+	 * @param threadCount[in] the number of threads expected to clear the chunks, used to size them
+	 * @return true on success, false if the chunk table could not be allocated (use initializeMarkMap() instead)
+	 */
+	bool prepareClearChunks(MM_EnvironmentBase *env, uintptr_t threadCount);
+
+	/**
+	 * Claim and clear unclaimed chunks. Chunks describing heap on the NUMA node of the calling thread are claimed
+	 * first, then the remaining nodes are visited round robin starting at a thread specific node.
+	 * Safe to call concurrently from any number of threads.
+	 * @param env[in] the current thread
+	 * @param maxChunks[in] the maximum number of chunks to clear (UDATA_MAX to clear until none remain)
+	 * @return the number of mark map bytes cleared by this call
+	 */
+	uintptr_t clearChunks(MM_EnvironmentBase *env, uintptr_t maxChunks);
+
+	/**
+	 * @return true if prepareClearChunks() has been called and the clearing has not been cancelled since
+	 */
+	MMINLINE bool isClearChunksPending() const { return _clearChunksPending; }
+
+	/**
+	 * Forget about prepared chunks. Must be called whenever the mark map may be dirtied outside of the unclaimed
+	 * chunks (heap resized, marking done for a heap walk, ...), so that the next clearing starts from scratch.
+	 */
+	MMINLINE void cancelClearChunks() { _clearChunksPending = false; }
+
 	MMINLINE void *getMarkBits() { return _heapMapBits; };
  	
 	MMINLINE uintptr_t getHeapMapBaseRegionRounded() { return _heapMapBaseDelta; }
@@ -108,6 +160,12 @@ public:
 	MM_MarkMap(MM_EnvironmentBase *env, uintptr_t maxHeapSize) :
 		MM_HeapMap(env, maxHeapSize, env->getExtensions()->isSegregatedHeap())
 		, _isMarkMapValid(false)
+		, _clearChunks(NULL)
+		, _clearChunksCapacity(0)
+		, _clearNodeEnd(NULL)
+		, _clearNodeNext(NULL)
+		, _clearNodeCount(0)
+		, _clearChunksPending(false)
 	{
 		_typeId = __FUNCTION__;
 	};
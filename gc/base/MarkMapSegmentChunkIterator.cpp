@@ -29,6 +29,7 @@
 
 #include "Heap.hpp"
 #include "HeapRegionManager.hpp"
+#include "ObjectStartIndex.hpp"
 
 /**
  * @see GC_MarkMapSegmentChunkIterator::nextChunk()
@@ -65,3 +66,36 @@ GC_MarkMapSegmentChunkIterator::nextChunk(MM_HeapMap *markMap, UDATA **base, UDA
 	return false;
 }
 
+/**
+ * @see GC_MarkMapSegmentChunkIterator::nextChunk()
+ */
+bool
+GC_MarkMapSegmentChunkIterator::nextChunk(MM_ObjectStartIndex *objectStartIndex, UDATA **base, UDATA **top)
+{
+	while (_segmentBytesRemaining > 0) {
+		UDATA thisChunkSize = OMR_MIN(_segmentBytesRemaining, _chunkSize);
+		UDATA *chunkBase = _nextChunkBase;
+		UDATA *chunkTop = (UDATA *)((U_8 *)_nextChunkBase + thisChunkSize);
+		_segmentBytesRemaining -= thisChunkSize;
+		_nextChunkBase = chunkTop;
+
+		UDATA *firstObject = NULL;
+		if (chunkBase == _segmentBase) {
+			firstObject = chunkBase;
+		} else if (NULL != objectStartIndex) {
+			/* There may not be a recorded object in this chunk */
+			/* If that is the case, we move on to the next chunk */
+			firstObject = (UDATA *)objectStartIndex->findObjectStart(chunkBase, chunkTop);
+			if (NULL != firstObject) {
+				objectStartIndex->reportWalkChunkStarted();
+			}
+		}
+
+		if (NULL != firstObject) {
+			*base = firstObject;
+			*top = chunkTop;
+			return true;
+		}
+	}
+	return false;
+}
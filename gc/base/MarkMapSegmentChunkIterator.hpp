@@ -36,11 +36,12 @@
 
 class MM_GCExtensionsBase;
 class MM_HeapMap;
+class MM_ObjectStartIndex;
 
 /**
  * Iterate over chunks of an area of memory by splitting the extent into even size chunks,
- * then using the mark map to find the first object in each chunk.
- * @note the mark map must be valid in order to use this iterator
+ * then using the mark map (or the object start index) to find the first object in each chunk.
+ * @note the mark map (or the object start index) must be valid in order to use this iterator
  * @ingroup GC_Base
  */
 class GC_MarkMapSegmentChunkIterator
@@ -51,6 +52,7 @@ private:
 	UDATA _segmentBytesRemaining;
 	MM_HeapMapIterator _markedObjectIterator;
 	UDATA *_nextChunkBase;
+	UDATA *_segmentBase;
 
 public:
 	void *operator new(size_t size, void *memoryPtr) { return memoryPtr; };
@@ -60,7 +62,8 @@ public:
 		_chunkSize(chunkSize),
 		_segmentBytesRemaining((UDATA)highAddress - (UDATA)lowAddress),
 		_markedObjectIterator(extensions),
-		_nextChunkBase((UDATA *)lowAddress)
+		_nextChunkBase((UDATA *)lowAddress),
+		_segmentBase((UDATA *)lowAddress)
 	{};
 
 	/**
@@ -74,6 +77,19 @@ public:
 	 * @return false if there were no more chunks
 	 */
 	bool nextChunk(MM_HeapMap *markMap, UDATA **base, UDATA **top);
+
+	/**
+	 * As nextChunk(MM_HeapMap *, UDATA **, UDATA **), with chunks starting at the objects recorded in an object start index.
+	 * The first chunk starts at the base of the area, since objects allocated after the index was recorded may precede
+	 * the first recorded object.
+	 *
+	 * @param objectStartIndex[in] The index to use when finding the next chunk, NULL to return the first chunk only
+	 * @param base (OUT parameter) a pointer to the base of the next chunk will be stored into this address
+	 * @param top (OUT parameter) a pointer to the top of the next chunk will be stored into this address
+	 * @return true if there was a chunk available
+	 * @return false if there were no more chunks
+	 */
+	bool nextChunk(MM_ObjectStartIndex *objectStartIndex, UDATA **base, UDATA **top);
 };
 
 #endif /* MARKMAPSEGMENTCHUNKITERATOR_HPP_ */
@@ -96,6 +96,9 @@ MM_MarkingScheme::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	_extensions->markingPrefetchDepth = OMR_MIN(_extensions->markingPrefetchDepth, MARKING_PREFETCH_DEPTH_MAX);
+	_prefetchDepth = _extensions->markingPrefetchDepth;
+
 	return _delegate.initialize(env, this);
 
 error_no_memory:
@@ -200,6 +203,19 @@ MM_MarkingScheme::masterCleanupAfterGC(MM_EnvironmentBase *env)
 	_delegate.masterCleanupAfterGC(env);
 }
 
+uintptr_t
+MM_MarkingScheme::estimatePendingMarkWork()
+{
+	uintptr_t estimate = 0;
+
+	if (0 != _previousMarkObjectsScanned) {
+		uintptr_t averageObjectSize = _previousMarkBytesScanned / _previousMarkObjectsScanned;
+		estimate = _workPackets->getNonEmptyPacketCount() * (MM_WorkPackets::getSlotsInPacket() / 2) * averageObjectSize;
+	}
+
+	return estimate;
+}
+
 void
 MM_MarkingScheme::workerSetupForGC(MM_EnvironmentBase *env)
 {
@@ -321,6 +337,11 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 void
 MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 {
+	if (0 != _prefetchDepth) {
+		completeScanWithPrefetch(env);
+		return;
+	}
+
 	do {
 		omrobjectptr_t objectPtr = NULL;
 		while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
@@ -330,6 +351,53 @@ MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 	} while (_workPackets->handleWorkPacketOverflow(env));
 }
 
+void
+MM_MarkingScheme::completeScanWithPrefetch(MM_EnvironmentBase *env)
+{
+	omrobjectptr_t fifo[MARKING_PREFETCH_DEPTH_MAX];
+	const uintptr_t fifoMask = MARKING_PREFETCH_DEPTH_MAX - 1;
+	uintptr_t fifoHead = 0;
+	uintptr_t fifoCount = 0;
+
+	do {
+		while (true) {
+			/* Top up the FIFO without waiting: a thread must never block for work while it still holds
+			 * unscanned objects, as the other threads could then decide that marking is complete.
+			 */
+			omrobjectptr_t objectPtr = NULL;
+			while ((fifoCount < _prefetchDepth) && (NULL != (objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env)))) {
+				/* the header and the first slots typically span two cache lines */
+				MM_PREFETCH_READ(objectPtr);
+				MM_PREFETCH_READ((uint8_t *)objectPtr + OMR_GC_CACHE_LINE_SIZE);
+				fifo[(fifoHead + fifoCount) & fifoMask] = objectPtr;
+				fifoCount += 1;
+			}
+
+			if (0 != fifoCount) {
+				if (fifoCount == _prefetchDepth) {
+					/* _prefetchDepth - 1 objects will have been scanned since this one was prefetched */
+					env->_markStats._prefetchFullDepth += 1;
+				} else {
+					env->_markStats._prefetchShortDepth += 1;
+				}
+				objectPtr = fifo[fifoHead];
+				fifoHead = (fifoHead + 1) & fifoMask;
+				fifoCount -= 1;
+			} else {
+				/* FIFO is drained - wait for more work, or for all threads to complete */
+				objectPtr = (omrobjectptr_t)env->_workStack.pop(env);
+				if (NULL == objectPtr) {
+					break;
+				}
+				env->_markStats._prefetchShortDepth += 1;
+			}
+
+			env->_markStats._bytesScanned += scanObject(env, objectPtr);
+			env->_markStats._objectsScanned += 1;
+		}
+	} while (_workPackets->handleWorkPacketOverflow(env));
+}
+
 /****************************************
  * Marking Core Functionality
  ****************************************/
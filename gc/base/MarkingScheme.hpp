@@ -38,6 +38,8 @@
 #include "ObjectScannerState.hpp"
 #include "WorkStack.hpp"
 
+#define MARKING_PREFETCH_DEPTH_MAX 16 /**< Upper bound for GCExtensionsBase::markingPrefetchDepth, must be a power of 2 */
+
 /**
  * @todo Provide class documentation
  */
@@ -56,6 +58,9 @@ protected:
 	MM_WorkPackets *_workPackets;
 	void *_heapBase;
 	void *_heapTop;
+	uintptr_t _prefetchDepth; /**< number of objects held in the prefetch FIFO of completeScan(), 0 if prefetching is disabled */
+	uintptr_t _previousMarkBytesScanned; /**< bytes scanned by the last complete mark, the work estimate of the next one for adaptive GC threading */
+	uintptr_t _previousMarkObjectsScanned; /**< objects scanned by the last complete mark */
 
 public:
 
@@ -76,6 +81,13 @@ private:
 	 */
 	MMINLINE uintptr_t scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
 
+	/**
+	 * Private internal. Called exclusively from completeScan() when prefetching is enabled.
+	 * Objects popped from the work stack are prefetched and queued in a FIFO of _prefetchDepth entries,
+	 * so that they are scanned only after several other objects have been scanned.
+	 */
+	void completeScanWithPrefetch(MM_EnvironmentBase *env);
+
 	MM_WorkPackets *createWorkPackets(MM_EnvironmentBase *env);
 
 protected:
@@ -266,6 +278,28 @@ public:
 	
 	bool isMarkedOutline(omrobjectptr_t objectPtr);
 	MM_WorkPackets *getWorkPackets() { return _workPackets; }
+
+	/**
+	 * Remember the size of a complete mark, to estimate the work of the next marks for adaptive GC threading.
+	 */
+	void
+	recordMarkWork(uintptr_t bytesScanned, uintptr_t objectsScanned)
+	{
+		_previousMarkBytesScanned = bytesScanned;
+		_previousMarkObjectsScanned = objectsScanned;
+	}
+
+	/**
+	 * @return the bytes scanned by the last complete mark, or 0 if none was recorded
+	 */
+	uintptr_t estimateMarkWork() { return _previousMarkBytesScanned; }
+
+	/**
+	 * Estimate the bytes left to scan from the objects held in work packets, taking packets as half full
+	 * and objects at the average size scanned by the last complete mark.
+	 * @return the estimate, or 0 if no complete mark was recorded
+	 */
+	uintptr_t estimatePendingMarkWork();
 	
 	bool heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress);
 	bool heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
@@ -308,6 +342,9 @@ public:
 		, _workPackets(NULL)
 		, _heapBase(NULL)
 		, _heapTop(NULL)
+		, _prefetchDepth(0)
+		, _previousMarkBytesScanned(0)
+		, _previousMarkObjectsScanned(0)
 	{
 		_typeId = __FUNCTION__;
 	}
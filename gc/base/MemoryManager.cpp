@@ -30,6 +30,13 @@
 #include "MemcheckWrapper.hpp"
 #endif /* defined(OMR_VALGRIND_MEMCHECK) */
 
+/* OMRTODO temporary workaround to allow both ut_j9mm.h and ut_omrmm.h to be included.
+ *                 Dependency on ut_j9mm.h should be removed in the future.
+ */
+#undef UT_MODULE_LOADED
+#undef UT_MODULE_UNLOADED
+#include "ut_omrmm.h"
+
 MM_MemoryManager*
 MM_MemoryManager::newInstance(MM_EnvironmentBase* env)
 {
@@ -393,11 +400,12 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 }
 
 bool
-MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_MemoryHandle* handle, uintptr_t alignment, uintptr_t size)
+MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_MemoryHandle* handle, uintptr_t alignment, uintptr_t size, const char* name)
 {
 	Assert_MM_true(NULL != handle);
 	Assert_MM_true(NULL == handle->getVirtualMemory());
 	MM_GCExtensionsBase* extensions = env->getExtensions();
+	uintptr_t hugePageAlignment = 0;
 
 	/*
 	 * Can we take already preallocated memory?
@@ -471,6 +479,14 @@ MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_Mem
 				 */
 				allocateSize = MM_Math::roundToCeiling(minimumAllocationUnit, allocateSize);
 				isOverAllocationRequested = true;
+			} else if ((0 != extensions->gcmetadataHugePageAlignment) && (size >= extensions->gcmetadataHugePageAlignment)) {
+				/*
+				 * Start on a huge page boundary so that transparent huge pages can back every whole huge page of the structure
+				 * (the port library advises default page reservations for THP)
+				 */
+				hugePageAlignment = extensions->gcmetadataHugePageAlignment;
+				alignment = OMR_MAX(alignment, hugePageAlignment);
+				allocateSize = size + ((2 * alignment) - 1);
 			}
 
 			/*
@@ -505,9 +521,41 @@ MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_Mem
 		}
 	}
 
+	if (NULL != handle->getVirtualMemory()) {
+		recordMetadataReservation(env, handle, (NULL != name) ? name : "metadata", size, hugePageAlignment);
+	}
+
 	return NULL != handle->getVirtualMemory();
 }
 
+void
+MM_MemoryManager::recordMetadataReservation(MM_EnvironmentBase* env, MM_MemoryHandle* handle, const char* name, uintptr_t size, uintptr_t hugePageAlignment)
+{
+	MM_VirtualMemory* memory = handle->getVirtualMemory();
+	MM_MetadataReservation* reservation = NULL;
+
+	for (uintptr_t i = 0; i < _metadataReservationCount; i++) {
+		if (0 == strcmp(_metadataReservations[i].name, name)) {
+			reservation = &_metadataReservations[i];
+			break;
+		}
+	}
+	if ((NULL == reservation) && (_metadataReservationCount < MEMORYMANAGER_METADATA_RESERVATIONS_MAX)) {
+		reservation = &_metadataReservations[_metadataReservationCount];
+		_metadataReservationCount += 1;
+	}
+
+	if (NULL != reservation) {
+		reservation->name = name;
+		reservation->size = size;
+		reservation->pageSize = memory->getPageSize();
+		reservation->pageFlags = memory->getPageFlags();
+		reservation->hugePageAlignment = hugePageAlignment;
+	}
+
+	Trc_OMRMM_MemoryManager_createVirtualMemoryForMetadata(env->getOmrVMThread(), name, size, memory->getPageSize(), memory->getPageFlags(), hugePageAlignment);
+}
+
 void
 MM_MemoryManager::destroyVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryHandle* handle)
 {
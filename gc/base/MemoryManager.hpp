@@ -32,12 +32,27 @@
 
 class MM_EnvironmentBase;
 
+#define MEMORYMANAGER_METADATA_RESERVATIONS_MAX 16
+
+/**
+ * Page parameters of a GC metadata reservation, recorded for startup reporting
+ */
+typedef struct MM_MetadataReservation {
+	const char* name; /**< name of the structure using the memory */
+	uintptr_t size; /**< bytes used by the structure */
+	uintptr_t pageSize; /**< page size of the memory */
+	uintptr_t pageFlags; /**< page flags of the memory */
+	uintptr_t hugePageAlignment; /**< huge page alignment applied for transparent huge pages, 0 if none */
+} MM_MetadataReservation;
+
 class MM_MemoryManager : public MM_BaseNonVirtual {
 	/*
 	 * Data members
 	 */
 private:
 	MM_MemoryHandle _preAllocated; /**< stored preallocated memory parameters in case of over-allocation */
+	MM_MetadataReservation _metadataReservations[MEMORYMANAGER_METADATA_RESERVATIONS_MAX]; /**< page parameters of the GC metadata reservations */
+	uintptr_t _metadataReservationCount; /**< number of entries used in _metadataReservations */
 
 protected:
 public:
@@ -103,6 +118,18 @@ private:
 	 */
 	bool isLargePage(MM_EnvironmentBase* env, uintptr_t pageSize);
 
+	/**
+	 * Record the page parameters of the memory taken by a GC metadata structure.
+	 * A structure reserving memory again (e.g. on heap expansion) replaces its previous entry.
+	 *
+	 * @param env environment
+	 * @param handle memory handle of the structure
+	 * @param name name of the structure
+	 * @param size bytes used by the structure
+	 * @param hugePageAlignment huge page alignment applied to the memory, 0 if none
+	 */
+	void recordMetadataReservation(MM_EnvironmentBase* env, MM_MemoryHandle* handle, const char* name, uintptr_t size, uintptr_t hugePageAlignment);
+
 protected:
 	/**
 	 * Provide an initialization for the class
@@ -114,6 +141,7 @@ protected:
 
 	MM_MemoryManager(MM_EnvironmentBase* env)
 		: _preAllocated()
+		, _metadataReservationCount(0)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -156,9 +184,27 @@ public:
 	 * @param[in/out] handle pointer to memory handle
 	 * @param heapAlignment required heap alignment
 	 * @param size required memory size
+	 * @param name name of the structure, reported with the page size used
 	 * @return true if pointer to virtual memory is not NULL
 	 */
-	bool createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_MemoryHandle* handle, uintptr_t heapAlignment, uintptr_t size);
+	bool createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_MemoryHandle* handle, uintptr_t heapAlignment, uintptr_t size, const char* name = NULL);
+
+	/**
+	 * @return number of GC metadata reservations recorded
+	 */
+	MMINLINE uintptr_t getMetadataReservationCount()
+	{
+		return _metadataReservationCount;
+	}
+
+	/**
+	 * @param index index of the reservation, less than getMetadataReservationCount()
+	 * @return page parameters of a GC metadata reservation
+	 */
+	MMINLINE MM_MetadataReservation* getMetadataReservation(uintptr_t index)
+	{
+		return &_metadataReservations[index];
+	}
 
 	/**
 	 * Destroy virtual memory instance
@@ -46,6 +46,11 @@
 #include "MemcheckWrapper.hpp"
 #endif /* defined(OMR_VALGRIND_MEMCHECK) */
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+/* Free entries searched for memory in a local NUMA stripe before a TLH is taken from the head of the free list */
+#define NUMA_LOCAL_TLH_SEARCH_LIMIT 16
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
 /**
  * Create and initialize a new instance of the receiver.
  */
@@ -581,6 +586,15 @@ MM_MemoryPoolAddressOrderedList::internalAllocateTLH(MM_EnvironmentBase *env, ui
 		_heapLock.acquire();
 	}
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (_numaStriped && internalAllocateNumaLocalTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, largeObjectAllocateStats)) {
+		if (lockingRequired) {
+			_heapLock.release();
+		}
+		return true;
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 retry:
 	freeEntry = _heapFreeList;
@@ -662,6 +676,115 @@ fail_allocate:
 	return false;
 }
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+/**
+ * Carve a TLH out of a nursery stripe of the NUMA node of the allocating thread.
+ * The free list is searched, in address order, for the first free memory in a local stripe. The TLH does not
+ * extend past the end of that stripe; the free memory before and after it remains in the free list.
+ * Must be called with the heap lock held.
+ * @return true if a TLH was allocated, false if the thread has no node or there is no free memory in its stripes
+ */
+bool
+MM_MemoryPoolAddressOrderedList::internalAllocateNumaLocalTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, MM_LargeObjectAllocateStats *largeObjectAllocateStats)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t localNode = env->getNurseryNumaNode();
+	if (0 == localNode) {
+		return false;
+	}
+	uintptr_t stripeSize = extensions->numaAwareNurseryStripeSize;
+	uintptr_t nodeCount = extensions->numaAwareNurseryNodeCount;
+
+	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
+	MM_HeapLinkedFreeHeader *freeEntry = _heapFreeList;
+	uintptr_t walkCount = 0;
+	/* the nursery free list is short (the pools are rebuilt as one entry per semi space): bound the search anyway */
+	while ((NULL != freeEntry) && (walkCount < NUMA_LOCAL_TLH_SEARCH_LIMIT)) {
+		uintptr_t entryBase = (uintptr_t)freeEntry;
+		uintptr_t entryTop = (uintptr_t)freeEntry->afterEnd();
+		uintptr_t stripeIndex = entryBase / stripeSize;
+		uintptr_t stripesToLocal = ((localNode - 1) + nodeCount - (stripeIndex % nodeCount)) % nodeCount;
+		uintptr_t localStripe = (stripeIndex + stripesToLocal) * stripeSize;
+		uintptr_t localBase = OMR_MAX(localStripe, entryBase);
+		uintptr_t localTop = OMR_MIN(entryTop, localStripe + stripeSize);
+		if (((localTop - localBase) < _minimumFreeEntrySize) && (localTop < entryTop)) {
+			/* the entry starts at the very end of a local stripe: use the next local stripe */
+			localStripe += nodeCount * stripeSize;
+			localBase = localStripe;
+			localTop = OMR_MIN(entryTop, localStripe + stripeSize);
+		}
+
+		if ((localBase < localTop) && ((localTop - localBase) >= _minimumFreeEntrySize)) {
+			uintptr_t prefixSize = localBase - entryBase;
+			if (prefixSize < _minimumFreeEntrySize) {
+				/* too small to stay in the free list: hand it out as the head of the TLH */
+				localBase = entryBase;
+				prefixSize = 0;
+			}
+			uintptr_t consumedSize = OMR_MIN(maximumSizeInBytesRequired, localTop - localBase);
+			uintptr_t recycleEntrySize = entryTop - (localBase + consumedSize);
+			if ((0 != recycleEntrySize) && (recycleEntrySize < _minimumFreeEntrySize)) {
+				consumedSize += recycleEntrySize;
+				recycleEntrySize = 0;
+			}
+			MM_HeapLinkedFreeHeader *entryNext = freeEntry->getNext();
+
+			_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(entryTop - entryBase);
+			_freeMemorySize -= consumedSize;
+			_freeEntryCount -= 1;
+			_allocCount += 1;
+			_allocBytes += consumedSize;
+			_allocSearchCount += walkCount;
+			if (NULL != largeObjectAllocateStats) {
+				largeObjectAllocateStats->incrementTlhAllocSizeClassStats(consumedSize);
+			}
+
+			addrBase = (void *)localBase;
+			addrTop = (void *)(localBase + consumedSize);
+
+			/* the prefix keeps the address (and any hint) of the entry */
+			MM_HeapLinkedFreeHeader *recyclePrevious = previousFreeEntry;
+			if (0 != prefixSize) {
+				recycleHeapChunk((void *)entryBase, (void *)localBase, previousFreeEntry, entryNext);
+				_freeEntryCount += 1;
+				_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(prefixSize);
+				recyclePrevious = freeEntry;
+			}
+			if (0 != recycleEntrySize) {
+				if (recycleHeapChunk(addrTop, (void *)entryTop, recyclePrevious, entryNext)) {
+					_freeEntryCount += 1;
+					_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
+					if (0 == prefixSize) {
+						updateHint(freeEntry, (MM_HeapLinkedFreeHeader *)addrTop);
+					}
+				} else {
+					_freeMemorySize -= recycleEntrySize;
+					_allocDiscardedBytes += recycleEntrySize;
+				}
+			}
+			if ((0 == prefixSize) && (0 == recycleEntrySize)) {
+				/* the whole entry was consumed */
+				if (NULL != previousFreeEntry) {
+					previousFreeEntry->setNext(entryNext);
+				} else {
+					_heapFreeList = entryNext;
+				}
+			}
+			if (0 == prefixSize) {
+				removeHint(freeEntry);
+			}
+			return true;
+		}
+
+		walkCount += 1;
+		previousFreeEntry = freeEntry;
+		freeEntry = freeEntry->getNext();
+	}
+
+	return false;
+}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
 void *
 MM_MemoryPoolAddressOrderedList::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription,
 											uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop)
@@ -1094,6 +1217,9 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	retListMemoryCount = 0;
 	retListMemorySize = 0;
 
+	/* Hints may refer to entries which are about to be removed */
+	clearHints();
+
 	/* Find the first free entry, if any, within specified range */
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
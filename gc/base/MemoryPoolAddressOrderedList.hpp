@@ -59,6 +59,9 @@ private:
 	uintptr_t _hintLru;
 	
 	MM_LargeObjectAllocateStats *_largeObjectCollectorAllocateStats;  /**< Same as _largeObjectAllocateStats except specifically for collector allocates */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	bool _numaStriped; /**< true if TLHs are carved from the nursery stripes of the allocating thread's NUMA node first (see MM_GCExtensionsBase::numaAwareNurseryStripeSize) */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 
 protected:
 public:
@@ -75,6 +78,9 @@ private:
 	void updateHintsBeyondEntry(MM_HeapLinkedFreeHeader *freeEntry);
 	void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	bool internalAllocateNumaLocalTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 
 	bool recycleHeapChunk(void *addrBase, void *addrTop, MM_HeapLinkedFreeHeader *previousFreeEntry, MM_HeapLinkedFreeHeader *nextFreeEntry);	
 	
@@ -133,6 +139,14 @@ public:
 	
 	virtual void appendCollectorLargeAllocateStats();
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/**
+	 * Carve TLHs from the nursery stripes of the allocating thread's NUMA node when there is such free memory.
+	 * @param numaStriped[in] true if the pool covers a striped nursery
+	 */
+	MMINLINE void setNumaStriped(bool numaStriped) { _numaStriped = numaStriped; }
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
 	virtual void mergeFreeEntryAllocateStats() {_largeObjectAllocateStats->getFreeEntrySizeClassStats()->mergeCountForVeryLargeEntries();}
 	
 	virtual bool initializeSweepPool(MM_EnvironmentBase *env);
@@ -153,6 +167,9 @@ public:
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize)
 		,_heapFreeList(NULL)
 		,_largeObjectCollectorAllocateStats(NULL)
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		,_numaStriped(false)
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -161,6 +178,9 @@ public:
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize, name)
 		,_heapFreeList(NULL)
 		,_largeObjectCollectorAllocateStats(NULL)
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		,_numaStriped(false)
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -0,0 +1,1000 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronopt.h"
+#include "ModronAssertions.h"
+
+#include "MemoryPoolSizeClassFreeList.hpp"
+
+#include "AllocateDescription.hpp"
+#include "Collector.hpp"
+#include "Debug.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "LargeObjectAllocateStats.hpp"
+#include "MemorySubSpace.hpp"
+
+#if defined(OMR_VALGRIND_MEMCHECK)
+#include "MemcheckWrapper.hpp"
+#endif /* defined(OMR_VALGRIND_MEMCHECK) */
+
+/**
+ * Create and initialize a new instance of the receiver.
+ */
+MM_MemoryPoolSizeClassFreeList *
+MM_MemoryPoolSizeClassFreeList::newInstance(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize, const char *name)
+{
+	MM_MemoryPoolSizeClassFreeList *memoryPool;
+
+	memoryPool = (MM_MemoryPoolSizeClassFreeList *)env->getForge()->allocate(sizeof(MM_MemoryPoolSizeClassFreeList), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (memoryPool) {
+		memoryPool = new(memoryPool) MM_MemoryPoolSizeClassFreeList(env, minimumFreeEntrySize, name);
+		if (!memoryPool->initialize(env)) {
+			memoryPool->kill(env);
+			memoryPool = NULL;
+		}
+	}
+	return memoryPool;
+}
+
+bool
+MM_MemoryPoolSizeClassFreeList::initialize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *ext = env->getExtensions();
+
+	if (!MM_MemoryPool::initialize(env)) {
+		return false;
+	}
+
+	if (!_extensions->_lazyCollectorInit) {
+		if (!initializeSweepPool(env)) {
+			return false;
+		}
+	}
+
+	/* sweep connects free entries into the address ordered list, postProcess() moves them into the bins */
+	_referenceHeapFreeList = &_heapFreeList;
+	clearBins();
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	_largeObjectAllocateStats = MM_LargeObjectAllocateStats::newInstance(env, (uint16_t)ext->largeObjectAllocationProfilingTopK, ext->largeObjectAllocationProfilingThreshold, ext->largeObjectAllocationProfilingVeryLargeObjectThreshold, (float)ext->largeObjectAllocationProfilingSizeClassRatio / (float)100.0,
+			_extensions->heap->getMaximumMemorySize(), _extensions->tlhMaximumSize + _minimumFreeEntrySize, _extensions->tlhMinimumSize);
+#else
+	_largeObjectAllocateStats = MM_LargeObjectAllocateStats::newInstance(env, (uint16_t)ext->largeObjectAllocationProfilingTopK, ext->largeObjectAllocationProfilingThreshold, ext->largeObjectAllocationProfilingVeryLargeObjectThreshold, (float)ext->largeObjectAllocationProfilingSizeClassRatio / (float)100.0,
+			_extensions->heap->getMaximumMemorySize(), 0, 0);
+#endif
+	if (NULL == _largeObjectAllocateStats) {
+		return false;
+	}
+
+	if (!_heapLock.initialize(env, &ext->lnrlOptions, "MM_MemoryPoolSizeClassFreeList:_heapLock")) {
+		return false;
+	}
+
+	if (!_resetLock.initialize(env, &ext->lnrlOptions, "MM_MemoryPoolSizeClassFreeList:_resetLock")) {
+		return false;
+	}
+
+	return true;
+}
+
+bool
+MM_MemoryPoolSizeClassFreeList::initializeSweepPool(MM_EnvironmentBase *env)
+{
+	if (NULL == _sweepPoolState) {
+		MM_Collector* globalCollector = (MM_Collector*) _extensions->getGlobalCollector();
+		Assert_MM_true(NULL != globalCollector);
+
+		_sweepPoolState = static_cast<MM_SweepPoolState*>(globalCollector->createSweepPoolState(env, this));
+		if (NULL == _sweepPoolState) {
+			return false;
+		}
+
+		_sweepPoolManager = env->getExtensions()->sweepPoolManagerSmallObjectArea;
+	}
+	return true;
+}
+
+void
+MM_MemoryPoolSizeClassFreeList::tearDown(MM_EnvironmentBase *env)
+{
+	MM_MemoryPool::tearDown(env);
+
+	if (NULL != _sweepPoolState) {
+		MM_Collector* globalCollector = (MM_Collector*) _extensions->getGlobalCollector();
+		Assert_MM_true(NULL != globalCollector);
+		globalCollector->deleteSweepPoolState(env, _sweepPoolState);
+	}
+
+	if (NULL != _largeObjectAllocateStats) {
+		_largeObjectAllocateStats->kill(env);
+	}
+
+	_largeObjectCollectorAllocateStats = NULL;
+
+	_heapLock.tearDown();
+	_resetLock.tearDown();
+}
+
+/****************************************
+ * Bin maintenance
+ ****************************************
+ */
+
+void
+MM_MemoryPoolSizeClassFreeList::clearBins()
+{
+	for (uintptr_t bin = 0; bin < SIZECLASS_FREELIST_BIN_COUNT; bin++) {
+		for (uintptr_t subBin = 0; subBin < SIZECLASS_FREELIST_SUB_BIN_COUNT; subBin++) {
+			_bins[bin][subBin] = NULL;
+		}
+		_subBinMap[bin] = 0;
+	}
+	_binMap = 0;
+}
+
+/**
+ * Remove a free entry known to be in the pool from its bin.
+ * Only the bin matching the entry size has to be searched.
+ */
+void
+MM_MemoryPoolSizeClassFreeList::unlinkEntry(MM_HeapLinkedFreeHeader *freeEntry)
+{
+	uintptr_t bin = 0;
+	uintptr_t subBin = 0;
+	mapSizeToBin(freeEntry->getSize(), &bin, &subBin);
+
+	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
+	MM_HeapLinkedFreeHeader *currentFreeEntry = _bins[bin][subBin];
+	while (currentFreeEntry != freeEntry) {
+		Assert_MM_true(NULL != currentFreeEntry);
+		previousFreeEntry = currentFreeEntry;
+		currentFreeEntry = currentFreeEntry->getNext();
+	}
+	unlinkEntry(bin, subBin, previousFreeEntry, freeEntry);
+}
+
+/**
+ * Find the free entry that contains the range [lowAddress, highAddress).
+ * @return the free entry or NULL if the range is not entirely free
+ */
+MM_HeapLinkedFreeHeader *
+MM_MemoryPoolSizeClassFreeList::findFreeEntryContaining(void *lowAddress, void *highAddress)
+{
+	uintptr_t binMap = _binMap;
+	while (0 != binMap) {
+		uintptr_t bin = lowestBit(binMap);
+		binMap &= binMap - 1;
+		for (uintptr_t subBin = 0; subBin < SIZECLASS_FREELIST_SUB_BIN_COUNT; subBin++) {
+			MM_HeapLinkedFreeHeader *currentFreeEntry = _bins[bin][subBin];
+			while (NULL != currentFreeEntry) {
+				if ((lowAddress >= (void *)currentFreeEntry) && (highAddress <= (void *)currentFreeEntry->afterEnd())) {
+					return currentFreeEntry;
+				}
+				currentFreeEntry = currentFreeEntry->getNext();
+			}
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Turn [addrBase, addrTop) into a free entry and add it to its bin if it is large enough for the pool,
+ * otherwise fill it with holes.
+ * @return true if the range was added to the pool
+ */
+bool
+MM_MemoryPoolSizeClassFreeList::recycleHeapChunk(void *addrBase, void *addrTop)
+{
+	Assert_MM_true(addrBase <= addrTop);
+	uintptr_t freeEntrySize = ((uintptr_t)addrTop) - ((uintptr_t)addrBase);
+#if defined(OMR_VALGRIND_MEMCHECK)
+	valgrindMakeMemUndefined((uintptr_t)addrBase, freeEntrySize);
+#endif /* defined(OMR_VALGRIND_MEMCHECK) */
+	MM_HeapLinkedFreeHeader *freeEntry = MM_HeapLinkedFreeHeader::fillWithHoles(addrBase, freeEntrySize);
+	if ((NULL != freeEntry) && (freeEntrySize >= _minimumFreeEntrySize)) {
+		insertEntry(freeEntry);
+		return true;
+	}
+	return false;
+}
+
+/**
+ * Find the first free entry of the pool in bin order (smallest size class first).
+ */
+MM_HeapLinkedFreeHeader *
+MM_MemoryPoolSizeClassFreeList::getFirstBinnedEntry()
+{
+	uintptr_t bin = 0;
+	uintptr_t subBin = 0;
+	if (findNonEmptyBin(&bin, &subBin)) {
+		return _bins[bin][subBin];
+	}
+	return NULL;
+}
+
+/**
+ * Find the free entry following currentFreeEntry in bin order.
+ */
+MM_HeapLinkedFreeHeader *
+MM_MemoryPoolSizeClassFreeList::getNextBinnedEntry(MM_HeapLinkedFreeHeader *currentFreeEntry)
+{
+	MM_HeapLinkedFreeHeader *nextFreeEntry = currentFreeEntry->getNext();
+	if (NULL == nextFreeEntry) {
+		uintptr_t bin = 0;
+		uintptr_t subBin = 0;
+		mapSizeToBin(currentFreeEntry->getSize(), &bin, &subBin);
+		subBin += 1;
+		if (findNonEmptyBin(&bin, &subBin)) {
+			nextFreeEntry = _bins[bin][subBin];
+		}
+	}
+	return nextFreeEntry;
+}
+
+/**
+ * Find the free entry with the lowest address above the given address.
+ * @param address the address to search above, or NULL to find the lowest free entry of the pool
+ * @return the free entry or NULL if there is none
+ */
+MM_HeapLinkedFreeHeader *
+MM_MemoryPoolSizeClassFreeList::findLowestEntryAbove(void *address)
+{
+	MM_HeapLinkedFreeHeader *lowestFreeEntry = NULL;
+	for (MM_HeapLinkedFreeHeader *currentFreeEntry = getFirstBinnedEntry(); NULL != currentFreeEntry; currentFreeEntry = getNextBinnedEntry(currentFreeEntry)) {
+		if (((void *)currentFreeEntry > address) && ((NULL == lowestFreeEntry) || (currentFreeEntry < lowestFreeEntry))) {
+			lowestFreeEntry = currentFreeEntry;
+		}
+	}
+	return lowestFreeEntry;
+}
+
+/**
+ * Distribute a list of free entries into the bins.
+ * @param freeListTail the last entry to distribute, or NULL to distribute until the end of the list
+ */
+void
+MM_MemoryPoolSizeClassFreeList::binFreeList(MM_HeapLinkedFreeHeader *freeListHead, MM_HeapLinkedFreeHeader *freeListTail)
+{
+	MM_HeapLinkedFreeHeader *currentFreeEntry = freeListHead;
+	while (NULL != currentFreeEntry) {
+		MM_HeapLinkedFreeHeader *nextFreeEntry = (currentFreeEntry == freeListTail) ? NULL : currentFreeEntry->getNext();
+		insertEntry(currentFreeEntry);
+		currentFreeEntry = nextFreeEntry;
+	}
+}
+
+/****************************************
+ * Allocation
+ ****************************************
+ */
+MMINLINE void *
+MM_MemoryPoolSizeClassFreeList::internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats)
+{
+	MM_HeapLinkedFreeHeader *freeEntry = NULL;
+	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
+	uintptr_t walkCount = 0;
+	uintptr_t bin = 0;
+	uintptr_t subBin = 0;
+	uintptr_t fittingBin = 0;
+	uintptr_t fittingSubBin = 0;
+
+	if (lockingRequired) {
+		_heapLock.acquire();
+	}
+
+	/* The bin holding the requested size may also hold smaller entries. Look at its first few entries for a
+	 * best fit before taking the head of the smallest bin that is guaranteed to fit.
+	 */
+	mapSizeToBin(sizeInBytesRequired, &bin, &subBin);
+	freeEntry = _bins[bin][subBin];
+	while ((NULL != freeEntry) && (walkCount < SIZECLASS_FREELIST_BEST_FIT_WALK)) {
+		if (sizeInBytesRequired <= freeEntry->getSize()) {
+			break;
+		}
+		walkCount += 1;
+		previousFreeEntry = freeEntry;
+		freeEntry = freeEntry->getNext();
+	}
+
+	if ((NULL == freeEntry) || (sizeInBytesRequired > freeEntry->getSize())) {
+		mapSizeToFittingBin(sizeInBytesRequired, &fittingBin, &fittingSubBin);
+		if (findNonEmptyBin(&fittingBin, &fittingSubBin)) {
+			bin = fittingBin;
+			subBin = fittingSubBin;
+			previousFreeEntry = NULL;
+			freeEntry = _bins[bin][subBin];
+		} else {
+			/* Only the remainder of the bin holding the requested size can satisfy the request */
+			while (NULL != freeEntry) {
+				if (sizeInBytesRequired <= freeEntry->getSize()) {
+					break;
+				}
+				walkCount += 1;
+				previousFreeEntry = freeEntry;
+				freeEntry = freeEntry->getNext();
+			}
+			if (NULL == freeEntry) {
+				goto fail_allocate;
+			}
+		}
+	}
+
+	unlinkEntry(bin, subBin, previousFreeEntry, freeEntry);
+
+	{
+		uintptr_t freeEntrySize = freeEntry->getSize();
+		_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(freeEntrySize);
+
+		/* Adjust the free memory size */
+		_freeMemorySize -= sizeInBytesRequired;
+
+		/* Update allocation statistics */
+		_allocCount += 1;
+		_allocBytes += sizeInBytesRequired;
+		_allocSearchCount += walkCount;
+
+		/* Determine what to do with the recycled portion of the free entry */
+		uintptr_t recycleEntrySize = freeEntrySize - sizeInBytesRequired;
+		void *recycleEntry = (void *)(((uint8_t *)freeEntry) + sizeInBytesRequired);
+		if (recycleHeapChunk(recycleEntry, ((uint8_t *)recycleEntry) + recycleEntrySize)) {
+			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
+		} else {
+			/* Adjust the free memory size and count */
+			_freeMemorySize -= recycleEntrySize;
+			_freeEntryCount -= 1;
+
+			/* Update discard bytes if necessary */
+			_allocDiscardedBytes += recycleEntrySize;
+		}
+	}
+
+	/* Collector object allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStats is null for Survivor) */
+	if (NULL != largeObjectAllocateStats) {
+		largeObjectAllocateStats->allocateObject(sizeInBytesRequired);
+	}
+
+	if (lockingRequired) {
+		_heapLock.release();
+	}
+
+	return (void *)freeEntry;
+
+fail_allocate:
+	/* Since we failed to allocate, update the largest free entry so that outside callers will be able to skip this pool */
+	{
+		uintptr_t largestFreeEntry = 0;
+		if (findLargestBin(&bin, &subBin)) {
+			for (freeEntry = _bins[bin][subBin]; NULL != freeEntry; freeEntry = freeEntry->getNext()) {
+				largestFreeEntry = OMR_MAX(largestFreeEntry, freeEntry->getSize());
+			}
+		}
+		setLargestFreeEntry(largestFreeEntry);
+	}
+	if (lockingRequired) {
+		_heapLock.release();
+	}
+	return NULL;
+}
+
+void *
+MM_MemoryPoolSizeClassFreeList::allocateObject(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
+{
+	void * addr = internalAllocate(env, allocDescription->getContiguousBytes(), true, _largeObjectAllocateStats);
+
+	if (addr != NULL) {
+#if defined(OMR_GC_ALLOCATION_TAX)
+		if (env->getExtensions()->payAllocationTax) {
+			allocDescription->setAllocationTaxSize(allocDescription->getBytesRequested());
+		}
+#endif  /* OMR_GC_ALLOCATION_TAX */
+		allocDescription->setTLHAllocation(false);
+		allocDescription->setNurseryAllocation((_memorySubSpace->getTypeFlags() == MEMORY_TYPE_NEW) ? true : false);
+		allocDescription->setMemoryPool(this);
+	}
+
+	return addr;
+}
+
+void *
+MM_MemoryPoolSizeClassFreeList::collectorAllocate(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool lockingRequired)
+{
+	void *addr = internalAllocate(env, allocDescription->getContiguousBytes(), lockingRequired, _largeObjectCollectorAllocateStats);
+
+	if (addr != NULL) {
+		allocDescription->setTLHAllocation(false);
+		allocDescription->setNurseryAllocation((_memorySubSpace->getTypeFlags() == MEMORY_TYPE_NEW) ? true : false);
+		allocDescription->setMemoryPool(this);
+	}
+
+	return addr;
+}
+
+MMINLINE bool
+MM_MemoryPoolSizeClassFreeList::internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats)
+{
+	MM_HeapLinkedFreeHeader *freeEntry = NULL;
+	uintptr_t bin = 0;
+	uintptr_t subBin = 0;
+
+	if (lockingRequired) {
+		_heapLock.acquire();
+	}
+
+	/* Carve a full sized TLH out of the smallest entry that can hold one, or failing that hand out the
+	 * largest entry available so that the TLH is as big as it can be.
+	 */
+	mapSizeToFittingBin(OMR_MAX(maximumSizeInBytesRequired, _minimumFreeEntrySize), &bin, &subBin);
+	if (!findNonEmptyBin(&bin, &subBin)) {
+		if (!findLargestBin(&bin, &subBin)) {
+			goto fail_allocate;
+		}
+	}
+	freeEntry = _bins[bin][subBin];
+	unlinkEntry(bin, subBin, NULL, freeEntry);
+
+	{
+		/* Consume the bytes and set the return pointer values */
+		uintptr_t freeEntrySize = freeEntry->getSize();
+		Assert_MM_true(freeEntrySize >= _minimumFreeEntrySize);
+		uintptr_t consumedSize = (maximumSizeInBytesRequired > freeEntrySize) ? freeEntrySize : maximumSizeInBytesRequired;
+		_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(freeEntrySize);
+
+		/* If the leftover chunk is smaller than the minimum size, hand it out */
+		uintptr_t recycleEntrySize = freeEntrySize - consumedSize;
+		if (recycleEntrySize && (recycleEntrySize < _minimumFreeEntrySize)) {
+			consumedSize += recycleEntrySize;
+			recycleEntrySize = 0;
+		}
+
+		/* Adjust the free memory size */
+		_freeMemorySize -= consumedSize;
+
+		_allocCount += 1;
+		_allocBytes += consumedSize;
+		/* Collector TLH allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStats is null for Survivor) */
+		if (NULL != largeObjectAllocateStats) {
+			largeObjectAllocateStats->incrementTlhAllocSizeClassStats(consumedSize);
+		}
+
+		addrBase = (void *)freeEntry;
+		addrTop = (void *)(((uint8_t *)addrBase) + consumedSize);
+
+		if (recycleEntrySize > 0) {
+			/* Recycle the remaining entry back into the bins (if applicable) */
+			if (recycleHeapChunk(addrTop, ((uint8_t *)addrTop) + recycleEntrySize)) {
+				_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
+			} else {
+				/* Adjust the free memory size and count */
+				_freeMemorySize -= recycleEntrySize;
+				_freeEntryCount -= 1;
+
+				_allocDiscardedBytes += recycleEntrySize;
+			}
+		} else {
+			_freeEntryCount -= 1;
+		}
+	}
+
+	if (lockingRequired) {
+		_heapLock.release();
+	}
+
+	return true;
+
+fail_allocate:
+	/* if we failed to allocate a TLH, this pool is full */
+	_largestFreeEntry = 0;
+	if (lockingRequired) {
+		_heapLock.release();
+	}
+	return false;
+}
+
+void *
+MM_MemoryPoolSizeClassFreeList::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription,
+											uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop)
+{
+	void *tlhBase = NULL;
+
+	if (internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, true, _largeObjectAllocateStats)) {
+		tlhBase = addrBase;
+	}
+
+	if (NULL != tlhBase) {
+#if defined(OMR_GC_ALLOCATION_TAX)
+		if (env->getExtensions()->payAllocationTax) {
+			allocDescription->setAllocationTaxSize((uint8_t *)addrTop - (uint8_t *)addrBase);
+		}
+#endif  /* OMR_GC_ALLOCATION_TAX */
+
+		allocDescription->setTLHAllocation(true);
+		allocDescription->setNurseryAllocation((_memorySubSpace->getTypeFlags() == MEMORY_TYPE_NEW) ? true : false);
+		allocDescription->setMemoryPool(this);
+	}
+
+	return tlhBase;
+}
+
+void *
+MM_MemoryPoolSizeClassFreeList::collectorAllocateTLH(MM_EnvironmentBase *env,
+													 MM_AllocateDescription *allocDescription, uintptr_t maximumSizeInBytesRequired,
+													 void * &addrBase, void * &addrTop, bool lockingRequired)
+{
+	void *base = NULL;
+	if (internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, lockingRequired, _largeObjectCollectorAllocateStats)) {
+		base = addrBase;
+		allocDescription->setTLHAllocation(true);
+		allocDescription->setNurseryAllocation((_memorySubSpace->getTypeFlags() == MEMORY_TYPE_NEW) ? true : false);
+		allocDescription->setMemoryPool(this);
+	}
+	return base;
+}
+
+/****************************************
+ * Free list building
+ ****************************************
+ */
+
+void
+MM_MemoryPoolSizeClassFreeList::reset(Cause cause)
+{
+	/* Call superclass first .. */
+	MM_MemoryPool::reset(cause);
+
+	clearBins();
+	_heapFreeList = NULL;
+
+	_lastFreeEntry = NULL;
+	resetFreeEntryAllocateStats(_largeObjectAllocateStats);
+	resetLargeObjectAllocateStats();
+}
+
+/**
+ * Move the address ordered list connected by sweep into the bins.
+ * The free memory statistics have already been updated by the sweep pool manager.
+ */
+void
+MM_MemoryPoolSizeClassFreeList::postProcess(MM_EnvironmentBase *env, Cause cause)
+{
+	binFreeList(_heapFreeList, NULL);
+	_heapFreeList = NULL;
+}
+
+/**
+ * As opposed to reset, which will empty out, this will fill out as if everything is free.
+ * Returns the free entry created for the given region
+ */
+MM_HeapLinkedFreeHeader *
+MM_MemoryPoolSizeClassFreeList::rebuildFreeListInRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, MM_HeapLinkedFreeHeader *previousFreeEntry)
+{
+	MM_HeapLinkedFreeHeader *newFreeEntry = NULL;
+	void* rangeBase = region->getLowAddress();
+	void* rangeTop = region->getHighAddress();
+	uintptr_t rangeSize = region->getSize();
+
+	acquireResetLock(env);
+	lock(env);
+	/* The bins are not address ordered, so there is nothing to link previousFreeEntry to. It only tells the first
+	 * region of a rebuild (NULL), which empties the pool, from the following ones, which add to it.
+	 */
+	if (NULL == previousFreeEntry) {
+		reset();
+	}
+
+	if (recycleHeapChunk(rangeBase, rangeTop)) {
+		newFreeEntry = (MM_HeapLinkedFreeHeader *)rangeBase;
+
+		/* Adjust the free memory data */
+		_freeMemorySize += rangeSize;
+		_freeEntryCount += 1;
+		/* the pool was reset or holds the previous regions, so it's safe to call increment */
+		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(rangeSize);
+
+		TRIGGER_J9HOOK_MM_PRIVATE_REBUILD_FREE_LIST(env->getExtensions()->privateHookInterface, env->getOmrVMThread(), rangeBase, rangeTop);
+	}
+	unlock(env);
+	releaseResetLock(env);
+
+	return newFreeEntry;
+}
+
+#if defined(DEBUG)
+/**
+ * The bins are not address ordered, only the list connected by sweep (before postProcess) must be.
+ */
+bool
+MM_MemoryPoolSizeClassFreeList::isValidListOrdering()
+{
+	MM_HeapLinkedFreeHeader *walk = _heapFreeList;
+	while (NULL != walk) {
+		if ((NULL != walk->getNext()) && (walk >= walk->getNext())) {
+			return false;
+		}
+		walk = walk->getNext();
+	}
+	return true;
+}
+
+bool
+MM_MemoryPoolSizeClassFreeList::isMemoryPoolValid(MM_EnvironmentBase *env, bool postCollect)
+{
+	uintptr_t freeBytes = 0;
+	uintptr_t freeCount = 0;
+	uintptr_t largestFree = 0;
+
+	MM_HeapLinkedFreeHeader *currentFreeEntry = getFirstBinnedEntry();
+	while (NULL != currentFreeEntry) {
+		uintptr_t currentFreeEntrySize = currentFreeEntry->getSize();
+		freeBytes += currentFreeEntrySize;
+		freeCount += 1;
+		largestFree = OMR_MAX(largestFree, currentFreeEntrySize);
+		currentFreeEntry = getNextBinnedEntry(currentFreeEntry);
+	}
+
+	return (freeBytes == _freeMemorySize) && (freeCount == _freeEntryCount) && (postCollect || (largestFree == _largestFreeEntry));
+}
+#endif /* DEBUG */
+
+/**
+ * Add the range of memory to the free memory of the receiver.
+ *
+ * @param expandSize Number of bytes to add to the memory pool
+ * @param lowAddress Low address of memory to add (inclusive)
+ * @param highAddress High address of memory to add (non inclusive)
+ */
+void
+MM_MemoryPoolSizeClassFreeList::expandWithRange(MM_EnvironmentBase *env, uintptr_t expandSize, void *lowAddress, void *highAddress, bool canCoalesce)
+{
+	if (0 == expandSize) {
+		return ;
+	}
+
+	/* Handle the entries that are too small to make the free list */
+	if (expandSize < _minimumFreeEntrySize) {
+		abandonHeapChunk(lowAddress, highAddress);
+		return ;
+	}
+
+	void *freeEntryBase = lowAddress;
+	void *freeEntryTop = highAddress;
+	uintptr_t coalescedCount = 0;
+
+	if (canCoalesce) {
+		/* Fuse the range with the free entries that end at its base and start at its top, if any */
+		MM_HeapLinkedFreeHeader *previousFreeEntry = (MM_HeapLinkedFreeHeader *)findFreeEntryEndingAtAddr(env, lowAddress);
+		if (NULL != previousFreeEntry) {
+			_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(previousFreeEntry->getSize());
+			unlinkEntry(previousFreeEntry);
+			freeEntryBase = previousFreeEntry;
+			coalescedCount += 1;
+		}
+		void *nextFreeEntryTop = findFreeEntryTopStartingAtAddr(env, highAddress);
+		if (NULL != nextFreeEntryTop) {
+			MM_HeapLinkedFreeHeader *nextFreeEntry = (MM_HeapLinkedFreeHeader *)highAddress;
+			_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(nextFreeEntry->getSize());
+			unlinkEntry(nextFreeEntry);
+			freeEntryTop = nextFreeEntryTop;
+			coalescedCount += 1;
+		}
+	}
+
+	recycleHeapChunk(freeEntryBase, freeEntryTop);
+	uintptr_t freeEntrySize = (uintptr_t)freeEntryTop - (uintptr_t)freeEntryBase;
+
+	/* Update the free list information */
+	_freeMemorySize += expandSize;
+	_freeEntryCount = _freeEntryCount + 1 - coalescedCount;
+	_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(freeEntrySize);
+
+	if (freeEntrySize > _largestFreeEntry) {
+		_largestFreeEntry = freeEntrySize;
+	}
+
+	assume0(isMemoryPoolValid(env, true));
+}
+
+/**
+ * Remove the range of memory from the free memory of the receiver.
+ *
+ * @param contractSize Number of bytes to remove from the memory pool
+ * @param lowAddress Low address of memory to remove (inclusive)
+ * @param highAddress High address of memory to remove (non inclusive)
+ *
+ * @note The expectation is that the range consists ONLY of free elements (no live data appears).
+ */
+void *
+MM_MemoryPoolSizeClassFreeList::contractWithRange(MM_EnvironmentBase *env, uintptr_t contractSize, void *lowAddress, void *highAddress)
+{
+	if (0 == contractSize) {
+		return NULL;
+	}
+
+	/* Find the free entry that encompasses the range to contract */
+	MM_HeapLinkedFreeHeader *currentFreeEntry = findFreeEntryContaining(lowAddress, highAddress);
+	Assert_MM_true(NULL != currentFreeEntry);  /* Can't contract what doesn't exist */
+
+	uintptr_t totalContractSize = contractSize;
+	intptr_t contractCount = 1;
+	void *currentFreeEntryTop = (void *)currentFreeEntry->afterEnd();
+	_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(currentFreeEntry->getSize());
+	unlinkEntry(currentFreeEntry);
+
+	/* Determine what to do with any trailing bytes to the free entry that are not being contracted. */
+	if (currentFreeEntryTop != highAddress) {
+		uintptr_t trailingSize = ((uintptr_t)currentFreeEntryTop) - ((uintptr_t)highAddress);
+		if (recycleHeapChunk(highAddress, currentFreeEntryTop)) {
+			contractCount -= 1;
+			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(trailingSize);
+		} else {
+			totalContractSize += trailingSize;
+		}
+	}
+
+	/* Determine what to do with any leading bytes to the free entry that are not being contracted. */
+	if ((void *)currentFreeEntry != lowAddress) {
+		uintptr_t leadingSize = ((uintptr_t)lowAddress) - ((uintptr_t)currentFreeEntry);
+		if (recycleHeapChunk(currentFreeEntry, lowAddress)) {
+			contractCount -= 1;
+			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(leadingSize);
+		} else {
+			totalContractSize += leadingSize;
+		}
+	}
+
+	/* Adjust the free memory data */
+	_freeMemorySize -= totalContractSize;
+	_freeEntryCount -= contractCount;
+
+	assume0(isMemoryPoolValid(env, true));
+
+	return lowAddress;
+}
+
+/**
+ * Add contents of an address ordered list of free entries (built by compaction) to the bins.
+ *
+ * @param freeListHead Head of list of free entries to be added
+ * @param freeListTail Tail of list of free entries to be added
+ */
+void
+MM_MemoryPoolSizeClassFreeList::addFreeEntries(MM_EnvironmentBase *env,
+												MM_HeapLinkedFreeHeader* &freeListHead, MM_HeapLinkedFreeHeader* &freeListTail,
+												uintptr_t freeListMemoryCount, uintptr_t freeListMemorySize)
+{
+	MM_HeapLinkedFreeHeader *currentFreeEntry = freeListHead;
+	while (NULL != currentFreeEntry) {
+		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(currentFreeEntry->getSize());
+		currentFreeEntry = (currentFreeEntry == freeListTail) ? NULL : currentFreeEntry->getNext();
+	}
+
+	binFreeList(freeListHead, freeListTail);
+
+	/* Adjust the free memory data */
+	_freeMemorySize += freeListMemorySize;
+	_freeEntryCount += freeListMemoryCount;
+}
+
+/**
+ * Find the free entry whose end address matches the parameter.
+ * @note All bins are searched, which is linear in the number of free entries as it is for the address ordered
+ * list. The callers (expansion coalescing and contraction) run only when the heap is resized.
+ *
+ * @param addr Address to match against the high end of a free entry.
+ *
+ * @return The leading address of the free entry whose top matches addr.
+ */
+void *
+MM_MemoryPoolSizeClassFreeList::findFreeEntryEndingAtAddr(MM_EnvironmentBase *env, void *addr)
+{
+	MM_HeapLinkedFreeHeader *currentFreeEntry = getFirstBinnedEntry();
+	while (NULL != currentFreeEntry) {
+		if (((void *)currentFreeEntry->afterEnd()) == addr) {
+			break;
+		}
+		currentFreeEntry = getNextBinnedEntry(currentFreeEntry);
+	}
+
+	return currentFreeEntry;
+}
+
+/**
+ * @copydoc MM_MemoryPool::getAvailableContractionSizeForRangeEndingAt(MM_EnvironmentBase *, MM_AllocateDescription *, void *, void *)
+ */
+uintptr_t
+MM_MemoryPoolSizeClassFreeList::getAvailableContractionSizeForRangeEndingAt(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, void *lowAddr, void *highAddr)
+{
+	MM_HeapLinkedFreeHeader *lastFree = (MM_HeapLinkedFreeHeader *)findFreeEntryEndingAtAddr(env, highAddr);
+
+	/* If matching free entry found */
+	if (NULL == lastFree) {
+		/* No free entry with matching end address so return 0 */
+		return 0;
+	}
+
+	uintptr_t availableContractSize = lastFree->getSize();
+
+	/* Is the last free element a candidate to satisfy the allocation request ?
+	 * If so we have to assume it is the only free element that could satisfy the
+	 * request and adjust the maximumContractSize.
+	 */
+	uintptr_t allocSize = 0;
+	if (NULL != allocDescription) {
+		allocSize = allocDescription->getContiguousBytes();
+	}
+	if ((allocSize != 0) && (allocSize <= availableContractSize)) {
+		 availableContractSize -= allocSize;
+	}
+
+	return availableContractSize;
+}
+
+/**
+ * Find the top of the free entry whose start address matches the parameter.
+ * @note Linear in the number of free entries, see findFreeEntryEndingAtAddr(). addr may be the top of the heap,
+ * so it cannot be read to find the bin of the entry.
+ *
+ * @param addr Address to match against the low end of a free entry.
+ *
+ * @return The trailing address of the free entry whose base matches addr.
+ */
+void *
+MM_MemoryPoolSizeClassFreeList::findFreeEntryTopStartingAtAddr(MM_EnvironmentBase *env, void *addr)
+{
+	MM_HeapLinkedFreeHeader *currentFreeEntry = getFirstBinnedEntry();
+	while (NULL != currentFreeEntry) {
+		if ((void *)currentFreeEntry == addr) {
+			return (void *)currentFreeEntry->afterEnd();
+		}
+		currentFreeEntry = getNextBinnedEntry(currentFreeEntry);
+	}
+
+	return NULL;
+}
+
+/**
+ * Find the free entry with the lowest address, as for the address ordered list (card cleaning cleans the cards
+ * below it first).
+ * @note The bins are not address ordered, so all of them are searched.
+ *
+ * @return The address of the first free entry
+ */
+void *
+MM_MemoryPoolSizeClassFreeList::getFirstFreeStartingAddr(MM_EnvironmentBase *env)
+{
+	return findLowestEntryAbove(NULL);
+}
+
+/**
+ * Find the free entry following currentFree in address order.
+ * @note Each call searches all bins, so walking the whole pool this way is quadratic. Walks that do not need
+ * address order use getFirstBinnedEntry() and getNextBinnedEntry().
+ *
+ * @return The address of next free entry or NULL
+ */
+void *
+MM_MemoryPoolSizeClassFreeList::getNextFreeStartingAddr(MM_EnvironmentBase *env, void *currentFree)
+{
+	assume0(currentFree != NULL);
+	return findLowestEntryAbove(currentFree);
+}
+
+/**
+ * Lock any free list information from use.
+ */
+void
+MM_MemoryPoolSizeClassFreeList::lock(MM_EnvironmentBase *env)
+{
+	_heapLock.acquire();
+}
+
+/**
+ * Unlock any free list information for use.
+ */
+void
+MM_MemoryPoolSizeClassFreeList::unlock(MM_EnvironmentBase *env)
+{
+	_heapLock.release();
+}
+
+/*
+ * Debug routine to dump details of the current state of the bins
+ */
+void
+MM_MemoryPoolSizeClassFreeList::printCurrentFreeList(MM_EnvironmentBase *env, const char *area)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	omrtty_printf("Analysis of %s freelist: \n", area);
+
+	uintptr_t binMap = _binMap;
+	while (0 != binMap) {
+		uintptr_t bin = lowestBit(binMap);
+		binMap &= binMap - 1;
+		for (uintptr_t subBin = 0; subBin < SIZECLASS_FREELIST_SUB_BIN_COUNT; subBin++) {
+			MM_HeapLinkedFreeHeader *currentFreeEntry = _bins[bin][subBin];
+			if (NULL != currentFreeEntry) {
+				omrtty_printf("Bin %zu/%zu:\n", bin + SIZECLASS_FREELIST_MINIMUM_LOG2, subBin);
+			}
+			while (NULL != currentFreeEntry) {
+				omrtty_printf("Free chunk %p -> %p (%i) \n",
+							currentFreeEntry,
+							currentFreeEntry->afterEnd(),
+							currentFreeEntry->getSize());
+				currentFreeEntry = currentFreeEntry->getNext();
+			}
+		}
+	}
+}
+
+void
+MM_MemoryPoolSizeClassFreeList::recalculateMemoryPoolStatistics(MM_EnvironmentBase *env)
+{
+	uintptr_t largestFreeEntry = 0;
+	uintptr_t freeBytes = 0;
+	uintptr_t freeEntryCount = 0;
+	_largeObjectAllocateStats->getFreeEntrySizeClassStats()->resetCounts();
+
+	MM_HeapLinkedFreeHeader *freeHeader = getFirstBinnedEntry();
+	while (NULL != freeHeader) {
+		uintptr_t freeSize = freeHeader->getSize();
+		if (freeSize > largestFreeEntry) {
+			largestFreeEntry = freeSize;
+		}
+		freeBytes += freeSize;
+		freeEntryCount += 1;
+		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(freeSize);
+		freeHeader = getNextBinnedEntry(freeHeader);
+	}
+
+	updateMemoryPoolStatistics(env, freeBytes, freeEntryCount, largestFreeEntry);
+}
+
+void
+MM_MemoryPoolSizeClassFreeList::appendCollectorLargeAllocateStats()
+{
+	_largeObjectCollectorAllocateStats = _largeObjectAllocateStats;
+}
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+uintptr_t
+MM_MemoryPoolSizeClassFreeList::releaseFreeMemoryPages(MM_EnvironmentBase* env)
+{
+	uintptr_t releasedBytes = 0;
+	_heapLock.acquire();
+	uintptr_t binMap = _binMap;
+	while (0 != binMap) {
+		uintptr_t bin = lowestBit(binMap);
+		binMap &= binMap - 1;
+		for (uintptr_t subBin = 0; subBin < SIZECLASS_FREELIST_SUB_BIN_COUNT; subBin++) {
+			releasedBytes += releaseFreeEntryMemoryPages(env, _bins[bin][subBin]);
+		}
+	}
+	_heapLock.release();
+	return releasedBytes;
+}
+#endif
@@ -0,0 +1,275 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(MEMORYPOOLSIZECLASSFREELIST_HPP_)
+#define MEMORYPOOLSIZECLASSFREELIST_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronopt.h"
+
+#include "Bits.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "LightweightNonReentrantLock.hpp"
+#include "MemoryPoolAddressOrderedListBase.hpp"
+#include "EnvironmentBase.hpp"
+
+class MM_AllocateDescription;
+
+#define SIZECLASS_FREELIST_SUB_BIN_SHIFT 3
+#define SIZECLASS_FREELIST_SUB_BIN_COUNT (((uintptr_t)1) << SIZECLASS_FREELIST_SUB_BIN_SHIFT)
+#define SIZECLASS_FREELIST_MINIMUM_LOG2 SIZECLASS_FREELIST_SUB_BIN_SHIFT
+#define SIZECLASS_FREELIST_BIN_COUNT (J9BITS_BITS_IN_SLOT - SIZECLASS_FREELIST_MINIMUM_LOG2)
+#define SIZECLASS_FREELIST_BEST_FIT_WALK 4
+
+/**
+ * Memory pool that keeps its free entries in size class bins rather than in a single address ordered list.
+ * Each power of two size range is split into SIZECLASS_FREELIST_SUB_BIN_COUNT linear sub bins, and a two level
+ * bitmap records which bins are non-empty, so the smallest bin whose entries all satisfy a request is found
+ * with a couple of bit scans, no matter how fragmented the pool is.
+ *
+ * Sweep still connects free entries into an address ordered list (the inherited AOL sweep support) which
+ * the pool then distributes into bins in postProcess().
+ *
+ * There is no address ordered index. The address based queries and their callers are:
+ * - getFirstFreeStartingAddr() returns the lowest free entry, which card cleaning relies on, and
+ *   getNextFreeStartingAddr() the next one in address order. Each call searches all bins.
+ * - findFreeEntryEndingAtAddr(), findFreeEntryTopStartingAtAddr() and contractWithRange() search all bins.
+ *   They are only used to coalesce or contract when the heap is resized.
+ * - rebuildFreeListInRegion() has no list to link previousFreeEntry to, it only uses it to tell the first
+ *   region of a rebuild from the following ones.
+ * Walks that visit every entry without needing address order use the bins directly.
+ * The pool does not support the large object area or concurrent sweep.
+ * @ingroup GC_Base_Core
+ */
+class MM_MemoryPoolSizeClassFreeList : public MM_MemoryPoolAddressOrderedListBase
+{
+/*
+ * Data members
+ */
+private:
+	MM_LightweightNonReentrantLock _heapLock;
+	MM_HeapLinkedFreeHeader *_heapFreeList; /**< address ordered list built by sweep, distributed into the bins by postProcess() */
+
+	MM_HeapLinkedFreeHeader *_bins[SIZECLASS_FREELIST_BIN_COUNT][SIZECLASS_FREELIST_SUB_BIN_COUNT]; /**< heads of the (unordered) bin lists */
+	uintptr_t _binMap; /**< bit n is set if any sub bin of power of two range n is non-empty */
+	uintptr_t _subBinMap[SIZECLASS_FREELIST_BIN_COUNT]; /**< bit m of entry n is set if _bins[n][m] is non-empty */
+
+	MM_LargeObjectAllocateStats *_largeObjectCollectorAllocateStats; /**< Same as _largeObjectAllocateStats except specifically for collector allocates */
+protected:
+public:
+
+/*
+ * Function members
+ */
+private:
+	/**
+	 * @return the index of the most significant bit set in value (value must not be 0)
+	 */
+	static MMINLINE uintptr_t highestBit(uintptr_t value) { return (J9BITS_BITS_IN_SLOT - 1) - MM_Bits::trailingZeroes(value); }
+
+	/**
+	 * @return the index of the least significant bit set in value (value must not be 0)
+	 */
+	static MMINLINE uintptr_t lowestBit(uintptr_t value) { return MM_Bits::leadingZeroes(value); }
+
+public:
+	/**
+	 * Find the bin that holds free entries of the given size.
+	 */
+	static MMINLINE void
+	mapSizeToBin(uintptr_t size, uintptr_t *bin, uintptr_t *subBin)
+	{
+		uintptr_t log2 = highestBit(size);
+		*subBin = (size >> (log2 - SIZECLASS_FREELIST_SUB_BIN_SHIFT)) & (SIZECLASS_FREELIST_SUB_BIN_COUNT - 1);
+		*bin = log2 - SIZECLASS_FREELIST_MINIMUM_LOG2;
+	}
+
+	/**
+	 * Find the lowest bin in which every free entry is at least the given size.
+	 */
+	static MMINLINE void
+	mapSizeToFittingBin(uintptr_t size, uintptr_t *bin, uintptr_t *subBin)
+	{
+		uintptr_t log2 = highestBit(size);
+		mapSizeToBin(size + (((uintptr_t)1) << (log2 - SIZECLASS_FREELIST_SUB_BIN_SHIFT)) - 1, bin, subBin);
+	}
+
+private:
+	/**
+	 * Find the first non-empty bin at or above (bin, subBin).
+	 * @return true if one was found, in which case bin and subBin are updated to identify it
+	 */
+	MMINLINE bool
+	findNonEmptyBin(uintptr_t *bin, uintptr_t *subBin)
+	{
+		uintptr_t searchBin = *bin;
+		if (searchBin >= SIZECLASS_FREELIST_BIN_COUNT) {
+			return false;
+		}
+		uintptr_t subMap = 0;
+		if (*subBin < SIZECLASS_FREELIST_SUB_BIN_COUNT) {
+			subMap = _subBinMap[searchBin] & (((uintptr_t)-1) << *subBin);
+		}
+		if (0 == subMap) {
+			uintptr_t map = 0;
+			if ((searchBin + 1) < SIZECLASS_FREELIST_BIN_COUNT) {
+				map = _binMap & (((uintptr_t)-1) << (searchBin + 1));
+			}
+			if (0 == map) {
+				return false;
+			}
+			searchBin = lowestBit(map);
+			subMap = _subBinMap[searchBin];
+		}
+		*bin = searchBin;
+		*subBin = lowestBit(subMap);
+		return true;
+	}
+
+	/**
+	 * Find the highest non-empty bin.
+	 * @return true if the pool has any free entry, in which case bin and subBin identify the bin
+	 */
+	MMINLINE bool
+	findLargestBin(uintptr_t *bin, uintptr_t *subBin)
+	{
+		if (0 == _binMap) {
+			return false;
+		}
+		*bin = highestBit(_binMap);
+		*subBin = highestBit(_subBinMap[*bin]);
+		return true;
+	}
+
+	MMINLINE void
+	insertEntry(MM_HeapLinkedFreeHeader *freeEntry)
+	{
+		uintptr_t bin = 0;
+		uintptr_t subBin = 0;
+		mapSizeToBin(freeEntry->getSize(), &bin, &subBin);
+		freeEntry->setNext(_bins[bin][subBin]);
+		_bins[bin][subBin] = freeEntry;
+		_subBinMap[bin] |= ((uintptr_t)1) << subBin;
+		_binMap |= ((uintptr_t)1) << bin;
+	}
+
+	/**
+	 * Remove freeEntry from bin (bin, subBin) given the entry preceding it in the bin (NULL if freeEntry is the head).
+	 */
+	MMINLINE void
+	unlinkEntry(uintptr_t bin, uintptr_t subBin, MM_HeapLinkedFreeHeader *previousFreeEntry, MM_HeapLinkedFreeHeader *freeEntry)
+	{
+		MM_HeapLinkedFreeHeader *nextFreeEntry = freeEntry->getNext();
+		if (NULL != previousFreeEntry) {
+			previousFreeEntry->setNext(nextFreeEntry);
+		} else {
+			_bins[bin][subBin] = nextFreeEntry;
+			if (NULL == nextFreeEntry) {
+				_subBinMap[bin] &= ~(((uintptr_t)1) << subBin);
+				if (0 == _subBinMap[bin]) {
+					_binMap &= ~(((uintptr_t)1) << bin);
+				}
+			}
+		}
+	}
+
+	void clearBins();
+	MM_HeapLinkedFreeHeader *getFirstBinnedEntry();
+	MM_HeapLinkedFreeHeader *getNextBinnedEntry(MM_HeapLinkedFreeHeader *currentFreeEntry);
+	MM_HeapLinkedFreeHeader *findLowestEntryAbove(void *address);
+	void unlinkEntry(MM_HeapLinkedFreeHeader *freeEntry);
+	MM_HeapLinkedFreeHeader *findFreeEntryContaining(void *lowAddress, void *highAddress);
+	bool recycleHeapChunk(void *addrBase, void *addrTop);
+	void binFreeList(MM_HeapLinkedFreeHeader *freeListHead, MM_HeapLinkedFreeHeader *freeListTail);
+
+	void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
+	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
+
+protected:
+public:
+	static MM_MemoryPoolSizeClassFreeList *newInstance(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize, const char *name);
+
+	virtual void lock(MM_EnvironmentBase *env);
+	virtual void unlock(MM_EnvironmentBase *env);
+
+	virtual void *allocateObject(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
+	virtual void *allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop);
+	virtual void *collectorAllocate(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool lockingRequired);
+	virtual void *collectorAllocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired);
+
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+	virtual void reset(Cause cause = any);
+	virtual void postProcess(MM_EnvironmentBase *env, Cause cause);
+	virtual MM_HeapLinkedFreeHeader *rebuildFreeListInRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, MM_HeapLinkedFreeHeader *previousFreeEntry);
+#if defined(DEBUG)
+	virtual bool isValidListOrdering();
+	bool isMemoryPoolValid(MM_EnvironmentBase *env, bool postCollect);
+#endif /* DEBUG */
+
+	virtual void addFreeEntries(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader* &freeListHead, MM_HeapLinkedFreeHeader* &freeListTail,
+								uintptr_t freeListMemoryCount, uintptr_t freeListMemorySize);
+
+	virtual void expandWithRange(MM_EnvironmentBase *env, uintptr_t expandSize, void *lowAddress, void *highAddress, bool canCoalesce);
+	virtual void *contractWithRange(MM_EnvironmentBase *env, uintptr_t contractSize, void *lowAddress, void *highAddress);
+
+	virtual void *findFreeEntryEndingAtAddr(MM_EnvironmentBase *env, void *addr);
+	virtual uintptr_t getAvailableContractionSizeForRangeEndingAt(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, void *lowAddr, void *highAddr);
+	virtual void *findFreeEntryTopStartingAtAddr(MM_EnvironmentBase *env, void *addr);
+	virtual void *getFirstFreeStartingAddr(MM_EnvironmentBase *env);
+	virtual void *getNextFreeStartingAddr(MM_EnvironmentBase *env, void *currentFree);
+
+	virtual void printCurrentFreeList(MM_EnvironmentBase *env, const char *area);
+
+	virtual void appendCollectorLargeAllocateStats();
+	virtual void mergeFreeEntryAllocateStats() {_largeObjectAllocateStats->getFreeEntrySizeClassStats()->mergeCountForVeryLargeEntries();}
+
+	virtual bool initializeSweepPool(MM_EnvironmentBase *env);
+
+	/**
+	 * Recalculate the memory pool statistics by actually examining the contents of the pool.
+	 */
+	virtual void recalculateMemoryPoolStatistics(MM_EnvironmentBase *env);
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+#endif
+
+	/**
+	 * Create a MemoryPoolSizeClassFreeList object.
+	 */
+	MM_MemoryPoolSizeClassFreeList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize, const char *name) :
+		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize, name)
+		,_heapFreeList(NULL)
+		,_binMap(0)
+		,_largeObjectCollectorAllocateStats(NULL)
+	{
+		_typeId = __FUNCTION__;
+	};
+};
+
+#endif /* MEMORYPOOLSIZECLASSFREELIST_HPP_ */
@@ -783,6 +783,8 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectTilt(MM_EnvironmentBas
 			desiredSurvivorSize += _avgBytesAllocatedDuringConcurrent * 1.1
 									 + extensions->concurrentScavengerAllocDeviationBoost * (uintptr_t)_avgDeviationBytesAllocatedDuringConcurrent
 									 + extensions->concurrentScavengerSlack;
+			/* Room the pacing controller predicts the next concurrent phase will lack */
+			desiredSurvivorSize += extensions->scavengerStats._pacingSurvivorReserve;
 			if (debug) {
 				omrtty_printf("\tmutator bytesAllocated current %zu average %zu\n", _bytesAllocatedDuringConcurrent, _avgBytesAllocatedDuringConcurrent);
 				omrtty_printf("\tmutator bytesAllocated deviation current %f average %f (%f%% of average allocation)\n",
@@ -95,7 +95,9 @@ void
 MM_MemorySubSpaceUniSpace::checkResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool _systemGC)
 {
 	uintptr_t oldVMState = env->pushVMstate(OMRVMSTATE_GC_CHECK_RESIZE);
-	if (!timeForHeapContract(env, allocDescription, _systemGC)) {
+	if (_extensions->predictiveHeapSizing) {
+		timeForHeapResizePredictive(env, allocDescription, _systemGC);
+	} else if (!timeForHeapContract(env, allocDescription, _systemGC)) {
 		timeForHeapExpand(env, allocDescription);
 	}
 	env->popVMstate(oldVMState);
@@ -349,6 +351,85 @@ MM_MemorySubSpaceUniSpace::timeForHeapContract(MM_EnvironmentBase *env, MM_Alloc
 }
 
 
+/**
+ * Determine how much we should attempt to expand or contract subspace by using the predictive resize model
+ * (-Xgc:predictiveHeapSizing) and store the result in _expansionSize or _contractionSize.
+ * Expansions required to satisfy the allocation and contractions required by -XsoftMx are handled as in the
+ * threshold based policy.
+ * @return true if expansion or contraction size is non zero
+ */
+bool
+MM_MemorySubSpaceUniSpace::timeForHeapResizePredictive(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool systemGC)
+{
+	_expansionSize = 0;
+	_contractionSize = 0;
+
+	uintptr_t allocSize = 0;
+	if (NULL != allocDescription) {
+		allocSize = allocDescription->getBytesRequested();
+		if (env->getMemorySpace()->findLargestFreeEntry(env, allocDescription) < allocSize) {
+			/* we have not met the allocation request, expand to satisfy it */
+			return timeForHeapExpand(env, allocDescription);
+		}
+	}
+
+	uintptr_t currentHeapSize = getActiveMemorySize();
+	uintptr_t actualSoftMx = _extensions->getHeap()->getActualSoftMxSize(env);
+	if ((0 != actualSoftMx) && (actualSoftMx < currentHeapSize)) {
+		return timeForHeapContract(env, allocDescription, systemGC);
+	}
+
+	uintptr_t currentFree = getApproximateActiveFreeMemorySize();
+	currentFree = (allocSize > currentFree) ? 0 : (currentFree - allocSize);
+
+	MM_HeapResizeStats *resizeStats = _extensions->heap->getResizeStats();
+	MM_HeapResizeModel *resizeModel = resizeStats->getResizeModel();
+	uintptr_t deadBand = OMR_MAX((uintptr_t)(currentHeapSize * _extensions->globalMinimumContraction), _extensions->regionSize);
+	intptr_t resize = resizeModel->predictResize(currentHeapSize, currentFree, _extensions->predictiveHeapSizingWeight,
+		_extensions->heapContractionGCTimeThreshold, _extensions->heapExpansionGCTimeThreshold,
+		(_extensions->heapFreeMinimumRatioMultiplier * 100) / _extensions->heapFreeMinimumRatioDivisor,
+		(_extensions->heapFreeMaximumRatioMultiplier * 100) / _extensions->heapFreeMaximumRatioDivisor,
+		_extensions->predictiveHeapSizingStabilizationCount, deadBand);
+
+	if (0 < resize) {
+		if ((NULL == _physicalSubArena) || !_physicalSubArena->canExpand(env) || (0 == maxExpansionInSpace(env))) {
+			return false;
+		}
+		uintptr_t expandSize = MM_Math::roundToCeiling(_extensions->heapAlignment, (uintptr_t)resize);
+		expandSize = adjustExpansionWithinFreeLimits(env, expandSize);
+		expandSize = adjustExpansionWithinUserIncrement(env, expandSize);
+		_expansionSize = adjustExpansionWithinSoftMax(env, expandSize, 0);
+		if (HEAP_RESIZE_MODEL_FREE_TOO_LOW == resizeModel->getLastReason()) {
+			resizeStats->setLastExpandReason(FREE_SPACE_LESS_MINF);
+		} else {
+			resizeStats->setLastExpandReason(GC_RATIO_PREDICTED_TOO_HIGH);
+		}
+	} else if (0 > resize) {
+		if ((NULL == _physicalSubArena) || !_physicalSubArena->canContract(env) || (0 == maxContraction(env))) {
+			return false;
+		}
+		/* Don't shrink if its a system GC and we had less than -Xminf free at the start of the garbage collection */
+		if (systemGC) {
+			uintptr_t minimumFree = (currentHeapSize / _extensions->heapFreeMinimumRatioDivisor) * _extensions->heapFreeMinimumRatioMultiplier;
+			if (resizeStats->getFreeBytesAtSystemGCStart() < minimumFree) {
+				return false;
+			}
+		}
+		/* contract at most globalMaximumContraction of the heap per GC, in multiples of region size */
+		uintptr_t contractionGranule = _extensions->regionSize;
+		uintptr_t maxContract = MM_Math::roundToCeiling(contractionGranule, (uintptr_t)(currentHeapSize * _extensions->globalMaximumContraction));
+		uintptr_t contractSize = OMR_MIN((uintptr_t)-resize, maxContract);
+		_contractionSize = MM_Math::roundToFloor(contractionGranule, contractSize);
+		if (HEAP_RESIZE_MODEL_FREE_TOO_HIGH == resizeModel->getLastReason()) {
+			resizeStats->setLastContractReason(FREE_SPACE_GREATER_MAXF);
+		} else {
+			resizeStats->setLastContractReason(GC_RATIO_PREDICTED_TOO_LOW);
+		}
+	}
+
+	return (0 != _expansionSize) || (0 != _contractionSize);
+}
+
 /**
  * Determine the amount of heap to contract.
  * Calculate the contraction size while factoring in the pending allocate and whether a contract based on
@@ -101,6 +101,29 @@ public:
 
 	virtual void *allocateObject(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure) = 0;
 	virtual void *allocateArray(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure) = 0;
+
+	/**
+	 * Allocate a contiguous run of up to maxCount objects of allocateDescription->getContiguousBytes() bytes each.
+	 * The base implementation allocates a single object.
+	 *
+	 * @param maxCount[in] maximum number of objects to allocate
+	 * @param count[out] number of objects allocated
+	 * @param cachedOnly[in] if true, only allocate from memory already cached by the interface (no refresh, no out of line allocation)
+	 * @return base address of the run, or NULL if no object could be allocated
+	 */
+	virtual void *
+	allocateObjects(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, MM_MemorySpace *memorySpace, uintptr_t maxCount, uintptr_t *count, bool shouldCollectOnFailure, bool cachedOnly)
+	{
+		void *result = NULL;
+		*count = 0;
+		if (!cachedOnly) {
+			result = allocateObject(env, allocateDescription, memorySpace, shouldCollectOnFailure);
+			if (NULL != result) {
+				*count = 1;
+			}
+		}
+		return result;
+	}
 	/**
 	 * Allocate the arraylet spine.
 	 */
@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "omrcfg.h"
+
+#include "ObjectStartIndex.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapMapIterator.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
+#include "MemoryManager.hpp"
+
+MM_ObjectStartIndex *
+MM_ObjectStartIndex::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ObjectStartIndex *objectStartIndex = (MM_ObjectStartIndex *)env->getForge()->allocate(sizeof(MM_ObjectStartIndex), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != objectStartIndex) {
+		new(objectStartIndex) MM_ObjectStartIndex(env);
+		if (!objectStartIndex->initialize(env)) {
+			objectStartIndex->kill(env);
+			objectStartIndex = NULL;
+		}
+	}
+	return objectStartIndex;
+}
+
+void
+MM_ObjectStartIndex::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ObjectStartIndex::initialize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	_heapBase = (uintptr_t)extensions->heap->getHeapBase();
+	_entryCount = (((uintptr_t)extensions->heap->getHeapTop() - _heapBase) + ((uintptr_t)1 << BYTES_PER_ENTRY_SHIFT) - 1) >> BYTES_PER_ENTRY_SHIFT;
+
+	MM_MemoryManager *memoryManager = extensions->memoryManager;
+	if (!memoryManager->createVirtualMemoryForMetadata(env, &_indexMemoryHandle, extensions->heapAlignment, _entryCount * sizeof(uint32_t), "objectStartIndex")) {
+		return false;
+	}
+	_entries = (volatile uint32_t *)memoryManager->getHeapBase(&_indexMemoryHandle);
+
+	return true;
+}
+
+void
+MM_ObjectStartIndex::tearDown(MM_EnvironmentBase *env)
+{
+	env->getExtensions()->memoryManager->destroyVirtualMemory(env, &_indexMemoryHandle);
+	_entries = NULL;
+}
+
+bool
+MM_ObjectStartIndex::heapAddRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress)
+{
+	/* cards shared with a range already in the heap are emptied as well, which only costs parallelism until the next sweep */
+	uintptr_t lowIndex = getIndex(lowAddress);
+	uintptr_t highIndex = getIndex((void *)((uintptr_t)highAddress - 1)) + 1;
+
+	MM_MemoryManager *memoryManager = env->getExtensions()->memoryManager;
+	if (!memoryManager->commitMemory(&_indexMemoryHandle, (void *)&_entries[lowIndex], (highIndex - lowIndex) * sizeof(uint32_t))) {
+		return false;
+	}
+	/* the range may have been in the heap before, with entries of the current sweep */
+	memset((void *)&_entries[lowIndex], 0, (highIndex - lowIndex) * sizeof(uint32_t));
+
+	return true;
+}
+
+bool
+MM_ObjectStartIndex::heapRemoveRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
+{
+	/* only whole cards are decommitted, the entries of a card shared with the remaining heap are kept */
+	uintptr_t lowIndex = getIndex((void *)((uintptr_t)lowAddress + ((uintptr_t)1 << BYTES_PER_ENTRY_SHIFT) - 1));
+	uintptr_t highIndex = getIndex(highAddress);
+	if (lowIndex >= highIndex) {
+		return true;
+	}
+
+	void *validLow = (NULL == lowValidAddress) ? NULL : (void *)&_entries[lowIndex];
+	void *validHigh = (NULL == highValidAddress) ? NULL : (void *)&_entries[highIndex];
+	MM_MemoryManager *memoryManager = env->getExtensions()->memoryManager;
+	return memoryManager->decommitMemory(&_indexMemoryHandle, (void *)&_entries[lowIndex], (highIndex - lowIndex) * sizeof(uint32_t), validLow, validHigh);
+}
+
+void
+MM_ObjectStartIndex::startRecording(MM_EnvironmentBase *env)
+{
+	_valid = false;
+	/* the epoch is 16 bits and never 0, so that committed (zeroed) entries are empty */
+	_epoch = (_epoch % (((uint32_t)1 << EPOCH_SHIFT) - 1)) + 1;
+	if (1 == _epoch) {
+		/* Wrapped around: entries recorded 65535 sweeps ago carry the new epoch, and a card no sweep
+		 * recorded since would still return them. Empty the entries of the heap before recording again.
+		 */
+		GC_HeapRegionIterator regionIterator(env->getExtensions()->heap->getHeapRegionManager());
+		MM_HeapRegionDescriptor *region = NULL;
+		while (NULL != (region = regionIterator.nextRegion())) {
+			uintptr_t lowIndex = getIndex(region->getLowAddress());
+			uintptr_t highIndex = getIndex((void *)((uintptr_t)region->getHighAddress() - 1)) + 1;
+			memset((void *)&_entries[lowIndex], 0, (highIndex - lowIndex) * sizeof(uint32_t));
+		}
+	}
+}
+
+void
+MM_ObjectStartIndex::recordObject(omrobjectptr_t objectPtr)
+{
+	uintptr_t index = getIndex(objectPtr);
+	uint32_t entry = (_epoch << EPOCH_SHIFT) | (uint32_t)(((uintptr_t)objectPtr - getCardBase(index)) + 1);
+	uint32_t oldEntry = _entries[index];
+
+	/* keep the lowest object of the card, ranges sharing the card may be recorded by other threads */
+	while (((oldEntry >> EPOCH_SHIFT) != _epoch) || (entry < oldEntry)) {
+		uint32_t currentEntry = MM_AtomicOperations::lockCompareExchangeU32(&_entries[index], oldEntry, entry);
+		if (currentEntry == oldEntry) {
+			break;
+		}
+		oldEntry = currentEntry;
+	}
+}
+
+uintptr_t
+MM_ObjectStartIndex::recordRange(MM_EnvironmentBase *env, MM_HeapMap *markMap, void *lowAddress, void *highAddress)
+{
+	/* a single pass over the mark map of the range, recording the first marked object seen in each card */
+	MM_HeapMapIterator markedObjectIterator(env->getExtensions(), markMap, (uintptr_t *)lowAddress, (uintptr_t *)highAddress, false);
+	uintptr_t recordedIndex = UDATA_MAX;
+	uintptr_t recordedCount = 0;
+	omrobjectptr_t objectPtr = NULL;
+
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		uintptr_t index = getIndex(objectPtr);
+		if (index != recordedIndex) {
+			recordObject(objectPtr);
+			recordedIndex = index;
+			recordedCount += 1;
+		}
+	}
+
+	return recordedCount;
+}
+
+omrobjectptr_t
+MM_ObjectStartIndex::findObjectStart(void *lowAddress, void *highAddress)
+{
+	uintptr_t index = getIndex(lowAddress);
+
+	while ((index < _entryCount) && (getCardBase(index) < (uintptr_t)highAddress)) {
+		omrobjectptr_t objectPtr = getEntry(index);
+		/* the first card may record an object below the range */
+		if ((NULL != objectPtr) && ((void *)objectPtr >= lowAddress)) {
+			return ((void *)objectPtr < highAddress) ? objectPtr : NULL;
+		}
+		index += 1;
+	}
+
+	return NULL;
+}
@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(OBJECTSTARTINDEX_HPP_)
+#define OBJECTSTARTINDEX_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+#include "objectdescription.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+#include "MemoryHandle.hpp"
+
+class MM_EnvironmentBase;
+class MM_HeapMap;
+
+/**
+ * Sparse index of object starts, recorded by the sweep of each global collection (-Xgc:objectStartIndex).
+ *
+ * There is one 32 bit entry per 4KB card of the heap, holding the offset in the card of the first object that
+ * was marked in it, tagged with the sweep that recorded it. Entries of earlier sweeps are ignored, so the
+ * index is only cleared when the 16 bit tag wraps around (every 65535 sweeps), and cards shared by sweep
+ * chunks are updated atomically.
+ *
+ * Objects surviving a collection do not move until the next one (or a compaction), and memory allocated
+ * after the sweep is carved from free entries, so a recorded object remains the start of a walkable
+ * sequence of objects up to the top of its region. This lets any address range of a tenure region start
+ * iterating without walking from the region base. Nursery regions are not recorded (scavenges move objects).
+ * @ingroup GC_Base
+ */
+class MM_ObjectStartIndex : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_MemoryHandle _indexMemoryHandle; /**< reserved memory for the entries */
+	volatile uint32_t *_entries; /**< one entry per card of the heap */
+	uintptr_t _heapBase; /**< base of the heap covered by the index */
+	uintptr_t _entryCount; /**< number of entries reserved */
+	uint32_t _epoch; /**< tag of the entries recorded by the current (or last) sweep, never 0 */
+	bool _valid; /**< true if the last sweep completed and no object has moved since */
+	volatile uintptr_t _walkChunksStarted; /**< chunks of parallel heap walks started at a recorded object */
+
+	static const uintptr_t BYTES_PER_ENTRY_SHIFT = 12; /**< 4KB of heap per entry */
+	static const uint32_t EPOCH_SHIFT = 16; /**< the epoch is in the high half of an entry, the offset plus one in the low half */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE uintptr_t
+	getIndex(void *address)
+	{
+		return ((uintptr_t)address - _heapBase) >> BYTES_PER_ENTRY_SHIFT;
+	}
+
+	MMINLINE uintptr_t
+	getCardBase(uintptr_t index)
+	{
+		return _heapBase + (index << BYTES_PER_ENTRY_SHIFT);
+	}
+
+	/**
+	 * @return the object recorded for a card by the last sweep, or NULL if there is none
+	 */
+	MMINLINE omrobjectptr_t
+	getEntry(uintptr_t index)
+	{
+		uint32_t entry = _entries[index];
+		if ((entry >> EPOCH_SHIFT) != _epoch) {
+			return NULL;
+		}
+		return (omrobjectptr_t)(getCardBase(index) + (entry & (((uint32_t)1 << EPOCH_SHIFT) - 1)) - 1);
+	}
+
+	void recordObject(omrobjectptr_t objectPtr);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_ObjectStartIndex *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Commit the entries for a range added to the heap. The entries are empty.
+	 * @return true if the entries could be committed
+	 */
+	bool heapAddRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress);
+
+	/**
+	 * Decommit the entries for a range removed from the heap.
+	 * @return true if the entries could be decommitted
+	 */
+	bool heapRemoveRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
+
+	/**
+	 * Start recording a new sweep, discarding all entries of the previous one (and emptying the entries of
+	 * the heap when the epoch wraps around). Called by the master thread.
+	 */
+	void startRecording(MM_EnvironmentBase *env);
+
+	/**
+	 * Record the first marked object of each card overlapping a swept range. Ranges may share cards and
+	 * may be recorded by different threads concurrently.
+	 * @param markMap[in] the mark map of the sweep
+	 * @param lowAddress[in] base of the swept range
+	 * @param highAddress[in] top of the swept range
+	 * @return the number of objects recorded (a card shared with another range may be counted for both)
+	 */
+	uintptr_t recordRange(MM_EnvironmentBase *env, MM_HeapMap *markMap, void *lowAddress, void *highAddress);
+
+	/**
+	 * The index can be used once the sweep that recorded it has completed, until an object is moved.
+	 */
+	MMINLINE void setValid(bool valid) { _valid = valid; }
+	MMINLINE bool isValid() { return _valid; }
+
+	/**
+	 * @param objectPtr[in] an object in a tenure region
+	 * @return true if objectPtr is the first object recorded for its card
+	 */
+	MMINLINE bool
+	isObjectStart(omrobjectptr_t objectPtr)
+	{
+		return objectPtr == getEntry(getIndex(objectPtr));
+	}
+
+	/**
+	 * Find the lowest recorded object in an address range of a tenure region. Iteration over the region
+	 * can start there and reaches every object (live or allocated since the sweep) up to the region top.
+	 * @param lowAddress[in] base of the range
+	 * @param highAddress[in] top of the range
+	 * @return the recorded object, or NULL if no object is recorded in the range
+	 */
+	omrobjectptr_t findObjectStart(void *lowAddress, void *highAddress);
+
+	/**
+	 * Count a chunk of a parallel heap walk that starts at an object found with findObjectStart().
+	 */
+	MMINLINE void reportWalkChunkStarted() { MM_AtomicOperations::add(&_walkChunksStarted, 1); }
+	MMINLINE uintptr_t getWalkChunksStarted() { return _walkChunksStarted; }
+
+	/**
+	 * Create an ObjectStartIndex object.
+	 */
+	MM_ObjectStartIndex(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _indexMemoryHandle()
+		, _entries(NULL)
+		, _heapBase(0)
+		, _entryCount(0)
+		, _epoch(1)
+		, _valid(false)
+		, _walkChunksStarted(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OBJECTSTARTINDEX_HPP_ */
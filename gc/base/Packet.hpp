@@ -32,6 +32,12 @@
 
 #define PACKET_RETURNED 0x01
 
+/* Packet identifiers used by the lock-free packet lists: block index in the high bits, index within the block
+ * in the low bits, biased by 1 so that 0 can represent NULL.
+ */
+#define PACKET_ID_BLOCK_SHIFT 27
+#define PACKET_ID_INDEX_MASK ((((uint32_t)1) << PACKET_ID_BLOCK_SHIFT) - 1)
+
 class MM_EnvironmentBase;
 
 class MM_Packet : public MM_BaseNonVirtual
@@ -45,6 +51,7 @@ private:
 	uintptr_t *_topPtr;
 	uintptr_t *_currentPtr;
 	uintptr_t _sublistIndex;
+	uint32_t _packetId; /**< identifier of the packet within the work packet blocks (see PACKET_ID_BLOCK_SHIFT) */
 	MM_EnvironmentBase *_owner;
 protected:
 public:
@@ -65,6 +72,16 @@ private:
 		_sublistIndex = sublistIndex;
 	}
 
+	MMINLINE uint32_t getPacketId()
+	{
+		return _packetId;
+	}
+
+	MMINLINE void setPacketId(uintptr_t blockIndex, uintptr_t indexInBlock)
+	{
+		_packetId = (uint32_t)(((blockIndex << PACKET_ID_BLOCK_SHIFT) | indexInBlock) + 1);
+	}
+
 protected:
 public:
 	/**
@@ -212,6 +229,7 @@ public:
 		_topPtr(NULL),
 		_currentPtr(NULL),
 		_sublistIndex(0),
+		_packetId(0),
 		_owner(NULL),
 		_next(NULL),
 		_previous(NULL)
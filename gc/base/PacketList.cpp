@@ -28,7 +28,7 @@
 #include "PacketList.hpp"
 
 bool 
-MM_PacketList::initialize(MM_EnvironmentBase *env)
+MM_PacketList::initialize(MM_EnvironmentBase *env, MM_Packet * const *packetBlocks)
 {
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
@@ -36,6 +36,10 @@ MM_PacketList::initialize(MM_EnvironmentBase *env)
 	_sublistCount = extensions->packetListSplit;
 	Assert_MM_true(0 < _sublistCount);
 
+	if (extensions->packetListLockFree) {
+		_packetBlocks = packetBlocks;
+	}
+
 	_sublists = (struct PacketSublist *)extensions->getForge()->allocate(sizeof(struct PacketSublist) * _sublistCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (NULL == _sublists) {
 		result = false;
@@ -73,6 +77,17 @@ MM_PacketList::pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count)
 	PacketSublist *list = &_sublists[0];
 	MM_Packet *current = head;
 	uintptr_t i;
+
+	if (isLockFree()) {
+		for (i = 0; i < count; ++i) {
+			current->_previous = NULL;
+			current->setSublistIndex(0);
+			current = current->_next;
+		}
+		incrementCount(count);
+		pushLockFree(list, head, tail);
+		return;
+	}
 	
 	list->_lock.acquire();
 	
@@ -101,6 +116,28 @@ MM_PacketList::popList(MM_Packet **head, MM_Packet **tail, uintptr_t *count)
 	*head = NULL;
 	*tail = NULL;
 	*count = 0;
+
+	if (isLockFree()) {
+		/* detach each sublist in turn; packets pushed concurrently are simply left for the next pop */
+		for (uintptr_t i = 0; i < _sublistCount; i++) {
+			MM_Packet *current = popAllLockFree(&_sublists[i]);
+			if (NULL != current) {
+				didPop = true;
+				if (NULL == *head) {
+					*head = current;
+				} else {
+					(*tail)->_next = current;
+				}
+				while (NULL != current) {
+					*tail = current;
+					*count += 1;
+					current = current->_next;
+				}
+			}
+		}
+		decrementCount(*count);
+		return didPop;
+	}
 	
 	/* acquire all of our locks */
 	for (uintptr_t i = 0; i < _sublistCount; i++) {
@@ -146,6 +183,9 @@ MM_PacketList::remove(MM_Packet *packetToRemove)
 	PacketSublist *list = &_sublists[packetToRemove->getSublistIndex()];
 	MM_Packet *previous = NULL;
 	MM_Packet *next = NULL;
+
+	/* lock-free lists are singly linked and cannot remove from the middle */
+	Assert_MM_false(isLockFree());
 	
 	list->_lock.acquire();
 	
@@ -188,7 +228,11 @@ MM_PacketList::getHead()
 	
 	if (popList(&head, &tail, &count)) {
 		pushList(head, tail, count);
-		result = _sublists[0]._head;
+		if (isLockFree()) {
+			result = packetFromHead(MM_AtomicOperations::getU64(&_sublists[0]._lockFreeHead));
+		} else {
+			result = _sublists[0]._head;
+		}
 	}
 
 	return result;
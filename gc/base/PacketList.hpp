@@ -49,6 +49,7 @@ public:
 		MM_Packet * _head;  /**< Head of the list */
 		MM_Packet * _tail;  /**< Tail of the list */
 		MM_LightweightNonReentrantLock _lock;  /**< Lock for getting/putting packets */
+		volatile uint64_t _lockFreeHead; /**< Head of the lock-free stack: packet id of the top packet in the low 32 bits, ABA tag in the high 32 bits */
 
 		bool
 		initialize(MM_EnvironmentBase *env)
@@ -62,6 +63,7 @@ public:
 		PacketSublist()
 			: _head(NULL)
 			, _tail(NULL)
+			, _lockFreeHead(0)
 		{
 		}
 	};
@@ -73,6 +75,7 @@ private:
 	
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
 	volatile uintptr_t _count;  /**< Number of items in the list */
+	MM_Packet * const *_packetBlocks; /**< work packet blocks used to resolve packet ids, non-NULL only if the list is lock-free */
 	
 /* Functionality Section */
 private:
@@ -84,7 +87,7 @@ private:
 	 */
 	void incrementCount(uintptr_t value)
 	{
-		if (1 == _sublistCount) {
+		if ((1 == _sublistCount) && !isLockFree()) {
 			_count += value;
 		} else {
 			/* use an atomic, as the locks have been split up */
@@ -100,7 +103,7 @@ private:
 	 */
 	void decrementCount(uintptr_t value)
 	{
-		if (1 == _sublistCount) {
+		if ((1 == _sublistCount) && !isLockFree()) {
 			_count -= value;
 		} else {
 			/* use an atomic, as the locks have been split up */
@@ -121,12 +124,126 @@ private:
 	{
 		return env->getEnvironmentId() % _sublistCount;
 	}
+
+	/**
+	 * @return true if the sublists are lock-free stacks
+	 */
+	MMINLINE bool
+	isLockFree()
+	{
+		return NULL != _packetBlocks;
+	}
+
+	/**
+	 * Resolve the packet referenced by a lock-free head value.
+	 *
+	 * @param head a value read from PacketSublist::_lockFreeHead
+	 *
+	 * @return the packet on top of the stack, or NULL if the stack is empty
+	 */
+	MMINLINE MM_Packet *
+	packetFromHead(uint64_t head)
+	{
+		MM_Packet *packet = NULL;
+		uint32_t packetId = (uint32_t)head;
+		if (0 != packetId) {
+			packetId -= 1;
+			packet = _packetBlocks[packetId >> PACKET_ID_BLOCK_SHIFT] + (packetId & PACKET_ID_INDEX_MASK);
+		}
+		return packet;
+	}
+
+	/**
+	 * Build a new lock-free head value. The ABA tag is advanced on every update so that a
+	 * stale head can never be successfully swapped, even if the same packet is back on top.
+	 *
+	 * @param oldHead the head value being replaced
+	 * @param packet the new top of the stack, or NULL
+	 *
+	 * @return the new head value
+	 */
+	MMINLINE uint64_t
+	nextHead(uint64_t oldHead, MM_Packet *packet)
+	{
+		uint64_t tag = (oldHead >> 32) + 1;
+		uint64_t packetId = (NULL == packet) ? 0 : packet->getPacketId();
+		return (tag << 32) | packetId;
+	}
+
+	/**
+	 * Push a chain of packets linked by _next on to a lock-free sublist.
+	 * The count must already account for the packets being pushed.
+	 */
+	MMINLINE void
+	pushLockFree(PacketSublist *list, MM_Packet *head, MM_Packet *tail)
+	{
+		uint64_t oldHead = MM_AtomicOperations::getU64(&list->_lockFreeHead);
+		while (true) {
+			tail->_next = packetFromHead(oldHead);
+			uint64_t seenHead = MM_AtomicOperations::lockCompareExchangeU64(&list->_lockFreeHead, oldHead, nextHead(oldHead, head));
+			if (seenHead == oldHead) {
+				break;
+			}
+			oldHead = seenHead;
+		}
+	}
+
+	/**
+	 * Pop the top packet off a lock-free sublist.
+	 *
+	 * @return the packet, or NULL if the sublist is empty
+	 */
+	MMINLINE MM_Packet *
+	popLockFree(PacketSublist *list)
+	{
+		MM_Packet *packet = NULL;
+		uint64_t oldHead = MM_AtomicOperations::getU64(&list->_lockFreeHead);
+		while (0 != (uint32_t)oldHead) {
+			MM_Packet *top = packetFromHead(oldHead);
+			/* top->_next may be stale if another thread popped top in the meantime; the tag then makes the swap fail */
+			uint64_t seenHead = MM_AtomicOperations::lockCompareExchangeU64(&list->_lockFreeHead, oldHead, nextHead(oldHead, top->_next));
+			if (seenHead == oldHead) {
+				packet = top;
+				break;
+			}
+			oldHead = seenHead;
+		}
+		return packet;
+	}
+
+	/**
+	 * Detach the entire contents of a lock-free sublist.
+	 *
+	 * @return the first packet of the detached chain, or NULL if the sublist was empty
+	 */
+	MMINLINE MM_Packet *
+	popAllLockFree(PacketSublist *list)
+	{
+		uint64_t oldHead = MM_AtomicOperations::getU64(&list->_lockFreeHead);
+		while (0 != (uint32_t)oldHead) {
+			uint64_t seenHead = MM_AtomicOperations::lockCompareExchangeU64(&list->_lockFreeHead, oldHead, nextHead(oldHead, NULL));
+			if (seenHead == oldHead) {
+				break;
+			}
+			oldHead = seenHead;
+		}
+		return packetFromHead(oldHead);
+	}
 		
 protected:
 	
 public:
 	
-	bool initialize(MM_EnvironmentBase *env);
+	/**
+	 * Initialize the list.
+	 *
+	 * @param env the current environment
+	 * @param packetBlocks the work packet blocks holding every packet that can be pushed on this list. If non-NULL
+	 * and lock-free packet lists are enabled, the sublists are lock-free stacks. Lock-free lists do not support remove().
+	 *
+	 * @return true on success, false otherwise
+	 */
+	bool initialize(MM_EnvironmentBase *env, MM_Packet * const *packetBlocks = NULL);
 	void tearDown(MM_EnvironmentBase *env) ;
 	
 	/**
@@ -162,6 +279,15 @@ public:
 	{
 		uintptr_t index = getSublistIndex(env);
 		PacketSublist *list = &_sublists[index];
+
+		if (isLockFree()) {
+			packet->_previous = NULL;
+			packet->setSublistIndex(index);
+			/* count before publishing so that the count never under-reports the packets on the list */
+			incrementCount(1);
+			pushLockFree(list, packet, packet);
+			return;
+		}
 	
 		list->_lock.acquire();
 
@@ -192,7 +318,13 @@ public:
 		for (uintptr_t i = 0; i < _sublistCount; i++) {
 			PacketSublist *list = &_sublists[index];
 
-			if (NULL != list->_head) {
+			if (isLockFree()) {
+				packet = popLockFree(list);
+				if (NULL != packet) {
+					decrementCount(1);
+					break;
+				}
+			} else if (NULL != list->_head) {
 				list->_lock.acquire();
 				if (NULL != list->_head) {
 					packet = list->_head;
@@ -254,6 +386,7 @@ public:
 		,_sublists(NULL)
 		,_sublistCount(0)
 		,_count(0)
+		,_packetBlocks(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
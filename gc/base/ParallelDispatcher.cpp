@@ -31,8 +31,10 @@
 #include "ModronAssertions.h"
 #include "ut_j9mm.h"
 
+#include "AtomicOperations.hpp"
 #include "Collector.hpp"
 #include "CollectorLanguageInterfaceImpl.hpp"
+#include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
@@ -159,7 +161,13 @@ MM_ParallelDispatcher::slaveEntryPoint(MM_EnvironmentBase *env)
 	while(slave_status_dying != _statusTable[slaveID]) {
 		/* Wait for a task to be dispatched to the slave thread */
 		while(slave_status_waiting == _statusTable[slaveID]) {
-			omrthread_monitor_wait(_slaveThreadMutex);
+			if (_extensions->adaptiveGCThreading) {
+				omrthread_monitor_exit(_slaveThreadMutex);
+				spinThenPark(env);
+				omrthread_monitor_enter(_slaveThreadMutex);
+			} else {
+				omrthread_monitor_wait(_slaveThreadMutex);
+			}
 		}
 
 		if(slave_status_reserved == _statusTable[slaveID]) {
@@ -177,6 +185,24 @@ MM_ParallelDispatcher::slaveEntryPoint(MM_EnvironmentBase *env)
 	omrthread_monitor_exit(_slaveThreadMutex);	
 }
 
+void
+MM_ParallelDispatcher::spinThenPark(MM_EnvironmentBase *env)
+{
+	volatile uintptr_t *status = &_statusTable[env->getSlaveID()];
+
+	for (uintptr_t spin = _extensions->gcThreadSpinCount; 0 < spin; spin--) {
+		if (slave_status_waiting != *status) {
+			return;
+		}
+		MM_AtomicOperations::yieldCPU();
+	}
+
+	/* A thread unparked before it parks keeps the permit, so the wake up can not be lost */
+	if (slave_status_waiting == *status) {
+		omrthread_park(0, 0);
+	}
+}
+
 void
 MM_ParallelDispatcher::masterEntryPoint(MM_EnvironmentBase *env)
 {
@@ -383,11 +409,21 @@ MM_ParallelDispatcher::shutDownThreads()
  * In this implementation, since slaveThreadEntryPoint() allows a thread to
  * go back to sleep if it wasn't selected, we can wake them all up. This
  * may not apply to all subclasses though.
+ * With adaptive GC threading, idle slaves park rather than wait on _slaveThreadMutex,
+ * and only the slaves that were reserved for a task (or told to die) are unparked.
  */
 void
 MM_ParallelDispatcher::wakeUpThreads(uintptr_t count)
 {
-	omrthread_monitor_notify_all(_slaveThreadMutex);	
+	if (_extensions->adaptiveGCThreading) {
+		for (uintptr_t index = 0; index < _threadCountMaximum; index++) {
+			if ((NULL != _threadTable[index]) && (slave_status_waiting != _statusTable[index])) {
+				omrthread_unpark(_threadTable[index]);
+			}
+		}
+	} else {
+		omrthread_monitor_notify_all(_slaveThreadMutex);
+	}
 }
 
 /**
@@ -428,6 +464,9 @@ MM_ParallelDispatcher::recomputeActiveThreadCountForTask(MM_EnvironmentBase *env
 	 * available and ready to run).
 	 */
 	uintptr_t taskActiveThreadCount = OMR_MIN(_activeThreadCount, threadCount);
+	if (_extensions->adaptiveGCThreading) {
+		taskActiveThreadCount = adjustThreadCountForTask(env, task, taskActiveThreadCount);
+	}
 	task->setThreadCount(taskActiveThreadCount);
  	return taskActiveThreadCount;
 }
@@ -463,6 +502,29 @@ MM_ParallelDispatcher::adjustThreadCount(uintptr_t maxThreadCount)
 	return toReturn;
 }
 
+uintptr_t
+MM_ParallelDispatcher::adjustThreadCountForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t maxThreadCount)
+{
+	uintptr_t toReturn = maxThreadCount;
+	uintptr_t estimatedWork = task->getEstimatedWork(env);
+
+	if (0 != estimatedWork) {
+		/* Waking a thread costs more than it saves unless it gets at least adaptiveGCThreadingWorkPerThread bytes of work */
+		uintptr_t workPerThread = _extensions->adaptiveGCThreadingWorkPerThread;
+		uintptr_t threadsForWork = (estimatedWork / workPerThread) + ((0 == (estimatedWork % workPerThread)) ? 0 : 1);
+		if (threadsForWork < toReturn) {
+			toReturn = threadsForWork;
+		}
+	}
+
+	Trc_MM_ParallelDispatcher_adjustThreadCountForTask(task->getBaseVirtualTypeId(), estimatedWork, toReturn, maxThreadCount);
+	if (NULL != env->_cycleState) {
+		env->_cycleState->recordDispatch(task->getBaseVirtualTypeId(), estimatedWork, maxThreadCount, toReturn);
+	}
+
+	return toReturn;
+}
+
 void
 MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount)
 {
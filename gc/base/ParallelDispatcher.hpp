@@ -113,6 +113,18 @@ protected:
 	virtual void setThreadInitializationComplete(MM_EnvironmentBase *env);
 	
 	uintptr_t adjustThreadCount(uintptr_t maxThreadCount);
+
+	/**
+	 * Reduce the thread count of a task to what its estimated work can keep busy (adaptive GC threading),
+	 * and record the decision in the cycle state for verbose GC.
+	 */
+	uintptr_t adjustThreadCountForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t maxThreadCount);
+
+	/**
+	 * Wait for the status of a waiting slave to change without holding _slaveThreadMutex: poll it up to
+	 * gcThreadSpinCount times, then park until wakeUpThreads() unparks the thread (adaptive GC threading).
+	 */
+	void spinThenPark(MM_EnvironmentBase *env);
 	
 public:
 	virtual bool startUpThreads();
@@ -34,6 +34,7 @@
 #include "MarkMap.hpp"
 #include "MarkMapSegmentChunkIterator.hpp"
 #include "MemorySubSpace.hpp"
+#include "ObjectStartIndex.hpp"
 #include "ParallelGlobalGC.hpp"
 #include "ParallelObjectHeapIterator.hpp"
 #include "ObjectModel.hpp"
@@ -105,10 +106,19 @@ MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalk
 	Trc_MM_ParallelHeapWalker_allObjectsDoParallel_Entry(env->getLanguageVMThread());
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 
+	/* Chunks start at marked objects during a collection. Otherwise they start at the objects recorded by the
+	 * last sweep in the object start index, if there is a valid one, or the walk is done by a single thread.
+	 */
+	MM_MarkMap *markMap = _markMap->isMarkMapValid() ? _markMap : NULL;
+	MM_ObjectStartIndex *objectStartIndex = NULL;
+	if ((NULL == markMap) && (NULL != extensions->objectStartIndex) && extensions->objectStartIndex->isValid()) {
+		objectStartIndex = extensions->objectStartIndex;
+	}
+
 	/* determine the size of the segment chunks to use for parallel walks */
 	uintptr_t threadCount = env->_currentTask->getThreadCount();
 	uintptr_t heapChunkFactor = 1;
-	if ((threadCount > 1) && _markMap->isMarkMapValid()) {
+	if ((threadCount > 1) && ((NULL != markMap) || (NULL != objectStartIndex))) {
 		heapChunkFactor = threadCount * 8;
 	}
 	uintptr_t parallelChunkSize = extensions->heap->getMemorySize() / heapChunkFactor;
@@ -125,7 +135,9 @@ MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalk
 
 	while (NULL != (region = regionIterator.nextRegion())) {
 		if (walkFlags == (region->getTypeFlags() & walkFlags)) {
-			GC_ParallelObjectHeapIterator objectHeapIterator(env, region, region->getLowAddress(), region->getHighAddress(), _markMap, parallelChunkSize);
+			/* the index does not record nursery regions, whose objects move on every scavenge */
+			MM_ObjectStartIndex *regionObjectStartIndex = (MEMORY_TYPE_NEW == (region->getTypeFlags() & MEMORY_TYPE_NEW)) ? NULL : objectStartIndex;
+			GC_ParallelObjectHeapIterator objectHeapIterator(env, region, region->getLowAddress(), region->getHighAddress(), markMap, regionObjectStartIndex, parallelChunkSize);
 			omrobjectptr_t object = NULL;
 			while ((object = objectHeapIterator.nextObject()) != NULL) {
 				function(omrVMThread, region, object, userData);
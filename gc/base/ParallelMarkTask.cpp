@@ -30,6 +30,7 @@
 #include "ParallelMarkTask.hpp"
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 #include "MarkingScheme.hpp"
 #include "WorkStack.hpp"
 
@@ -92,6 +93,22 @@ MM_ParallelMarkTask::cleanup(MM_EnvironmentBase *env)
 		0/* TODO CRG figure out to get the array split size*/);
 }
 
+void
+MM_ParallelMarkTask::masterCleanup(MM_EnvironmentBase *env)
+{
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+	/* the slaves merged their mark stats in cleanup() */
+	MM_MarkStats *markStats = &env->getExtensions()->globalGCStats.markStats;
+	_markingScheme->recordMarkWork(markStats->_bytesScanned, markStats->_objectsScanned);
+#endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
+}
+
+uintptr_t
+MM_ParallelMarkTask::getEstimatedWork(MM_EnvironmentBase *env)
+{
+	return _markingScheme->estimateMarkWork();
+}
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 void
 MM_ParallelMarkTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
@@ -55,6 +55,8 @@ public:
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
 	virtual void cleanup(MM_EnvironmentBase *env);
+	virtual void masterCleanup(MM_EnvironmentBase *env);
+	virtual uintptr_t getEstimatedWork(MM_EnvironmentBase *env);
 	
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	virtual void synchronizeGCThreads(MM_EnvironmentBase *env, const char *id);
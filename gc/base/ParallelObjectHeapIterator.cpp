@@ -30,6 +30,7 @@
 #include "ParallelObjectHeapIterator.hpp"
 #include "ObjectModel.hpp"
 #include "MarkMap.hpp"
+#include "ObjectStartIndex.hpp"
 
 /**
  * Loop until either the end of the segment is hit, or a new chunk is acquired.
@@ -40,7 +41,7 @@ bool
 GC_ParallelObjectHeapIterator::getNextChunk()
 {
 	/* Loop until we hit the last chunk, or we find one we are responsible for */
-	while (_segmentChunkIterator.nextChunk(_markMap, &_chunkBase, &_chunkTop)) {
+	while ((NULL != _markMap) ? _segmentChunkIterator.nextChunk(_markMap, &_chunkBase, &_chunkTop) : _segmentChunkIterator.nextChunk(_objectStartIndex, &_chunkBase, &_chunkTop)) {
 		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(_env)) {
 			/* _chunkTop will be used later. Reseting the top address of the iterator to the end of the segment,
 			 * so that iteration of the current chunk may go beyond _chunkTop, until first marked object is found.
@@ -54,6 +55,19 @@ GC_ParallelObjectHeapIterator::getNextChunk()
 	return false;	
 }
 
+/**
+ * @return true if the object is where a chunk starts (the next chunk if it is beyond the current chunk top)
+ */
+bool
+GC_ParallelObjectHeapIterator::isChunkStart(omrobjectptr_t objectPtr)
+{
+	/* Note:  we can use the mark map directly, in this case, since we know that objectPtr must be on the heap */
+	if (NULL != _markMap) {
+		return _markMap->isBitSet(objectPtr);
+	}
+	return (NULL != _objectStartIndex) && _objectStartIndex->isObjectStart(objectPtr);
+}
+
 /**
  * @see GC_ObjectHeapBufferedIterator::nextObject()
  */
@@ -68,10 +82,9 @@ GC_ParallelObjectHeapIterator::nextObject()
 			return NULL;
 		}
 
-		/* If we hit first marked object beyond the chunk boundary,
+		/* If we hit first marked (or recorded) object beyond the chunk boundary,
 		 * get the next chunk */
-		/* Note:  we can use the mark map directly, in this case, since we know that nextObject must be on the heap */
-		if (((UDATA *)nextObject >= _chunkTop) && _markMap->isBitSet(nextObject)) {
+		if (((UDATA *)nextObject >= _chunkTop) && isChunkStart(nextObject)) {
 			if (!getNextChunk()) {
 				return NULL;
 			}
@@ -41,6 +41,7 @@
 #include "Task.hpp"
 
 class MM_MarkMap;
+class MM_ObjectStartIndex;
 
 /**
  * Multi-threaded iterator for iterating over objects in a memory segment.
@@ -48,6 +49,9 @@ class MM_MarkMap;
  * segment before using this iterator.
  * @note Also assumes that the environment passed in has already been set up
  * with a parallel task, and slave threads are active.
+ * @note The segment is split into chunks of parallelChunkSize bytes, each starting at
+ * its first marked object if a valid mark map is given, otherwise at its first object
+ * recorded in the object start index (the whole segment is a single chunk if neither is given).
  * @ingroup GC_Base
  */
 class GC_ParallelObjectHeapIterator : public GC_ObjectHeapIterator
@@ -61,6 +65,7 @@ private:
 	GC_MarkMapSegmentChunkIterator _segmentChunkIterator;
 	void *_topAddress;
 	MM_MarkMap *_markMap;
+	MM_ObjectStartIndex *_objectStartIndex;
 	UDATA *_chunkBase;
 	UDATA *_chunkTop;
 
@@ -72,6 +77,7 @@ public:
 	 */
 private:
 	bool getNextChunk();
+	bool isChunkStart(omrobjectptr_t objectPtr);
 protected:
 public:
 	virtual omrobjectptr_t nextObject();
@@ -79,13 +85,14 @@ public:
 	virtual void advance(UDATA size);
 	virtual void reset(UDATA *base, UDATA *top);
 	
-	GC_ParallelObjectHeapIterator(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, void *base, void *top, MM_MarkMap *markMap, UDATA parallelChunkSize)
+	GC_ParallelObjectHeapIterator(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, void *base, void *top, MM_MarkMap *markMap, MM_ObjectStartIndex *objectStartIndex, UDATA parallelChunkSize)
 		: GC_ObjectHeapIterator()
 		, _env(env)
 		, _objectHeapIterator(env->getExtensions(), region, base, top, false, 1)
 		, _segmentChunkIterator(env->getExtensions(), base, top, parallelChunkSize)
 		, _topAddress(top)
 		, _markMap(markMap)
+		, _objectStartIndex(objectStartIndex)
 		, _chunkBase(NULL)
 		, _chunkTop(NULL)
 	{
@@ -177,7 +177,11 @@ MM_PhysicalArenaVirtualMemory::attachSubArena(MM_EnvironmentBase* env, MM_Physic
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	/* now that address range is known, just before we commit, bind memory to NUMA node, if applicable */
-	if (0 != currentSubArena->getNumaNode()) {
+	if (currentSubArena->isNumaStriped()) {
+		if (!currentSubArena->setNumaStripeAffinity(env, candidateBase, (void*)(((uint8_t*)candidateBase) + size))) {
+			return false;
+		}
+	} else if (0 != currentSubArena->getNumaNode()) {
 		MM_GCExtensionsBase *ext = env->getExtensions();
 		uintptr_t j9NodeNumber = ext->_numaManager.getJ9NodeNumber(currentSubArena->getNumaNode());
 		if (0 != j9NodeNumber) {
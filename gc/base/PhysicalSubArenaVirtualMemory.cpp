@@ -23,7 +23,11 @@
 
 #include "PhysicalSubArenaVirtualMemory.hpp"
 
-class MM_EnvironmentBase;
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "HeapVirtualMemory.hpp"
+#include "Math.hpp"
+#include "MemoryManager.hpp"
 
 bool
 MM_PhysicalSubArenaVirtualMemory::initialize(MM_EnvironmentBase* env)
@@ -52,3 +56,27 @@ MM_PhysicalSubArenaVirtualMemory::findAdjacentHighValidAddress(MM_EnvironmentBas
 	/* There is - return its lowest address */
 	return _highArena->getLowAddress();
 }
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+bool
+MM_PhysicalSubArenaVirtualMemory::setNumaStripeAffinity(MM_EnvironmentBase* env, void* lowAddress, void* highAddress)
+{
+	MM_GCExtensionsBase* ext = env->getExtensions();
+	bool result = true;
+
+	if (ext->_numaManager.isPhysicalNUMASupported() && (0 != ext->numaAwareNurseryStripeSize)) {
+		uintptr_t stripeSize = ext->numaAwareNurseryStripeSize;
+		uintptr_t stripeBase = (uintptr_t)lowAddress;
+		while (result && (stripeBase < (uintptr_t)highAddress)) {
+			uintptr_t stripeTop = OMR_MIN(MM_Math::roundToFloor(stripeSize, stripeBase) + stripeSize, (uintptr_t)highAddress);
+			uintptr_t j9NodeNumber = ext->_numaManager.getJ9NodeNumber(ext->getNurseryNumaNode((void*)stripeBase));
+			if (0 != j9NodeNumber) {
+				result = ext->memoryManager->setNumaAffinity(((MM_HeapVirtualMemory*)_heap)->getVmemHandle(), j9NodeNumber, (void*)stripeBase, stripeTop - stripeBase);
+			}
+			stripeBase = stripeTop;
+		}
+	}
+
+	return result;
+}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
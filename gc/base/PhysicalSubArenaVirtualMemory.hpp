@@ -47,6 +47,9 @@ protected:
 	bool _expandFromHighRange, _expandFromLowRange;
 
 	uintptr_t _numaNode;  /**< NUMA node binding, starting from 0. if UDATA_MAX, no explicit binding */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	bool _numaStriped; /**< true if the memory is bound stripe by stripe to the nodes of MM_GCExtensionsBase::getNurseryNumaNode() rather than to _numaNode */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 
 	virtual bool initialize(MM_EnvironmentBase* env);
 
@@ -86,6 +89,20 @@ public:
 	MMINLINE uintptr_t getNumaNode() { return _numaNode; }
 	MMINLINE void setNumaNode(uintptr_t numaNode) { _numaNode = numaNode; }
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	MMINLINE bool isNumaStriped() { return _numaStriped; }
+	MMINLINE void setNumaStriped(bool numaStriped) { _numaStriped = numaStriped; }
+
+	/**
+	 * Bind each nursery stripe of a range to its NUMA node, if NUMA is physical.
+	 * Called before the range is committed, so that the first touch of each page is satisfied from the right node.
+	 * @param lowAddress[in] base of the range
+	 * @param highAddress[in] top of the range
+	 * @return true on success, false if a stripe could not be bound
+	 */
+	bool setNumaStripeAffinity(MM_EnvironmentBase* env, void* lowAddress, void* highAddress);
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
 	/**
 	 * Calculate the size of the range from the supplied address to the top of the sub arena.
 	 * @param address The base address of the range.
@@ -106,6 +123,9 @@ public:
 		, _expandFromHighRange(false)
 		, _expandFromLowRange(false)
 		, _numaNode(0)
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		, _numaStriped(false)
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -43,11 +43,79 @@
 #define OMR_XGCPOLICY_LENGTH 11
 #define OMR_GCPOLICY_GENCON "gencon"
 #define OMR_GCPOLICY_GENCON_LENGTH 6
+#define OMR_XGCSCAVENGERWORKSTEALINGDEQUESIZE "-Xgc:scavengerWorkStealingDequeSize="
+#define OMR_XGCSCAVENGERWORKSTEALINGDEQUESIZE_LENGTH 36
+#define OMR_XGCSCAVENGERWORKSTEALING "-Xgc:scavengerWorkStealing"
+#define OMR_XGCSCAVENGERWORKSTEALING_LENGTH 26
+#define OMR_XGCSCAVENGERHOTFIELDCOPYDEPTH "-Xgc:scavengerHotFieldCopyDepth="
+#define OMR_XGCSCAVENGERHOTFIELDCOPYDEPTH_LENGTH 32
+#define OMR_XGCSCAVENGERHOTFIELDCOPY "-Xgc:scavengerHotFieldCopy"
+#define OMR_XGCSCAVENGERHOTFIELDCOPY_LENGTH 26
+#define OMR_XGCSCAVENGERREMEMBEREDSETRANGESIZE "-Xgc:scavengerRememberedSetRangeSize="
+#define OMR_XGCSCAVENGERREMEMBEREDSETRANGESIZE_LENGTH 37
+#define OMR_XGCSCAVENGERREMEMBEREDSETRANGES "-Xgc:scavengerRememberedSetRanges"
+#define OMR_XGCSCAVENGERREMEMBEREDSETRANGES_LENGTH 33
+#define OMR_XGCREMEMBEREDSETDEDUPLICATE "-Xgc:rememberedSetDeduplicate"
+#define OMR_XGCREMEMBEREDSETDEDUPLICATE_LENGTH 29
+#define OMR_XGCSCAVENGERFORWARDINGTABLE "-Xgc:scavengerForwardingTable"
+#define OMR_XGCSCAVENGERFORWARDINGTABLE_LENGTH 29
+#define OMR_XGCNUMAAWARENURSERY "-Xgc:numaAwareNursery"
+#define OMR_XGCNUMAAWARENURSERY_LENGTH 21
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+#define OMR_XGCCONCURRENTSCAVENGERPACING "-Xgc:concurrentScavengerPacing"
+#define OMR_XGCCONCURRENTSCAVENGERPACING_LENGTH 30
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#define OMR_XGCCARDTABLESUMMARY "-Xgc:cardTableSummary"
+#define OMR_XGCCARDTABLESUMMARY_LENGTH 21
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#define OMR_XGCPACKETLISTLOCKFREE "-Xgc:packetListLockFree"
+#define OMR_XGCPACKETLISTLOCKFREE_LENGTH 23
+#define OMR_XGCWORKPACKETCACHE "-Xgc:workPacketCache"
+#define OMR_XGCWORKPACKETCACHE_LENGTH 20
+#define OMR_XGCMARKINGPREFETCHDEPTH "-Xgc:markingPrefetchDepth="
+#define OMR_XGCMARKINGPREFETCHDEPTH_LENGTH 26
+#define OMR_XGCPARALLELCLEARMARKMAP "-Xgc:parallelClearMarkMap"
+#define OMR_XGCPARALLELCLEARMARKMAP_LENGTH 25
+#define OMR_XGCCONCURRENTCLEARMARKMAP "-Xgc:concurrentClearMarkMap"
+#define OMR_XGCCONCURRENTCLEARMARKMAP_LENGTH 27
+#define OMR_XGCSIZECLASSFREELISTPOOL "-Xgc:sizeClassFreeListPool"
+#define OMR_XGCSIZECLASSFREELISTPOOL_LENGTH 26
+#define OMR_XGCTLHADAPTIVESIZING "-Xgc:tlhAdaptiveSizing"
+#define OMR_XGCTLHADAPTIVESIZING_LENGTH 22
+#define OMR_XGCTLHADAPTIVEREFRESHINTERVAL "-Xgc:tlhAdaptiveRefreshInterval="
+#define OMR_XGCTLHADAPTIVEREFRESHINTERVAL_LENGTH 32
+#define OMR_XGCPREDICTIVEHEAPSIZINGWEIGHT "-Xgc:predictiveHeapSizingWeight="
+#define OMR_XGCPREDICTIVEHEAPSIZINGWEIGHT_LENGTH 32
+#define OMR_XGCPREDICTIVEHEAPSIZINGSTABILIZATIONCOUNT "-Xgc:predictiveHeapSizingStabilizationCount="
+#define OMR_XGCPREDICTIVEHEAPSIZINGSTABILIZATIONCOUNT_LENGTH 44
+#define OMR_XGCPREDICTIVEHEAPSIZING "-Xgc:predictiveHeapSizing"
+#define OMR_XGCPREDICTIVEHEAPSIZING_LENGTH 25
 #define OMR_XVERBOSEGCLOG "-Xverbosegclog:"
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE "-Xgc:asyncLoggingBufferSize="
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH 28
+#define OMR_XGCASYNC_LOGGING "-Xgc:asyncLogging"
+#define OMR_XGCASYNC_LOGGING_LENGTH 17
+#define OMR_XGCBINARY_LOGGING "-Xgc:binaryLogging"
+#define OMR_XGCBINARY_LOGGING_LENGTH 18
+#define OMR_XGCMETADATAPAGESIZE "-Xgc:gcmetadataPageSize="
+#define OMR_XGCMETADATAPAGESIZE_LENGTH 24
+#define OMR_XGCOBJECTSTARTINDEX "-Xgc:objectStartIndex"
+#define OMR_XGCOBJECTSTARTINDEX_LENGTH 21
+#define OMR_XGCALLOCATIONSAMPLINGINTERVAL "-Xgc:allocationSamplingInterval="
+#define OMR_XGCALLOCATIONSAMPLINGINTERVAL_LENGTH 32
+#define OMR_XGCALLOCATIONCACHEREFILLBATCHCELLS "-Xgc:allocationCacheRefillBatchCells="
+#define OMR_XGCALLOCATIONCACHEREFILLBATCHCELLS_LENGTH 37
+#define OMR_XGCADAPTIVEGCTHREADINGWORKPERTHREAD "-Xgc:adaptiveGCThreadingWorkPerThread="
+#define OMR_XGCADAPTIVEGCTHREADINGWORKPERTHREAD_LENGTH 38
+#define OMR_XGCADAPTIVEGCTHREADING "-Xgc:adaptiveGCThreading"
+#define OMR_XGCADAPTIVEGCTHREADING_LENGTH 24
+#define OMR_XGCTHREADSPINCOUNT "-Xgc:gcThreadSpinCount="
+#define OMR_XGCTHREADSPINCOUNT_LENGTH 23
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
 
@@ -276,6 +344,17 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING_BUFFER_SIZE, OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH, &extensions->asyncLoggingBufferSize)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING, OMR_XGCASYNC_LOGGING_LENGTH)) {
+		extensions->asyncLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCBINARY_LOGGING, OMR_XGCBINARY_LOGGING_LENGTH)) {
+		extensions->binaryLogging = true;
+	}
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
@@ -287,6 +366,129 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		}
 	}
 #endif /* defined(OMR_GC_MORDON_SCAVENGER) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCSCAVENGERWORKSTEALINGDEQUESIZE, OMR_XGCSCAVENGERWORKSTEALINGDEQUESIZE_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCSCAVENGERWORKSTEALINGDEQUESIZE_LENGTH, &extensions->scavengerWorkStealingDequeSize)) || (0 == extensions->scavengerWorkStealingDequeSize)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGERWORKSTEALING, OMR_XGCSCAVENGERWORKSTEALING_LENGTH)) {
+		extensions->scavengerWorkStealing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGERHOTFIELDCOPYDEPTH, OMR_XGCSCAVENGERHOTFIELDCOPYDEPTH_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCSCAVENGERHOTFIELDCOPYDEPTH_LENGTH, &extensions->scavengerHotFieldCopyDepth)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGERHOTFIELDCOPY, OMR_XGCSCAVENGERHOTFIELDCOPY_LENGTH)) {
+		extensions->scavengerHotFieldCopy = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGERREMEMBEREDSETRANGESIZE, OMR_XGCSCAVENGERREMEMBEREDSETRANGESIZE_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCSCAVENGERREMEMBEREDSETRANGESIZE_LENGTH, &extensions->scavengerRememberedSetRangeSize)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGERREMEMBEREDSETRANGES, OMR_XGCSCAVENGERREMEMBEREDSETRANGES_LENGTH)) {
+		extensions->scavengerRememberedSetRanges = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCREMEMBEREDSETDEDUPLICATE, OMR_XGCREMEMBEREDSETDEDUPLICATE_LENGTH)) {
+		extensions->rememberedSetDeduplicate = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGERFORWARDINGTABLE, OMR_XGCSCAVENGERFORWARDINGTABLE_LENGTH)) {
+		extensions->scavengerForwardingTable = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCNUMAAWARENURSERY, OMR_XGCNUMAAWARENURSERY_LENGTH)) {
+		extensions->numaAwareNursery = true;
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCCONCURRENTSCAVENGERPACING, OMR_XGCCONCURRENTSCAVENGERPACING_LENGTH)) {
+		extensions->concurrentScavengerPacing = true;
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	else if (0 == strncmp(option, OMR_XGCCARDTABLESUMMARY, OMR_XGCCARDTABLESUMMARY_LENGTH)) {
+		extensions->cardTableSummary = true;
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+	else if (0 == strncmp(option, OMR_XGCPACKETLISTLOCKFREE, OMR_XGCPACKETLISTLOCKFREE_LENGTH)) {
+		extensions->packetListLockFree = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCWORKPACKETCACHE, OMR_XGCWORKPACKETCACHE_LENGTH)) {
+		extensions->workPacketCache = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCMARKINGPREFETCHDEPTH, OMR_XGCMARKINGPREFETCHDEPTH_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCMARKINGPREFETCHDEPTH_LENGTH, &extensions->markingPrefetchDepth)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCPARALLELCLEARMARKMAP, OMR_XGCPARALLELCLEARMARKMAP_LENGTH)) {
+		extensions->parallelClearMarkMap = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCCONCURRENTCLEARMARKMAP, OMR_XGCCONCURRENTCLEARMARKMAP_LENGTH)) {
+		extensions->concurrentClearMarkMap = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSIZECLASSFREELISTPOOL, OMR_XGCSIZECLASSFREELISTPOOL_LENGTH)) {
+		extensions->sizeClassFreeListPool = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCTLHADAPTIVESIZING, OMR_XGCTLHADAPTIVESIZING_LENGTH)) {
+		extensions->tlhAdaptiveSizing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCTLHADAPTIVEREFRESHINTERVAL, OMR_XGCTLHADAPTIVEREFRESHINTERVAL_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCTLHADAPTIVEREFRESHINTERVAL_LENGTH, &extensions->tlhAdaptiveRefreshInterval)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCPREDICTIVEHEAPSIZINGWEIGHT, OMR_XGCPREDICTIVEHEAPSIZINGWEIGHT_LENGTH)) {
+		uintptr_t weightPercent = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCPREDICTIVEHEAPSIZINGWEIGHT_LENGTH, &weightPercent)) || (0 == weightPercent) || (100 < weightPercent)) {
+			result = false;
+		} else {
+			extensions->predictiveHeapSizingWeight = (double)weightPercent / 100.0;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCPREDICTIVEHEAPSIZINGSTABILIZATIONCOUNT, OMR_XGCPREDICTIVEHEAPSIZINGSTABILIZATIONCOUNT_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCPREDICTIVEHEAPSIZINGSTABILIZATIONCOUNT_LENGTH, &extensions->predictiveHeapSizingStabilizationCount)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCPREDICTIVEHEAPSIZING, OMR_XGCPREDICTIVEHEAPSIZING_LENGTH)) {
+		extensions->predictiveHeapSizing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCMETADATAPAGESIZE, OMR_XGCMETADATAPAGESIZE_LENGTH)) {
+		uintptr_t pageSize = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCMETADATAPAGESIZE_LENGTH, &pageSize) || (0 == pageSize)) {
+			result = false;
+		} else {
+			extensions->setGCMetadataPageSize(pageSize);
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCOBJECTSTARTINDEX, OMR_XGCOBJECTSTARTINDEX_LENGTH)) {
+		extensions->enableObjectStartIndex = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCALLOCATIONSAMPLINGINTERVAL, OMR_XGCALLOCATIONSAMPLINGINTERVAL_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCALLOCATIONSAMPLINGINTERVAL_LENGTH, &extensions->allocationSamplingInterval)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCALLOCATIONCACHEREFILLBATCHCELLS, OMR_XGCALLOCATIONCACHEREFILLBATCHCELLS_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCALLOCATIONCACHEREFILLBATCHCELLS_LENGTH, &extensions->allocationCacheRefillBatchCells)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCADAPTIVEGCTHREADINGWORKPERTHREAD, OMR_XGCADAPTIVEGCTHREADINGWORKPERTHREAD_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCADAPTIVEGCTHREADINGWORKPERTHREAD_LENGTH, &extensions->adaptiveGCThreadingWorkPerThread) || (0 == extensions->adaptiveGCThreadingWorkPerThread)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCADAPTIVEGCTHREADING, OMR_XGCADAPTIVEGCTHREADING_LENGTH)) {
+		extensions->adaptiveGCThreading = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCTHREADSPINCOUNT, OMR_XGCTHREADSPINCOUNT_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCTHREADSPINCOUNT_LENGTH, &extensions->gcThreadSpinCount)) {
+			result = false;
+		}
+	}
 	else if (0 == strncmp(option, OMR_XGCTHREADS, OMR_XGCTHREADS_LENGTH)) {
 		uintptr_t forcedThreadCount = 0;
 		if (0 >= getUDATAValue(option + OMR_XGCTHREADS_LENGTH, &forcedThreadCount)) {
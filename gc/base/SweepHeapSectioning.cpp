@@ -86,7 +86,7 @@ MM_ParallelSweepChunkArray::initialize(MM_EnvironmentBase* env, bool useVmem)
 	} else {
 		if (useVmem) {
 			MM_MemoryManager* memoryManager = extensions->memoryManager;
-			if (memoryManager->createVirtualMemoryForMetadata(env, &_memoryHandle, extensions->heapAlignment, _size * sizeof(MM_ParallelSweepChunk))) {
+			if (memoryManager->createVirtualMemoryForMetadata(env, &_memoryHandle, extensions->heapAlignment, _size * sizeof(MM_ParallelSweepChunk), "sweepChunks")) {
 				void* base = memoryManager->getHeapBase(&_memoryHandle);
 				result = memoryManager->commitMemory(&_memoryHandle, base, _size * sizeof(MM_ParallelSweepChunk));
 				if (!result) {
@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "SweepPoolManagerSizeClassFreeList.hpp"
+#if defined(OMR_GC_MODRON_STANDARD)
+/**
+ * Allocate and initialize a new instance of the receiver.
+ * @return a new instance of the receiver, or NULL on failure.
+ */
+MM_SweepPoolManagerSizeClassFreeList *
+MM_SweepPoolManagerSizeClassFreeList::newInstance(MM_EnvironmentBase *env)
+{
+	MM_SweepPoolManagerSizeClassFreeList *sweepPoolManager;
+
+	sweepPoolManager = (MM_SweepPoolManagerSizeClassFreeList *)env->getForge()->allocate(sizeof(MM_SweepPoolManagerSizeClassFreeList), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (sweepPoolManager) {
+		new(sweepPoolManager) MM_SweepPoolManagerSizeClassFreeList(env);
+		if (!sweepPoolManager->initialize(env)) {
+			sweepPoolManager->kill(env);
+			sweepPoolManager = NULL;
+		}
+	}
+
+	return sweepPoolManager;
+}
+
+/**
+ * Move the free entries connected by sweep into the size class bins of the pool.
+ */
+void
+MM_SweepPoolManagerSizeClassFreeList::poolPostProcess(MM_EnvironmentBase *envModron, MM_MemoryPool *memoryPool)
+{
+	memoryPool->postProcess(envModron, MM_MemoryPool::forSweep);
+}
+
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(SWEEPPOOLMANAGERSIZECLASSFREELIST_HPP_)
+#define SWEEPPOOLMANAGERSIZECLASSFREELIST_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+#include "modronbase.h"
+
+#if defined(OMR_GC_MODRON_STANDARD)
+
+#include "Base.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "MemoryPool.hpp"
+#include "SweepPoolManagerAddressOrderedListBase.hpp"
+
+/**
+ * Sweep pool manager for MM_MemoryPoolSizeClassFreeList.
+ * Chunks are swept and connected into an address ordered list exactly as for the address ordered list pools,
+ * the pool then distributes the connected free entries into its size class bins once sweep completes.
+ */
+class MM_SweepPoolManagerSizeClassFreeList : public MM_SweepPoolManagerAddressOrderedListBase
+{
+private:
+protected:
+public:
+
+	static MM_SweepPoolManagerSizeClassFreeList *newInstance(MM_EnvironmentBase *env);
+
+	virtual void poolPostProcess(MM_EnvironmentBase *envModron, MM_MemoryPool *memoryPool);
+
+	/**
+	 * Create a SweepPoolManager object.
+	 */
+	MM_SweepPoolManagerSizeClassFreeList(MM_EnvironmentBase *env)
+		: MM_SweepPoolManagerAddressOrderedListBase(env)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+};
+
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+#endif /* SWEEPPOOLMANAGERSIZECLASSFREELIST_HPP_ */
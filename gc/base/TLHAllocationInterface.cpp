@@ -161,6 +161,24 @@ MM_TLHAllocationInterface::allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateD
 	return result;
 };
 
+/**
+ * Charge an object allocated out of line to the allocation sampling countdown of the TLH it would have come from.
+ */
+void
+MM_TLHAllocationInterface::sampleOutOfLineAllocation(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, void *heapBytes)
+{
+	if (0 != env->getExtensions()->allocationSamplingInterval) {
+#if defined(OMR_GC_NON_ZERO_TLH)
+		if (allocDescription->getNonZeroTLHFlag()) {
+			_tlhAllocationSupportNonZero.sampleOutOfLineAllocation(env, allocDescription, heapBytes);
+		} else
+#endif /* defined(OMR_GC_NON_ZERO_TLH) */
+		{
+			_tlhAllocationSupport.sampleOutOfLineAllocation(env, allocDescription, heapBytes);
+		}
+	}
+}
+
 void *
 MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure)
 {
@@ -206,7 +224,69 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 #endif /* OMR_GC_OBJECT_ALLOCATION_NOTIFY */
 		_stats._allocationBytes += allocDescription->getContiguousBytes();
 		_stats._allocationCount += 1;
+		sampleOutOfLineAllocation(env, allocDescription, result);
+	}
+
+	env->_oolTraceAllocationBytes += (_stats.bytesAllocated() - _bytesAllocatedBase); /* Increment by bytes allocated */
+
+	return result;
+}
+
+/**
+ * Allocate a contiguous run of objects of the same size from the TLH, refreshing it if it can not hold a single object.
+ * Tenured allocations and objects the TLH can not satisfy are allocated one at a time out of line. Tenured allocations
+ * must be allowed to collect on failure (see allocateObject()), so a tenured request that is not allocates nothing and
+ * the caller gets at most one tenured object per batch.
+ */
+void *
+MM_TLHAllocationInterface::allocateObjects(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySpace *memorySpace, uintptr_t maxCount, uintptr_t *count, bool shouldCollectOnFailure, bool cachedOnly)
+{
+	void *result = NULL;
+	*count = 0;
+
+	if (allocDescription->getTenuredFlag()) {
+		if (!cachedOnly && shouldCollectOnFailure) {
+			result = allocateObject(env, allocDescription, memorySpace, shouldCollectOnFailure);
+			if (NULL != result) {
+				*count = 1;
+			}
+		}
+		return result;
+	}
+
+	MM_AllocationContext *ac = env->getAllocationContext();
+	_bytesAllocatedBase = _stats.bytesAllocated();
+
+	/* Record the memory space from which the allocation takes place in the AD */
+	allocDescription->setMemorySpace(memorySpace);
+
+#if defined(OMR_GC_NON_ZERO_TLH)
+	if (allocDescription->getNonZeroTLHFlag()) {
+		result = _tlhAllocationSupportNonZero.allocateObjectsFromTLH(env, allocDescription, maxCount, count, shouldCollectOnFailure, !cachedOnly);
+	} else
+#endif /* defined(OMR_GC_NON_ZERO_TLH) */
+	{
+		result = _tlhAllocationSupport.allocateObjectsFromTLH(env, allocDescription, maxCount, count, shouldCollectOnFailure, !cachedOnly);
+	}
+
+	if ((NULL == result) && !cachedOnly) {
+		if (NULL != ac) {
+			/* allocation contexts currently aren't supported with generational schemes */
+			Assert_MM_true(memorySpace->getTenureMemorySubSpace() == memorySpace->getDefaultMemorySubSpace());
+			result = ac->allocateObject(env, allocDescription, shouldCollectOnFailure);
+		} else {
+			result = memorySpace->getDefaultMemorySubSpace()->allocateObject(env, allocDescription, NULL, NULL, shouldCollectOnFailure);
+		}
 
+		if (NULL != result) {
+#if defined(OMR_GC_OBJECT_ALLOCATION_NOTIFY)
+			env->objectAllocationNotify((omrobjectptr_t)result);
+#endif /* OMR_GC_OBJECT_ALLOCATION_NOTIFY */
+			_stats._allocationBytes += allocDescription->getContiguousBytes();
+			_stats._allocationCount += 1;
+			sampleOutOfLineAllocation(env, allocDescription, result);
+			*count = 1;
+		}
 	}
 
 	env->_oolTraceAllocationBytes += (_stats.bytesAllocated() - _bytesAllocatedBase); /* Increment by bytes allocated */
@@ -302,6 +382,9 @@ MM_TLHAllocationInterface::flushCache(MM_EnvironmentBase *env)
 void
 MM_TLHAllocationInterface::restartCache(MM_EnvironmentBase *env)
 {
+	/* Do not charge the GC pause to the allocation rate, and decay the rate of threads that were idle since the previous GC */
+	_owningEnv->_tlhAllocationRate.gcCompleted();
+
 	_tlhAllocationSupport.restart(env);
 
 #if defined(OMR_GC_NON_ZERO_TLH)
@@ -70,6 +70,7 @@ public:
 
 	virtual void *allocateObject(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure);
 	virtual void *allocateArray(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure);
+	virtual void *allocateObjects(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, MM_MemorySpace *memorySpace, uintptr_t maxCount, uintptr_t *count, bool shouldCollectOnFailure, bool cachedOnly);
 	virtual void *allocateArrayletSpine(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure);
 	virtual void *allocateArrayletLeaf(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure);
 
@@ -90,6 +91,7 @@ protected:
 private:
 	void reconnect(MM_EnvironmentBase *env, bool shouldFlush);
 	void *allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
+	void sampleOutOfLineAllocation(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, void *heapBytes);
 
 	/**
 	 * Create a ThreadLocalHeap object.
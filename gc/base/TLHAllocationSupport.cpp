@@ -25,6 +25,7 @@
  * @ingroup GC_Base_Core
  */
 
+#include <math.h>
 #include <string.h>
 
 #include "omrcfg.h"
@@ -73,8 +74,26 @@ void
 MM_TLHAllocationSupport::reportRefreshCache(MM_EnvironmentBase *env)
 {
 	MM_MemorySubSpace *subspace = env->getMemorySpace()->getDefaultMemorySubSpace();
+	MM_AllocationRateEstimator *allocationRate = &_objectAllocationInterface->getOwningEnv()->_tlhAllocationRate;
 
-	TRIGGER_J9HOOK_MM_PRIVATE_CACHE_REFRESHED(env->getExtensions()->privateHookInterface, _omrVMThread, subspace, getBase(), getTop());
+	TRIGGER_J9HOOK_MM_PRIVATE_CACHE_REFRESHED(env->getExtensions()->privateHookInterface, _omrVMThread, subspace, getBase(), getTop(),
+		allocationRate->getRefreshCount(), getRefreshSize(), allocationRate->getBytesPerMillisecond());
+}
+
+/**
+ * Pick the refresh size for the owning thread from its estimated allocation rate,
+ * such that a TLH lasts about tlhAdaptiveRefreshInterval microseconds.
+ */
+uintptr_t
+MM_TLHAllocationSupport::getAdaptiveRefreshSize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_AllocationRateEstimator *allocationRate = &_objectAllocationInterface->getOwningEnv()->_tlhAllocationRate;
+
+	uintptr_t refreshSize = allocationRate->getBytesPerInterval(extensions->tlhAdaptiveRefreshInterval);
+	refreshSize = MM_Math::roundToCeiling(extensions->tlhIncrementSize, refreshSize);
+	refreshSize = OMR_MAX(refreshSize, extensions->tlhInitialSize);
+	return OMR_MIN(refreshSize, extensions->tlhMaximumSize);
 }
 
 /**
@@ -120,6 +139,10 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 	}
 
 	_tlh->refreshSize = extensions->tlhInitialSize;
+
+	if (0 != extensions->allocationSamplingInterval) {
+		_bytesUntilSample = nextSamplingInterval(env);
+	}
 }
 
 /**
@@ -142,7 +165,12 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	/* Clear current information accumulated */
 	setAllZeroes();
 
-	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	if (extensions->tlhAdaptiveSizing) {
+		/* the rate of threads that did not refresh since the previous GC has been decayed by MM_TLHAllocationInterface::restartCache */
+		_tlh->refreshSize = getAdaptiveRefreshSize(env);
+	} else {
+		_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	}
 }
 
 /**
@@ -173,6 +201,12 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 
 	stats->_tlhDiscardedBytes += getSize();
 
+	/* Bytes allocated from the TLH being replaced, a sample for the thread allocation rate */
+	uintptr_t consumedBytes = 0;
+	if (NULL != getBase()) {
+		consumedBytes = (uintptr_t)getRealAlloc() - (uintptr_t)getBase();
+	}
+
 	/* Try to cache the current TLH */
 	if (NULL != getRealAlloc() && getSize() >= tlhMinimumSize) {
 		/* Cache the current TLH because it is bigger than the minimum size */
@@ -270,15 +304,23 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		 * Do not change stats here if TLH is flushed already
 		 */
 		if (0 < getSize()) {
-			reportRefreshCache(env);
 			stats->_tlhRequestedBytes += getRefreshSize();
-			/* TODO VMDESIGN 1322: adjust the amount consumed by the TLH refresh since a TLH refresh
-			 * may not give you the size requested */
-			/* Increase thread hungriness */
-			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
-				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
+			MM_AllocationRateEstimator *allocationRate = &_objectAllocationInterface->getOwningEnv()->_tlhAllocationRate;
+			if (extensions->tlhAdaptiveSizing) {
+				/* Size the next TLH from the observed allocation rate of this thread */
+				allocationRate->refreshed(env->getPortLibrary(), consumedBytes);
+				setRefreshSize(getAdaptiveRefreshSize(env));
+			} else {
+				allocationRate->refreshed(NULL, consumedBytes);
+				/* TODO VMDESIGN 1322: adjust the amount consumed by the TLH refresh since a TLH refresh
+				 * may not give you the size requested */
+				/* Increase thread hungriness */
+				/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
+				if (getRefreshSize() < tlhMaximumSize) {
+					setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
+				}
 			}
+			reportRefreshCache(env);
 		}
 	}
 
@@ -296,9 +338,15 @@ MM_TLHAllocationSupport::allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDes
 
 	Assert_MM_true(!env->getExtensions()->isSegregatedHeap());
 	uintptr_t sizeInBytesRequired = allocDescription->getContiguousBytes();
-	/* If there's insufficient space, refresh the current TLH */
-	if (sizeInBytesRequired > getSize()) {
-		refresh(env, allocDescription, shouldCollectOnFailure);
+	bool sample = false;
+	/* Inline allocation stops at the visible top, so the sampling countdown is only checked here */
+	if (sizeInBytesRequired > getVisibleSize()) {
+		/* If there's insufficient space, refresh the current TLH */
+		if (sizeInBytesRequired > getSize()) {
+			refresh(env, allocDescription, shouldCollectOnFailure);
+		}
+		/* the allocation covers the sampling point */
+		sample = (NULL != _realTop) && (sizeInBytesRequired > getVisibleSize());
 	}
 
 	/* Try to fit the allocate into the current TLH */
@@ -315,6 +363,67 @@ MM_TLHAllocationSupport::allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDes
 		allocDescription->setObjectFlags(getObjectFlags());
 		allocDescription->setMemorySubSpace((MM_MemorySubSpace *)_tlh->memorySubSpace);
 		allocDescription->completedFromTlh();
+		if (sample) {
+			sampleAllocation(env, allocDescription, memPtr, sizeInBytesRequired);
+		}
+	}
+
+	return memPtr;
+}
+
+/**
+ * Attempt to allocate a contiguous run of objects of the same size in this TLH.
+ * The TLH is refreshed first if it can not hold a single object and refreshing is allowed.
+ * A refresh that incurs allocation tax yields a single object so that the caller can save it while the tax is paid.
+ * @param maxCount[in] maximum number of objects to allocate
+ * @param count[out] number of objects allocated
+ * @return base address of the run, or NULL if not even one object fits
+ */
+void *
+MM_TLHAllocationSupport::allocateObjectsFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t maxCount, uintptr_t *count, bool shouldCollectOnFailure, bool shouldRefresh)
+{
+	void *memPtr = NULL;
+	*count = 0;
+
+	Assert_MM_true(!env->getExtensions()->isSegregatedHeap());
+	uintptr_t sizeInBytesRequired = allocDescription->getContiguousBytes();
+	/* If there's insufficient space for one object, refresh the current TLH */
+	if (shouldRefresh && (sizeInBytesRequired > getSize())) {
+		refresh(env, allocDescription, shouldCollectOnFailure);
+	}
+
+	uintptr_t available = getSize() / sizeInBytesRequired;
+	if (0 < available) {
+		uintptr_t runCount = OMR_MIN(maxCount, available);
+		if ((0 != allocDescription->getAllocationTaxSize()) && env->getExtensions()->payAllocationTax) {
+			runCount = 1;
+		}
+		/* end the run with the object that covers the sampling point */
+		bool sample = false;
+		if (NULL != _realTop) {
+			uintptr_t visibleCount = getVisibleSize() / sizeInBytesRequired;
+			if (visibleCount < runCount) {
+				runCount = visibleCount + 1;
+				sample = true;
+			}
+		}
+		uintptr_t runBytes = runCount * sizeInBytesRequired;
+		memPtr = (void *)getAlloc();
+		setAlloc((void *)((uintptr_t)getAlloc() + runBytes));
+#if defined(OMR_GC_TLH_PREFETCH_FTA)
+		if (*_pointerToTlhPrefetchFTA < (intptr_t)runBytes) {
+			*_pointerToTlhPrefetchFTA = 0;
+		} else {
+			*_pointerToTlhPrefetchFTA -= (intptr_t)runBytes;
+		}
+#endif /* OMR_GC_TLH_PREFETCH_FTA */
+		allocDescription->setObjectFlags(getObjectFlags());
+		allocDescription->setMemorySubSpace((MM_MemorySubSpace *)_tlh->memorySubSpace);
+		allocDescription->completedFromTlh();
+		*count = runCount;
+		if (sample) {
+			sampleAllocation(env, allocDescription, (void *)((uintptr_t)memPtr + runBytes - sizeInBytesRequired), sizeInBytesRequired);
+		}
 	}
 
 	return memPtr;
@@ -360,6 +469,14 @@ MM_TLHAllocationSupport::setupTLH(MM_EnvironmentBase *env, void *addrBase, void
 		updateFrequentObjectsStats(env);
 	}
 
+	if (0 != extensions->allocationSamplingInterval) {
+		/* carry the sampling countdown over to the new TLH */
+		if (NULL != getBase()) {
+			uintptr_t consumedBytes = (uintptr_t)getRealAlloc() - (uintptr_t)getBase();
+			_bytesUntilSample -= OMR_MIN(consumedBytes, _bytesUntilSample);
+		}
+	}
+
 	/* Set the new TLH values */
 	setBase(addrBase);
 	setAlloc(addrBase);
@@ -372,6 +489,86 @@ MM_TLHAllocationSupport::setupTLH(MM_EnvironmentBase *env, void *addrBase, void
 #if defined(OMR_GC_TLH_PREFETCH_FTA)
 	*_pointerToTlhPrefetchFTA = 0;
 #endif /* OMR_GC_TLH_PREFETCH_FTA */
+
+	if (0 != extensions->allocationSamplingInterval) {
+		setSamplingTop(env);
+	}
+}
+
+/**
+ * Pick the number of bytes to allocate before the next sampled object.
+ * The intervals are geometrically distributed around allocationSamplingInterval: the countdown is memoryless, so every
+ * allocated byte has the same chance of being sampled whatever the TLH (or out of line allocation) it came from.
+ */
+uintptr_t
+MM_TLHAllocationSupport::nextSamplingInterval(MM_EnvironmentBase *env)
+{
+	if (0 == _samplingSeed) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		_samplingSeed = (omrtime_hires_clock() ^ (uint64_t)(uintptr_t)this) | 1;
+	}
+
+	/* xorshift64* */
+	_samplingSeed ^= _samplingSeed >> 12;
+	_samplingSeed ^= _samplingSeed << 25;
+	_samplingSeed ^= _samplingSeed >> 27;
+	uint64_t random = _samplingSeed * 2685821657736338717ULL;
+
+	/* uniform in (0, 1) from the top 53 bits */
+	double uniform = ((double)(random >> 11) + 0.5) / 9007199254740992.0;
+	return (uintptr_t)(-log(uniform) * (double)env->getExtensions()->allocationSamplingInterval);
+}
+
+/**
+ * Lower the visible top of the TLH to the sampling point if it is in the TLH, restore the real top otherwise.
+ */
+void
+MM_TLHAllocationSupport::setSamplingTop(MM_EnvironmentBase *env)
+{
+	void *top = getTop();
+	uintptr_t base = (uintptr_t)getBase();
+
+	if ((0 != base) && (_bytesUntilSample < ((uintptr_t)top - base))) {
+		/* an allocation that already passed the sampling point stops at the current alloc */
+		uintptr_t samplingTop = OMR_MAX(base + _bytesUntilSample, (uintptr_t)getAlloc());
+		*_pointerToHeapTop = (uint8_t *)samplingTop;
+		_realTop = top;
+	} else {
+		setTop(top);
+	}
+}
+
+/**
+ * Record an object allocated from the TLH across the sampling point, and start the countdown to the next one.
+ * The sample is reported by MM_AllocateInitialization once the object is initialized.
+ */
+void
+MM_TLHAllocationSupport::sampleAllocation(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, void *heapBytes, uintptr_t size)
+{
+	allocDescription->setSampledAllocation(heapBytes);
+	_bytesUntilSample = ((uintptr_t)heapBytes + size - (uintptr_t)getBase()) + nextSamplingInterval(env);
+	setSamplingTop(env);
+}
+
+/**
+ * Charge an object allocated out of line to the sampling countdown, and record it if it covers the sampling point.
+ */
+void
+MM_TLHAllocationSupport::sampleOutOfLineAllocation(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, void *heapBytes)
+{
+	uintptr_t size = allocDescription->getContiguousBytes();
+	uintptr_t consumedBytes = 0;
+	if (NULL != getBase()) {
+		consumedBytes = (uintptr_t)getRealAlloc() - (uintptr_t)getBase();
+	}
+
+	if ((consumedBytes + size) > _bytesUntilSample) {
+		allocDescription->setSampledAllocation(heapBytes);
+		_bytesUntilSample = consumedBytes + nextSamplingInterval(env);
+	} else {
+		_bytesUntilSample -= size;
+	}
+	setSamplingTop(env);
 }
 
 void
@@ -83,6 +83,10 @@ private:
 
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
+	void *_realTop; /**< real top of the TLH while allocation sampling has lowered the visible top, NULL otherwise */
+	uintptr_t _bytesUntilSample; /**< bytes to allocate, counted from the TLH base, before the next sampled object */
+	uint64_t _samplingSeed; /**< state of the random generator of the sampling intervals */
+
 public:
 protected:
 private:
@@ -108,8 +112,18 @@ private:
 	};
 	MMINLINE void *getAlloc() { return (void *) *_pointerToHeapAlloc; };
 	MMINLINE void setAlloc(void *allocPtr) { *_pointerToHeapAlloc = (uint8_t *)allocPtr; };
-	MMINLINE void *getTop() { return (void *) *_pointerToHeapTop; };
-	MMINLINE void setTop(void *topPtr) { *_pointerToHeapTop = (uint8_t *)topPtr; };
+	/* Allocation sampling lowers the heapTop seen by inline allocation to the next sampling point, so that only the
+	 * out of line allocation path checks the sampling countdown. getTop() is the real top of the TLH.
+	 */
+	MMINLINE void *getTop()
+	{
+		if (NULL != _realTop) {
+			return _realTop;
+		} else {
+			return (void *) *_pointerToHeapTop;
+		}
+	};
+	MMINLINE void setTop(void *topPtr) { *_pointerToHeapTop = (uint8_t *)topPtr; _realTop = NULL; };
 	MMINLINE void setAllZeroes(void) { memset((void *)_tlh, 0, sizeof(LanguageThreadLocalHeapStruct)); };
 
 	/**
@@ -119,6 +133,13 @@ private:
 	 */
 	MMINLINE uintptr_t getSize() { return (uintptr_t)getTop() - (uintptr_t)getAlloc(); };
 
+	/**
+	 * Determine how much space is left below the visible top of the TLH, the next sampling point if it is in the TLH
+	 *
+	 * @return the space available to inline allocation (in bytes)
+	 */
+	MMINLINE uintptr_t getVisibleSize() { return (uintptr_t) *_pointerToHeapTop - (uintptr_t)getAlloc(); };
+
 	MMINLINE uint32_t getObjectFlags() { return (uint32_t)_tlh->objectFlags; };
 	MMINLINE void setObjectFlags(uint32_t flags) { _tlh->objectFlags = (uintptr_t)flags; };
 
@@ -133,12 +154,14 @@ private:
 
 	void reportClearCache(MM_EnvironmentBase *env);
 	void reportRefreshCache(MM_EnvironmentBase *env);
+	uintptr_t getAdaptiveRefreshSize(MM_EnvironmentBase *env);
 	void clear(MM_EnvironmentBase *env);
 	void reconnect(MM_EnvironmentBase *env, bool shouldFlush);
 	void restart(MM_EnvironmentBase *env);
 	bool refresh(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
 
 	void *allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
+	void *allocateObjectsFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t maxCount, uintptr_t *count, bool shouldCollectOnFailure, bool shouldRefresh);
 
 	void setupTLH(MM_EnvironmentBase *env, void *addrBase, void *addrTop, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
 
@@ -172,6 +195,11 @@ private:
 
 	void updateFrequentObjectsStats(MM_EnvironmentBase *env);
 
+	uintptr_t nextSamplingInterval(MM_EnvironmentBase *env);
+	void setSamplingTop(MM_EnvironmentBase *env);
+	void sampleAllocation(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, void *heapBytes, uintptr_t size);
+	void sampleOutOfLineAllocation(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, void *heapBytes);
+
 	/**
 	 * Create a ThreadLocalHeap object.
 	 */
@@ -185,7 +213,10 @@ private:
 		_objectAllocationInterface(NULL),
 		_abandonedList(NULL),
 		_abandonedListSize(0),
-		_zeroTLH(zeroTLH)
+		_zeroTLH(zeroTLH),
+		_realTop(NULL),
+		_bytesUntilSample(0),
+		_samplingSeed(0)
 	{};
 
 	/*
@@ -151,6 +151,13 @@ public:
 	 */
 	virtual bool shouldYieldFromTask(MM_EnvironmentBase *env) { return false; }
 
+	/**
+	 * Estimate the work of the task before it is dispatched, for adaptive GC threading.
+	 * @param env[in] The master thread
+	 * @return the estimated bytes to process, or 0 if the task can not estimate its work (all available threads are used)
+	 */
+	virtual uintptr_t getEstimatedWork(MM_EnvironmentBase *env) { return 0; }
+
 	/**
 	 * Create a Task object.
 	 */
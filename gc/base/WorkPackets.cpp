@@ -87,23 +87,23 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 
 	heapSize = _extensions->heap->getMaximumMemorySize();
 
-	if (!_emptyPacketList.initialize(env)) {
+	if (!_emptyPacketList.initialize(env, _packetsStart)) {
 		return false;
 	}
-	if (!_fullPacketList.initialize(env)) {
+	if (!_fullPacketList.initialize(env, _packetsStart)) {
 		return false;
 	}
-	if (!_nonEmptyPacketList.initialize(env)) {
+	if (!_nonEmptyPacketList.initialize(env, _packetsStart)) {
 		return false;
 	}
-	if (!_relativelyFullPacketList.initialize(env)) {
+	if (!_relativelyFullPacketList.initialize(env, _packetsStart)) {
 		return false;
 	}
-	if (!_deferredPacketList.initialize(env)) {
+	if (!_deferredPacketList.initialize(env, _packetsStart)) {
 		return false;
 	}
 	
-	if (!_deferredFullPacketList.initialize(env)) {
+	if (!_deferredFullPacketList.initialize(env, _packetsStart)) {
 		return false;
 	}
 
@@ -140,6 +140,8 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 	initialPacketCount = OMR_MAX(initialPacketCount, minimumPacketsForForwardProgress);
 
 	_packetsPerBlock = initialPacketCount / _initialBlocks;
+	/* packet ids used by the lock-free packet lists must be able to address every packet in a block */
+	Assert_MM_true(_packetsPerBlock <= PACKET_ID_INDEX_MASK);
 
 	/* If -Xgcworkpackets was specified  we don't allow later allocation of more packets */
 	_maxPackets = (0 != _extensions->workpacketCount) ? initialPacketCount : initialPacketCount * _increaseFactor;
@@ -194,6 +196,7 @@ MM_WorkPackets::initWorkPacketsBlock(MM_EnvironmentBase *env)
 	for(uintptr_t i = 0; i < _packetsPerBlock; i++) {
 		baseAddress = (uintptr_t *) (dataStart + (i * dataSize));
 		currentPtr->initialize(env, nextPtr, previousPtr, baseAddress, _slotsInPacket);
+		currentPtr->setPacketId(_packetsBlocksTop, i);
 
 		previousPtr = currentPtr;
 		currentPtr += 1;
@@ -329,7 +332,8 @@ MM_WorkPackets::reuseDeferredPackets(MM_EnvironmentBase *env)
 bool
 MM_WorkPackets::inputPacketAvailable(MM_EnvironmentBase *env)
 {
-	bool res = 	((!_fullPacketList.isEmpty())
+	bool res = 	((NULL != env->_cachedFullPacket)
+				|| (!_fullPacketList.isEmpty())
 				|| (!_relativelyFullPacketList.isEmpty())
 				|| (!_nonEmptyPacketList.isEmpty())
 				|| (!_overflowHandler->isEmpty()));
@@ -386,6 +390,18 @@ MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 {
 	MM_Packet *packet;
 
+	if (NULL != env->_cachedFullPacket) {
+		/* the packet this thread filled most recently is likely still in its cache */
+		packet = env->_cachedFullPacket;
+		env->_cachedFullPacket = NULL;
+		packet->setOwner(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats.workPacketsAcquired += 1;
+		env->_workPacketStats.workPacketsExchanged += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		return packet;
+	}
+
 	if (!inputPacketAvailable(env)) {
 		return NULL;
 	}
@@ -443,6 +459,9 @@ MM_WorkPackets::getInputPacket(MM_EnvironmentBase *env)
 			}
 		}
 
+		/* packets retained by this thread must be visible to the others before it waits for, or declares, completion */
+		flushPacketCache(env);
+
 		omrthread_monitor_enter(_inputListMonitor);
 
 		if(doneIndex == _inputListDoneIndex) {
@@ -507,6 +526,14 @@ MM_WorkPackets::getOutputPacket(MM_EnvironmentBase *env)
 {
 	MM_Packet *outputPacket = NULL;
 
+	/* Check the thread local cache */
+	if (NULL != env->_cachedEmptyPacket) {
+		outputPacket = env->_cachedEmptyPacket;
+		env->_cachedEmptyPacket = NULL;
+		outputPacket->setOwner(env);
+		return outputPacket;
+	}
+
 	/* Check the free list */
 	outputPacket = getPacket(env, &_emptyPacketList);
 	if(NULL != outputPacket) {
@@ -712,6 +739,10 @@ MM_WorkPackets::putPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 	if(freeSlots == _slotsInPacket) {
 		list = &_emptyPacketList;
 		packet->clearOwner();
+		if (isPacketCacheEnabled(env) && (NULL == env->_cachedEmptyPacket)) {
+			env->_cachedEmptyPacket = packet;
+			return;
+		}
 				
 	/* Full packet */
 	} else if(freeSlots == 0) {
@@ -755,14 +786,40 @@ MM_WorkPackets::notifyWaitingThreads(MM_EnvironmentBase *env)
  * Put an output packet
  * 
  * @param packet The packet to put
+ * @param mayCache false if the packet must not be retained in the packet cache of the thread
  */
 void
-MM_WorkPackets::putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+MM_WorkPackets::putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet, bool mayCache)
 {
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	env->_workPacketStats.workPacketsReleased += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
-	putPacket(env, packet);
+	/* Keep a full packet for this thread's next input packet unless another thread is starved for work */
+	if (mayCache && packet->isFull(env) && isPacketCacheEnabled(env) && (NULL == env->_cachedFullPacket) && (0 == _inputListWaitCount)) {
+		packet->resetOwner();
+		env->_cachedFullPacket = packet;
+	} else {
+		putPacket(env, packet);
+	}
+}
+
+/**
+ * Return any packets retained in the thread local cache to the shared lists
+ */
+void
+MM_WorkPackets::flushPacketCache(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = env->_cachedFullPacket;
+	if (NULL != packet) {
+		env->_cachedFullPacket = NULL;
+		putPacket(env, packet);
+	}
+
+	packet = env->_cachedEmptyPacket;
+	if (NULL != packet) {
+		env->_cachedEmptyPacket = NULL;
+		_emptyPacketList.push(env, packet);
+	}
 }
 
 /**
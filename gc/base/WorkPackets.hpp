@@ -94,6 +94,15 @@ protected:
 	bool initWorkPacketsBlock(MM_EnvironmentBase *env);
 
 	MM_Packet *getPacket(MM_EnvironmentBase *env, MM_PacketList *list);
+
+	/**
+	 * Packets are only cached by threads running a task, which flush their work stack (and therefore
+	 * the cache) when the task completes.
+	 */
+	MMINLINE bool isPacketCacheEnabled(MM_EnvironmentBase *env)
+	{
+		return _extensions->workPacketCache && (NULL != env->_currentTask);
+	}
 	MM_Packet *getLeastFullPacket(MM_EnvironmentBase *env, int requiredSlots);
 
 	virtual bool initialize(MM_EnvironmentBase *env);
@@ -115,7 +124,20 @@ public:
 	virtual MM_Packet *getInputPacket(MM_EnvironmentBase *env);
 	virtual MM_Packet *getOutputPacket(MM_EnvironmentBase *env);
 	void putPacket(MM_EnvironmentBase *env, MM_Packet *packet);
-	void putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+	/**
+	 * Return a packet filled by the current thread.
+	 * @param env - the current thread
+	 * @param packet - the packet to return
+	 * @param mayCache - if false the packet is put on the shared lists, never retained in the packet cache of the thread
+	 */
+	void putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet, bool mayCache = true);
+
+	/**
+	 * Return the packets retained by the current thread (see GCExtensionsBase::workPacketCache) to the shared lists.
+	 * Must be called before the thread stops using this object so that packet counts are accurate.
+	 * @param env - the current thread
+	 */
+	void flushPacketCache(MM_EnvironmentBase *env);
 	
 	MM_Packet *getDeferredPacket(MM_EnvironmentBase *env);
 	void putDeferredPacket(MM_EnvironmentBase *env, MM_Packet *packet);
@@ -83,6 +83,9 @@ MM_WorkStack::flush(MM_EnvironmentBase *env)
 		_workPackets->putDeferredPacket(env, _deferredPacket);
 		_deferredPacket = NULL;
 	}	
+	if (NULL != _workPackets) {
+		_workPackets->flushPacketCache(env);
+	}
 	_workPackets = NULL;
 }
 
@@ -268,7 +271,8 @@ void
 MM_WorkStack::flushOutputPacket(MM_EnvironmentBase *env)
 {
 	if (NULL != _outputPacket) {
-		_workPackets->putOutputPacket(env, _outputPacket);
+		/* the packet must reach the shared lists, it cannot wait in the thread local packet cache */
+		_workPackets->putOutputPacket(env, _outputPacket, false);
 		_outputPacket = NULL;
 	}
 }
@@ -190,6 +190,8 @@ getContractReasonAsString(ContractReason reason)
 		return "heap reconfiguration";
 	case FORCED_NURSERY_CONTRACT:
 		return "forced nursery contract";
+	case GC_RATIO_PREDICTED_TOO_LOW:
+		return "insufficient time predicted to be spent in gc";
 	default:
 		return "unknown";
 	}
@@ -217,6 +219,8 @@ getExpandReasonAsString(ExpandReason reason)
 		return "forced nursery expand";
 	case HINT_PREVIOUS_RUNS:
 		return "hint from previous runs";
+	case GC_RATIO_PREDICTED_TOO_HIGH:
+		return "excessive time predicted to be spent in gc";
 	default:
 		return "unknown";
 	}
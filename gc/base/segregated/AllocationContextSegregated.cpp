@@ -43,6 +43,8 @@
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
 #define MAX_UINT ((uintptr_t) (-1))
+/* The maximum number of free ranges a batched refill takes from a region */
+#define MAX_REFILL_RANGES 16
 
 MM_AllocationContextSegregated *
 MM_AllocationContextSegregated::newInstance(MM_EnvironmentBase *env, MM_GlobalAllocationManagerSegregated *gam, MM_RegionPoolSegregated *regionPool)
@@ -268,6 +270,27 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 	MM_SegregatedAllocationInterface* segregatedAllocationInterface = (MM_SegregatedAllocationInterface*)env->_objectAllocationInterface;
 	uintptr_t replenishSize = segregatedAllocationInterface->getReplenishSize(env, sizeInBytesRequired);
 	uintptr_t preAllocatedBytes = 0;
+	uintptr_t cellSize = sizeClasses->getCellSize(sizeClass);
+	uintptr_t refillBatchCells = env->getExtensions()->allocationCacheRefillBatchCells;
+	bool batchRefill = (0 < refillBatchCells) && segregatedAllocationInterface->cachedAllocationsEnabled(env);
+
+	if (batchRefill) {
+		/* Spare ranges of the last batched refill and ranges returned at the last GC are already pre-allocated and pre-marked */
+		MM_AllocationStats *stats = segregatedAllocationInterface->getAllocationStats();
+		MM_HeapLinkedFreeHeader *range = segregatedAllocationInterface->takeSpareCellRange(env, sizeClass);
+		if (NULL != range) {
+			stats->_cacheRefillSpareCount += 1;
+		} else {
+			range = _regionPool->popReturnedCellRange(sizeClass);
+			if (NULL != range) {
+				stats->_cacheRefillReturnedCount += 1;
+			}
+		}
+		if (NULL != range) {
+			segregatedAllocationInterface->replenishCache(env, sizeInBytesRequired, range, range->getSize());
+			return (uintptr_t *) segregatedAllocationInterface->allocateFromCache(env, sizeInBytesRequired);
+		}
+	}
 
 	while (!done) {
 
@@ -275,15 +298,33 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 		MM_HeapRegionDescriptorSegregated *region = _smallRegions[sizeClass];
 		if (NULL != region) {
 			MM_MemoryPoolAggregatedCellList *memoryPoolACL = region->getMemoryPoolACL();
-			uintptr_t* cellList = memoryPoolACL->preAllocateCells(env, sizeClasses->getCellSize(sizeClass), replenishSize, &preAllocatedBytes);
-			if (NULL != cellList) {
-				Assert_MM_true(preAllocatedBytes > 0);
-				if (shouldPreMarkSmallCells(env)) {
-					_markingScheme->preMarkSmallCells(env, region, cellList, preAllocatedBytes);
+			if (batchRefill) {
+				/* Take at least refillBatchCells cells under one acquisition of the region lock, the ranges that do not fit in the cache are kept as spares */
+				MM_HeapLinkedFreeHeader *ranges = memoryPoolACL->preAllocateCellRanges(env, cellSize, OMR_MAX(replenishSize, refillBatchCells * cellSize), MAX_REFILL_RANGES, &preAllocatedBytes);
+				if (NULL != ranges) {
+					Assert_MM_true(preAllocatedBytes > 0);
+					if (shouldPreMarkSmallCells(env)) {
+						for (MM_HeapLinkedFreeHeader *range = ranges; NULL != range; range = range->getNext()) {
+							_markingScheme->preMarkSmallCells(env, region, (uintptr_t *)range, range->getSize());
+						}
+					}
+					segregatedAllocationInterface->getAllocationStats()->_cacheRefillBatchCount += 1;
+					segregatedAllocationInterface->addSpareCellRanges(env, sizeClass, ranges->getNext());
+					segregatedAllocationInterface->replenishCache(env, sizeInBytesRequired, ranges, ranges->getSize());
+					result = (uintptr_t *) segregatedAllocationInterface->allocateFromCache(env, sizeInBytesRequired);
+					done = true;
+				}
+			} else {
+				uintptr_t* cellList = memoryPoolACL->preAllocateCells(env, cellSize, replenishSize, &preAllocatedBytes);
+				if (NULL != cellList) {
+					Assert_MM_true(preAllocatedBytes > 0);
+					if (shouldPreMarkSmallCells(env)) {
+						_markingScheme->preMarkSmallCells(env, region, cellList, preAllocatedBytes);
+					}
+					segregatedAllocationInterface->replenishCache(env, sizeInBytesRequired, cellList, preAllocatedBytes);
+					result = (uintptr_t *) segregatedAllocationInterface->allocateFromCache(env, sizeInBytesRequired);
+					done = true;
 				}
-				segregatedAllocationInterface->replenishCache(env, sizeInBytesRequired, cellList, preAllocatedBytes);
-				result = (uintptr_t *) segregatedAllocationInterface->allocateFromCache(env, sizeInBytesRequired);
-				done = true;
 			}
 		}
 
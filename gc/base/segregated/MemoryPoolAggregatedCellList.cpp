@@ -92,6 +92,73 @@ MM_MemoryPoolAggregatedCellList::preAllocateCells(MM_EnvironmentBase* env, uintp
 	return allocatedCellList;
 }
 
+/**
+ * Pre allocates up to maxRanges ranges of cells within the region, under a single acquisition of the lock,
+ * until at least desiredBytes have been taken or the region has no free cells left.
+ * Each range starts with a hole header holding its size and linking it to the next range, so that the ranges
+ * stay walkable until they are allocated into.
+ * @param desiredBytes the desired amount of bytes to be pre-allocated
+ * @param maxRanges the maximum number of ranges to take
+ * @param preAllocatedBytes a pointer to where the actual amount of pre-allocated bytes will be written to
+ * @return the first of the linked ranges, NULL if the region has no free cells
+ */
+MM_HeapLinkedFreeHeader*
+MM_MemoryPoolAggregatedCellList::preAllocateCellRanges(MM_EnvironmentBase* env, uintptr_t cellSize, uintptr_t desiredBytes, uintptr_t maxRanges, uintptr_t* preAllocatedBytes)
+{
+	MM_HeapLinkedFreeHeader *firstRange = NULL;
+	MM_HeapLinkedFreeHeader *lastRange = NULL;
+	uintptr_t rangeCount = 0;
+	uintptr_t totalBytes = 0;
+
+	_lock.acquire();
+
+	while ((totalBytes < desiredBytes) && (rangeCount < maxRanges)) {
+		if (_heapCurrent == _heapTop) {
+			/* The current chunk is empty, get the next one */
+			refreshCurrentEntry();
+			if (NULL == _heapCurrent) {
+				break;
+			}
+		}
+
+		uintptr_t *rangeBase = _heapCurrent;
+		uintptr_t availableBytes = (uintptr_t)_heapTop - (uintptr_t)_heapCurrent;
+		uintptr_t rangeBytes = availableBytes;
+		uintptr_t remainingBytes = desiredBytes - totalBytes;
+		if (availableBytes > remainingBytes) {
+			/* Carve off the cells still needed and make the remainder walkable */
+			rangeBytes = ((remainingBytes + cellSize - 1) / cellSize) * cellSize;
+			_heapCurrent = (uintptr_t *)((uintptr_t)_heapCurrent + rangeBytes);
+		} else {
+			/* Take the whole free chunk */
+			_heapCurrent = _heapTop;
+		}
+		if (_heapCurrent < _heapTop) {
+			MM_HeapLinkedFreeHeader::fillWithHoles(_heapCurrent, (uintptr_t)_heapTop - (uintptr_t)_heapCurrent);
+		}
+
+		MM_HeapLinkedFreeHeader *range = MM_HeapLinkedFreeHeader::getHeapLinkedFreeHeader(rangeBase);
+		range->setSize(rangeBytes);
+		range->setNext(NULL);
+		if (NULL == lastRange) {
+			firstRange = range;
+		} else {
+			lastRange->setNext(range);
+		}
+		lastRange = range;
+		rangeCount += 1;
+		totalBytes += rangeBytes;
+	}
+
+	if (0 < totalBytes) {
+		addBytesAllocated(env, totalBytes);
+	}
+	_lock.release();
+
+	*preAllocatedBytes = totalBytes;
+	return firstRange;
+}
+
 /**
  * @todo Provide function documentation
  */
@@ -121,6 +121,7 @@ public:
 	void returnCell(MM_EnvironmentBase *env, uintptr_t *cell);
 	MMINLINE bool hasCell() { return (_freeListHead != NULL) || (_heapCurrent < _heapTop); }
 	uintptr_t* preAllocateCells(MM_EnvironmentBase* env, uintptr_t cellSize, uintptr_t desiredBytes, uintptr_t* preAllocatedBytesOutput);
+	MM_HeapLinkedFreeHeader* preAllocateCellRanges(MM_EnvironmentBase* env, uintptr_t cellSize, uintptr_t desiredBytes, uintptr_t maxRanges, uintptr_t* preAllocatedBytesOutput);
 	void addBytesAllocated(MM_EnvironmentBase* env, uintptr_t bytesAllocated);
 	uintptr_t debugCountFreeBytes();
 	
@@ -78,6 +78,7 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 		}
 		_smallFullRegions[szClass] = NULL;
 		_smallSweepRegions[szClass] = NULL;
+		_returnedCellRanges[szClass] = NULL;
 	}
 
 	_singleFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_FREE, true);
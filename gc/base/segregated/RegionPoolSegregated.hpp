@@ -26,6 +26,7 @@
 #include "omrcomp.h"
 #include "sizeclasses.h"
 
+#include "HeapLinkedFreeHeader.hpp"
 #include "HeapRegionList.hpp"
 #include "HeapRegionManager.hpp"
 #include "LockingHeapRegionQueue.hpp"
@@ -139,6 +140,12 @@ private:
 	uintptr_t _splitAvailableListSplitCount; /* number of split available region queues per size class per defragment bucket */
 	uint8_t _skipAvailableRegionForAllocation[OMR_SIZECLASSES_NUM_SMALL+1]; /* per size class flag to indicate if there is any available regions left for allocation for that size class */
 
+	/**
+	 * @note Ranges are only pushed while the GC holds exclusive access and only popped by mutators, so the
+	 * stacks cannot suffer from ABA: a range that has been popped is never pushed back before the next GC.
+	 */
+	MM_HeapLinkedFreeHeader *volatile _returnedCellRanges[OMR_SIZECLASSES_NUM_SMALL+1]; /**< Pre-allocated cell ranges returned by the allocation caches at GC, handed out again without locking (per size class). */
+
 
 protected:
 public:
@@ -257,6 +264,40 @@ public:
 	MMINLINE uintptr_t getDarkMatterCellCount(uintptr_t sizeClass) { return _darkMatterCellCount[sizeClass]; }
 
 	void joinBucketListsForSplitIndex(MM_EnvironmentBase *env);
+
+	/**
+	 * Push a pre-allocated cell range left over in an allocation cache. Only called by the GC, with exclusive access.
+	 * @param range the first cell of the range, which holds the range size
+	 */
+	MMINLINE void
+	pushReturnedCellRange(uintptr_t sizeClass, MM_HeapLinkedFreeHeader *range)
+	{
+		range->setNext(_returnedCellRanges[sizeClass]);
+		_returnedCellRanges[sizeClass] = range;
+	}
+
+	/**
+	 * Pop a pre-allocated cell range returned at the last GC.
+	 * @return the first cell of the range, which holds the range size, or NULL if there is none left
+	 */
+	MMINLINE MM_HeapLinkedFreeHeader *
+	popReturnedCellRange(uintptr_t sizeClass)
+	{
+		MM_HeapLinkedFreeHeader *range = _returnedCellRanges[sizeClass];
+		while (NULL != range) {
+			/* the next link may be overwritten by the thread that wins the range, in which case the exchange fails */
+			MM_HeapLinkedFreeHeader *next = range->getNext();
+			MM_HeapLinkedFreeHeader *head = (MM_HeapLinkedFreeHeader *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_returnedCellRanges[sizeClass], (uintptr_t)range, (uintptr_t)next);
+			if (head == range) {
+				break;
+			}
+			range = head;
+		}
+		return range;
+	}
+
+	MMINLINE MM_HeapLinkedFreeHeader *getReturnedCellRanges(uintptr_t sizeClass) { return _returnedCellRanges[sizeClass]; }
+	MMINLINE void resetReturnedCellRanges() { memset((void *)_returnedCellRanges, 0, sizeof(_returnedCellRanges)); }
 	
 	void setSweepScheme(MM_SweepSchemeSegregated *sweepScheme) { _sweepScheme = sweepScheme; }
 
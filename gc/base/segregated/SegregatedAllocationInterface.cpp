@@ -33,6 +33,7 @@
 #include "Heap.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
+#include "RegionPoolSegregated.hpp"
 #include "SizeClasses.hpp"
 #include "ObjectHeapIteratorSegregated.hpp"
 
@@ -261,6 +262,8 @@ MM_SegregatedAllocationInterface::flushCache(MM_EnvironmentBase *env)
 		}
 	}
 	memset(_allocationCache, 0, sizeof(LanguageSegregatedAllocationCache));
+	/* spare ranges are already walkable, they are recovered by the next sweep */
+	memset(_spareCellRanges, 0, sizeof(_spareCellRanges));
 	env->getExtensions()->allocationStats.merge(&_stats);
 	_stats.clear();
 }
@@ -339,6 +342,57 @@ MM_SegregatedAllocationInterface::replenishCache(MM_EnvironmentBase* env, uintpt
 	}
 }
 
+/**
+ * Keep the ranges of a batched refill that did not go into the cache. The spare ranges of the size class must be empty.
+ * @param ranges The first of the linked ranges, each starting with a hole header holding its size
+ */
+void
+MM_SegregatedAllocationInterface::addSpareCellRanges(MM_EnvironmentBase* env, uintptr_t sizeClass, MM_HeapLinkedFreeHeader *ranges)
+{
+	Assert_MM_true(NULL == _spareCellRanges[sizeClass]);
+	_spareCellRanges[sizeClass] = ranges;
+}
+
+/**
+ * Take the next spare range of the given size class.
+ * @return The first cell of the range, which holds the range size, or NULL if there are no spare ranges
+ */
+MM_HeapLinkedFreeHeader *
+MM_SegregatedAllocationInterface::takeSpareCellRange(MM_EnvironmentBase* env, uintptr_t sizeClass)
+{
+	MM_HeapLinkedFreeHeader *range = _spareCellRanges[sizeClass];
+	if (NULL != range) {
+		_spareCellRanges[sizeClass] = range->getNext();
+	}
+	return range;
+}
+
+/**
+ * Hand the unused part of the cache and the spare ranges over to the returned cell range stacks of the region pool,
+ * so that any thread can refill from them after the GC without taking a region lock. Must be called by the GC,
+ * with exclusive access, before the caches are flushed.
+ */
+void
+MM_SegregatedAllocationInterface::returnCellRanges(MM_EnvironmentBase* env, MM_RegionPoolSegregated *regionPool)
+{
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		if (_allocationCache[sizeClass].current < _allocationCache[sizeClass].top) {
+			MM_HeapLinkedFreeHeader *range = MM_HeapLinkedFreeHeader::getHeapLinkedFreeHeader(_allocationCache[sizeClass].current);
+			range->setSize((uintptr_t)_allocationCache[sizeClass].top - (uintptr_t)_allocationCache[sizeClass].current);
+			regionPool->pushReturnedCellRange(sizeClass, range);
+		}
+		_allocationCache[sizeClass].current = NULL;
+		_allocationCache[sizeClass].top = NULL;
+
+		MM_HeapLinkedFreeHeader *range = takeSpareCellRange(env, sizeClass);
+		while (NULL != range) {
+			MM_HeapLinkedFreeHeader *next = takeSpareCellRange(env, sizeClass);
+			regionPool->pushReturnedCellRange(sizeClass, range);
+			range = next;
+		}
+	}
+}
+
 uintptr_t
 MM_SegregatedAllocationInterface::getReplenishSize(MM_EnvironmentBase* env, uintptr_t sizeInBytes)
 {
@@ -374,14 +428,14 @@ void
 MM_SegregatedAllocationInterface::updateFrequentObjectsStats(MM_EnvironmentBase *env, uintptr_t sizeClass)
 {
 	MM_GCExtensionsBase *extensions = env->getExtensions();
-	MM_AllocationContextSegregated *ac = (MM_AllocationContextSegregated *) env->getAllocationContext();
 	omrobjectptr_t base = (omrobjectptr_t) _allocationCacheBases[sizeClass];
 	omrobjectptr_t top = (omrobjectptr_t) _allocationCache[sizeClass].top;
 
 	if((NULL != _frequentObjectsStats) && (NULL != base) && (NULL != top)){
 		uintptr_t cellSize = _sizeClasses->getCellSize(sizeClass);
 
-		GC_ObjectHeapIteratorSegregated objectHeapIterator(extensions, base, top, ac->_smallRegions[sizeClass]->getRegionType(), cellSize, false, false);
+		/* the cache may have been refilled from a returned or spare range, without a current region */
+		GC_ObjectHeapIteratorSegregated objectHeapIterator(extensions, base, top, MM_HeapRegionDescriptor::SEGREGATED_SMALL, cellSize, false, false);
 		omrobjectptr_t object = NULL;
 		uintptr_t limit = (((uintptr_t) top - (uintptr_t) base)*extensions->frequentObjectAllocationSamplingRate)/100 + (uintptr_t) base;
 
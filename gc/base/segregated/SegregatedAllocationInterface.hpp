@@ -32,6 +32,8 @@
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
+class MM_HeapLinkedFreeHeader;
+class MM_RegionPoolSegregated;
 class MM_SizeClasses;
 
 typedef struct SegregatedAllocationCacheStats {
@@ -58,6 +60,7 @@ private:
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
 	
 	uintptr_t *_allocationCacheBases[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The Base of each current cache (per size class). */
+	MM_HeapLinkedFreeHeader *_spareCellRanges[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< Pre-allocated cell ranges taken by a batched refill that have not been moved into the cache yet (per size class). */
 
 	/*
 	 * Function members
@@ -90,6 +93,9 @@ public:
 	void* allocateFromCache(MM_EnvironmentBase* env, uintptr_t sizeInBytes);
 	void replenishCache(MM_EnvironmentBase* env, uintptr_t sizeInBytes, void *cacheMemory, uintptr_t cacheSize);
 	uintptr_t getReplenishSize(MM_EnvironmentBase* env, uintptr_t sizeInBytes);
+	void addSpareCellRanges(MM_EnvironmentBase* env, uintptr_t sizeClass, MM_HeapLinkedFreeHeader *ranges);
+	MM_HeapLinkedFreeHeader *takeSpareCellRange(MM_EnvironmentBase* env, uintptr_t sizeClass);
+	void returnCellRanges(MM_EnvironmentBase* env, MM_RegionPoolSegregated *regionPool);
 	
 	virtual void enableCachedAllocations(MM_EnvironmentBase *env);
 	virtual void disableCachedAllocations(MM_EnvironmentBase *env);
@@ -106,6 +112,7 @@ protected:
 	{
 		_typeId = __FUNCTION__;
 		memset(_allocationCacheBases, 0, sizeof(_allocationCacheBases));
+		memset(_spareCellRanges, 0, sizeof(_spareCellRanges));
 	};
 	
 private:
@@ -26,10 +26,13 @@
 #include "EnvironmentBase.hpp"
 #include "GlobalAllocationManagerSegregated.hpp"
 #include "Heap.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionManager.hpp"
 #include "MarkMap.hpp"
 #include "modronapicore.hpp"
 #include "MemoryPoolSegregated.hpp"
 #include "ParallelMarkTask.hpp"
+#include "RegionPoolSegregated.hpp"
 #include "SegregatedAllocationInterface.hpp"
 #include "SegregatedMarkingScheme.hpp"
 #include "SegregatedSweepTask.hpp"
@@ -215,6 +218,9 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 
+	/* The returned cell ranges stay reserved for allocation, keep them from being swept */
+	preMarkReturnedCellRanges(env);
+
 	/* Do any post mark checks */
 	/* OMRTODO we need to implement this function for segregated marking scheme */
 //	_markingScheme->masterCleanupAfterGC(env);
@@ -308,6 +314,46 @@ MM_SegregatedGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace
 }
 
 
+/**
+ * With batched allocation cache refills, move the cells left in the allocation caches of all threads to the
+ * returned cell range stacks of the region pool, from which any thread can refill after the GC without locking.
+ * Otherwise drop whatever is left on the stacks so that it is swept. This has to happen before exclusive access
+ * for the GC flushes the caches, which would otherwise leave the cells to the sweep.
+ */
+void
+MM_SegregatedGC::preFlushCachesForGC(MM_EnvironmentBase *env)
+{
+	MM_RegionPoolSegregated *regionPool = ((MM_MemoryPoolSegregated *)env->getDefaultMemorySubSpace()->getMemoryPool())->getRegionPool();
+
+	if (0 < _extensions->allocationCacheRefillBatchCells) {
+		GC_OMRVMThreadListIterator vmThreadListIterator(env->getOmrVM());
+		while (OMR_VMThread *thread = vmThreadListIterator.nextOMRVMThread()) {
+			MM_EnvironmentBase *walkEnv = MM_EnvironmentBase::getEnvironment(thread);
+			((MM_SegregatedAllocationInterface *)(walkEnv->_objectAllocationInterface))->returnCellRanges(walkEnv, regionPool);
+		}
+	} else {
+		regionPool->resetReturnedCellRanges();
+	}
+}
+
+/**
+ * Mark the cells of the returned cell ranges, as allocation does when it pre-allocates them.
+ * Must be called after the mark map has been cleared for the cycle and before the sweep.
+ */
+void
+MM_SegregatedGC::preMarkReturnedCellRanges(MM_EnvironmentBase *env)
+{
+	MM_RegionPoolSegregated *regionPool = ((MM_MemoryPoolSegregated *)env->getDefaultMemorySubSpace()->getMemoryPool())->getRegionPool();
+	MM_HeapRegionManager *regionManager = _extensions->getHeap()->getHeapRegionManager();
+
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		for (MM_HeapLinkedFreeHeader *range = regionPool->getReturnedCellRanges(sizeClass); NULL != range; range = range->getNext()) {
+			MM_HeapRegionDescriptorSegregated *region = (MM_HeapRegionDescriptorSegregated *)regionManager->tableDescriptorForAddress(range);
+			_markingScheme->preMarkSmallCells(env, region, (uintptr_t *)range, range->getSize());
+		}
+	}
+}
+
 /*
  * Reporting
  */
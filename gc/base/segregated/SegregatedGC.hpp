@@ -73,6 +73,8 @@ protected:
 	void reportSweepStart(MM_EnvironmentBase *env);
 	void reportSweepEnd(MM_EnvironmentBase *env);
 
+	void preMarkReturnedCellRanges(MM_EnvironmentBase *env);
+
 public:
 	static MM_SegregatedGC *newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
@@ -83,6 +85,7 @@ public:
 	virtual void collectorShutdown(MM_GCExtensionsBase* extensions);
 
 	virtual void setupForGC(MM_EnvironmentBase*);
+	virtual void preFlushCachesForGC(MM_EnvironmentBase *env);
 	virtual void abortCollection(MM_EnvironmentBase* env, CollectionAbortReason reason);
 
 	virtual void* createSweepPoolState(MM_EnvironmentBase* env, MM_MemoryPool* memoryPool);
@@ -1411,7 +1411,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
@@ -1476,7 +1476,7 @@ MM_CompactScheme::parallelFixHeapForWalk(MM_EnvironmentBase *env)
         	if (subAreaTable[i].state == SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_heap_for_walk)) {
 	        		omrobjectptr_t start = subAreaTable[i].firstObject;
-					omrobjectptr_t end   = subAreaTable[i].firstObject;
+					omrobjectptr_t end   = subAreaTable[i + 1].firstObject;
 					omrobjectptr_t alignedEnd = pageStart(pageIndex(end));
 
 					GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, start, end, false);
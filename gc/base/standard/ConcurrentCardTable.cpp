@@ -469,6 +469,12 @@ MM_ConcurrentCardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 		assume0(_extensions->heapAlignment % CARD_SIZE == 0);
 	
 		_lastCard = getCardTableStart();
+
+		if (_extensions->cardTableSummary) {
+			if (!initializeCardSummary(env, calculateCardTableSize(env, heap->getMaximumPhysicalRange()))) {
+				return false;
+			}
+		}
 	
 		/* We only allocate TLH mark bits if scavenger is NOT active.
 		 * If scavenger is active all TLH's are in NEW space and we don't trace
@@ -483,7 +489,7 @@ MM_ConcurrentCardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 			uintptr_t tlhMarkMapSizeRequired = calculateTLHMarkMapSize(env,cardTableSizeRequired);
 
 			MM_MemoryManager *memoryManager = _extensions->memoryManager;
-			if (!memoryManager->createVirtualMemoryForMetadata(env, &_tlhMarkMapMemoryHandle, sizeof(uintptr_t), tlhMarkMapSizeRequired)) {
+			if (!memoryManager->createVirtualMemoryForMetadata(env, &_tlhMarkMapMemoryHandle, sizeof(uintptr_t), tlhMarkMapSizeRequired, "tlhMarkMap")) {
 				return false;
 			}
 	
@@ -610,6 +616,7 @@ MM_ConcurrentCardTable::dirtyCardsInRange(MM_EnvironmentBase *env, void *heapBas
 		if (*baseCard != (Card)CARD_DIRTY) {
 			*baseCard = (Card)CARD_DIRTY;
 		}
+		dirtyCardSummary(baseCard);
 		baseCard += 1;
 	}
 }
@@ -623,6 +630,11 @@ MM_ConcurrentCardTable::initializeCardCleaning(MM_EnvironmentBase *env)
 {
 	initializeCardCleaningStatistics();
 
+	/* All cards of the concurrently collectable subspaces are about to be cleared by concurrent
+	 * initialization, and nothing is marked yet, so dirtied blocks can start to be tracked afresh
+	 */
+	clearCardSummary(env);
+
 	if (_extensions->cardCleaningPasses > 0) {
 		MM_AtomicOperations::lockCompareExchangeU32((volatile uint32_t*)&_cardCleanPhase,
 													(uint32_t)_cardCleanPhase,
@@ -1639,25 +1651,13 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 
 		for (currentCard = firstCard; currentCard < lastCardToClean; currentCard++) {
 
-			/* Are we are on an uintptr_t boundary? If so scan the card table a uintptr_t
-	 		 * at a time until we find a slot which is non-zero or the end of card table
-	 		 * found. This is based on the premise that the card table will be mostly
-	 		 * empty and scanning an uintptr_t at a time will reduce the time taken to
-	 		 * scan the card table.
-	 		 */
-			if (((Card)CARD_CLEAN == *currentCard) && (0 == (uintptr_t)currentCard % sizeof(uintptr_t))) {
-				uintptr_t *nextSlot = (uintptr_t *)currentCard;
-				/* Last card may be in middle of a slot so only scan up to an including last
-				 * complete slots worth of cards; then go card at a time
-				 **/
-				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
-				}
-				/*
-			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
-				 */
-				currentCard = (Card *)nextSlot;
+			/* Skip clean cards in bulk. This is based on the premise that the card table
+			 * will be mostly empty: clean cards are scanned many at a time and, if the
+			 * card table has a summary, blocks of cards which have not been dirtied since
+			 * card cleaning was initialized are not scanned at all.
+			 */
+			if ((Card)CARD_CLEAN == *currentCard) {
+				currentCard = findFirstUncleanCard(env, currentCard, lastCardToClean);
 
 				if (currentCard >= lastCardToClean) {
 					break;
@@ -25,6 +25,7 @@
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 
 #include "ConcurrentGC.hpp"
+#include "MarkingScheme.hpp"
 
 #include "ConcurrentCompleteTracingTask.hpp"
 
@@ -56,5 +57,12 @@ MM_ConcurrentCompleteTracingTask::cleanup(MM_EnvironmentBase *env)
 	}
 }
 
+uintptr_t
+MM_ConcurrentCompleteTracingTask::getEstimatedWork(MM_EnvironmentBase *env)
+{
+	/* the objects left in work packets by concurrent marking are the work of the final trace */
+	return _collector->getMarkingScheme()->estimatePendingMarkWork();
+}
+
 #endif /* OMR_GC_MODRON_CONCURRENT_MARK */
  
@@ -54,6 +54,7 @@ public:
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
 	virtual void cleanup(MM_EnvironmentBase *env);
+	virtual uintptr_t getEstimatedWork(MM_EnvironmentBase *env);
 
 	/**
 	 * Create a ConcurrentCompleteTracingTask object
@@ -35,6 +35,7 @@
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapSplit.hpp"
+#include "Math.hpp"
 #include "MemoryPool.hpp"
 #include "MemoryPoolAddressOrderedList.hpp"
 #include "MemorySpace.hpp"
@@ -47,6 +48,9 @@
 #include "PhysicalSubArenaVirtualMemorySemiSpace.hpp"
 #include "Scavenger.hpp"
 
+/* Nursery stripes of each NUMA node in each semi space of the initial nursery, with -Xgc:numaAwareNursery */
+#define NUMA_NURSERY_STRIPES_PER_NODE 4
+
 MM_Configuration *
 MM_ConfigurationGenerational::newInstance(MM_EnvironmentBase *env)
 {
@@ -118,6 +122,20 @@ MM_ConfigurationGenerational::createSemiSpace(MM_EnvironmentBase *envBase, MM_He
 		return NULL;
 	}
 	physicalSubArenaSemiSpace->setNumaNode(numaNode);
+
+	/* Without an explicit binding, spread the nursery over the nodes in address aligned stripes (whole pages, so that
+	 * each can be bound to its node) and carve TLHs and survivor copies from the stripes of the thread's own node.
+	 */
+	uintptr_t nodeCount = ext->_numaManager.getAffinityLeaderCount();
+	if (ext->numaAwareNursery && (1 < nodeCount) && ((0 == numaNode) || (UDATA_MAX == numaNode))) {
+		uintptr_t pageSize = heap->getPageSize();
+		uintptr_t stripeSize = MM_Math::roundToFloor(pageSize, parameters->_initialNewSpaceSize / (2 * nodeCount * NUMA_NURSERY_STRIPES_PER_NODE));
+		ext->numaAwareNurseryStripeSize = OMR_MAX(stripeSize, pageSize);
+		ext->numaAwareNurseryNodeCount = nodeCount;
+		memoryPoolAllocate->setNumaStriped(true);
+		memoryPoolSurvivor->setNumaStriped(true);
+		physicalSubArenaSemiSpace->setNumaStriped(true);
+	}
 	if(NULL == (memorySubSpaceSemiSpace = MM_MemorySubSpaceSemiSpace::newInstance(env, scavenger, physicalSubArenaSemiSpace, memorySubSpaceGenericAllocate, memorySubSpaceGenericSurvivor, false, parameters->_minimumNewSpaceSize, parameters->_initialNewSpaceSize, parameters->_maximumNewSpaceSize))) {
 		memorySubSpaceGenericAllocate->kill(env);
 		memorySubSpaceGenericSurvivor->kill(env);
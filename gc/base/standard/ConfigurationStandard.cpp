@@ -26,6 +26,7 @@
  */
  
 #include "omrcfg.h"
+#include "ModronAssertions.h"
 
 #include "ConfigurationStandard.hpp"
 
@@ -47,10 +48,12 @@
 #include "MemoryPoolSplitAddressOrderedList.hpp"
 #include "MemoryPoolHybrid.hpp"
 #include "MemoryPoolLargeObjects.hpp"
+#include "MemoryPoolSizeClassFreeList.hpp"
 #include "ParallelGlobalGC.hpp"
 #include "SweepPoolManagerAddressOrderedList.hpp"
 #include "SweepPoolManagerSplitAddressOrderedList.hpp"
 #include "SweepPoolManagerHybrid.hpp"
+#include "SweepPoolManagerSizeClassFreeList.hpp"
 
 /**
  * Tear down Standard Configuration
@@ -81,7 +84,32 @@ MM_ConfigurationStandard::initialize(MM_EnvironmentBase* env)
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 	bool result = MM_Configuration::initialize(env);
 	if (result) {
-		extensions->payAllocationTax = extensions->isConcurrentMarkEnabled() || extensions->isConcurrentSweepEnabled();
+		if (extensions->concurrentClearMarkMap) {
+			/* Mutators may only clear the mark map if nothing reads it between global collections */
+			const char *markMapReader = NULL;
+			if (extensions->isConcurrentMarkEnabled()) {
+				/* concurrent kickoff already clears the mark map concurrently */
+				markMapReader = "concurrent mark";
+			} else if (extensions->isConcurrentSweepEnabled()) {
+				/* the chunks left unswept by a collection are swept from the mark map while mutators run */
+				markMapReader = "concurrent sweep";
+			}
+#if defined(OMR_GC_OBJECT_MAP)
+			else {
+				/* the mark map of a collection becomes the object map until the next one */
+				markMapReader = "object map";
+			}
+#endif /* OMR_GC_OBJECT_MAP */
+
+			if (NULL != markMapReader) {
+				Trc_MM_ConfigurationStandard_concurrentClearMarkMapDisabled(env->getLanguageVMThread(), markMapReader);
+				extensions->concurrentClearMarkMap = false;
+			} else {
+				/* whatever the mutators leave uncleared is finished by the parallel clearing task */
+				extensions->parallelClearMarkMap = true;
+			}
+		}
+		extensions->payAllocationTax = extensions->isConcurrentMarkEnabled() || extensions->isConcurrentSweepEnabled() || extensions->concurrentClearMarkMap;
 		extensions->setStandardGC(true);
 	}
 
@@ -159,10 +187,13 @@ MM_ConfigurationStandard::createMemoryPool(MM_EnvironmentBase* env, bool appendC
 
 	bool doSplit = 1 < extensions->splitFreeListSplitAmount;
 	bool doHybrid = extensions->enableHybridMemoryPool;
+	/* size class bins replace the split lists, but are not supported together with the large object area */
+	bool doSizeClass = extensions->sizeClassFreeListPool && !extensions->largeObjectArea;
 
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	if (extensions->concurrentSweep) {
 		doSplit = false;
+		doSizeClass = false;
 		/* TODO: enable processLargeAllocateStats in concurrentSweep case, currently can not collect correct FreeEntry Stats in concurrentSweep case*/
 		extensions->processLargeAllocateStats = false;
 		extensions->estimateFragmentation = NO_ESTIMATE_FRAGMENTATION;
@@ -173,6 +204,10 @@ MM_ConfigurationStandard::createMemoryPool(MM_EnvironmentBase* env, bool appendC
 		extensions->largeObjectAllocationProfilingVeryLargeObjectThreshold = OMR_MAX(10*1024*1024, extensions->memoryMax/100);
 	}
 
+	if (doSizeClass) {
+		doSplit = false;
+	}
+
 	/* Create Sweep Pool Manager for Tenure */
 	if (doSplit) {
 		if (doHybrid) {
@@ -195,6 +230,11 @@ MM_ConfigurationStandard::createMemoryPool(MM_EnvironmentBase* env, bool appendC
 		if (!createSweepPoolManagerAddressOrderedList(env)) {
 			return NULL;
 		}
+		if (doSizeClass) {
+			if (!createSweepPoolManagerSizeClassFreeList(env)) {
+				return NULL;
+			}
+		}
 	}
 
 	if (extensions->largeObjectArea) {
@@ -234,7 +274,9 @@ MM_ConfigurationStandard::createMemoryPool(MM_EnvironmentBase* env, bool appendC
 	} else {
 		MM_MemoryPool* memoryPool = NULL;
 
-		if (doSplit) {
+		if (doSizeClass) {
+			memoryPool = MM_MemoryPoolSizeClassFreeList::newInstance(env, minimumFreeEntrySize, "Tenure");
+		} else if (doSplit) {
 			memoryPool = MM_MemoryPoolSplitAddressOrderedList::newInstance(env, minimumFreeEntrySize, extensions->splitFreeListSplitAmount, "Tenure");
 		} else {
 			memoryPool = MM_MemoryPoolAddressOrderedList::newInstance(env, minimumFreeEntrySize, "Tenure");
@@ -330,6 +372,25 @@ MM_ConfigurationStandard::createSweepPoolManagerHybrid(MM_EnvironmentBase* env)
 	return true;
 }
 
+/**
+ * Create Sweep Pool Manager for Memory Pool Size Class Free List
+ */
+bool
+MM_ConfigurationStandard::createSweepPoolManagerSizeClassFreeList(MM_EnvironmentBase* env)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	/* Create Sweep Pool Manager for MPSCFL if it is not created yet */
+	if (NULL == extensions->sweepPoolManagerSmallObjectArea) {
+		extensions->sweepPoolManagerSmallObjectArea = MM_SweepPoolManagerSizeClassFreeList::newInstance(env);
+		if (NULL == extensions->sweepPoolManagerSmallObjectArea) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
 MM_HeapRegionManager*
 MM_ConfigurationStandard::createHeapRegionManager(MM_EnvironmentBase* env)
 {
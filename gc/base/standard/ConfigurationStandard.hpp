@@ -52,6 +52,7 @@ protected:
 	bool createSweepPoolManagerAddressOrderedList(MM_EnvironmentBase* env);
 	bool createSweepPoolManagerSplitAddressOrderedList(MM_EnvironmentBase* env);
 	bool createSweepPoolManagerHybrid(MM_EnvironmentBase* env);
+	bool createSweepPoolManagerSizeClassFreeList(MM_EnvironmentBase* env);
 
 	static const uintptr_t STANDARD_REGION_SIZE_BYTES = 64 * 1024;
 	static const uintptr_t STANDARD_ARRAYLET_LEAF_SIZE_BYTES = UDATA_MAX;
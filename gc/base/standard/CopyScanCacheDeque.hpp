@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(COPYSCANCACHEDEQUE_HPP_)
+#define COPYSCANCACHEDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+class MM_CopyScanCacheStandard;
+class MM_EnvironmentBase;
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+/**
+ * Fixed capacity Chase-Lev work-stealing deque of scan caches.
+ * The owning GC thread pushes and pops at the bottom without synchronization (except when racing
+ * for the last entry), while other GC threads steal from the top with a single compare-and-swap.
+ * The deque does not grow: push() fails once capacity is reached and the caller is expected to
+ * spill the cache to the shared scan list instead.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_CopyScanCacheDeque : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	volatile uintptr_t _top; /**< index of the oldest entry, advanced by thieves and by the owner taking the last entry */
+	volatile uintptr_t _bottom; /**< index of the next free slot, only written by the owner */
+	MM_CopyScanCacheStandard * volatile *_entries; /**< circular buffer of (_mask + 1) entries */
+	uintptr_t _mask; /**< capacity - 1, capacity is a power of 2 */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	/**
+	 * Allocate the backing buffer for the deque.
+	 * @param env[in] the current thread
+	 * @param capacity[in] maximum number of entries, rounded up to a power of 2
+	 * @return true on success
+	 */
+	bool initialize(MM_EnvironmentBase *env, uintptr_t capacity);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Approximate check for entries in the deque. May be called by any thread.
+	 * @return true if the deque appears to be empty
+	 */
+	MMINLINE bool
+	isEmpty()
+	{
+		return ((intptr_t)(_bottom - _top)) <= 0;
+	}
+
+	/**
+	 * Approximate number of entries in the deque. May be called by any thread.
+	 * @return the number of entries the deque appears to hold
+	 */
+	MMINLINE uintptr_t
+	getApproximateEntryCount()
+	{
+		intptr_t count = (intptr_t)(_bottom - _top);
+		return (count > 0) ? (uintptr_t)count : 0;
+	}
+
+	/**
+	 * Add a cache at the bottom of the deque. Must only be called by the owning thread.
+	 * @param cache[in] the cache to add
+	 * @return true if the cache was added, false if the deque is full
+	 */
+	MMINLINE bool
+	push(MM_CopyScanCacheStandard *cache)
+	{
+		uintptr_t bottom = _bottom;
+		if ((intptr_t)(bottom - _top) > (intptr_t)_mask) {
+			return false;
+		}
+		_entries[bottom & _mask] = cache;
+		/* the entry must be visible before thieves can observe the new bottom */
+		MM_AtomicOperations::storeSync();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Remove the most recently pushed cache. Must only be called by the owning thread.
+	 * @return the cache, or NULL if the deque is empty or the last entry was stolen
+	 */
+	MMINLINE MM_CopyScanCacheStandard *
+	pop()
+	{
+		MM_CopyScanCacheStandard *cache = NULL;
+		uintptr_t bottom = _bottom - 1;
+		_bottom = bottom;
+		/* publish the reservation of the bottom entry before reading top */
+		MM_AtomicOperations::sync();
+		uintptr_t top = _top;
+		intptr_t size = (intptr_t)(bottom - top);
+		if (size < 0) {
+			/* deque was empty */
+			_bottom = bottom + 1;
+		} else {
+			cache = _entries[bottom & _mask];
+			if (0 == size) {
+				/* last entry - race against thieves for it */
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					cache = NULL;
+				}
+				_bottom = bottom + 1;
+			}
+		}
+		return cache;
+	}
+
+	/**
+	 * Remove the oldest cache. May be called by any thread.
+	 * @return the cache, or NULL if the deque is empty or another thread won the race for the entry
+	 */
+	MMINLINE MM_CopyScanCacheStandard *
+	steal()
+	{
+		MM_CopyScanCacheStandard *cache = NULL;
+		uintptr_t top = _top;
+		/* top must be read before bottom */
+		MM_AtomicOperations::sync();
+		uintptr_t bottom = _bottom;
+		if ((intptr_t)(bottom - top) > 0) {
+			cache = _entries[top & _mask];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				cache = NULL;
+			}
+		}
+		return cache;
+	}
+
+	/**
+	 * Create a CopyScanCacheDeque object.
+	 */
+	MM_CopyScanCacheDeque()
+		: MM_BaseNonVirtual()
+		, _top(0)
+		, _bottom(0)
+		, _entries(NULL)
+		, _mask(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+#endif /* COPYSCANCACHEDEQUE_HPP_ */
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(PARALLELCLEARMARKMAPTASK_HPP_)
+#define PARALLELCLEARMARKMAPTASK_HPP_
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+
+#include "ParallelTask.hpp"
+
+class MM_Dispatcher;
+class MM_EnvironmentBase;
+class MM_MarkMap;
+
+/**
+ * Clear the chunks of the mark map prepared by MM_MarkMap::prepareClearChunks() ahead of a global mark.
+ * Each thread clears the chunks of its own NUMA node first and then helps with the other nodes.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelClearMarkMapTask : public MM_ParallelTask
+{
+private:
+	MM_MarkMap *_markMap;
+	volatile uintptr_t _bytesCleared; /**< Total number of mark map bytes cleared by all threads */
+
+public:
+	virtual UDATA getVMStateID() { return OMRVMSTATE_GC_CLEAR_MARK_MAP; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the number of mark map bytes cleared by the task
+	 */
+	uintptr_t getBytesCleared() { return _bytesCleared; }
+
+	/**
+	 * Create a ParallelClearMarkMapTask object
+	 */
+	MM_ParallelClearMarkMapTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_MarkMap *markMap) :
+		MM_ParallelTask(env, dispatcher),
+		_markMap(markMap),
+		_bytesCleared(0)
+	{
+		_typeId = __FUNCTION__;
+	};
+};
+
+#endif /* PARALLELCLEARMARKMAPTASK_HPP_ */
@@ -55,6 +55,8 @@
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 #include "OMRVMInterface.hpp"
 #include "ObjectIterator.hpp"
+#include "ObjectStartIndex.hpp"
+#include "ParallelClearMarkMapTask.hpp"
 #if defined(OMR_GC_MODRON_COMPACTION)
 #include "ParallelCompactTask.hpp"
 #endif /* OMR_GC_MODRON_COMPACTION */
@@ -295,6 +297,13 @@ MM_ParallelGlobalGC::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	if (_extensions->enableObjectStartIndex) {
+		_extensions->objectStartIndex = MM_ObjectStartIndex::newInstance(env);
+		if (NULL == _extensions->objectStartIndex) {
+			goto error_no_memory;
+		}
+	}
+
 #if defined(OMR_GC_OBJECT_MAP)
 	_extensions->setObjectMap(MM_ObjectMap::newInstance(env));
 	if(NULL == _extensions->getObjectMap()) {
@@ -367,6 +376,11 @@ MM_ParallelGlobalGC::tearDown(MM_EnvironmentBase *env)
 		_sweepScheme = NULL;
 	}
 
+	if (NULL != _extensions->objectStartIndex) {
+		_extensions->objectStartIndex->kill(env);
+		_extensions->objectStartIndex = NULL;
+	}
+
 #if defined(OMR_GC_MODRON_COMPACTION)
 	if(NULL != _compactScheme) {
 		_compactScheme->kill(env);
@@ -539,7 +553,7 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 	
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	/* Merge sublists in the remembered set (if necessary) */
-	_extensions->rememberedSet.compact(env);
+	_extensions->rememberedSet.compact(env, _extensions->rememberedSetDeduplicate);
 
 	_extensions->oldHeapSizeOnLastGlobalGC = _extensions->heap->getActiveMemorySize(MEMORY_TYPE_OLD);
 	_extensions->freeOldHeapSizeOnLastGlobalGC = _extensions->heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_OLD);
@@ -554,6 +568,15 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 	
 	cleanupAfterGC(env, allocDescription);
 
+	if (_extensions->concurrentClearMarkMap) {
+		/* The configuration guarantees that nothing reads the mark map again before the next global mark, so let the mutators start clearing it.
+		 * If the chunks cannot be prepared the next collection clears the whole map itself.
+		 */
+		MM_MarkMap *markMap = _markingScheme->getMarkMap();
+		markMap->setMarkMapValid(false);
+		markMap->prepareClearChunks(env, _dispatcher->activeThreadCount());
+	}
+
 	if (_extensions->trackMutatorThreadCategory) {
 		/* Done doing GC, reset the category back to the old one */
 		omrthread_set_category(env->getOmrVMThread()->_os_thread, 0, J9THREAD_TYPE_SET_GC);
@@ -908,6 +931,11 @@ MM_ParallelGlobalGC::sweep(MM_EnvironmentBase *env, MM_AllocateDescription *allo
 	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 
+	if (NULL != _extensions->objectStartIndex) {
+		/* a concurrent sweep leaves chunks to be swept (and recorded) after the collection */
+		_extensions->objectStartIndex->setValid(!_extensions->isConcurrentSweepEnabled());
+	}
+
 	sweepStats->_endTime = omrtime_hires_clock();
 	reportSweepEnd(env);
 }
@@ -954,6 +982,10 @@ MM_ParallelGlobalGC::markAll(MM_EnvironmentBase *env, bool initMarkMap)
 		env->_cycleState->_referenceObjectOptions |= MM_CycleState::references_soft_as_weak;
 	}
 
+	if (initMarkMap && _extensions->parallelClearMarkMap) {
+		initMarkMap = !clearMarkMap(env);
+	}
+
 	/* run the mark */
 	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
 	_dispatcher->run(env, &markTask);
@@ -967,10 +999,42 @@ MM_ParallelGlobalGC::markAll(MM_EnvironmentBase *env, bool initMarkMap)
 	reportMarkEnd(env);
 }
 
+bool
+MM_ParallelGlobalGC::clearMarkMap(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_MarkStats *markStats = &_extensions->globalGCStats.markStats;
+	MM_MarkMap *markMap = _markingScheme->getMarkMap();
+	bool cleared = false;
+
+	markStats->_clearMarkMapStartTime = omrtime_hires_clock();
+	markStats->_clearMarkMapConcurrentBytes = _concurrentClearMarkMapBytes;
+	_concurrentClearMarkMapBytes = 0;
+
+	/* chunks are still pending if the mutators were clearing since the last collection, only the rest is left to do */
+	if (markMap->isClearChunksPending() || markMap->prepareClearChunks(env, _dispatcher->activeThreadCount())) {
+		MM_ParallelClearMarkMapTask clearTask(env, _dispatcher, markMap);
+		_dispatcher->run(env, &clearTask);
+		markMap->cancelClearChunks();
+		markStats->_clearMarkMapBytes = clearTask.getBytesCleared();
+		cleared = true;
+	} else {
+		/* whatever the mutators cleared is cleared again by the mark task */
+		markStats->_clearMarkMapConcurrentBytes = 0;
+	}
+
+	markStats->_clearMarkMapEndTime = omrtime_hires_clock();
+
+	return cleared;
+}
+
 void
 MM_ParallelGlobalGC::masterThreadSweepStart(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
 {
 	_sweepScheme->setMarkMap(_markingScheme->getMarkMap());
+	if (NULL != _extensions->objectStartIndex) {
+		_extensions->objectStartIndex->startRecording(env);
+	}
 	_sweepScheme->sweepForMinimumSize(env, env->_cycleState->_activeSubSpace,  allocDescription);
 }
 
@@ -989,6 +1053,10 @@ MM_ParallelGlobalGC::masterThreadCompact(MM_EnvironmentBase *env, MM_AllocateDes
 	MM_MarkMap *markMap = _markingScheme->getMarkMap();
 
 	markMap->setMarkMapValid(false);
+	if (NULL != _extensions->objectStartIndex) {
+		/* objects are moved, the index is recorded again by the next sweep */
+		_extensions->objectStartIndex->setValid(false);
+	}
 	_compactScheme->setMarkMap(markMap);
 
 	reportCompactStart(env);
@@ -1307,6 +1375,13 @@ MM_ParallelGlobalGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *su
 		goto sweepScheme_failed_heapAddRange;
 	}
 
+	if (NULL != _extensions->objectStartIndex) {
+		result = _extensions->objectStartIndex->heapAddRange(env, size, lowAddress, highAddress);
+		if (0 == result) {
+			goto objectStartIndex_failed_heapAddRange;
+		}
+	}
+
 #if defined(OMR_GC_OBJECT_MAP)
 	result = _extensions->getObjectMap()->heapAddRange(env, subspace, size, lowAddress, highAddress);
 	if (0 == result) {
@@ -1326,6 +1401,10 @@ parallelGlobalGC_failed_heapAddRange:
 	_extensions->getObjectMap()->heapRemoveRange(env, subspace, size, lowAddress, highAddress, NULL, NULL);
 objectMap_failed_heapAddRange:
 #endif /* defined(OMR_GC_OBJECT_MAP) */
+	if (NULL != _extensions->objectStartIndex) {
+		_extensions->objectStartIndex->heapRemoveRange(env, size, lowAddress, highAddress, NULL, NULL);
+	}
+objectStartIndex_failed_heapAddRange:
 	_sweepScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, NULL, NULL);
 sweepScheme_failed_heapAddRange:
 	_markingScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, NULL, NULL);
@@ -1342,6 +1421,9 @@ MM_ParallelGlobalGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace
 {
 	bool result = _markingScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 	result = result && _sweepScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+	if (NULL != _extensions->objectStartIndex) {
+		result = result && _extensions->objectStartIndex->heapRemoveRange(env, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+	}
 
 	result = result && _delegate.heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 
@@ -1453,7 +1535,11 @@ globalGCHookAFCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventDa
 		extensions->heap->getResizeStats()->resetRatioTicks();
 	} else {
 #endif /* OMR_GC_MODRON_COMPACTION */
-		extensions->heap->getResizeStats()->updateHeapResizeStats();
+		if (extensions->predictiveHeapSizing) {
+			extensions->heap->getResizeStats()->updateHeapResizeStats(extensions->predictiveHeapSizingWeight);
+		} else {
+			extensions->heap->getResizeStats()->updateHeapResizeStats();
+		}
 #if defined(OMR_GC_MODRON_COMPACTION)
 	}
 #endif /* OMR_GC_MODRON_COMPACTION */
@@ -1496,7 +1582,11 @@ globalGCHookCCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, v
 		extensions->heap->getResizeStats()->resetRatioTicks();
 	} else {
 #endif /* OMR_GC_MODRON_COMPACTION */
-		extensions->heap->getResizeStats()->updateHeapResizeStats();
+		if (extensions->predictiveHeapSizing) {
+			extensions->heap->getResizeStats()->updateHeapResizeStats(extensions->predictiveHeapSizingWeight);
+		} else {
+			extensions->heap->getResizeStats()->updateHeapResizeStats();
+		}
 #if defined(OMR_GC_MODRON_COMPACTION)
 	}
 #endif /* OMR_GC_MODRON_COMPACTION */
@@ -1526,6 +1616,20 @@ MM_ParallelGlobalGC::deleteSweepPoolState(MM_EnvironmentBase *env, void *sweepPo
 	_sweepScheme->deleteSweepPoolState(env, sweepPoolState);
 }
 
+void
+MM_ParallelGlobalGC::payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription)
+{
+	if (_extensions->concurrentClearMarkMap) {
+		MM_MarkMap *markMap = _markingScheme->getMarkMap();
+		if (markMap->isClearChunksPending()) {
+			uintptr_t bytesCleared = markMap->clearChunks(env, 1);
+			if (0 != bytesCleared) {
+				MM_AtomicOperations::add(&_concurrentClearMarkMapBytes, bytesCleared);
+			}
+		}
+	}
+}
+
 bool
 MM_ParallelGlobalGC::isMarked(void *objectPtr)
 {
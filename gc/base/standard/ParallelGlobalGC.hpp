@@ -80,6 +80,7 @@ protected:
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the master cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
 	bool _fixHeapForWalkCompleted;
+	volatile uintptr_t _concurrentClearMarkMapBytes; /**< Mark map bytes cleared by mutators since the last global collection (see GCExtensionsBase::concurrentClearMarkMap) */
 public:
 	
 /*
@@ -151,6 +152,13 @@ private:
 	 *	@param initMarkMap instruct should mark map be initialized (might be already partially done like in conrurrentGC) 
 	 */
 	void markAll(MM_EnvironmentBase *env, bool initMarkMap);
+
+	/**
+	 * Clear the mark map ahead of a mark with MM_ParallelClearMarkMapTask, finishing any clearing started by
+	 * the mutators since the previous collection.
+	 * @return true if the mark map was cleared, false if the mark task must initialize it
+	 */
+	bool clearMarkMap(MM_EnvironmentBase *env);
 	
 	/**
 	 *	Main call for Sweep operation
@@ -308,6 +316,11 @@ public:
 
 	virtual bool isMarked(void *objectPtr);
 
+	/**
+	 * Clear a chunk of the mark map on behalf of the next global collection, when concurrentClearMarkMap is enabled.
+	 */
+	virtual void payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription);
+
 	/**
 	 * Return reference to Marking Scheme
 	 */
@@ -340,6 +353,7 @@ public:
 		, _cycleState()
 		, _collectionStatistics()
 		, _fixHeapForWalkCompleted(false)
+		, _concurrentClearMarkMapBytes(0)
 	{
 		_typeId = __FUNCTION__;
 	}
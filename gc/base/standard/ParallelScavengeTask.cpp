@@ -45,6 +45,12 @@ MM_ParallelScavengeTask::masterSetup(MM_EnvironmentBase *env)
 	_collector->setAliasThreshold(calculatedAliasThreshold);
 }
 
+uintptr_t
+MM_ParallelScavengeTask::getEstimatedWork(MM_EnvironmentBase *env)
+{
+	return _collector->estimateScavengeWork(env);
+}
+
 void
 MM_ParallelScavengeTask::setup(MM_EnvironmentBase *env)
 {
@@ -39,6 +39,7 @@
 #include "MemoryPoolAddressOrderedList.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
+#include "ObjectStartIndex.hpp"
 #include "ParallelSweepChunk.hpp"
 #include "ParallelSweepScheme.hpp"
 #include "ParallelTask.hpp"
@@ -47,6 +48,7 @@
 #include "SweepPoolState.hpp"
 #include "MarkMap.hpp"
 #include "ModronAssertions.h"
+#include "HeapMapScanner.hpp"
 #include "HeapMapWordIterator.hpp"
 #include "ObjectModel.hpp"
 #include "Math.hpp"
@@ -341,14 +343,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = MM_HeapMapScanner::skipEmptyWords(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -639,6 +634,11 @@ MM_ParallelSweepScheme::sweepAllChunks(MM_EnvironmentBase *env, uintptr_t totalC
         	/* Sweep the chunk */
 			sweepChunk(env, chunk);
 
+			/* objects in the nursery move on every scavenge, only record tenure chunks */
+			if ((NULL != _extensions->objectStartIndex) && (MEMORY_TYPE_NEW != (chunk->memoryPool->getSubSpace()->getTypeFlags() & MEMORY_TYPE_NEW))) {
+				env->_sweepStats._objectStartsRecorded += _extensions->objectStartIndex->recordRange(env, _currentMarkMap, chunk->chunkBase, chunk->chunkTop);
+			}
+
 			prevChunk = chunk;
 		}	
 	}
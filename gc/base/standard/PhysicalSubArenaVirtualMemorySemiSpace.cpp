@@ -1229,6 +1229,9 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::expandNoCheck(MM_EnvironmentBase *env
 		if(debug) {
 			omrtty_printf("\tCommit (%p %p)\n", newLowAddress, ((uintptr_t)newLowAddress) + splitExpandSize);
 		}
+		if(_numaStriped && !setNumaStripeAffinity(env, newLowAddress, _lowAddress)) {
+			return 0;
+		}
 		if(!_heap->commitMemory(newLowAddress, splitExpandSize)) {
 			/* Memory couldn't be commited (for whatever reason) - can't expand */
 			return 0;
@@ -1299,6 +1302,9 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::expandNoCheck(MM_EnvironmentBase *env
 		if(debug) {
 			omrtty_printf("\tCommit (%p %p)\n", newLowAddress, ((uintptr_t)newLowAddress)+splitExpandSize);
 		}
+		if(_numaStriped && !setNumaStripeAffinity(env, newLowAddress, _lowAddress)) {
+			return 0;
+		}
 		if(!_heap->commitMemory(newLowAddress, splitExpandSize)) {
 			/* Memory couldn't be commited (for whatever reason) - can't expand */
 			return 0;
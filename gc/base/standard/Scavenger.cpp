@@ -30,6 +30,7 @@
 #endif
 
 #include <math.h>
+#include <new>
 
 #include "omrcfg.h"
 #include "omrcomp.h"
@@ -105,17 +106,6 @@
 #define FLIP_TENURE_LARGE_SCAN 4
 #define FLIP_TENURE_LARGE_SCAN_DEFERRED 5
 
-/* VM Design 1774: Ideally we would pull these cache line values from the port library but this will suffice for
- * a quick implementation
- */
-#if defined(AIXPPC) || defined(LINUXPPC)
-#define CACHE_LINE_SIZE 128
-#elif defined(J9ZOS390) || (defined(LINUX) && defined(S390))
-#define CACHE_LINE_SIZE 256
-#else
-#define CACHE_LINE_SIZE 64
-#endif
-
 /* create macros to interpret the hot field descriptor */
 #define HOTFIELD_SHOULD_ALIGN(descriptor) (0x1 == (0x1 & (descriptor)))
 #define HOTFIELD_ALIGNMENT_BIAS(descriptor, heapObjectAlignment) (((descriptor) >> 1) * (heapObjectAlignment))
@@ -229,6 +219,25 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	/* Per-thread work-stealing deques are only used by the stop-the-world scavenger; with Concurrent Scavenger
+	 * mutator threads also produce scan work, so they keep using the shared scan list. */
+	if (_extensions->scavengerWorkStealing && !_extensions->isConcurrentScavengerEnabled()) {
+		uintptr_t dequeCount = _dispatcher->threadCountMaximum();
+		_scanCacheDeques = (MM_CopyScanCacheDeque *)env->getForge()->allocate(sizeof(MM_CopyScanCacheDeque) * dequeCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _scanCacheDeques) {
+			return false;
+		}
+		for (uintptr_t i = 0; i < dequeCount; i++) {
+			new (&_scanCacheDeques[i]) MM_CopyScanCacheDeque();
+		}
+		_scanCacheDequeCount = dequeCount;
+		for (uintptr_t i = 0; i < dequeCount; i++) {
+			if (!_scanCacheDeques[i].initialize(env, _extensions->scavengerWorkStealingDequeSize)) {
+				return false;
+			}
+		}
+	}
+
 	if (omrthread_monitor_init_with_name(&_scanCacheMonitor, 0, "MM_Scavenger::scanCacheMonitor")) {
 		return false;
 	}
@@ -278,7 +287,21 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
-	_cacheLineAlignment = CACHE_LINE_SIZE;
+	_cacheLineAlignment = OMR_GC_CACHE_LINE_SIZE;
+
+	/* Mutator threads copy objects during a Concurrent Scavenger cycle and must not be made to copy hot field referents too */
+	_hotFieldCopy = _extensions->scavengerHotFieldCopy && !_extensions->isConcurrentScavengerEnabled();
+
+	/* Slot ranges cannot remove slots while they are scanned, which the concurrent phases of Concurrent Scavenger rely on */
+	_rememberedSetRanges = _extensions->scavengerRememberedSetRanges && (0 < _extensions->scavengerRememberedSetRangeSize) && !_extensions->isConcurrentScavengerEnabled();
+
+	/* Mutators of Concurrent Scavenger find forwarding pointers in object headers, and heaps too large to be encoded in 32 bit entries keep them there too */
+	if (_extensions->scavengerForwardingTable && !_extensions->isConcurrentScavengerEnabled() && MM_ScavengerForwardingTable::canEncodeHeap(env)) {
+		_forwardingTable = MM_ScavengerForwardingTable::newInstance(env);
+		if (NULL == _forwardingTable) {
+			return false;
+		}
+	}
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	if (_extensions->concurrentScavenger) {
@@ -303,6 +326,20 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
+	if (NULL != _scanCacheDeques) {
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			_scanCacheDeques[i].tearDown(env);
+		}
+		env->getForge()->free(_scanCacheDeques);
+		_scanCacheDeques = NULL;
+		_scanCacheDequeCount = 0;
+	}
+
+	if (NULL != _forwardingTable) {
+		_forwardingTable->kill(env);
+		_forwardingTable = NULL;
+	}
+
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
 		_scanCacheMonitor = NULL;
@@ -374,6 +411,7 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard *env)
 	/* Reinitialize the copy scan caches */
 	Assert_MM_true(_scavengeCacheFreeList.areAllCachesReturned());
 	Assert_MM_true(0 == _cachedEntryCount);
+	Assert_MM_true(areScanCacheDequesEmpty());
 	_extensions->copyScanRatio.reset(env, true);
 
 	/* Cache heap ranges for fast "valid object" checks (this can change in an expanding heap situation, so we refetch every cycle) */
@@ -436,9 +474,18 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard *env)
 	_activeSubSpace->cacheRanges(_evacuateMemorySubSpace, &_evacuateSpaceBase, &_evacuateSpaceTop);
 	_activeSubSpace->cacheRanges(_survivorMemorySubSpace, &_survivorSpaceBase, &_survivorSpaceTop);
 
+	/* If the table can not be committed for this evacuate range, forwarding pointers go in object headers for this scavenge */
+	_activeForwardingTable = NULL;
+	if ((NULL != _forwardingTable) && _forwardingTable->startCycle(env, _evacuateSpaceBase, _evacuateSpaceTop)) {
+		_activeForwardingTable = _forwardingTable;
+	}
+
 	/* assume that value of RS Overflow flag will not be changed until scavengeRememberedSet() call, so handle it first */
 	_isRememberedSetInOverflowAtTheBeginning = isRememberedSetInOverflowState();
 	_extensions->rememberedSet.startProcessingSublist();
+	if (_rememberedSetRanges && !_isRememberedSetInOverflowAtTheBeginning) {
+		_extensions->rememberedSet.startProcessingSlotRanges(_extensions->scavengerRememberedSetRangeSize);
+	}
 }
 
 void
@@ -484,6 +531,20 @@ MM_Scavenger::scavenge(MM_EnvironmentBase *envBase)
 
 	Assert_MM_true(_scavengeCacheFreeList.areAllCachesReturned());
 	Assert_MM_true(0 == _cachedEntryCount);
+	Assert_MM_true(areScanCacheDequesEmpty());
+}
+
+uintptr_t
+MM_Scavenger::estimateScavengeWork(MM_EnvironmentBase *env)
+{
+	uintptr_t estimate = 0;
+
+	if ((0 != _previousSurvivedObjects) && !isRememberedSetInOverflowState()) {
+		uintptr_t averageObjectSize = _previousSurvivedBytes / _previousSurvivedObjects;
+		estimate = _previousSurvivedBytes + (_extensions->rememberedSet.countElements() * averageObjectSize);
+	}
+
+	return estimate;
 }
 
 void
@@ -512,6 +573,13 @@ MM_Scavenger::reportScavengeEnd(MM_EnvironmentStandard *env, bool lastIncrement)
 		_extensions->scavengerStats._tiltRatio = calculateTiltRatio();
 
 		Trc_MM_Tiltratio(env->getLanguageVMThread(), _extensions->scavengerStats._tiltRatio);
+
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		if (IS_CONCURRENT_ENABLED && _extensions->concurrentScavengerPacing && scavengeSuccessful) {
+			/* update before the end of the cycle is reported, so that verbose picks up the predictions */
+			updateConcurrentPacing(env);
+		}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	}
 
 	TRIGGER_J9HOOK_MM_PRIVATE_SCAVENGE_END(
@@ -680,6 +748,9 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_acquireFreeListCount += scavStats->_acquireFreeListCount;
 	finalGCStats->_releaseFreeListCount += scavStats->_releaseFreeListCount;
 	finalGCStats->_acquireScanListCount += scavStats->_acquireScanListCount;
+	finalGCStats->_dequeScanCacheCount += scavStats->_dequeScanCacheCount;
+	finalGCStats->_spillScanCacheCount += scavStats->_spillScanCacheCount;
+	finalGCStats->_stealScanCacheCount += scavStats->_stealScanCacheCount;
 	finalGCStats->_releaseScanListCount += scavStats->_releaseScanListCount;
 	finalGCStats->_acquireListLockCount += scavStats->_acquireListLockCount;
 	finalGCStats->_aliasToCopyCacheCount += scavStats->_aliasToCopyCacheCount;
@@ -688,6 +759,8 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_totalDeepStructures += scavStats->_totalDeepStructures;
 	finalGCStats->_totalObjsDeepScanned += scavStats->_totalObjsDeepScanned;
 	finalGCStats->_depthDeepestStructure = scavStats->_depthDeepestStructure;
+	finalGCStats->_hotFieldCopyCount += scavStats->_hotFieldCopyCount;
+	finalGCStats->_hotFieldCacheMissCount += scavStats->_hotFieldCacheMissCount;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	finalGCStats->_flipDiscardBytes += scavStats->_flipDiscardBytes;
@@ -914,7 +987,7 @@ MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env)
 		cacheSize = OMR_MIN(cacheSizeBasedOnWaitingCount, cacheSize);
 	}
 
-	env->approxScanCacheCount = _scavengeCacheScanList.getApproximateEntryCount();
+	env->approxScanCacheCount = getApproximateScanCacheCount();
 	if (env->approxScanCacheCount < threadCount) {
 		uintptr_t cacheSizeBasedOnScanCacheCount = calculateCopyScanCacheSizeForQueueLength(maxCacheSize, threadCount, env->approxScanCacheCount);
 		cacheSize = OMR_MIN(cacheSizeBasedOnScanCacheCount, cacheSize);
@@ -1176,7 +1249,7 @@ MM_Scavenger::copyAndForward(MM_EnvironmentStandard *env, volatile omrobjectptr_
 		if (isObjectInEvacuateMemory(objectPtr)) {
 			/* Object needs to be copy and forwarded.  Check if the work has already been done */
 			MM_ForwardedHeader forwardHeader(objectPtr);
-			omrobjectptr_t forwardPtr = forwardHeader.getForwardedObject();
+			omrobjectptr_t forwardPtr = getForwardedObject(&forwardHeader);
 
 			if (NULL != forwardPtr) {
 				/* Object has been copied - update the forwarding information and return */
@@ -1445,7 +1518,7 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 	} else
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	{
-		destinationObjectPtr = forwardedHeader->setForwardedObject(destinationObjectPtr);
+		destinationObjectPtr = setForwardedObject(forwardedHeader, destinationObjectPtr);
 	}
 
 	if (originalDestinationObjectPtr == destinationObjectPtr) {
@@ -1543,6 +1616,12 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 			scavStats->_flipBytes += objectCopySizeInBytes;
 			scavStats->getFlipHistory(0)->_flipBytes[oldObjectAge + 1] += objectReserveSizeInBytes;
 		}
+
+		if (_hotFieldCopy && (env->_hotFieldCopyDepth < _extensions->scavengerHotFieldCopyDepth)
+			&& ((copyCache == env->_survivorCopyScanCache) || (copyCache == env->_tenureCopyScanCache))
+		) {
+			copyHotFields(env, destinationObjectPtr, copyCache);
+		}
 	} else {
 		/* We have not used the reserved space now, but we will for subsequent allocations. If this space was reserved for an individual object,
 		 * we might have created a TLH remainder from previous cache just before reserving this space. This space eventaully can create another remainder.
@@ -1648,7 +1727,7 @@ MM_Scavenger::updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanne
 	env->_scavengerStats._slotsCopied += slotsCopied;
 	uint64_t updateResult = _extensions->copyScanRatio.update(env, &(env->_scavengerStats._slotsScanned), &(env->_scavengerStats._slotsCopied), _waitingCount);
 	if (0 != updateResult) {
-		_extensions->copyScanRatio.majorUpdate(env, updateResult, _cachedEntryCount, _scavengeCacheScanList.getApproximateEntryCount());
+		_extensions->copyScanRatio.majorUpdate(env, updateResult, _cachedEntryCount, getApproximateScanCacheCount());
 	}
 }
 
@@ -1708,6 +1787,10 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	}
 	updateCopyScanCounts(env, slotsScanned, slotsCopied);
 
+	if (_hotFieldCopy && (NULL != scanCache) && !objectScanner->isIndexableObject()) {
+		countHotFieldCacheMisses(env, objectPtr);
+	}
+
 	if (shouldRemember && (NULL != rememberedSetSlot)) {
 		Assert_MM_true(!isObjectInNewSpace(objectPtr));
 		Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
@@ -1773,6 +1856,56 @@ MM_Scavenger::deepScanOutline(MM_EnvironmentStandard *env, omrobjectptr_t object
 	}
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 }
+
+void
+MM_Scavenger::copyHotFields(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, MM_CopyScanCacheStandard *copyCache)
+{
+	uintptr_t hotFieldCount = 0;
+	const uintptr_t *hotFieldOffsets = _delegate.getHotFieldOffsets(env, objectPtr, &hotFieldCount);
+	if (0 == hotFieldCount) {
+		return;
+	}
+
+	bool tenured = (0 != (copyCache->flags & OMR_SCAVENGER_CACHE_TYPE_TENURESPACE));
+	env->_hotFieldCopyDepth += 1;
+	for (uintptr_t i = 0; i < hotFieldCount; i++) {
+		GC_SlotObject hotSlot(env->getOmrVM(), (fomrobject_t *)((uintptr_t)objectPtr + hotFieldOffsets[i]));
+		copyAndForward(env, &hotSlot);
+		if (NULL != env->_effectiveCopyScanCache) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_scavengerStats._hotFieldCopyCount += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		}
+	}
+	env->_hotFieldCopyDepth -= 1;
+
+	/* Callers look at the effective copy cache to decide whether to alias it. The hot field copies may have retired the cache the
+	 * object was copied into (it may even be getting scanned by another thread by now), so only report a cache the thread still owns.
+	 */
+	if ((copyCache != env->_survivorCopyScanCache) && (copyCache != env->_tenureCopyScanCache)) {
+		copyCache = tenured ? env->_tenureCopyScanCache : env->_survivorCopyScanCache;
+	}
+	env->_effectiveCopyScanCache = copyCache;
+}
+
+void
+MM_Scavenger::countHotFieldCacheMisses(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	uintptr_t hotFieldCount = 0;
+	const uintptr_t *hotFieldOffsets = _delegate.getHotFieldOffsets(env, objectPtr, &hotFieldCount);
+	uintptr_t objectEnd = (uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+	for (uintptr_t i = 0; i < hotFieldCount; i++) {
+		GC_SlotObject hotSlot(env->getOmrVM(), (fomrobject_t *)((uintptr_t)objectPtr + hotFieldOffsets[i]));
+		uintptr_t referent = (uintptr_t)hotSlot.readReferenceFromSlot();
+		/* referents below the object wrap around to large distances */
+		if ((0 != referent) && ((referent - objectEnd) >= _cacheLineAlignment)) {
+			env->_scavengerStats._hotFieldCacheMissCount += 1;
+		}
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+}
+
 /**
  * Scans the slots of a non-indexable object, remembering objects as required. Scanning is interrupted
  * as soon as there is a copy cache that is preferred to the current scan cache. This is returned
@@ -1853,6 +1986,10 @@ MM_Scavenger::incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobj
 	}
 	updateCopyScanCounts(env, slotsScanned, slotsCopied);
 
+	if (_hotFieldCopy && !objectScanner->isIndexableObject()) {
+		countHotFieldCacheMisses(env, objectPtr);
+	}
+
 	scanCache->_hasPartiallyScannedObject = false;
 	if (scanCache->_shouldBeRemembered) {
 		if (NULL != scanCache->_arraySplitRememberedSlot) {
@@ -1947,12 +2084,12 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 #endif /* OMR_SCAVENGER_TRACE || J9MODRON_TGC_PARALLEL_STATISTICS */
 
  	while (!doneFlag && !shouldAbortScanLoop(env)) {
- 		while (_cachedEntryCount > 0) {
+ 		while (isScanCacheWorkAvailable()) {
  			cache = getNextScanCacheFromList(env);
 
 			if (NULL != cache) {
  				/* Check if there are threads waiting that should be notified because of pending entries */
- 				if((_cachedEntryCount > 0) && _waitingCount) {
+ 				if(isScanCacheWorkAvailable() && _waitingCount) {
 					if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
 						if(0 != _waitingCount) {
 							omrthread_monitor_notify(_scanCacheMonitor);
@@ -1973,14 +2110,14 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 		_waitingCount += 1;
 
 		if(doneIndex == _doneIndex) {
-			if((env->_currentTask->getThreadCount() == _waitingCount) && (0 == _cachedEntryCount)) {
+			if((env->_currentTask->getThreadCount() == _waitingCount) && !isScanCacheWorkAvailable()) {
 				_waitingCount = 0;
 				_doneIndex += 1;
 				flushBuffersForGetNextScanCache(env);
 				_extensions->copyScanRatio.reset(env, false);
 				omrthread_monitor_notify_all(_scanCacheMonitor);
 			} else {
-				while((0 == _cachedEntryCount) && (doneIndex == _doneIndex) && !shouldAbortScanLoop(env)) {
+				while(!isScanCacheWorkAvailable() && (doneIndex == _doneIndex) && !shouldAbortScanLoop(env)) {
 					flushBuffersForGetNextScanCache(env);
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 					uint64_t waitEndTime, waitStartTime;
@@ -2720,11 +2857,40 @@ MM_Scavenger::scavengeRememberedSetListIndirect(MM_EnvironmentStandard *env)
 
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
+MMINLINE void
+MM_Scavenger::scavengeRememberedSetSlot(MM_EnvironmentStandard *env, omrobjectptr_t *slotPtr)
+{
+	omrobjectptr_t objectPtr = *slotPtr;
+	Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
+
+	/* First assume the object will not be remembered.
+	 * This is helpful for work completion ordering of split arrays.
+	 * Flag slot for later removal if we complete scavenge OK
+	 */
+	*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr | DEFERRED_RS_REMOVE_FLAG);
+	bool shouldBeRemembered = scavengeObjectSlots(env, NULL, objectPtr, GC_ObjectScanner::scanRoots, slotPtr);
+	if (_extensions->objectModel.hasIndirectObjectReferents((CLI_THREAD_TYPE*)env->getLanguageVMThread(), objectPtr)) {
+		shouldBeRemembered |= _delegate.scavengeIndirectObjectSlots(env, objectPtr);
+	}
+
+	shouldBeRemembered |= isRememberedThreadReference(env, objectPtr);
+
+	if (shouldBeRemembered) {
+		/* We want to remember this object after all; clear the flag for removal. */
+		*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
+	}
+}
+
 void
 MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 {
 	Assert_MM_false(IS_CONCURRENT_ENABLED);
 
+	if (_rememberedSetRanges) {
+		scavengeRememberedSetSlotRanges(env);
+		return;
+	}
+
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Entry(env->getLanguageVMThread());
 
 	/* Remembered set walk */
@@ -2735,28 +2901,9 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 		GC_SublistSlotIterator remSetSlotIterator(puddle);
 		omrobjectptr_t *slotPtr;
 		while((slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot()) != NULL) {
-			omrobjectptr_t objectPtr = *slotPtr;
-
-			if(NULL != objectPtr) {
-				Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
+			if(NULL != *slotPtr) {
 				numElements += 1;
-
-				/* First assume the object will not be remembered.
-				 * This is helpful for work completion ordering of split arrays.
-				 * Flag slot for later removal if we complete scavenge OK
-				 */
-				*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr | DEFERRED_RS_REMOVE_FLAG);
-				bool shouldBeRemembered = scavengeObjectSlots(env, NULL, objectPtr, GC_ObjectScanner::scanRoots, slotPtr);
-				if (_extensions->objectModel.hasIndirectObjectReferents((CLI_THREAD_TYPE*)env->getLanguageVMThread(), objectPtr)) {
-					shouldBeRemembered |= _delegate.scavengeIndirectObjectSlots(env, objectPtr);
-				}
-
-				shouldBeRemembered |= isRememberedThreadReference(env, objectPtr);
-
-				if (shouldBeRemembered) {
-					/* We want to remember this object after all; clear the flag for removal. */
-					*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
-				}
+				scavengeRememberedSetSlot(env, slotPtr);
 			} else {
 				remSetSlotIterator.removeSlot();
 			}
@@ -2768,6 +2915,49 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Exit(env->getLanguageVMThread());
 }
 
+/**
+ * Scan the remembered set in fixed size slot ranges, claimed atomically across all puddles, so that
+ * a single large puddle (filled by one heavily writing thread) is shared by all GC threads.
+ * Slots are never removed here since neighbouring ranges of the same puddle may be scanned concurrently;
+ * NULL slots are left for pruneRememberedSetList().
+ */
+void
+MM_Scavenger::scavengeRememberedSetSlotRanges(MM_EnvironmentStandard *env)
+{
+	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Entry(env->getLanguageVMThread());
+
+	MM_SublistPool *rememberedSet = &_extensions->rememberedSet;
+	MM_SublistPuddle *puddle = NULL;
+	MM_SublistPuddle *tracedPuddle = NULL;
+	uintptr_t puddleFirstRange = 0;
+	uintptr_t numElements = 0;
+	uintptr_t *rangeTop = NULL;
+	uintptr_t *rangeBase = NULL;
+	while (NULL != (rangeBase = rememberedSet->popPreviousSlotRange(&puddle, &puddleFirstRange, &rangeTop))) {
+		/* trace the part of each puddle scanned by this thread, as a puddle at a time scan does for whole puddles */
+		if (puddle != tracedPuddle) {
+			if (NULL != tracedPuddle) {
+				Trc_MM_ParallelScavenger_scavengeRememberedSetList_donePuddle(env->getLanguageVMThread(), tracedPuddle, numElements);
+			}
+			tracedPuddle = puddle;
+			numElements = 0;
+			Trc_MM_ParallelScavenger_scavengeRememberedSetList_startPuddle(env->getLanguageVMThread(), tracedPuddle);
+		}
+		for (omrobjectptr_t *slotPtr = (omrobjectptr_t *)rangeBase; slotPtr < (omrobjectptr_t *)rangeTop; slotPtr++) {
+			if (NULL != *slotPtr) {
+				numElements += 1;
+				scavengeRememberedSetSlot(env, slotPtr);
+			}
+		}
+		rememberedSet->completePreviousSlotRange();
+	}
+	if (NULL != tracedPuddle) {
+		Trc_MM_ParallelScavenger_scavengeRememberedSetList_donePuddle(env->getLanguageVMThread(), tracedPuddle, numElements);
+	}
+
+	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Exit(env->getLanguageVMThread());
+}
+
 /* NOTE - only  scavengeRememberedSetOverflow ends with a sync point.
  * Callers of this function must not assume that there is a sync point
  */
@@ -2836,8 +3026,7 @@ MM_Scavenger::rescanThreadSlot(MM_EnvironmentStandard *env, omrobjectptr_t *obje
 			/* the slot is still pointing at evacuate memory. This means that it must have been left unforwarded
 			 * in the first pass so that we would process it here.
 			 */
-			MM_ForwardedHeader forwardedHeader(objectPtr);
-			omrobjectptr_t tenuredObjectPtr = forwardedHeader.getForwardedObject();
+			omrobjectptr_t tenuredObjectPtr = getForwardedObject(objectPtr);
 
 			Trc_MM_ParallelScavenger_rescanThreadSlot_rememberedObject(env->getLanguageVMThread(), tenuredObjectPtr);
 
@@ -3200,7 +3389,20 @@ MM_Scavenger::addCopyCachesToFreeList(MM_EnvironmentStandard *env)
 MMINLINE void
 MM_Scavenger::addCacheEntryToScanListAndNotify(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *newCacheEntry)
 {
-	_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	uintptr_t slaveID = env->getSlaveID();
+	if (slaveID >= _scanCacheDequeCount) {
+		_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	} else if (_scanCacheDeques[slaveID].push(newCacheEntry)) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_scavengerStats._dequeScanCacheCount += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	} else {
+		/* the deque is full - spill to the shared scan list */
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_scavengerStats._spillScanCacheCount += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	}
 	if (0 != _waitingCount) {
 		/* Added an entry to the list - notify any other threads that a new entry has appeared on the list */
 		if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
@@ -3279,7 +3481,72 @@ MM_Scavenger::aliasToCopyCache(MM_EnvironmentStandard *env, GC_SlotObject *scann
 MMINLINE MM_CopyScanCacheStandard *
 MM_Scavenger::getNextScanCacheFromList(MM_EnvironmentStandard *env)
 {
-	return _scavengeCacheScanList.popCache(env);
+	MM_CopyScanCacheStandard *cache = NULL;
+	uintptr_t slaveID = env->getSlaveID();
+
+	if (slaveID < _scanCacheDequeCount) {
+		/* own work first, then spilled work, and steal only when both are exhausted */
+		cache = _scanCacheDeques[slaveID].pop();
+		if ((NULL == cache) && (0 < _cachedEntryCount)) {
+			cache = _scavengeCacheScanList.popCache(env);
+		}
+		if (NULL == cache) {
+			cache = stealScanCache(env);
+		}
+	} else {
+		cache = _scavengeCacheScanList.popCache(env);
+	}
+
+	return cache;
+}
+
+MMINLINE bool
+MM_Scavenger::isScanCacheWorkAvailable()
+{
+	return (0 < _cachedEntryCount) || !areScanCacheDequesEmpty();
+}
+
+MM_CopyScanCacheStandard *
+MM_Scavenger::stealScanCache(MM_EnvironmentStandard *env)
+{
+	MM_CopyScanCacheStandard *cache = NULL;
+	uintptr_t slaveID = env->getSlaveID();
+
+	for (uintptr_t i = 1; (NULL == cache) && (i < _scanCacheDequeCount); i++) {
+		MM_CopyScanCacheDeque *victim = &_scanCacheDeques[(slaveID + i) % _scanCacheDequeCount];
+		if (!victim->isEmpty()) {
+			cache = victim->steal();
+		}
+	}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	if (NULL != cache) {
+		env->_scavengerStats._stealScanCacheCount += 1;
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	return cache;
+}
+
+bool
+MM_Scavenger::areScanCacheDequesEmpty()
+{
+	for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+		if (!_scanCacheDeques[i].isEmpty()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uintptr_t
+MM_Scavenger::getApproximateScanCacheCount()
+{
+	uintptr_t count = _scavengeCacheScanList.getApproximateEntryCount();
+	for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+		count += _scanCacheDeques[i].getApproximateEntryCount();
+	}
+	return count;
 }
 
 /**
@@ -3431,53 +3698,94 @@ MM_Scavenger::backOutObjectScan(MM_EnvironmentStandard *env, omrobjectptr_t obje
 	}
 }
 
+void
+MM_Scavenger::reverseForwardPointersInForwardingTable(MM_EnvironmentStandard *env)
+{
+	uintptr_t cursor = 0;
+	omrobjectptr_t originalObject = NULL;
+	omrobjectptr_t forwardedObject = NULL;
+
+#if defined(OMR_SCAVENGER_TRACE_BACKOUT)
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+#endif /* OMR_SCAVENGER_TRACE_BACKOUT */
+	while (NULL != (originalObject = _activeForwardingTable->nextForwardedObject(&cursor, &forwardedObject))) {
+		/* Back out is single threaded, so the forwarding pointer can be installed in the original header for the delegate to
+		 * reverse exactly as when forwarding pointers are kept in headers (it restores the header and the overlapped slot from
+		 * the copy, which the destroyed slot fixup of backoutFixupAndReverseForwardPointersInSurvivor() then relies on).
+		 */
+		MM_ForwardedHeader originalHeader(originalObject);
+		originalHeader.setForwardedObject(forwardedObject);
+		MM_ForwardedHeader header(originalObject);
+		_delegate.reverseForwardedObject(env, &header);
+
+		/* Same reverse forwarded object as for forwarding pointers in headers */
+		uintptr_t evacuateObjectSizeInBytes = _extensions->objectModel.getConsumedSizeInBytesWithHeader(forwardedObject);
+		MM_HeapLinkedFreeHeader* freeHeader = MM_HeapLinkedFreeHeader::getHeapLinkedFreeHeader(forwardedObject);
+#if defined(OMR_VALGRIND_MEMCHECK)
+		valgrindMempoolAlloc(_extensions,(uintptr_t) originalObject, (uintptr_t) evacuateObjectSizeInBytes);
+		valgrindFreeObject(_extensions, (uintptr_t) forwardedObject);
+		valgrindMakeMemUndefined((uintptr_t)freeHeader, (uintptr_t) sizeof(MM_HeapLinkedFreeHeader));
+#endif /* defined(OMR_VALGRIND_MEMCHECK) */
+		freeHeader->setNext((MM_HeapLinkedFreeHeader*)originalObject);
+		freeHeader->setSize(evacuateObjectSizeInBytes);
+#if defined(OMR_SCAVENGER_TRACE_BACKOUT)
+		omrtty_printf("{SCAV: Back out forwarding table entry %p@%p -> %p[%p]}\n", originalObject, forwardedObject, freeHeader->getNext(), freeHeader->getSize());
+#endif /* OMR_SCAVENGER_TRACE_BACKOUT */
+	}
+}
+
 void
 MM_Scavenger::backoutFixupAndReverseForwardPointersInSurvivor(MM_EnvironmentStandard *env)
 {
-	GC_MemorySubSpaceRegionIteratorStandard evacuateRegionIterator(_activeSubSpace);
 	MM_HeapRegionDescriptorStandard* rootRegion = NULL;
 
 #if defined(OMR_SCAVENGER_TRACE_BACKOUT)
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 #endif /* OMR_SCAVENGER_TRACE_BACKOUT */
-	while(NULL != (rootRegion = evacuateRegionIterator.nextRegion())) {
-		/* skip survivor regions */
-		if (isObjectInEvacuateMemory((omrobjectptr_t )rootRegion->getLowAddress())) {
-			/* tell the object iterator to work on the given region */
-			GC_ObjectHeapIteratorAddressOrderedList evacuateHeapIterator(_extensions, rootRegion, false);
+	if (NULL != _activeForwardingTable) {
+		/* evacuated objects still have their original headers */
+		reverseForwardPointersInForwardingTable(env);
+	} else {
+		GC_MemorySubSpaceRegionIteratorStandard evacuateRegionIterator(_activeSubSpace);
+		while(NULL != (rootRegion = evacuateRegionIterator.nextRegion())) {
+			/* skip survivor regions */
+			if (isObjectInEvacuateMemory((omrobjectptr_t )rootRegion->getLowAddress())) {
+				/* tell the object iterator to work on the given region */
+				GC_ObjectHeapIteratorAddressOrderedList evacuateHeapIterator(_extensions, rootRegion, false);
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
-			evacuateHeapIterator.includeForwardedObjects();
+				evacuateHeapIterator.includeForwardedObjects();
 #endif
-			omrobjectptr_t objectPtr = NULL;
+				omrobjectptr_t objectPtr = NULL;
 
 #if defined(OMR_SCAVENGER_TRACE_BACKOUT)
-			omrtty_printf("{SCAV: Back out forward pointers in region [%p:%p]}\n", rootRegion->getLowAddress(), rootRegion->getHighAddress());
+				omrtty_printf("{SCAV: Back out forward pointers in region [%p:%p]}\n", rootRegion->getLowAddress(), rootRegion->getHighAddress());
 #endif /* OMR_SCAVENGER_TRACE_BACKOUT */
 
-			while((objectPtr = evacuateHeapIterator.nextObjectNoAdvance()) != NULL) {
-				MM_ForwardedHeader header(objectPtr);
-				if (header.isForwardedPointer()) {
-					omrobjectptr_t forwardedObject = header.getForwardedObject();
-					omrobjectptr_t originalObject = header.getObject();
+				while((objectPtr = evacuateHeapIterator.nextObjectNoAdvance()) != NULL) {
+					MM_ForwardedHeader header(objectPtr);
+					if (header.isForwardedPointer()) {
+						omrobjectptr_t forwardedObject = header.getForwardedObject();
+						omrobjectptr_t originalObject = header.getObject();
 
-					_delegate.reverseForwardedObject(env, &header);
+						_delegate.reverseForwardedObject(env, &header);
 
-					/* A reverse forwarded object is a hole whose 'next' pointer actually points at the original object.
-					 * This keeps tenure space walkable once the reverse forwarded objects are abandoned.
-					 */
-					UDATA evacuateObjectSizeInBytes = _extensions->objectModel.getConsumedSizeInBytesWithHeader(forwardedObject);					
-					MM_HeapLinkedFreeHeader* freeHeader = MM_HeapLinkedFreeHeader::getHeapLinkedFreeHeader(forwardedObject);
+						/* A reverse forwarded object is a hole whose 'next' pointer actually points at the original object.
+						 * This keeps tenure space walkable once the reverse forwarded objects are abandoned.
+						 */
+						UDATA evacuateObjectSizeInBytes = _extensions->objectModel.getConsumedSizeInBytesWithHeader(forwardedObject);					
+						MM_HeapLinkedFreeHeader* freeHeader = MM_HeapLinkedFreeHeader::getHeapLinkedFreeHeader(forwardedObject);
 #if defined(OMR_VALGRIND_MEMCHECK)
-					valgrindMempoolAlloc(_extensions,(uintptr_t) originalObject, (uintptr_t) evacuateObjectSizeInBytes);
-					valgrindFreeObject(_extensions, (uintptr_t) forwardedObject);
-					valgrindMakeMemUndefined((uintptr_t)freeHeader, (uintptr_t) sizeof(MM_HeapLinkedFreeHeader));
+						valgrindMempoolAlloc(_extensions,(uintptr_t) originalObject, (uintptr_t) evacuateObjectSizeInBytes);
+						valgrindFreeObject(_extensions, (uintptr_t) forwardedObject);
+						valgrindMakeMemUndefined((uintptr_t)freeHeader, (uintptr_t) sizeof(MM_HeapLinkedFreeHeader));
 #endif /* defined(OMR_VALGRIND_MEMCHECK) */
-					freeHeader->setNext((MM_HeapLinkedFreeHeader*)originalObject);
-					freeHeader->setSize(evacuateObjectSizeInBytes);
+						freeHeader->setNext((MM_HeapLinkedFreeHeader*)originalObject);
+						freeHeader->setSize(evacuateObjectSizeInBytes);
 #if defined(OMR_SCAVENGER_TRACE_BACKOUT)
-					omrtty_printf("{SCAV: Back out forward pointer %p[%p]@%p -> %p[%p]}\n", objectPtr, *objectPtr, forwardedObject, freeHeader->getNext(), freeHeader->getSize());
-					Assert_MM_true(objectPtr == originalObject);
+						omrtty_printf("{SCAV: Back out forward pointer %p[%p]@%p -> %p[%p]}\n", objectPtr, *objectPtr, forwardedObject, freeHeader->getNext(), freeHeader->getSize());
+						Assert_MM_true(objectPtr == originalObject);
 #endif /* OMR_SCAVENGER_TRACE_BACKOUT */			
+					}
 				}
 			}
 		}
@@ -3692,8 +4000,15 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 			while (NULL != (cache = _scavengeCacheScanList.popCache(env))) {
 				flushCache(env, cache);
 			}
+			/* all threads are synchronized, so the deques of the other threads can be drained from here */
+			for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+				while (NULL != (cache = _scanCacheDeques[i].steal())) {
+					flushCache(env, cache);
+				}
+			}
 		}
 		Assert_MM_true(0 == _cachedEntryCount);
+		Assert_MM_true(areScanCacheDequesEmpty());
 
 		/* 2
 		 * a) Mark the overflow scan as invalid (backing out of objects moved into old space)
@@ -3716,28 +4031,38 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 				clearRememberedSetLists(env);
 			} else {
 				/* i) Unremember any objects that moved from new space to old */
-				while(NULL != (rootRegion = evacuateRegionIterator.nextRegion())) {
-					/* skip survivor regions */
-					if (isObjectInEvacuateMemory((omrobjectptr_t)rootRegion->getLowAddress())) {
-						/* tell the object iterator to work on the given region */
-						GC_ObjectHeapIteratorAddressOrderedList evacuateHeapIterator(_extensions, rootRegion, false);
+				if (NULL != _activeForwardingTable) {
+					uintptr_t cursor = 0;
+					omrobjectptr_t fwdObjectPtr = NULL;
+					while (NULL != _activeForwardingTable->nextForwardedObject(&cursor, &fwdObjectPtr)) {
+						if (_extensions->objectModel.isRemembered(fwdObjectPtr)) {
+							_extensions->objectModel.clearRemembered(fwdObjectPtr);
+						}
+					}
+				} else {
+					while(NULL != (rootRegion = evacuateRegionIterator.nextRegion())) {
+						/* skip survivor regions */
+						if (isObjectInEvacuateMemory((omrobjectptr_t)rootRegion->getLowAddress())) {
+							/* tell the object iterator to work on the given region */
+							GC_ObjectHeapIteratorAddressOrderedList evacuateHeapIterator(_extensions, rootRegion, false);
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
-						evacuateHeapIterator.includeForwardedObjects();
+							evacuateHeapIterator.includeForwardedObjects();
 #endif
-						omrobjectptr_t objectPtr = NULL;
-						omrobjectptr_t fwdObjectPtr = NULL;
-						while((objectPtr = evacuateHeapIterator.nextObjectNoAdvance()) != NULL) {
-							MM_ForwardedHeader header(objectPtr);
-							fwdObjectPtr = header.getForwardedObject();
-							if (NULL != fwdObjectPtr) {
-								if(_extensions->objectModel.isRemembered(fwdObjectPtr)) {
-									_extensions->objectModel.clearRemembered(fwdObjectPtr);
-								}
+							omrobjectptr_t objectPtr = NULL;
+							omrobjectptr_t fwdObjectPtr = NULL;
+							while((objectPtr = evacuateHeapIterator.nextObjectNoAdvance()) != NULL) {
+								MM_ForwardedHeader header(objectPtr);
+								fwdObjectPtr = header.getForwardedObject();
+								if (NULL != fwdObjectPtr) {
+									if(_extensions->objectModel.isRemembered(fwdObjectPtr)) {
+										_extensions->objectModel.clearRemembered(fwdObjectPtr);
+									}
 #if defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
-								evacuateHeapIterator.advance(_extensions->objectModel.getConsumedSizeInBytesWithHeaderBeforeMove(fwdObjectPtr));
+									evacuateHeapIterator.advance(_extensions->objectModel.getConsumedSizeInBytesWithHeaderBeforeMove(fwdObjectPtr));
 #else
-								evacuateHeapIterator.advance(_extensions->objectModel.getConsumedSizeInBytesWithHeader(fwdObjectPtr));
+									evacuateHeapIterator.advance(_extensions->objectModel.getConsumedSizeInBytesWithHeader(fwdObjectPtr));
 #endif /* defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
+								}
 							}
 						}
 					}
@@ -3863,7 +4188,10 @@ MM_Scavenger::masterThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_Allocat
 
 		if(scavengeCompletedSuccessfully(env)) {
 			/* Merge sublists in the remembered set (if necessary) */
-			_extensions->rememberedSet.compact(env);
+			_extensions->rememberedSet.compact(env, _extensions->rememberedSetDeduplicate);
+
+			_previousSurvivedBytes = _extensions->scavengerStats._flipBytes + _extensions->scavengerStats._tenureAggregateBytes;
+			_previousSurvivedObjects = _extensions->scavengerStats._flipCount + _extensions->scavengerStats._tenureAggregateCount;
 
 			/* If -Xgc:fvtest=forcePoisonEvacuate has been specified, poison(fill poison pattern) evacuate space */
 			if(_extensions->fvtest_forcePoisonEvacuate) {
@@ -3894,6 +4222,12 @@ MM_Scavenger::masterThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_Allocat
 			/* Build free list in survivor profile - the scavenge was unsuccessful, so rebuild the free list */
 			_activeSubSpace->masterTeardownForAbortedGC(env);
 		}
+
+		/* Whether the scavenge completed or backed out, the forwarding pointers are no longer needed */
+		if (NULL != _activeForwardingTable) {
+			_activeForwardingTable->resetCycle(env);
+			_activeForwardingTable = NULL;
+		}
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		/* Although evacuate is functionally irrelevant at this point since we are finishing the cycle,
 		 * it is still useful for debugging (CS must not see live objects in Evacuate).
@@ -4939,6 +5273,16 @@ MM_Scavenger::scavengeIncremental(MM_EnvironmentBase *env)
 	bool result = false;
 	bool timeout = false;
 
+	if ((concurrent_state_scan == _concurrentState) || (concurrent_state_complete == _concurrentState)) {
+		/* Mutators stopped allocating into the hybrid allocate/survivor space. Their allocation caches were flushed for
+		 * this increment, and allocation stats were cleared at the end of the roots increment, so the stats hold the
+		 * bytes allocated since the concurrent phase started.
+		 */
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		_pacingWindowEndTime = omrtime_hires_clock();
+		_pacingBytesAllocated = _extensions->allocationStats.bytesAllocated();
+	}
+
 	while (!timeout) {
 
 		switch (_concurrentState) {
@@ -4966,6 +5310,18 @@ MM_Scavenger::scavengeIncremental(MM_EnvironmentBase *env)
 			/* prepare for the second pass (direct refs) */
 			_extensions->rememberedSet.startProcessingSublist();
 
+			/* start measuring the concurrent phase for the pacing controller */
+			{
+				OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+				_pacingWindowStartTime = omrtime_hires_clock();
+			}
+			_pacingWindowEndTime = _pacingWindowStartTime;
+			_pacingConcurrentTime = 0;
+			_pacingBytesScanned = 0;
+			_pacingBytesAllocated = 0;
+			_pacingBlocked = false;
+			_pacingFreeAtConcurrentStart = _activeSubSpace->getApproximateActiveFreeMemorySize(MEMORY_TYPE_NEW);
+
 			_concurrentState = concurrent_state_scan;
 
 			if (isBackOutFlagRaised()) {
@@ -4986,6 +5342,9 @@ MM_Scavenger::scavengeIncremental(MM_EnvironmentBase *env)
 
 			timeout = scavengeScan(env);
 
+			/* the scan work did not get a chance to run concurrently */
+			_pacingBlocked = true;
+
 			_concurrentState = concurrent_state_complete;
 
 			mergeIncrementGCStats(env, false);
@@ -5112,9 +5471,13 @@ MM_Scavenger::masterThreadConcurrentCollect(MM_EnvironmentBase *env)
 	if (concurrent_state_scan == _concurrentState) {
 		clearIncrementGCStats(env, false);
 
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 		MM_ConcurrentScavengeTask scavengeTask(env, _dispatcher, this, MM_ConcurrentScavengeTask::SCAVENGE_SCAN, UDATA_MAX, env->_cycleState);
 		/* Concurrent background task will run with different (typically lower) number of threads. */
+		uint64_t startTime = omrtime_hires_clock();
 		_dispatcher->run(env, &scavengeTask, _extensions->concurrentScavengerBackgroundThreads);
+		_pacingConcurrentTime += omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		_pacingBytesScanned += scavengeTask.getBytesScanned();
 
 		/* Now that we are done with concurrent scanning in this cycle (where we could possibly
 		 * be interested in its value), record shouldYield Flag for reporting purposes and reset it. */
@@ -5129,6 +5492,7 @@ MM_Scavenger::masterThreadConcurrentCollect(MM_EnvironmentBase *env)
 				/* Ran out of free space in allocate/survivor, or system/global GC */
 				getConcurrentPhaseStats()->_terminationRequestType = MM_ConcurrentPhaseStatsBase::terminationRequest_ByGC;
 				_concurrentState = concurrent_state_complete;
+				_pacingBlocked = true;
 			}
 			_shouldYield = false;
 		} else {
@@ -5201,6 +5565,35 @@ MM_Scavenger::switchConcurrentForThread(MM_EnvironmentBase *env)
 	}
 }
 
+void
+MM_Scavenger::updateConcurrentPacing(MM_EnvironmentStandard *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_ScavengerStats *stats = &_extensions->scavengerStats;
+	uintptr_t backgroundThreads = OMR_MAX(_extensions->concurrentScavengerBackgroundThreads, 1);
+
+	uint64_t windowTime = omrtime_hires_delta(_pacingWindowStartTime, _pacingWindowEndTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	_pacing.cycleCompleted(_pacingBytesScanned, _pacingConcurrentTime, backgroundThreads, _pacingBytesAllocated, windowTime,
+			_pacingFreeAtConcurrentStart, stats->_flipBytes + stats->_tenureAggregateBytes, _pacingBlocked);
+
+	uintptr_t nextThreads = backgroundThreads;
+	if (!_extensions->concurrentScavengerBackgroundThreadsForced) {
+		nextThreads = _pacing.selectBackgroundThreads(_extensions->gcThreadCount);
+		_extensions->concurrentScavengerBackgroundThreads = nextThreads;
+	}
+	_pacing.predict(nextThreads);
+
+	stats->_pacingBlocked = _pacingBlocked;
+	stats->_pacingCopyRate = _pacing.getCopyRate();
+	stats->_pacingAllocationRate = _pacing.getAllocationRate();
+	stats->_pacingPredictedCopyBytes = _pacing.getCopyBytes();
+	stats->_pacingPredictedConcurrentTime = _pacing.getPredictedConcurrentTime();
+	stats->_pacingPredictedAllocationBytes = _pacing.getPredictedAllocationBytes();
+	stats->_pacingBackgroundThreads = nextThreads;
+	/* consumed by the tilt of this cycle: a larger survivor makes the next cycle start earlier and gives its concurrent phase more room */
+	stats->_pacingSurvivorReserve = _pacing.getSurvivorReserve();
+}
+
 void
 MM_Scavenger::triggerConcurrentScavengerTransition(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
 {
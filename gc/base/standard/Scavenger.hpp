@@ -34,14 +34,18 @@
 #include "CollectionStatisticsStandard.hpp"
 #include "Collector.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
+#include "ConcurrentScavengerPacing.hpp"
+#include "CopyScanCacheDeque.hpp"
 #include "CopyScanCacheList.hpp"
 #include "CopyScanCacheStandard.hpp"
 #include "CycleState.hpp"
+#include "ForwardedHeader.hpp"
 #include "GCExtensionsBase.hpp"
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 #include "MasterGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #include "ScavengerDelegate.hpp"
+#include "ScavengerForwardingTable.hpp"
 
 struct J9HookInterface;
 class GC_ObjectScanner;
@@ -105,12 +109,20 @@ private:
 	MM_CopyScanCacheList _scavengeCacheFreeList; /**< pool of unused copy-scan caches */
 	MM_CopyScanCacheList _scavengeCacheScanList; /**< scan lists */
 	volatile uintptr_t _cachedEntryCount; /**< non-empty scanCacheList count (not the total count of caches in the lists) */
+	MM_CopyScanCacheDeque *_scanCacheDeques; /**< per GC thread work-stealing deques of scan caches (indexed by slave ID), NULL unless scavengerWorkStealing is enabled */
+	uintptr_t _scanCacheDequeCount; /**< number of entries in _scanCacheDeques */
 	uintptr_t _cachesPerThread; /**< maximum number of copy and scan caches required per thread at any one time */
 	omrthread_monitor_t _scanCacheMonitor; /**< monitor to synchronize threads on scan lists */
 	omrthread_monitor_t _freeCacheMonitor; /**< monitor to synchronize threads on free list */
 	uintptr_t _waitingCountAliasThreshold; /**< Only alias a copy cache IF the number of threads waiting hasn't reached the threshold*/
 	volatile uintptr_t _waitingCount; /**< count of threads waiting  on scan cache queues (blocked via _scanCacheMonitor); threads never wait on _freeCacheMonitor */
 	uintptr_t _cacheLineAlignment; /**< The number of bytes per cache line which is used to determine which boundaries in memory represent the beginning of a cache line */
+	bool _hotFieldCopy; /**< true if hot field referents are copied behind their parents, and hot field cache misses are counted (scavengerHotFieldCopy, stop-the-world scavenges only) */
+	bool _rememberedSetRanges; /**< true if the remembered set is scanned in slot ranges claimed across all puddles (scavengerRememberedSetRanges, stop-the-world scavenges only) */
+	MM_ScavengerForwardingTable *_forwardingTable; /**< side table of forwarding pointers (scavengerForwardingTable, stop-the-world scavenges only), NULL if not enabled */
+	MM_ScavengerForwardingTable *_activeForwardingTable; /**< _forwardingTable while it holds the forwarding pointers of the current scavenge, NULL if they are in object headers */
+	uintptr_t _previousSurvivedBytes; /**< bytes flipped or tenured by the last successful scavenge, the base of its work estimate for adaptive GC threading */
+	uintptr_t _previousSurvivedObjects; /**< objects flipped or tenured by the last successful scavenge */
 	volatile bool _rescanThreadsForRememberedObjects; /**< Indicates that thread-referenced objects were tenured and threads must be rescanned */
 
 	volatile uintptr_t _backOutDoneIndex; /**< snapshot of _doneIndex, when backOut was detected */
@@ -134,6 +146,15 @@ private:
 	volatile bool _shouldYield; /**< Set by the first GC thread that observes that a criteria for yielding is met. Reset only when the concurrent phase is finished. */
 
 	MM_ConcurrentPhaseStatsBase _concurrentPhaseStats;
+
+	uint64_t _pacingWindowStartTime; /**< Time the concurrent phase of the current cycle was entered (end of the roots increment) */
+	uint64_t _pacingWindowEndTime; /**< Time the final increment of the current cycle was entered */
+	uint64_t _pacingConcurrentTime; /**< Microseconds spent running concurrent scan tasks in the current cycle */
+	uintptr_t _pacingBytesScanned; /**< Bytes scanned by concurrent scan tasks in the current cycle */
+	uintptr_t _pacingBytesAllocated; /**< Bytes allocated by mutators from the start of the concurrent phase to the final increment */
+	uintptr_t _pacingFreeAtConcurrentStart; /**< Free bytes in the hybrid allocate/survivor space when the concurrent phase was entered */
+	bool _pacingBlocked; /**< True if scan work was left for the final increment because mutators ran out of allocation space */
+	MM_ConcurrentScavengerPacing _pacing; /**< Averages and predictions of the pacing controller */
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 #define IS_CONCURRENT_ENABLED _extensions->isConcurrentScavengerEnabled()
@@ -251,6 +272,35 @@ public:
 
 	MMINLINE omrobjectptr_t copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHeader);
 
+	/**
+	 * Get the copy of an evacuated object, from the forwarding table if one is active or else from the object header.
+	 * @param forwardedHeader the header of an object in evacuate space
+	 * @return the copy, or NULL if the object has not been forwarded
+	 */
+	MMINLINE omrobjectptr_t
+	getForwardedObject(MM_ForwardedHeader *forwardedHeader)
+	{
+		if (NULL != _activeForwardingTable) {
+			return _activeForwardingTable->getForwardedObject(forwardedHeader->getObject());
+		}
+		return forwardedHeader->getForwardedObject();
+	}
+
+	/**
+	 * Forward an evacuated object to its copy, in the forwarding table if one is active or else in the object header.
+	 * @param forwardedHeader the header of an object in evacuate space
+	 * @param destinationObjectPtr the copy
+	 * @return the winning copy (either destinationObjectPtr or one installed by another thread)
+	 */
+	MMINLINE omrobjectptr_t
+	setForwardedObject(MM_ForwardedHeader *forwardedHeader, omrobjectptr_t destinationObjectPtr)
+	{
+		if (NULL != _activeForwardingTable) {
+			return _activeForwardingTable->setForwardedObject(forwardedHeader->getObject(), destinationObjectPtr);
+		}
+		return forwardedHeader->setForwardedObject(destinationObjectPtr);
+	}
+
 	MMINLINE void updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanned, uint64_t slotsCopied);
 	bool splitIndexableObjectScanner(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t startIndex, omrobjectptr_t *rememberedSetSlot);
 
@@ -302,8 +352,28 @@ public:
 	
 	void deepScanOutline(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t priorityFieldOffset1, uintptr_t priorityFieldOffset2);
 
+	/**
+	 * Copy the referents of the hot fields of a just copied object right behind it, in the order the delegate lists them
+	 * (-Xgc:scavengerHotFieldCopy). Referents copied this way copy their own hot field referents in turn, down to
+	 * scavengerHotFieldCopyDepth levels, so that the paths the mutator is expected to follow end up in consecutive memory.
+	 * The object is still scanned as usual later on, finding the hot field slots already forwarded.
+	 * @param env The environment.
+	 * @param objectPtr The new location of the object that has just been copied
+	 * @param copyCache The copy cache that received the object, which must be the thread's current survivor or tenure copy cache
+	 */
+	void copyHotFields(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, MM_CopyScanCacheStandard *copyCache);
+
+	/**
+	 * Count the hot field references of a fully scanned object that do not point into the cache line following it.
+	 * @param env The environment.
+	 * @param objectPtr The object, in survivor or tenure space, whose slots have all been forwarded
+	 */
+	void countHotFieldCacheMisses(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+
 	MMINLINE bool scavengeRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
 	void scavengeRememberedSetList(MM_EnvironmentStandard *env);
+	void scavengeRememberedSetSlotRanges(MM_EnvironmentStandard *env);
+	MMINLINE void scavengeRememberedSetSlot(MM_EnvironmentStandard *env, omrobjectptr_t *slotPtr);
 	void scavengeRememberedSetOverflow(MM_EnvironmentStandard *env);
 	MMINLINE void flushRememberedSet(MM_EnvironmentStandard *env);
 	void pruneRememberedSetList(MM_EnvironmentStandard *env);
@@ -324,6 +394,13 @@ public:
 	bool backOutFixSlot(GC_SlotObject *slotObject);
 
 	void backoutFixupAndReverseForwardPointersInSurvivor(MM_EnvironmentStandard *env);
+
+	/**
+	 * Back out variant of backoutFixupAndReverseForwardPointersInSurvivor() used when the forwarding pointers are in
+	 * the forwarding table. Evacuated objects were never modified, so only the copies found in the dirty parts of the
+	 * table are turned into reverse forwarded objects, without walking the evacuate space.
+	 */
+	void reverseForwardPointersInForwardingTable(MM_EnvironmentStandard *env);
 	void processRememberedSetInBackout(MM_EnvironmentStandard *env);
 	void completeBackOut(MM_EnvironmentStandard *env);
 
@@ -366,6 +443,27 @@ public:
 	MMINLINE uintptr_t copyCacheDistanceMetric(MM_CopyScanCacheStandard* cache);
 
 	MMINLINE MM_CopyScanCacheStandard *getNextScanCacheFromList(MM_EnvironmentStandard *env);
+	MMINLINE bool isScanCacheWorkAvailable();
+
+	/**
+	 * Steal a scan cache from the deque of another GC thread. Victims are visited round robin,
+	 * starting with the thread following the current one.
+	 * @param env[in] the current (thief) GC thread
+	 * @return the stolen cache, or NULL if no cache could be stolen
+	 */
+	MM_CopyScanCacheStandard *stealScanCache(MM_EnvironmentStandard *env);
+
+	/**
+	 * @return true if every per-thread scan cache deque is empty (trivially true if work stealing is disabled)
+	 */
+	bool areScanCacheDequesEmpty();
+
+	/**
+	 * Approximate number of scan caches waiting to be scanned, in the shared scan list and
+	 * (if work stealing is enabled) in the per-thread scan cache deques.
+	 * @return the approximate scan cache backlog
+	 */
+	uintptr_t getApproximateScanCacheCount();
 	void addCopyCachesToFreeList(MM_EnvironmentStandard *env);
 	MMINLINE void addCacheEntryToScanListAndNotify(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *newCacheEntry);
 
@@ -527,6 +625,14 @@ public:
 	void calcGCStats(MM_EnvironmentStandard *env);
 
 	void scavenge(MM_EnvironmentBase *env);
+
+	/**
+	 * Estimate the bytes a scavenge will copy and scan, for adaptive GC threading: the survivors of the
+	 * last successful scavenge, plus the remembered objects at the average size of those survivors.
+	 * @return the estimate, or 0 if there is no history yet or the remembered set overflowed
+	 */
+	uintptr_t estimateScavengeWork(MM_EnvironmentBase *env);
+
 	bool scavengeCompletedSuccessfully(MM_EnvironmentStandard *env);
 	virtual	void masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool initMarkMap = false, bool rebuildMarkBits = false);
 
@@ -695,6 +801,19 @@ public:
 	
 	void reportConcurrentScavengeStart(MM_EnvironmentStandard *env);
 	void reportConcurrentScavengeEnd(MM_EnvironmentStandard *env);
+
+	/**
+	 * Pacing controller for Concurrent Scavenger (concurrentScavengerPacing), run at the end of each successful cycle.
+	 * Background threads copy surviving objects while mutators allocate into the same (hybrid allocate/survivor) space.
+	 * From the copy rate per background thread, the mutator allocation rate and the space available when the concurrent
+	 * phase starts, predict whether the next concurrent phase can finish before mutators run out of space (which forces
+	 * the remaining work into a blocking final increment). Select the smallest background thread count that is expected
+	 * to finish in time, and if even all GC threads are not expected to, reserve extra survivor space in the tilt so that
+	 * the next cycle starts earlier. The model is MM_ConcurrentScavengerPacing; its predictions are recorded in the
+	 * cycle MM_ScavengerStats for verbose output.
+	 * @param env master GC thread.
+	 */
+	void updateConcurrentPacing(MM_EnvironmentStandard *env);
 	
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
@@ -720,6 +839,19 @@ public:
 		/* check if the object in cached allocate (from GC perspective, evacuate) ranges */
 		return ((void *)objectPtr >= _evacuateSpaceBase) && ((void *)objectPtr < _evacuateSpaceTop);
 	}
+
+	/**
+	 * Get the copy of an object in evacuate space during a scavenge. Language code must use this rather than
+	 * MM_ForwardedHeader, since forwarding pointers are kept out of object headers with -Xgc:scavengerForwardingTable.
+	 * @param objectPtr an object in evacuate space
+	 * @return the copy, or NULL if the object has not been forwarded
+	 */
+	MMINLINE omrobjectptr_t
+	getForwardedObject(omrobjectptr_t objectPtr)
+	{
+		MM_ForwardedHeader forwardedHeader(objectPtr);
+		return getForwardedObject(&forwardedHeader);
+	}
 	
 	MMINLINE void *
 	getEvacuateBase()
@@ -843,12 +975,20 @@ public:
 		, _cycleState()
 		, _collectionStatistics()
 		, _cachedEntryCount(0)
+		, _scanCacheDeques(NULL)
+		, _scanCacheDequeCount(0)
 		, _cachesPerThread(0)
 		, _scanCacheMonitor(NULL)
 		, _freeCacheMonitor(NULL)
 		, _waitingCountAliasThreshold(0)
 		, _waitingCount(0)
 		, _cacheLineAlignment(0)
+		, _hotFieldCopy(false)
+		, _rememberedSetRanges(false)
+		, _forwardingTable(NULL)
+		, _activeForwardingTable(NULL)
+		, _previousSurvivedBytes(0)
+		, _previousSurvivedObjects(0)
 #if !defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, _rescanThreadsForRememberedObjects(false)
 #endif
@@ -861,6 +1001,14 @@ public:
 		, _concurrentState(concurrent_state_idle)
 		, _concurrentScavengerSwitchCount(0)
 		, _shouldYield(false)
+		, _pacingWindowStartTime(0)
+		, _pacingWindowEndTime(0)
+		, _pacingConcurrentTime(0)
+		, _pacingBytesScanned(0)
+		, _pacingBytesAllocated(0)
+		, _pacingFreeAtConcurrentStart(0)
+		, _pacingBlocked(false)
+		, _pacing()
 #endif /* #if defined(OMR_GC_CONCURRENT_SCAVENGER) */
 
 		, _omrVM(env->getOmrVM())
@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "omrcfg.h"
+
+#include "ScavengerForwardingTable.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "Math.hpp"
+#include "MemoryManager.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+MM_ScavengerForwardingTable *
+MM_ScavengerForwardingTable::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ScavengerForwardingTable *forwardingTable = (MM_ScavengerForwardingTable *)env->getForge()->allocate(sizeof(MM_ScavengerForwardingTable), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != forwardingTable) {
+		new(forwardingTable) MM_ScavengerForwardingTable(env);
+		if (!forwardingTable->initialize(env)) {
+			forwardingTable->kill(env);
+			forwardingTable = NULL;
+		}
+	}
+	return forwardingTable;
+}
+
+void
+MM_ScavengerForwardingTable::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ScavengerForwardingTable::canEncodeHeap(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t heapSize = (uintptr_t)extensions->heap->getHeapTop() - (uintptr_t)extensions->heap->getHeapBase();
+	uintptr_t granules = heapSize >> MM_Math::floorLog2(env->getObjectAlignmentInBytes());
+
+	/* entries are granule offsets plus one, so the last granule must still fit */
+	return granules < (uintptr_t)U_32_MAX;
+}
+
+bool
+MM_ScavengerForwardingTable::initialize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	uintptr_t heapTop = (uintptr_t)extensions->heap->getHeapTop();
+	_heapBase = (uintptr_t)extensions->heap->getHeapBase();
+	/* the nursery is always at the top of the heap (see MM_ConfigurationGenerational::defaultMemorySpaceAllocated()) */
+	uintptr_t nurserySize = heapTop - _heapBase;
+	if ((0 != extensions->maxNewSpaceSize) && (extensions->maxNewSpaceSize < nurserySize)) {
+		nurserySize = extensions->maxNewSpaceSize;
+	}
+	_tableBase = heapTop - nurserySize;
+	_shift = MM_Math::floorLog2(env->getObjectAlignmentInBytes());
+	_entryCount = nurserySize >> _shift;
+
+	MM_MemoryManager *memoryManager = extensions->memoryManager;
+	if (!memoryManager->createVirtualMemoryForMetadata(env, &_tableMemoryHandle, extensions->heapAlignment, _entryCount * sizeof(uint32_t), "scavengerForwardingTable")) {
+		return false;
+	}
+	_entries = (volatile uint32_t *)memoryManager->getHeapBase(&_tableMemoryHandle);
+
+	uintptr_t chunkCount = (_entryCount >> ENTRIES_PER_CHUNK_SHIFT) + 1;
+	_dirtyChunks = (volatile uint8_t *)env->getForge()->allocate(chunkCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _dirtyChunks) {
+		return false;
+	}
+	memset((void *)_dirtyChunks, 0, chunkCount);
+
+	return true;
+}
+
+void
+MM_ScavengerForwardingTable::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _dirtyChunks) {
+		env->getForge()->free((void *)_dirtyChunks);
+		_dirtyChunks = NULL;
+	}
+
+	env->getExtensions()->memoryManager->destroyVirtualMemory(env, &_tableMemoryHandle);
+	_entries = NULL;
+}
+
+bool
+MM_ScavengerForwardingTable::startCycle(MM_EnvironmentBase *env, void *evacuateBase, void *evacuateTop)
+{
+	if (((uintptr_t)evacuateBase < _tableBase) || (getIndex((omrobjectptr_t)evacuateTop) > _entryCount)) {
+		return false;
+	}
+
+	_cycleLowIndex = getIndex((omrobjectptr_t)evacuateBase);
+	_cycleHighIndex = getIndex((omrobjectptr_t)evacuateTop);
+
+	/* the evacuate space moves and resizes between scavenges; committing an already committed range is harmless */
+	MM_MemoryManager *memoryManager = env->getExtensions()->memoryManager;
+	return memoryManager->commitMemory(&_tableMemoryHandle, (void *)&_entries[_cycleLowIndex], (_cycleHighIndex - _cycleLowIndex) * sizeof(uint32_t));
+}
+
+void
+MM_ScavengerForwardingTable::resetCycle(MM_EnvironmentBase *env)
+{
+	uintptr_t lowChunk = _cycleLowIndex >> ENTRIES_PER_CHUNK_SHIFT;
+	uintptr_t highChunk = (_cycleHighIndex + ((uintptr_t)1 << ENTRIES_PER_CHUNK_SHIFT) - 1) >> ENTRIES_PER_CHUNK_SHIFT;
+
+	for (uintptr_t chunk = lowChunk; chunk < highChunk; chunk++) {
+		if (0 != _dirtyChunks[chunk]) {
+			/* only the part of the chunk within the evacuate range is committed (and may have been written) */
+			uintptr_t low = OMR_MAX(chunk << ENTRIES_PER_CHUNK_SHIFT, _cycleLowIndex);
+			uintptr_t high = OMR_MIN((chunk + 1) << ENTRIES_PER_CHUNK_SHIFT, _cycleHighIndex);
+			memset((void *)&_entries[low], 0, (high - low) * sizeof(uint32_t));
+			_dirtyChunks[chunk] = 0;
+		}
+	}
+}
+
+omrobjectptr_t
+MM_ScavengerForwardingTable::nextForwardedObject(uintptr_t *cursor, omrobjectptr_t *forwardedObject)
+{
+	uintptr_t index = OMR_MAX(*cursor, _cycleLowIndex);
+
+	while (index < _cycleHighIndex) {
+		uintptr_t chunk = index >> ENTRIES_PER_CHUNK_SHIFT;
+		if (0 == _dirtyChunks[chunk]) {
+			index = (chunk + 1) << ENTRIES_PER_CHUNK_SHIFT;
+		} else {
+			uint32_t entry = _entries[index];
+			index += 1;
+			if (0 != entry) {
+				*cursor = index;
+				*forwardedObject = decode(entry);
+				return (omrobjectptr_t)(_tableBase + ((index - 1) << _shift));
+			}
+		}
+	}
+
+	*cursor = index;
+	return NULL;
+}
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
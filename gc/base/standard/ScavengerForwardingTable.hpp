@@ -0,0 +1,195 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(SCAVENGERFORWARDINGTABLE_HPP_)
+#define SCAVENGERFORWARDINGTABLE_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+#include "objectdescription.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+#include "MemoryHandle.hpp"
+
+class MM_EnvironmentBase;
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+/**
+ * Side table of Scavenger forwarding pointers, used instead of installing forwarding pointers in the headers
+ * of evacuated objects (stop-the-world scavenges only).
+ *
+ * There is one 32 bit entry per object alignment granule of the nursery. The entry of an object that has been copied
+ * holds the offset of its copy (in the nursery or in tenure) from the heap base, in units of object alignment, plus
+ * one (0 means not forwarded). The nursery is at the top of the heap, so the table covers the top maxNewSpaceSize
+ * bytes of the heap; a scavenge whose evacuate range falls outside of it keeps forwarding pointers in headers.
+ *
+ * Cost: 4 bytes of virtual memory are reserved per object alignment granule of the maximum nursery size (half of
+ * maxNewSpaceSize with 8 byte alignment), and entries are committed for the evacuate range of each scavenge, so
+ * once both semispaces have been evacuated the committed part is 4 bytes per granule of the current nursery. Entries
+ * are grouped in 4KB chunks with a dirty byte each (one byte of native memory per 1024 granules), so resetting the
+ * table after a scavenge (or a back out) only clears and visits the chunks that received forwarding pointers.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ScavengerForwardingTable : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_MemoryHandle _tableMemoryHandle; /**< reserved memory for the entries */
+	volatile uint32_t *_entries; /**< one entry per object alignment granule of the nursery */
+	volatile uint8_t *_dirtyChunks; /**< non-zero if any entry of the corresponding chunk may be non-zero */
+	uintptr_t _heapBase; /**< base of the heap, entries encode copies relative to it */
+	uintptr_t _tableBase; /**< lowest address the nursery can have, entries are indexed relative to it */
+	uintptr_t _shift; /**< log2 of the object alignment */
+	uintptr_t _entryCount; /**< number of entries reserved */
+	uintptr_t _cycleLowIndex; /**< first entry committed for the current scavenge */
+	uintptr_t _cycleHighIndex; /**< entry following the last one committed for the current scavenge */
+
+	static const uintptr_t ENTRIES_PER_CHUNK_SHIFT = 10; /**< 4KB of entries per dirty byte */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE uintptr_t
+	getIndex(omrobjectptr_t objectPtr)
+	{
+		return ((uintptr_t)objectPtr - _tableBase) >> _shift;
+	}
+
+	MMINLINE uint32_t
+	encode(omrobjectptr_t objectPtr)
+	{
+		return (uint32_t)((((uintptr_t)objectPtr - _heapBase) >> _shift) + 1);
+	}
+
+	MMINLINE omrobjectptr_t
+	decode(uint32_t entry)
+	{
+		return (omrobjectptr_t)(_heapBase + ((uintptr_t)(entry - 1) << _shift));
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_ScavengerForwardingTable *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Check whether every heap address can be encoded in a 32 bit entry.
+	 * @param env[in] the current thread
+	 * @return true if a table can be created for the current heap
+	 */
+	static bool canEncodeHeap(MM_EnvironmentBase *env);
+
+	/**
+	 * Commit the entries for the evacuate range of a scavenge. All entries are expected to be 0.
+	 * @param env[in] the master GC thread
+	 * @param evacuateBase[in] base of the evacuate space
+	 * @param evacuateTop[in] top of the evacuate space
+	 * @return true if the table can be used for this scavenge, false if the range is not covered or can not be committed
+	 */
+	bool startCycle(MM_EnvironmentBase *env, void *evacuateBase, void *evacuateTop);
+
+	/**
+	 * Clear all forwarding pointers installed since startCycle(). Must be called once no GC thread uses the table.
+	 * @param env[in] the master GC thread
+	 */
+	void resetCycle(MM_EnvironmentBase *env);
+
+	/**
+	 * @param objectPtr[in] an object in the evacuate space
+	 * @return the copy of the object, or NULL if the object has not been forwarded
+	 */
+	MMINLINE omrobjectptr_t
+	getForwardedObject(omrobjectptr_t objectPtr)
+	{
+		uint32_t entry = _entries[getIndex(objectPtr)];
+		return (0 == entry) ? NULL : decode(entry);
+	}
+
+	/**
+	 * Atomically forward an object to its copy, unless another thread forwarded it first.
+	 * @param objectPtr[in] an object in the evacuate space
+	 * @param destinationObjectPtr[in] the copy of the object
+	 * @return the winning copy (either destinationObjectPtr or the one installed by another thread)
+	 */
+	MMINLINE omrobjectptr_t
+	setForwardedObject(omrobjectptr_t objectPtr, omrobjectptr_t destinationObjectPtr)
+	{
+		uintptr_t index = getIndex(objectPtr);
+		uint32_t entry = encode(destinationObjectPtr);
+		uint32_t oldEntry = MM_AtomicOperations::lockCompareExchangeU32((volatile uint32_t *)&_entries[index], 0, entry);
+		if (0 != oldEntry) {
+			return decode(oldEntry);
+		}
+		/* read first, to avoid writing to a shared line for every forwarded object */
+		uintptr_t chunk = index >> ENTRIES_PER_CHUNK_SHIFT;
+		if (0 == _dirtyChunks[chunk]) {
+			_dirtyChunks[chunk] = 1;
+		}
+		return destinationObjectPtr;
+	}
+
+	/**
+	 * Find the next forwarded object of the current scavenge, in address order. Single threaded.
+	 * @param cursor[in/out] iteration state, must be 0 on the first call
+	 * @param forwardedObject[out] the copy of the returned object
+	 * @return the next forwarded object in the evacuate space, or NULL if there are no more
+	 */
+	omrobjectptr_t nextForwardedObject(uintptr_t *cursor, omrobjectptr_t *forwardedObject);
+
+	/**
+	 * Create a ScavengerForwardingTable object.
+	 */
+	MM_ScavengerForwardingTable(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _tableMemoryHandle()
+		, _entries(NULL)
+		, _dirtyChunks(NULL)
+		, _heapBase(0)
+		, _tableBase(0)
+		, _shift(0)
+		, _entryCount(0)
+		, _cycleLowIndex(0)
+		, _cycleHighIndex(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+#endif /* SCAVENGERFORWARDINGTABLE_HPP_ */
@@ -40,6 +40,9 @@ extern "C" {
 /* Allocation description will be initialized in call */
 omrobjectptr_t OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, uintptr_t allocationCategory, uintptr_t requiredSizeInBytes, uintptr_t objectAllocationFlags);
 
+/* Allocate up to count objects of the same size, returns the number allocated (see MM_AllocateInitialization::allocateAndInitializeObjects()) */
+uintptr_t OMR_GC_AllocateObjects(OMR_VMThread * omrVMThread, uintptr_t allocationCategory, uintptr_t requiredSizeInBytes, uintptr_t objectAllocationFlags, omrobjectptr_t *objects, uintptr_t count);
+
 omr_error_t OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode);
 
 #ifdef __cplusplus
@@ -51,6 +54,7 @@ omr_error_t OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode);
 class MM_AllocateInitialization;
 /* Caller is expected to initialize the allocation description (MM_AllocateInitialization::getAllocateDescription()) prior to call */
 omrobjectptr_t OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, MM_AllocateInitialization *allocator);
+uintptr_t OMR_GC_AllocateObjects(OMR_VMThread * omrVMThread, MM_AllocateInitialization *allocator, omrobjectptr_t *objects, uintptr_t count);
 #endif
 
 #endif /* MM_OMRGCAPI_HPP_ */
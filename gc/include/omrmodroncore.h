@@ -79,7 +79,7 @@ typedef U_8 Card;
  */
 #define J9VMSTATE_GC 0x20000
 
-#define OMRVMSTATE_GC_THIS_STATE_CAN_BE_REUSED_0001 (J9VMSTATE_GC | 0x0001)
+#define OMRVMSTATE_GC_CLEAR_MARK_MAP (J9VMSTATE_GC | 0x0001)
 #define OMRVMSTATE_GC_MARK (J9VMSTATE_GC | 0x0002)
 #define OMRVMSTATE_GC_SWEEP (J9VMSTATE_GC | 0x0003)
 #define OMRVMSTATE_GC_COMPACT (J9VMSTATE_GC | 0x0004)
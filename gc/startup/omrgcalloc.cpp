@@ -46,6 +46,21 @@ OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, uintptr_t allocationCategory,
 	return OMR_GC_AllocateObject(omrVMThread, &allocator);
 }
 
+uintptr_t
+OMR_GC_AllocateObjects(OMR_VMThread * omrVMThread, MM_AllocateInitialization *allocator, omrobjectptr_t *objects, uintptr_t count)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	Assert_MM_true(NULL != env->getExtensions()->getGlobalCollector());
+	return allocator->allocateAndInitializeObjects(omrVMThread, objects, count);
+}
+
+uintptr_t
+OMR_GC_AllocateObjects(OMR_VMThread * omrVMThread, uintptr_t allocationCategory, uintptr_t requiredSizeInBytes, uintptr_t allocationFlags, omrobjectptr_t *objects, uintptr_t count)
+{
+	MM_AllocateInitialization allocator(MM_EnvironmentBase::getEnvironment(omrVMThread), allocationCategory, requiredSizeInBytes, allocationFlags);
+	return OMR_GC_AllocateObjects(omrVMThread, &allocator, objects, count);
+}
+
 omr_error_t
 OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode)
 {
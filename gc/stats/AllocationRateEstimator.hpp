@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(ALLOCATIONRATEESTIMATOR_HPP_)
+#define ALLOCATIONRATEESTIMATOR_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+#include "modronbase.h"
+
+#include "Base.hpp"
+
+#define ALLOCATION_RATE_HISTORY_WEIGHT_SHIFT 2 /**< new samples contribute 1/4 of the average rate */
+
+/**
+ * Per-thread estimate of the TLH allocation rate, updated on every TLH refresh.
+ * Each refresh contributes a sample of the bytes consumed from the previous TLH divided by the time elapsed
+ * since the previous refresh, folded into an exponentially weighted average.
+ * @see MM_GCExtensionsBase::tlhAdaptiveSizing
+ * @ingroup GC_Stats
+ */
+class MM_AllocationRateEstimator : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+private:
+	uint64_t _lastSampleTime; /**< hires clock at the previous refresh, 0 if the next refresh only starts a new sampling period */
+	uintptr_t _bytesPerMillisecond; /**< weighted average allocation rate */
+	uintptr_t _refreshCount; /**< total TLH refreshes of the thread */
+	uintptr_t _refreshCountAtLastGC; /**< _refreshCount when the last GC ended */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	/**
+	 * Record a TLH refresh.
+	 * @param portLibrary[in] port library used to read the clock, or NULL to only count the refresh
+	 * @param consumedBytes[in] bytes allocated from the TLH being replaced
+	 */
+	MMINLINE void
+	refreshed(OMRPortLibrary *portLibrary, uintptr_t consumedBytes)
+	{
+		_refreshCount += 1;
+		if (NULL != portLibrary) {
+			OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+			uint64_t now = omrtime_hires_clock();
+			if ((0 != _lastSampleTime) && (0 != consumedBytes)) {
+				uint64_t elapsedMicros = OMR_MAX(omrtime_hires_delta(_lastSampleTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS), 1);
+				uintptr_t sample = (uintptr_t)(((uint64_t)consumedBytes * 1000) / elapsedMicros);
+				if (0 == _bytesPerMillisecond) {
+					_bytesPerMillisecond = sample;
+				} else {
+					_bytesPerMillisecond = _bytesPerMillisecond - (_bytesPerMillisecond >> ALLOCATION_RATE_HISTORY_WEIGHT_SHIFT) + (sample >> ALLOCATION_RATE_HISTORY_WEIGHT_SHIFT);
+				}
+			}
+			_lastSampleTime = now;
+		}
+	}
+
+	/**
+	 * Called for the thread at the end of each GC. The time spent in GC is not attributed to the next sample,
+	 * and the rate of a thread that did not refresh since the previous GC is halved.
+	 * @return true if the thread did not refresh its TLH since the previous GC
+	 */
+	MMINLINE bool
+	gcCompleted()
+	{
+		bool idle = (_refreshCount == _refreshCountAtLastGC);
+		if (idle) {
+			_bytesPerMillisecond >>= 1;
+		}
+		_refreshCountAtLastGC = _refreshCount;
+		_lastSampleTime = 0;
+		return idle;
+	}
+
+	/**
+	 * @return the TLH size that this thread would consume in refreshInterval microseconds at its current allocation rate
+	 */
+	MMINLINE uintptr_t
+	getBytesPerInterval(uintptr_t refreshInterval)
+	{
+		return (uintptr_t)(((uint64_t)_bytesPerMillisecond * refreshInterval) / 1000);
+	}
+
+	MMINLINE uintptr_t getBytesPerMillisecond() { return _bytesPerMillisecond; }
+	MMINLINE uintptr_t getRefreshCount() { return _refreshCount; }
+
+	MM_AllocationRateEstimator()
+		: MM_Base()
+		, _lastSampleTime(0)
+		, _bytesPerMillisecond(0)
+		, _refreshCount(0)
+		, _refreshCountAtLastGC(0)
+	{}
+};
+
+#endif /* ALLOCATIONRATEESTIMATOR_HPP_ */
@@ -36,6 +36,12 @@ MM_AllocationStats::clear()
 	_tlhMaxAbandonedListSize = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	_cacheRefillBatchCount = 0;
+	_cacheRefillSpareCount = 0;
+	_cacheRefillReturnedCount = 0;
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+
 	_arrayletLeafAllocationCount = 0;
 	_arrayletLeafAllocationBytes = 0;
 
@@ -45,6 +51,7 @@ MM_AllocationStats::clear()
 	_discardedBytes = 0;
 	_allocationSearchCount = 0;
 	_allocationSearchCountMax = 0;
+	_allocationSampleCount = 0;
 }
 
 void
@@ -67,6 +74,12 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 	}
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	MM_AtomicOperations::add(&_cacheRefillBatchCount, stats->_cacheRefillBatchCount);
+	MM_AtomicOperations::add(&_cacheRefillSpareCount, stats->_cacheRefillSpareCount);
+	MM_AtomicOperations::add(&_cacheRefillReturnedCount, stats->_cacheRefillReturnedCount);
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+
 	MM_AtomicOperations::add(&_arrayletLeafAllocationCount, stats->_arrayletLeafAllocationCount);
 	MM_AtomicOperations::add(&_arrayletLeafAllocationBytes, stats->_arrayletLeafAllocationBytes);
 
@@ -83,4 +96,5 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 		MM_AtomicOperations::lockCompareExchange(
 			&_allocationSearchCountMax, prevMax, stats->_allocationSearchCountMax);
 	}
+	MM_AtomicOperations::add(&_allocationSampleCount, stats->_allocationSampleCount);
 }
@@ -43,6 +43,12 @@ public:
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	uintptr_t _cacheRefillBatchCount; /**< Number of allocation cache refills that took a batch of cell ranges from a region (-Xgc:allocationCacheRefillBatchCells) */
+	uintptr_t _cacheRefillSpareCount; /**< Number of allocation cache refills from a spare range of an earlier batched refill */
+	uintptr_t _cacheRefillReturnedCount; /**< Number of allocation cache refills from a range returned by an allocation cache at the last GC */
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+
 	uintptr_t _arrayletLeafAllocationCount;	/**< Number of arraylet leaf allocations */
 	uintptr_t _arrayletLeafAllocationBytes; /**< The amount of memory allocated for arraylet leafs */
 
@@ -52,6 +58,7 @@ public:
 	uintptr_t _discardedBytes;
 	uintptr_t _allocationSearchCount;
 	uintptr_t _allocationSearchCountMax;
+	uintptr_t _allocationSampleCount; /**< Number of allocations reported to J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE (-Xgc:allocationSamplingInterval) */
 
 	void clear();
 	void clearOwnableSynchronizer() { _ownableSynchronizerObjectCount = 0; }
@@ -85,6 +92,11 @@ public:
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+		_cacheRefillBatchCount(0),
+		_cacheRefillSpareCount(0),
+		_cacheRefillReturnedCount(0),
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 		_arrayletLeafAllocationCount(0),
 		_arrayletLeafAllocationBytes(0),
 		_allocationCount(0),
@@ -92,7 +104,8 @@ public:
 		_ownableSynchronizerObjectCount(0),
 		_discardedBytes(0),
 		_allocationSearchCount(0),
-		_allocationSearchCountMax(0)
+		_allocationSearchCountMax(0),
+		_allocationSampleCount(0)
 	{}
 };
 
@@ -34,6 +34,7 @@ class MM_CardCleaningStats : public MM_Base
 public:
 	uint64_t _cardCleaningTime; /**< Time spent cleaning cards in hi-res clock resolution. */
 	uintptr_t _cardsCleaned; /**< The number of cards cleaned */
+	uintptr_t _cardSummaryBlocksSkipped; /**< The number of card summary blocks skipped without reading their cards */
 	
 /* Function Members */
 public:
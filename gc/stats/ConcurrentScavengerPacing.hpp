@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(CONCURRENTSCAVENGERPACING_HPP_)
+#define CONCURRENTSCAVENGERPACING_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "Base.hpp"
+#include "Math.hpp"
+
+#define CONCURRENT_SCAVENGER_PACING_WEIGHT 0.7f /**< weight of the history for cycles that finished concurrently */
+#define CONCURRENT_SCAVENGER_PACING_BLOCKED_WEIGHT 0.3f /**< weight of the history for cycles that ended in a blocking final increment */
+#define CONCURRENT_SCAVENGER_PACING_ALLOCATION_MARGIN 1.1f /**< margin applied to predicted allocation, as the survivor tilt does */
+
+/**
+ * Model behind the Concurrent Scavenger pacing controller (concurrentScavengerPacing).
+ * Background threads copy surviving objects while mutators allocate into the same (hybrid allocate/survivor) space.
+ * Copying C bytes with N threads at r bytes per millisecond per thread takes C / (r * N), and mutators allocating a
+ * bytes per millisecond meanwhile consume a * C / (r * N), which must fit in the free space F left after copying.
+ * The model keeps weighted averages of r, a, C and F over cycles, reacting quickly to a cycle that could not finish
+ * concurrently and slowly to one that could, selects the smallest thread count expected to finish in time, and
+ * predicts how much survivor space would have to be reserved for the next cycle to finish concurrently.
+ * @see MM_Scavenger::updateConcurrentPacing()
+ * @ingroup GC_Stats
+ */
+class MM_ConcurrentScavengerPacing : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+private:
+	float _copyRate; /**< weighted average of bytes copied per millisecond by one background thread */
+	float _allocationRate; /**< weighted average of bytes allocated per millisecond by mutators during the concurrent phase */
+	float _copyBytes; /**< weighted average of bytes copied per cycle */
+	float _free; /**< weighted average of free bytes in the hybrid allocate/survivor space at the start of the concurrent phase */
+	float _predictedConcurrentTime; /**< milliseconds the next concurrent phase is expected to take, 0 if no copy rate is known yet */
+	float _predictedAllocationBytes; /**< bytes mutators are expected to allocate during the next concurrent phase */
+	uintptr_t _survivorReserve; /**< survivor bytes the next cycle lacks to finish concurrently */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	static MMINLINE float
+	average(float currentAverage, float newValue, float weight)
+	{
+		/* the first sample is taken as is */
+		return (0.0f == currentAverage) ? newValue : MM_Math::weightedAverage(currentAverage, newValue, weight);
+	}
+
+protected:
+public:
+	/**
+	 * Fold the measurements of a completed cycle into the averages.
+	 * @param bytesScanned[in] bytes scanned by the background threads during the concurrent phase
+	 * @param concurrentMicros[in] time the background threads ran during the concurrent phase
+	 * @param backgroundThreads[in] number of background threads that ran
+	 * @param bytesAllocated[in] bytes allocated by mutators since the concurrent phase started
+	 * @param windowMicros[in] time from the start of the concurrent phase to the final increment
+	 * @param freeAtConcurrentStart[in] free bytes in the hybrid space when the concurrent phase started
+	 * @param bytesCopied[in] bytes copied (flipped and tenured) by the whole cycle
+	 * @param blocked[in] true if the cycle ended in a blocking final increment with scan work left
+	 */
+	MMINLINE void
+	cycleCompleted(uintptr_t bytesScanned, uint64_t concurrentMicros, uintptr_t backgroundThreads, uintptr_t bytesAllocated, uint64_t windowMicros,
+			uintptr_t freeAtConcurrentStart, uintptr_t bytesCopied, bool blocked)
+	{
+		float weight = blocked ? CONCURRENT_SCAVENGER_PACING_BLOCKED_WEIGHT : CONCURRENT_SCAVENGER_PACING_WEIGHT;
+		if ((0 != concurrentMicros) && (0 != bytesScanned)) {
+			float copyRate = ((float)bytesScanned * 1000.0f) / ((float)concurrentMicros * (float)OMR_MAX(backgroundThreads, 1));
+			_copyRate = average(_copyRate, copyRate, weight);
+		}
+		float allocationRate = ((float)bytesAllocated * 1000.0f) / (float)OMR_MAX(windowMicros, 1);
+		_allocationRate = MM_Math::weightedAverage(_allocationRate, allocationRate, weight);
+		_copyBytes = MM_Math::weightedAverage(_copyBytes, (float)bytesCopied, weight);
+		_free = average(_free, (float)freeAtConcurrentStart, weight);
+	}
+
+	/**
+	 * @param maxThreads[in] the number of GC threads available
+	 * @return the smallest number of background threads, up to maxThreads, expected to finish the concurrent phase
+	 * before mutators run out of free space, or maxThreads if no number is
+	 */
+	MMINLINE uintptr_t
+	selectBackgroundThreads(uintptr_t maxThreads)
+	{
+		maxThreads = OMR_MAX(maxThreads, 1);
+		uintptr_t threads = maxThreads;
+		float headroom = _free - _copyBytes;
+		if ((0.0f < headroom) && (0.0f < _copyRate)) {
+			float requiredThreads = CONCURRENT_SCAVENGER_PACING_ALLOCATION_MARGIN * _allocationRate * _copyBytes / (_copyRate * headroom);
+			if (requiredThreads < (float)maxThreads) {
+				threads = OMR_MIN((uintptr_t)requiredThreads + 1, maxThreads);
+			}
+		}
+		return threads;
+	}
+
+	/**
+	 * Predict the next concurrent phase when it runs with the given number of background threads.
+	 * @param threads[in] number of background threads of the next cycle
+	 */
+	MMINLINE void
+	predict(uintptr_t threads)
+	{
+		_predictedConcurrentTime = 0.0f;
+		if (0.0f < _copyRate) {
+			_predictedConcurrentTime = _copyBytes / (_copyRate * (float)OMR_MAX(threads, 1));
+		}
+		_predictedAllocationBytes = _allocationRate * _predictedConcurrentTime;
+		float shortfall = _copyBytes + (CONCURRENT_SCAVENGER_PACING_ALLOCATION_MARGIN * _predictedAllocationBytes) - _free;
+		_survivorReserve = (0.0f < shortfall) ? (uintptr_t)shortfall : 0;
+	}
+
+	MMINLINE uintptr_t getCopyRate() { return (uintptr_t)_copyRate; }
+	MMINLINE uintptr_t getAllocationRate() { return (uintptr_t)_allocationRate; }
+	MMINLINE uintptr_t getCopyBytes() { return (uintptr_t)_copyBytes; }
+	MMINLINE uintptr_t getFree() { return (uintptr_t)_free; }
+	MMINLINE uintptr_t getPredictedConcurrentTime() { return (uintptr_t)_predictedConcurrentTime; }
+	MMINLINE uintptr_t getPredictedAllocationBytes() { return (uintptr_t)_predictedAllocationBytes; }
+	MMINLINE uintptr_t getSurvivorReserve() { return _survivorReserve; }
+
+	MM_ConcurrentScavengerPacing()
+		: MM_Base()
+		, _copyRate(0.0f)
+		, _allocationRate(0.0f)
+		, _copyBytes(0.0f)
+		, _free(0.0f)
+		, _predictedConcurrentTime(0.0f)
+		, _predictedAllocationBytes(0.0f)
+		, _survivorReserve(0)
+	{}
+};
+
+#endif /* CONCURRENTSCAVENGERPACING_HPP_ */
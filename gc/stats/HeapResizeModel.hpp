@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(HEAPRESIZEMODEL_HPP_)
+#define HEAPRESIZEMODEL_HPP_
+
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "Base.hpp"
+
+/**
+ * Reason for the last resize predicted by MM_HeapResizeModel.
+ */
+typedef enum {
+	HEAP_RESIZE_MODEL_NONE = 0, /**< no resize */
+	HEAP_RESIZE_MODEL_GC_RATIO, /**< resize towards the target GC time ratio */
+	HEAP_RESIZE_MODEL_FREE_TOO_LOW, /**< expand to keep the minimum free ratio (-Xminf) */
+	HEAP_RESIZE_MODEL_FREE_TOO_HIGH /**< contract to keep the maximum free ratio (-Xmaxf) */
+} HeapResizeModelReason;
+
+/**
+ * Predictive heap resize policy, selected with MM_GCExtensionsBase::predictiveHeapSizing.
+ *
+ * The time spent in GC and outside GC of each cycle, and the live bytes after each GC, are folded into
+ * exponentially smoothed averages. The GC time ratio is assumed to be inversely proportional to the free
+ * space after GC (GC frequency drops as free space grows, while the cost of each GC follows the live set),
+ * so the free space needed to bring the smoothed ratio to the middle of the contraction/expansion thresholds
+ * is predicted from the current one. The resulting heap size is then bounded by the -Xminf/-Xmaxf free ratios.
+ *
+ * To avoid oscillation under bursty load:
+ *  - no ratio driven resize is predicted while the smoothed ratio is inside the threshold band;
+ *  - contraction is sized from the larger of the current and the smoothed live bytes;
+ *  - a resize is only returned once it has been predicted in the same direction for stabilizationCount
+ *    consecutive cycles (further resizes in that direction follow without delay), except for expansions
+ *    required to keep -Xminf free;
+ *  - resizes smaller than the dead band are ignored.
+ *
+ * The model has no dependencies on the heap so that it can be replayed against verbose GC logs.
+ * @ingroup GC_Stats
+ */
+class MM_HeapResizeModel : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+private:
+	double _gcTime; /**< smoothed time spent in GC per cycle (any unit) */
+	double _mutatorTime; /**< smoothed time spent outside GC per cycle (same unit as _gcTime) */
+	double _liveBytes; /**< smoothed bytes in use after GC */
+	uintptr_t _cycles; /**< number of cycles folded into _gcTime and _mutatorTime */
+	intptr_t _pendingDirection; /**< direction (1 expand, -1 contract) of the predictions being stabilized */
+	uintptr_t _pendingCount; /**< consecutive cycles that predicted _pendingDirection */
+	HeapResizeModelReason _lastReason; /**< reason for the last non zero prediction */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE static double
+	smooth(double average, double sample, double weight, bool first)
+	{
+		return first ? sample : (average + ((sample - average) * weight));
+	}
+
+protected:
+public:
+	/**
+	 * Fold the times of a completed cycle into the model.
+	 * @param gcTime[in] time spent in the GC
+	 * @param mutatorTime[in] time spent outside GC since the previous GC, in the same unit as gcTime
+	 * @param weight[in] weight (0, 1] of the new sample in the smoothed averages
+	 */
+	MMINLINE void
+	recordCycle(uint64_t gcTime, uint64_t mutatorTime, double weight)
+	{
+		bool first = (0 == _cycles);
+		_gcTime = smooth(_gcTime, (double)gcTime, weight, first);
+		_mutatorTime = smooth(_mutatorTime, (double)mutatorTime, weight, first);
+		_cycles += 1;
+	}
+
+	/**
+	 * @return the smoothed percentage of time spent in GC, 0 if no cycle has been recorded
+	 */
+	MMINLINE double
+	getGCPercentage()
+	{
+		double total = _gcTime + _mutatorTime;
+		return ((0 == _cycles) || (0.0 >= total)) ? 0.0 : ((_gcTime * 100.0) / total);
+	}
+
+	/**
+	 * Predict the resize after a GC.
+	 * @param heapSize[in] current heap size
+	 * @param freeBytes[in] free bytes after the GC
+	 * @param weight[in] weight (0, 1] of the live bytes of this GC in the smoothed live bytes
+	 * @param contractThreshold[in] GC time percentage below which the heap should contract
+	 * @param expandThreshold[in] GC time percentage above which the heap should expand
+	 * @param minFreePercent[in] minimum percentage of the heap free after a resize
+	 * @param maxFreePercent[in] maximum percentage of the heap free after a resize (100 to never contract for free space)
+	 * @param stabilizationCount[in] consecutive predictions in the same direction required before resizing
+	 * @param deadBand[in] smallest resize worth returning, in bytes
+	 * @return bytes to expand (positive) or contract (negative) the heap by, 0 for no resize
+	 */
+	intptr_t
+	predictResize(uintptr_t heapSize, uintptr_t freeBytes, double weight, uintptr_t contractThreshold, uintptr_t expandThreshold,
+		uintptr_t minFreePercent, uintptr_t maxFreePercent, uintptr_t stabilizationCount, uintptr_t deadBand)
+	{
+		if ((0 == heapSize) || (freeBytes > heapSize)) {
+			return 0;
+		}
+
+		double liveBytes = (double)(heapSize - freeBytes);
+		_liveBytes = smooth(_liveBytes, liveBytes, weight, (0.0 == _liveBytes));
+
+		/* Ratio driven target: scale free space so that the smoothed GC ratio reaches the middle of the threshold band */
+		double desiredHeap = (double)heapSize;
+		HeapResizeModelReason reason = HEAP_RESIZE_MODEL_NONE;
+		double gcPercentage = getGCPercentage();
+		if ((0.0 < gcPercentage) && ((gcPercentage > (double)expandThreshold) || (gcPercentage < (double)contractThreshold))) {
+			double targetPercentage = (double)(contractThreshold + expandThreshold) / 2.0;
+			double freeForTarget = OMR_MAX((double)freeBytes, 1.0) * (gcPercentage / targetPercentage);
+			desiredHeap = liveBytes + freeForTarget;
+			reason = HEAP_RESIZE_MODEL_GC_RATIO;
+		}
+
+		/* Free space bounds: expansion is sized from the current live bytes, contraction from the larger of current and smoothed */
+		double minHeap = liveBytes / (1.0 - ((double)OMR_MIN(minFreePercent, 99) / 100.0));
+		bool urgent = (minHeap > (double)heapSize);
+		if (desiredHeap < minHeap) {
+			reason = urgent ? HEAP_RESIZE_MODEL_FREE_TOO_LOW : reason;
+			desiredHeap = minHeap;
+		}
+		if (maxFreePercent < 100) {
+			double maxHeap = OMR_MAX(liveBytes, _liveBytes) / (1.0 - ((double)maxFreePercent / 100.0));
+			if (desiredHeap > maxHeap) {
+				reason = (maxHeap < (double)heapSize) ? HEAP_RESIZE_MODEL_FREE_TOO_HIGH : reason;
+				desiredHeap = maxHeap;
+			}
+		}
+		if (desiredHeap < (double)heapSize) {
+			/* never contract below what the smoothed live bytes need to keep -Xminf free */
+			desiredHeap = OMR_MAX(desiredHeap, _liveBytes / (1.0 - ((double)OMR_MIN(minFreePercent, 99) / 100.0)));
+		}
+
+		intptr_t resize = (intptr_t)(desiredHeap - (double)heapSize);
+		uintptr_t magnitude = (uintptr_t)((0 > resize) ? -resize : resize);
+		intptr_t direction = 0;
+		if ((magnitude >= deadBand) && (0 != magnitude)) {
+			direction = (0 > resize) ? -1 : 1;
+		}
+
+		/* Hysteresis: require consecutive predictions in the same direction */
+		if (direction == _pendingDirection) {
+			_pendingCount += 1;
+		} else {
+			_pendingDirection = direction;
+			_pendingCount = 1;
+		}
+
+		if ((0 == direction) || (!urgent && (_pendingCount < stabilizationCount))) {
+			_lastReason = HEAP_RESIZE_MODEL_NONE;
+			return 0;
+		}
+
+		_lastReason = reason;
+		return resize;
+	}
+
+	MMINLINE HeapResizeModelReason getLastReason() { return _lastReason; }
+	MMINLINE double getLiveBytes() { return _liveBytes; }
+	MMINLINE uintptr_t getCycles() { return _cycles; }
+
+	MM_HeapResizeModel()
+		: MM_Base()
+		, _gcTime(0.0)
+		, _mutatorTime(0.0)
+		, _liveBytes(0.0)
+		, _cycles(0)
+		, _pendingDirection(0)
+		, _pendingCount(0)
+		, _lastReason(HEAP_RESIZE_MODEL_NONE)
+	{}
+};
+
+#endif /* HEAPRESIZEMODEL_HPP_ */
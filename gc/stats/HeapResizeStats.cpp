@@ -57,6 +57,9 @@ MM_HeapResizeStats::calculateGCPercentage()
 	return percentage;
 }
 
+/**
+ * Update the GC ratio history with the times of the AF that just ended.
+ */
 void
 MM_HeapResizeStats::updateHeapResizeStats()
 {
@@ -89,3 +92,17 @@ MM_HeapResizeStats::updateHeapResizeStats()
 		updateRatioTicks(timeInGC, timeOutsideGC);
 	}			
 }	
+
+/**
+ * Update the GC ratio history with the times of the AF that just ended, and fold them into the predictive resize model.
+ * @param resizeModelWeight weight of this AF in the smoothed history of the predictive resize model
+ */
+void
+MM_HeapResizeStats::updateHeapResizeStats(double resizeModelWeight)
+{
+	updateHeapResizeStats();
+	/* the time outside GC of the first AF is measured from the start of the clock rather than from the end of a previous AF */
+	if (_lastAFEndTime && (0 != _ticksOutsideGC[RATIO_RESIZE_HISTORIES-2])) {
+		_resizeModel.recordCycle(_ticksInGC[RATIO_RESIZE_HISTORIES-1], _ticksOutsideGC[RATIO_RESIZE_HISTORIES-1], resizeModelWeight);
+	}
+}
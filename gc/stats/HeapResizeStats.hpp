@@ -28,6 +28,7 @@
 
 #include "Base.hpp"
 #include "Debug.hpp"
+#include "HeapResizeModel.hpp"
 
 #define RATIO_RESIZE_HISTORIES				3
 
@@ -70,6 +71,8 @@ private:
 	uint64_t 				_ticksInGC[RATIO_RESIZE_HISTORIES];
 	uint64_t 				_ticksOutsideGC[RATIO_RESIZE_HISTORIES];
 
+	MM_HeapResizeModel		_resizeModel; /**< smoothed GC time and live bytes history used by the predictive resize policy */
+
 protected:
 public:
 
@@ -83,6 +86,7 @@ public:
 	uint32_t	calculateGCPercentage();
 
 	void	updateHeapResizeStats();
+	void	updateHeapResizeStats(double resizeModelWeight);
 
 	MMINLINE void 	resetRatioTicks()
 	{
@@ -108,6 +112,8 @@ public:
 		_ticksOutsideGC[RATIO_RESIZE_HISTORIES-1] = timeOutsideGC;	
 	}
 	
+	MMINLINE MM_HeapResizeModel *getResizeModel() { return &_resizeModel; }
+
 	MMINLINE void	setLastAFEndTime(uint64_t time) { _lastAFEndTime = time; }
 	MMINLINE uint64_t	getLastAFEndTime() { return _lastAFEndTime; }
 	
@@ -190,7 +196,8 @@ public:
 		_lastContractTime(0),
 		_lastGCPercentage(0),
 		_lastTimeOutsideGC(0),
-		_globalGCCountAtAF(0)
+		_globalGCCountAtAF(0),
+		_resizeModel()
 	{
 		resetRatioTicks();
 	}
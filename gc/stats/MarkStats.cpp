@@ -35,6 +35,13 @@ MM_MarkStats::clear()
 	_objectsMarked = 0;
 	_objectsScanned = 0;
 	_bytesScanned = 0;
+	_prefetchFullDepth = 0;
+	_prefetchShortDepth = 0;
+
+	_clearMarkMapBytes = 0;
+	_clearMarkMapConcurrentBytes = 0;
+	_clearMarkMapStartTime = 0;
+	_clearMarkMapEndTime = 0;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	_syncStallCount = 0;
@@ -50,6 +57,8 @@ MM_MarkStats::merge(MM_MarkStats *statsToMerge)
 	_objectsMarked += statsToMerge->_objectsMarked;
 	_objectsScanned += statsToMerge->_objectsScanned;
 	_bytesScanned += statsToMerge->_bytesScanned;
+	_prefetchFullDepth += statsToMerge->_prefetchFullDepth;
+	_prefetchShortDepth += statsToMerge->_prefetchShortDepth;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/* It may not ever be useful to merge these stats, but do it anyways */
@@ -48,6 +48,8 @@ public:
 	uintptr_t _objectsMarked;  /**< The number of objects found through scanning during marking */
 	uintptr_t _objectsScanned;  /**< The number of objects popped and scanned during marking (e.g., non-base type arrays) */
 	uintptr_t _bytesScanned; /**< The number of bytes scanned by the owning thread (or globally) during marking */
+	uintptr_t _prefetchFullDepth; /**< The number of objects scanned while the prefetch FIFO was full, i.e. prefetched a full FIFO depth ahead (see GCExtensionsBase::markingPrefetchDepth). Says nothing about cache hits */
+	uintptr_t _prefetchShortDepth; /**< The number of objects scanned with a partially filled or empty prefetch FIFO, i.e. with less lead time, when prefetching is enabled */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t _syncStallCount; /**< The number of times the thread stalled at a sync point */
@@ -57,6 +59,11 @@ public:
 	uint64_t _startTime;	/**< Mark start time */
 	uint64_t _endTime;		/**< Mark end time */
 
+	uintptr_t _clearMarkMapBytes; /**< Mark map bytes cleared by the parallel mark map clearing task (see GCExtensionsBase::parallelClearMarkMap) */
+	uintptr_t _clearMarkMapConcurrentBytes; /**< Mark map bytes cleared by mutators since the previous collection (see GCExtensionsBase::concurrentClearMarkMap) */
+	uint64_t _clearMarkMapStartTime; /**< Parallel mark map clearing start time, 0 if the mark task cleared the mark map itself */
+	uint64_t _clearMarkMapEndTime; /**< Parallel mark map clearing end time */
+
 /* function members */
 private:
 protected:
@@ -108,8 +115,14 @@ public:
 		,_objectsMarked(0)
 		,_objectsScanned(0)
 		,_bytesScanned(0)
+		,_prefetchFullDepth(0)
+		,_prefetchShortDepth(0)
 		,_startTime(0)
 		,_endTime(0)
+		,_clearMarkMapBytes(0)
+		,_clearMarkMapConcurrentBytes(0)
+		,_clearMarkMapStartTime(0)
+		,_clearMarkMapEndTime(0)
 	{
 		clear();
 	}
@@ -51,6 +51,9 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_acquireFreeListCount(0)
 	,_releaseFreeListCount(0)
 	,_acquireScanListCount(0)
+	,_dequeScanCacheCount(0)
+	,_spillScanCacheCount(0)
+	,_stealScanCacheCount(0)
 	,_acquireListLockCount(0)
 	,_aliasToCopyCacheCount(0)
 	,_arraySplitCount(0)
@@ -64,6 +67,8 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_totalDeepStructures(0)
 	,_totalObjsDeepScanned(0)
 	,_depthDeepestStructure(0)
+	,_hotFieldCopyCount(0)
+	,_hotFieldCacheMissCount(0)
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	,_avgInitialFree(0)
 	,_avgTenureBytes(0)
@@ -93,6 +98,14 @@ MM_ScavengerStats::MM_ScavengerStats()
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	,_readObjectBarrierCopy(0)
 	,_readObjectBarrierUpdate(0)
+	,_pacingBlocked(false)
+	,_pacingCopyRate(0)
+	,_pacingAllocationRate(0)
+	,_pacingPredictedCopyBytes(0)
+	,_pacingPredictedConcurrentTime(0)
+	,_pacingPredictedAllocationBytes(0)
+	,_pacingBackgroundThreads(0)
+	,_pacingSurvivorReserve(0)
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	,_flipHistoryNewIndex(0)
 {
@@ -158,6 +171,9 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_acquireFreeListCount = 0;
 	_releaseFreeListCount = 0;
 	_acquireScanListCount = 0;
+	_dequeScanCacheCount = 0;
+	_spillScanCacheCount = 0;
+	_stealScanCacheCount = 0;
 	_acquireListLockCount = 0;
 	_aliasToCopyCacheCount = 0;
 	_workStallCount = 0;
@@ -169,6 +185,8 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_totalDeepStructures = 0;
 	_totalObjsDeepScanned = 0;
 	_depthDeepestStructure = 0;
+	_hotFieldCopyCount = 0;
+	_hotFieldCacheMissCount = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	/* NOTE: _startTime and _endTime are also not cleared
 	 * as they are recorded before/after all stat clearing/gathering.
@@ -194,6 +212,14 @@ MM_ScavengerStats::clear(bool firstIncrement)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	_readObjectBarrierCopy = 0;
 	_readObjectBarrierUpdate = 0;
+	_pacingBlocked = false;
+	_pacingCopyRate = 0;
+	_pacingAllocationRate = 0;
+	_pacingPredictedCopyBytes = 0;
+	_pacingPredictedConcurrentTime = 0;
+	_pacingPredictedAllocationBytes = 0;
+	_pacingBackgroundThreads = 0;
+	_pacingSurvivorReserve = 0;
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 	_leafObjectCount = 0;
@@ -82,6 +82,9 @@ public:
 	uintptr_t _acquireFreeListCount;
 	uintptr_t _releaseFreeListCount;
 	uintptr_t _acquireScanListCount;
+	uintptr_t _dequeScanCacheCount; /**< number of scan caches pushed to the thread's own work-stealing deque */
+	uintptr_t _spillScanCacheCount; /**< number of scan caches pushed to the shared scan list because the thread's work-stealing deque was full */
+	uintptr_t _stealScanCacheCount; /**< number of scan caches taken from the work-stealing deque of another thread */
 	uintptr_t _acquireListLockCount;  /**< cumulative (for scan&free list) lock count. if this number is much larger than cumulative acquire list count, it indicates over-splitting */
 	uintptr_t _aliasToCopyCacheCount;
 	uintptr_t _arraySplitCount;
@@ -95,6 +98,8 @@ public:
 	uintptr_t _totalDeepStructures; /**<  The number of deep structures that are scanned with priority (number of deepScanOutline function calls) */
 	uintptr_t _totalObjsDeepScanned; /**< The total number of deep structure objects that are special treated (number of copyAndForward with priority)*/
 	uintptr_t _depthDeepestStructure; /**< Length of longest deep structure that is special treated */
+	uintptr_t _hotFieldCopyCount; /**< The number of hot field referents copied right behind their parent */
+	uintptr_t _hotFieldCacheMissCount; /**< The number of hot field references of copied objects that do not point into the cache line following the parent, an estimate of the cache misses taken by a mutator traversing them */
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	/* Average (weighted) number of bytes free after a collection and
@@ -142,6 +147,14 @@ public:
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	uint64_t _readObjectBarrierCopy; /**< Number of objects copied by read barrier */
 	uint64_t _readObjectBarrierUpdate; /**< Number of reference slots updates, which may be (often is) preceded by object copy */ 
+	bool _pacingBlocked; /**< True if the concurrent phase of this cycle was cut short because mutators ran out of allocation space */
+	uintptr_t _pacingCopyRate; /**< Average bytes copied per millisecond by one background thread in the concurrent phase */
+	uintptr_t _pacingAllocationRate; /**< Average bytes allocated per millisecond by mutators during the concurrent phase */
+	uintptr_t _pacingPredictedCopyBytes; /**< Bytes expected to be copied in the concurrent phase of the next cycle */
+	uintptr_t _pacingPredictedConcurrentTime; /**< Expected duration, in milliseconds, of the concurrent phase of the next cycle */
+	uintptr_t _pacingPredictedAllocationBytes; /**< Bytes mutators are expected to allocate during the concurrent phase of the next cycle */
+	uintptr_t _pacingBackgroundThreads; /**< Number of background threads selected for the concurrent phase of the next cycle */
+	uintptr_t _pacingSurvivorReserve; /**< Survivor bytes added to the tilt so that the next cycle starts early enough to finish concurrently */
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 protected:
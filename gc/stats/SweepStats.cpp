@@ -35,6 +35,8 @@
 void
 MM_SweepStats::clear()
 {
+	_objectStartsRecorded = 0;
+
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	sweepHeapBytesTotal = 0;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
@@ -49,6 +51,8 @@ MM_SweepStats::clear()
 void
 MM_SweepStats::merge(MM_SweepStats *statsToMerge)
 {
+	_objectStartsRecorded += statsToMerge->_objectStartsRecorded;
+
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	sweepHeapBytesTotal += statsToMerge->sweepHeapBytesTotal;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
@@ -39,6 +39,7 @@ class MM_SweepStats : public MM_Base
 {
 public:
 	uintptr_t _gcCount; /**< The GC cycle in which these stats were collected */
+	uintptr_t _objectStartsRecorded; /**< Objects recorded in the object start index (-Xgc:objectStartIndex) */
 	
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	uintptr_t sweepHeapBytesTotal;  /**< Number of heap bytes processed during the sweep phase */
@@ -37,6 +37,10 @@
 #include "ModronAssertions.h"
 #include "SublistFragment.hpp"
 #include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
+
+/* A deduplication bitmap may always use this much memory, or as much as the puddles themselves if that is larger */
+#define SUBLIST_DEDUPLICATE_MINIMUM_BITMAP_BYTES (1024 * 1024)
 
 /**
  * Initialize the sublist pool default values and internal structure.
@@ -67,6 +71,12 @@ MM_SublistPool::tearDown(MM_EnvironmentBase *env)
 	/* Free all puddles associated to the sublist */
 	freePuddles(env, _list);
 	freePuddles(env, _previousList);
+
+	if (NULL != _deduplicateBitmap) {
+		env->getForge()->free(_deduplicateBitmap);
+		_deduplicateBitmap = NULL;
+		_deduplicateBitmapSize = 0;
+	}
 }
 
 void
@@ -263,13 +273,84 @@ MM_SublistPool::allocateElementNoContention(MM_EnvironmentBase *env)
 	return element;
 }
  
+/**
+ * Remove NULL and duplicate entries from all puddles on the list.
+ * Entries are treated as object addresses: a bitmap with one bit per object alignment unit between the lowest
+ * and the highest entry records the entries seen so far. If the entries are spread so sparsely that the bitmap
+ * would be larger than the puddles (and larger than SUBLIST_DEDUPLICATE_MINIMUM_BITMAP_BYTES), only the NULL
+ * entries are removed. The bitmap is kept for the next compaction, and only reallocated when it has to grow.
+ *
+ * @note assumes an exclusive use scenario, does not lock any structures/access.
+ */
+void
+MM_SublistPool::deduplicate(MM_EnvironmentBase *env)
+{
+	uintptr_t lowEntry = UDATA_MAX;
+	uintptr_t highEntry = 0;
+	uintptr_t *slot = NULL;
+
+	for (MM_SublistPuddle *puddle = _list; NULL != puddle; puddle = puddle->getNext()) {
+		for (slot = puddle->_listBase; slot < puddle->_listCurrent; slot++) {
+			if (0 != *slot) {
+				lowEntry = OMR_MIN(lowEntry, *slot);
+				highEntry = OMR_MAX(highEntry, *slot);
+			}
+		}
+	}
+
+	uint8_t *bitmap = NULL;
+	uintptr_t shift = 0;
+	if (lowEntry <= highEntry) {
+		uintptr_t alignment = env->getExtensions()->getObjectAlignmentInBytes();
+		while (((uintptr_t)1 << (shift + 1)) <= alignment) {
+			shift += 1;
+		}
+		uintptr_t bitmapBytes = (((highEntry - lowEntry) >> shift) / 8) + 1;
+		if (bitmapBytes <= OMR_MAX(_currentSize, (uintptr_t)SUBLIST_DEDUPLICATE_MINIMUM_BITMAP_BYTES)) {
+			if (bitmapBytes > _deduplicateBitmapSize) {
+				if (NULL != _deduplicateBitmap) {
+					env->getForge()->free(_deduplicateBitmap);
+				}
+				_deduplicateBitmap = (uint8_t *)env->getForge()->allocate(bitmapBytes, _allocCategory, OMR_GET_CALLSITE());
+				_deduplicateBitmapSize = (NULL != _deduplicateBitmap) ? bitmapBytes : 0;
+			}
+			if (NULL != _deduplicateBitmap) {
+				bitmap = _deduplicateBitmap;
+				memset(bitmap, 0, bitmapBytes);
+			}
+		}
+	}
+
+	for (MM_SublistPuddle *puddle = _list; NULL != puddle; puddle = puddle->getNext()) {
+		GC_SublistSlotIterator slotIterator(puddle);
+		while (NULL != (slot = (uintptr_t *)slotIterator.nextSlot())) {
+			if (0 == *slot) {
+				slotIterator.removeSlot();
+			} else if (NULL != bitmap) {
+				uintptr_t bitIndex = (*slot - lowEntry) >> shift;
+				uint8_t bit = (uint8_t)(1 << (bitIndex & 7));
+				if (0 != (bitmap[bitIndex >> 3] & bit)) {
+					/* the same entry is already held by this or an earlier slot */
+					slotIterator.removeSlot();
+				} else {
+					bitmap[bitIndex >> 3] |= bit;
+				}
+			}
+		}
+	}
+}
+
 void
-MM_SublistPool::compact(MM_EnvironmentBase *env)
+MM_SublistPool::compact(MM_EnvironmentBase *env, bool deduplicate)
 {
 	MM_SublistPuddle *currentPuddle, *nextPuddle;
 	MM_SublistPuddle *sourcePuddle, *destinationPuddle;
 	MM_SublistPuddle *lastPuddle = NULL;
 
+	if (deduplicate) {
+		this->deduplicate(env);
+	}
+
 	/* Use the list of puddles to iterate through and reset the list pointer to NULL
 	 * as we will add puddles back
 	 */
@@ -452,3 +533,96 @@ MM_SublistPool::popPreviousPuddle(MM_SublistPuddle * returnedPuddle)
 	
 	return result;
 }
+
+void
+MM_SublistPool::startProcessingSlotRanges(uintptr_t rangeSize)
+{
+	Assert_MM_true(0 < rangeSize);
+
+	uintptr_t rangeCount = 0;
+	for (MM_SublistPuddle *puddle = _previousList; NULL != puddle; puddle = puddle->getNext()) {
+		uintptr_t slotCount = puddle->consumedSize() / sizeof(uintptr_t);
+		rangeCount += (slotCount + rangeSize - 1) / rangeSize;
+	}
+
+	_rangeSize = rangeSize;
+	_rangeCount = rangeCount;
+	_rangeNext = 0;
+	_rangeDone = 0;
+
+	if (0 == rangeCount) {
+		/* nothing will be claimed, so nobody would complete the last range */
+		returnPreviousPuddles();
+	}
+}
+
+uintptr_t *
+MM_SublistPool::popPreviousSlotRange(MM_SublistPuddle **puddle, uintptr_t *puddleFirstRange, uintptr_t **rangeTop)
+{
+	if (_rangeNext >= _rangeCount) {
+		return NULL;
+	}
+	uintptr_t rangeIndex = MM_AtomicOperations::add(&_rangeNext, 1) - 1;
+	if (rangeIndex >= _rangeCount) {
+		return NULL;
+	}
+
+	/* ranges are claimed in increasing order, so the cursor of a thread only ever moves forward */
+	MM_SublistPuddle *current = *puddle;
+	uintptr_t firstRange = *puddleFirstRange;
+	if (NULL == current) {
+		current = _previousList;
+		firstRange = 0;
+	}
+	uintptr_t slotCount = current->consumedSize() / sizeof(uintptr_t);
+	uintptr_t puddleRanges = (slotCount + _rangeSize - 1) / _rangeSize;
+	while (rangeIndex >= (firstRange + puddleRanges)) {
+		firstRange += puddleRanges;
+		current = current->getNext();
+		Assert_MM_true(NULL != current);
+		slotCount = current->consumedSize() / sizeof(uintptr_t);
+		puddleRanges = (slotCount + _rangeSize - 1) / _rangeSize;
+	}
+
+	*puddle = current;
+	*puddleFirstRange = firstRange;
+
+	uintptr_t *rangeBase = current->_listBase + ((rangeIndex - firstRange) * _rangeSize);
+	*rangeTop = OMR_MIN(rangeBase + _rangeSize, current->_listCurrent);
+	return rangeBase;
+}
+
+void
+MM_SublistPool::completePreviousSlotRange()
+{
+	if (_rangeCount == MM_AtomicOperations::add(&_rangeDone, 1)) {
+		returnPreviousPuddles();
+	}
+}
+
+/**
+ * Return all puddles remaining on the previous list to the list of used puddles.
+ */
+void
+MM_SublistPool::returnPreviousPuddles()
+{
+	omrthread_monitor_enter(_mutex);
+
+	MM_SublistPuddle *head = _previousList;
+	if (NULL != head) {
+		MM_SublistPuddle *tail = head;
+		while (NULL != tail->getNext()) {
+			tail = tail->getNext();
+		}
+		tail->setNext(_list);
+		_list = head;
+		_previousList = NULL;
+
+		/* as in popPreviousPuddle(), a non-empty list must have an _allocPuddle */
+		if (NULL == _allocPuddle) {
+			_allocPuddle = tail;
+		}
+	}
+
+	omrthread_monitor_exit(_mutex);
+}
@@ -65,6 +65,14 @@ private:
 	OMR::GC::AllocationCategory::Enum _allocCategory;
 	
 	MM_SublistPuddle *_previousList; /**< A list of the non-empty puddles when #startProcessingSublist() was called */
+
+	uintptr_t _rangeSize; /**< Number of slots in each range handed out by #popPreviousSlotRange() */
+	uintptr_t _rangeCount; /**< Total number of slot ranges across the puddles on _previousList */
+	volatile uintptr_t _rangeNext; /**< Index of the next slot range to be claimed */
+	volatile uintptr_t _rangeDone; /**< Number of claimed slot ranges that have been fully processed */
+
+	uint8_t *_deduplicateBitmap; /**< Bitmap used by #deduplicate(), kept between compactions and grown as needed */
+	uintptr_t _deduplicateBitmapSize; /**< Size in bytes of _deduplicateBitmap */
 	
 protected:
 public:
@@ -75,6 +83,8 @@ public:
 private:
 	MM_SublistPuddle *createNewPuddle(MM_EnvironmentBase *env);
 	void freePuddles(MM_EnvironmentBase *env, MM_SublistPuddle *list);
+	void returnPreviousPuddles();
+	void deduplicate(MM_EnvironmentBase *env);
 
 protected:
 public:
@@ -107,7 +117,12 @@ public:
 	bool allocate(MM_EnvironmentBase *env, MM_SublistFragment *fragment);
 	uintptr_t *allocateElementNoContention(MM_EnvironmentBase *env);
 
-	void compact(MM_EnvironmentBase *env);
+	/**
+	 * Merge partially filled puddles and free the empty ones.
+	 * @param env[in] the current thread
+	 * @param deduplicate[in] if true, first remove NULL and duplicate entries (entries are expected to be object addresses)
+	 */
+	void compact(MM_EnvironmentBase *env, bool deduplicate = false);
 	void clear(MM_EnvironmentBase *env);
 	
 	/**
@@ -125,6 +140,35 @@ public:
 	 * @return a puddle to process, or NULL if the list is empty
 	 */
 	MM_SublistPuddle *popPreviousPuddle(MM_SublistPuddle * returnedPuddle);
+
+	/**
+	 * Divide the puddles which were active when #startProcessingSublist() was called into ranges of
+	 * rangeSize slots, to be claimed with #popPreviousSlotRange() instead of #popPreviousPuddle().
+	 * Ranges never cross puddles, so one large puddle is shared between all the threads processing it.
+	 * Must be called by a single thread after #startProcessingSublist().
+	 *
+	 * @param rangeSize[in] number of slots in each range
+	 */
+	void startProcessingSlotRanges(uintptr_t rangeSize);
+
+	/**
+	 * Atomically claim the next unprocessed slot range. The caller must process every slot in
+	 * [returned slot, *rangeTop) and then call #completePreviousSlotRange(). Slots must not be removed
+	 * while ranges are being processed since other threads may own neighbouring ranges; NULL slots are
+	 * left for a later pass.
+	 *
+	 * @param puddle[in/out] cursor of the calling thread, NULL on the first call
+	 * @param puddleFirstRange[in/out] index of the first range of *puddle, 0 on the first call
+	 * @param rangeTop[out] end (exclusive) of the claimed range
+	 * @return the first slot of the claimed range, or NULL if all ranges have been claimed
+	 */
+	uintptr_t *popPreviousSlotRange(MM_SublistPuddle **puddle, uintptr_t *puddleFirstRange, uintptr_t **rangeTop);
+
+	/**
+	 * Report that a range returned by #popPreviousSlotRange() has been processed. The thread completing
+	 * the last range returns all the previous puddles to the list.
+	 */
+	void completePreviousSlotRange();
 	
 	MM_SublistPool() 
 		: _list(NULL)
@@ -136,6 +180,12 @@ public:
 		, _count(0)
 		, _allocCategory(OMR::GC::AllocationCategory::OTHER)
 		, _previousList(NULL)
+		, _rangeSize(0)
+		, _rangeCount(0)
+		, _rangeNext(0)
+		, _rangeDone(0)
+		, _deduplicateBitmap(NULL)
+		, _deduplicateBitmapSize(0)
 	{}
 
 	friend class GC_SublistIterator;
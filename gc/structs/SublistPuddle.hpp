@@ -96,6 +96,7 @@ public:
 
 	MM_SublistPuddle() {}
 
+	friend class MM_SublistPool;
 	friend class GC_SublistIterator;
 	friend class GC_SublistSlotIterator;
 };
@@ -0,0 +1,336 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "VerboseBinaryFormat.hpp"
+
+#include <string.h>
+
+/* longest conversion kept, e.g. "%-020.10llu" */
+#define VERBOSE_BINARY_FORMAT_MAXIMUM_CONVERSION_LENGTH 32
+/* matches the spacer of MM_VerboseWriterChain */
+#define VERBOSE_BINARY_FORMAT_INDENT_SPACER "  "
+#define VERBOSE_BINARY_FORMAT_INDENT_SPACER_LENGTH 2
+
+/* How the argument of a conversion is read and encoded; the same as omrstr_vprintf() reads it */
+typedef enum {
+	ARGUMENT_NONE = 0, /**< "%%" */
+	ARGUMENT_U32,
+	ARGUMENT_U64,
+	ARGUMENT_DOUBLE,
+	ARGUMENT_POINTER,
+	ARGUMENT_STRING,
+	ARGUMENT_UNSUPPORTED
+} ArgumentType;
+
+typedef union Argument {
+	uint64_t u64;
+	double dbl;
+	const char *string;
+} Argument;
+
+/**
+ * Find the next conversion of a format.
+ * @param format[in] the rest of the format
+ * @param conversion[out] the start of the conversion, or the end of the format if there is none
+ * @param type[out] how the argument of the conversion is encoded
+ * @return the rest of the format after the conversion
+ */
+static const char *
+nextConversion(const char *format, const char **conversion, ArgumentType *type)
+{
+	const char *cursor = strchr(format, '%');
+	if (NULL == cursor) {
+		*conversion = format + strlen(format);
+		*type = ARGUMENT_NONE;
+		return *conversion;
+	}
+	*conversion = cursor;
+	cursor += 1;
+	if ('%' == *cursor) {
+		*type = ARGUMENT_NONE;
+		return cursor + 1;
+	}
+
+	/* one flag, a width and a precision; '*' and positional arguments are not supported */
+	if (('\0' != *cursor) && (NULL != strchr("0 -+#", *cursor))) {
+		cursor += 1;
+	}
+	while (('0' <= *cursor) && ('9' >= *cursor)) {
+		cursor += 1;
+	}
+	if ('.' == *cursor) {
+		cursor += 1;
+		while (('0' <= *cursor) && ('9' >= *cursor)) {
+			cursor += 1;
+		}
+	}
+
+	bool is64Bit = false;
+	if ('z' == *cursor) {
+#if defined(OMR_ENV_DATA64)
+		is64Bit = true;
+#endif /* defined(OMR_ENV_DATA64) */
+		cursor += 1;
+	} else if ('l' == *cursor) {
+		cursor += 1;
+		if ('l' == *cursor) {
+			is64Bit = true;
+			cursor += 1;
+		}
+	}
+
+	switch (*cursor) {
+	case 'c':
+		*type = ARGUMENT_U32;
+		break;
+	case 'i':
+	case 'd':
+	case 'u':
+	case 'x':
+	case 'X':
+		*type = is64Bit ? ARGUMENT_U64 : ARGUMENT_U32;
+		break;
+	case 'p':
+		*type = ARGUMENT_POINTER;
+		break;
+	case 's':
+		*type = ARGUMENT_STRING;
+		break;
+	case 'f':
+	case 'e':
+	case 'E':
+	case 'F':
+	case 'g':
+	case 'G':
+		*type = ARGUMENT_DOUBLE;
+		break;
+	default:
+		*type = ARGUMENT_UNSUPPORTED;
+		return cursor;
+	}
+	cursor += 1;
+
+	if ((uintptr_t)(cursor - *conversion) >= VERBOSE_BINARY_FORMAT_MAXIMUM_CONVERSION_LENGTH) {
+		*type = ARGUMENT_UNSUPPORTED;
+	}
+	return cursor;
+}
+
+/**
+ * Read the next argument of the given type.
+ */
+static void
+readArgument(ArgumentType type, va_list *args, Argument *argument)
+{
+	switch (type) {
+	case ARGUMENT_U32:
+		argument->u64 = va_arg(*args, uint32_t);
+		break;
+	case ARGUMENT_U64:
+		argument->u64 = va_arg(*args, uint64_t);
+		break;
+	case ARGUMENT_DOUBLE:
+		argument->dbl = va_arg(*args, double);
+		break;
+	case ARGUMENT_POINTER:
+		argument->u64 = (uint64_t)(uintptr_t)va_arg(*args, void *);
+		break;
+	case ARGUMENT_STRING:
+		argument->string = va_arg(*args, const char *);
+		break;
+	default:
+		break;
+	}
+}
+
+uintptr_t
+MM_VerboseBinaryFormat::getEncodedArgumentsLength(const char *format, va_list args)
+{
+	uintptr_t length = 0;
+	va_list argsCopy;
+
+	COPY_VA_LIST(argsCopy, args);
+	while ('\0' != *format) {
+		const char *conversion = NULL;
+		ArgumentType type = ARGUMENT_NONE;
+		format = nextConversion(format, &conversion, &type);
+		if (ARGUMENT_UNSUPPORTED == type) {
+			length = UDATA_MAX;
+			break;
+		}
+		if (ARGUMENT_NONE != type) {
+			Argument argument;
+			readArgument(type, &argsCopy, &argument);
+			if (ARGUMENT_STRING == type) {
+				length += sizeof(uint32_t) + ((NULL == argument.string) ? 0 : (strlen(argument.string) + 1));
+			} else {
+				length += sizeof(uint64_t);
+			}
+		}
+	}
+	END_VA_LIST_COPY(argsCopy);
+
+	return length;
+}
+
+void
+MM_VerboseBinaryFormat::encodeArguments(const char *format, va_list args, uint8_t *buffer)
+{
+	va_list argsCopy;
+
+	COPY_VA_LIST(argsCopy, args);
+	while ('\0' != *format) {
+		const char *conversion = NULL;
+		ArgumentType type = ARGUMENT_NONE;
+		format = nextConversion(format, &conversion, &type);
+		if (ARGUMENT_NONE != type) {
+			Argument argument;
+			readArgument(type, &argsCopy, &argument);
+			if (ARGUMENT_STRING == type) {
+				uint32_t stringLength = (NULL == argument.string) ? 0 : (uint32_t)(strlen(argument.string) + 1);
+				memcpy(buffer, &stringLength, sizeof(stringLength));
+				buffer += sizeof(stringLength);
+				memcpy(buffer, argument.string, stringLength);
+				buffer += stringLength;
+			} else {
+				memcpy(buffer, &argument, sizeof(uint64_t));
+				buffer += sizeof(uint64_t);
+			}
+		}
+	}
+	END_VA_LIST_COPY(argsCopy);
+}
+
+/**
+ * Format one argument with omrstr_printf().
+ * @return the length of the text, counting the terminating NUL if buffer is NULL, as omrstr_printf() does
+ */
+static uintptr_t
+printArgument(OMRPortLibrary *portLibrary, char *buffer, uintptr_t bufferSize, const char *conversion, ArgumentType type, Argument *argument)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uintptr_t length = 0;
+
+	switch (type) {
+	case ARGUMENT_U32:
+		length = omrstr_printf(buffer, bufferSize, conversion, (uint32_t)argument->u64);
+		break;
+	case ARGUMENT_U64:
+		length = omrstr_printf(buffer, bufferSize, conversion, argument->u64);
+		break;
+	case ARGUMENT_DOUBLE:
+		length = omrstr_printf(buffer, bufferSize, conversion, argument->dbl);
+		break;
+	case ARGUMENT_POINTER:
+		length = omrstr_printf(buffer, bufferSize, conversion, (void *)(uintptr_t)argument->u64);
+		break;
+	case ARGUMENT_STRING:
+		length = omrstr_printf(buffer, bufferSize, conversion, argument->string);
+		break;
+	default:
+		break;
+	}
+	return length;
+}
+
+/**
+ * Append text to a line, unless the line was already truncated.
+ * @return the new length of the line
+ */
+static uintptr_t
+appendText(char *buffer, uintptr_t bufferSize, uintptr_t length, bool *truncated, const char *text, uintptr_t textLength)
+{
+	if ((NULL != buffer) && !*truncated) {
+		if ((length + textLength) < bufferSize) {
+			memcpy(buffer + length, text, textLength);
+		} else {
+			*truncated = true;
+		}
+	}
+	return length + textLength;
+}
+
+uintptr_t
+MM_VerboseBinaryFormat::formatLine(OMRPortLibrary *portLibrary, char *buffer, uintptr_t bufferSize, uintptr_t indent, const char *format, const uint8_t *arguments, uintptr_t argumentsLength)
+{
+	const uint8_t *argumentsEnd = arguments + argumentsLength;
+	bool truncated = (0 == bufferSize);
+	uintptr_t length = 0;
+
+	for (uintptr_t i = 0; i < indent; ++i) {
+		length = appendText(buffer, bufferSize, length, &truncated, VERBOSE_BINARY_FORMAT_INDENT_SPACER, VERBOSE_BINARY_FORMAT_INDENT_SPACER_LENGTH);
+	}
+
+	while ('\0' != *format) {
+		const char *conversion = NULL;
+		ArgumentType type = ARGUMENT_NONE;
+		const char *rest = nextConversion(format, &conversion, &type);
+		length = appendText(buffer, bufferSize, length, &truncated, format, conversion - format);
+		if (ARGUMENT_UNSUPPORTED == type) {
+			/* not written by the encoder */
+			break;
+		}
+		if (conversion != rest) {
+			if (ARGUMENT_NONE == type) {
+				length = appendText(buffer, bufferSize, length, &truncated, "%", 1);
+			} else {
+				Argument argument;
+				char conversionString[VERBOSE_BINARY_FORMAT_MAXIMUM_CONVERSION_LENGTH];
+				memcpy(conversionString, conversion, rest - conversion);
+				conversionString[rest - conversion] = '\0';
+
+				memset(&argument, 0, sizeof(argument));
+				if (ARGUMENT_STRING == type) {
+					uint32_t stringLength = 0;
+					if ((arguments + sizeof(stringLength)) <= argumentsEnd) {
+						memcpy(&stringLength, arguments, sizeof(stringLength));
+						arguments += sizeof(stringLength);
+					}
+					if ((0 != stringLength) && ((arguments + stringLength) <= argumentsEnd) && ('\0' == arguments[stringLength - 1])) {
+						argument.string = (const char *)arguments;
+					}
+					arguments += stringLength;
+				} else if ((arguments + sizeof(uint64_t)) <= argumentsEnd) {
+					memcpy(&argument, arguments, sizeof(uint64_t));
+					arguments += sizeof(uint64_t);
+				}
+
+				uintptr_t argumentLength = printArgument(portLibrary, NULL, 0, conversionString, type, &argument) - 1;
+				if ((NULL != buffer) && !truncated) {
+					if ((length + argumentLength) < bufferSize) {
+						printArgument(portLibrary, buffer + length, bufferSize - length, conversionString, type, &argument);
+					} else {
+						truncated = true;
+					}
+				}
+				length += argumentLength;
+			}
+		}
+		format = rest;
+	}
+
+	length = appendText(buffer, bufferSize, length, &truncated, "\n", 1);
+	if ((NULL != buffer) && (0 != bufferSize)) {
+		buffer[truncated ? 0 : length] = '\0';
+	}
+	return length;
+}
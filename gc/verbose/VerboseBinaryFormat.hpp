@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYFORMAT_HPP_)
+#define VERBOSEBINARYFORMAT_HPP_
+
+#include "omrcomp.h"
+#include "omrport.h"
+#include "omrstdarg.h"
+
+/*
+ * Binary verbose GC log format, written by -Xgc:binaryLogging.
+ *
+ * A file starts with the VERBOSEGC_BINARY_MAGIC bytes, followed by a sequence of records. Each record is a
+ * VerboseGCBinaryRecordHeader followed by length bytes of payload, in the byte order of the writing platform.
+ * - TEXT records hold XML text as is: the opening and closing verbosegc elements, dropped cycle comments and
+ *   the lines the writer could not encode.
+ * - FORMAT records define a format string: a uint32_t id followed by the string, without its terminating NUL.
+ *   A format is defined once per file, before the first LINE using it.
+ * - LINE records hold one line of output: the uint32_t id of its format, the uint32_t indent level and the
+ *   arguments of the format, encoded as described at MM_VerboseBinaryFormat.
+ * Formatting each LINE with MM_VerboseBinaryFormat::formatLine() and concatenating it with the TEXT records
+ * gives the XML log back. A file without the closing verbosegc element was not closed, e.g. the process ended
+ * abruptly; its last record may be truncated.
+ */
+
+#define VERBOSEGC_BINARY_MAGIC "OMRVGCB2"
+#define VERBOSEGC_BINARY_MAGIC_LENGTH 8
+
+typedef enum VerboseGCBinaryRecordType {
+	VERBOSEGC_BINARY_RECORD_TEXT = 1, /**< XML text */
+	VERBOSEGC_BINARY_RECORD_FORMAT = 2, /**< definition of a format string */
+	VERBOSEGC_BINARY_RECORD_LINE = 3 /**< a line of output as a format id, an indent level and arguments */
+} VerboseGCBinaryRecordType;
+
+typedef struct VerboseGCBinaryRecordHeader {
+	uint32_t type; /**< a VerboseGCBinaryRecordType */
+	uint32_t length; /**< length of the payload that follows, in bytes */
+} VerboseGCBinaryRecordHeader;
+
+/**
+ * Encoding of the arguments of a verbose GC line, so that the line can be formatted later, by another thread
+ * or another process.
+ *
+ * The arguments are encoded in the order of the conversions of the format. Integers, whatever their size, and
+ * pointers take a uint64_t, floating point numbers a double, and strings a uint32_t length including the
+ * terminating NUL followed by the characters (a length of 0 for NULL). Values are not aligned.
+ * Formats using a conversion that can not be encoded, e.g. a '*' width or a 'j' length modifier, are formatted
+ * right away by the writers.
+ */
+class MM_VerboseBinaryFormat
+{
+public:
+	/**
+	 * @return the number of bytes encodeArguments() needs for the arguments, or UDATA_MAX if the format has a
+	 * conversion that can not be encoded
+	 */
+	static uintptr_t getEncodedArgumentsLength(const char *format, va_list args);
+
+	/**
+	 * Encode the arguments of the format, which must be encodable.
+	 * @param buffer[out] getEncodedArgumentsLength() bytes
+	 */
+	static void encodeArguments(const char *format, va_list args, uint8_t *buffer);
+
+	/**
+	 * Format a line as the verbose GC writers do: indented, and ending with a new line.
+	 * @param buffer[out] the text, or NULL to only get its length
+	 * @param bufferSize[in] the size of buffer, which is left holding an empty string if the text does not fit
+	 * @param arguments[in] the arguments encoded by encodeArguments()
+	 * @param argumentsLength[in] the length of the arguments, arguments missing from it format as zero
+	 * @return the length of the whole text, not counting the terminating NUL
+	 */
+	static uintptr_t formatLine(OMRPortLibrary *portLibrary, char *buffer, uintptr_t bufferSize, uintptr_t indent, const char *format, const uint8_t *arguments, uintptr_t argumentsLength);
+};
+
+#endif /* VERBOSEBINARYFORMAT_HPP_ */
@@ -26,6 +26,7 @@
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "MemoryManager.hpp"
 #include "CollectionStatistics.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "ObjectAllocationInterface.hpp"
@@ -301,6 +302,15 @@ MM_VerboseHandlerOutput::handleInitialized(J9HookInterface** hook, uintptr_t eve
 	writer->formatAndOutput(env, 1, "<attribute name=\"splitFreeListSplitAmount\" value=\"%zu\" />", _extensions->splitFreeListSplitAmount);
 	writer->formatAndOutput(env, 1, "<attribute name=\"numaNodes\" value=\"%zu\" />", event->numaNodes);
 
+	MM_MemoryManager* memoryManager = _extensions->memoryManager;
+	for (uintptr_t i = 0; i < memoryManager->getMetadataReservationCount(); i++) {
+		MM_MetadataReservation* reservation = memoryManager->getMetadataReservation(i);
+		writer->formatAndOutput(env, 1, "<attribute name=\"metadataPageSize %s\" value=\"0x%zx\" />", reservation->name, reservation->pageSize);
+		if (0 != reservation->hugePageAlignment) {
+			writer->formatAndOutput(env, 1, "<attribute name=\"metadataHugePageAlignment %s\" value=\"0x%zx\" />", reservation->name, reservation->hugePageAlignment);
+		}
+	}
+
 	handleInitializedInnerStanzas(hook, eventNum, eventData);
 
 	writer->formatAndOutput(env, 1, "<system>");
@@ -413,10 +423,19 @@ MM_VerboseHandlerOutput::handleCycleEnd(J9HookInterface** hook, uintptr_t eventN
 	char tagTemplate[200];
 	getTagTemplate(tagTemplate, sizeof(tagTemplate), _manager->getIdAndIncrement(), cycleType, env->_cycleState->_verboseContextID, omrtime_current_time_millis());
 
+	/* thread counts chosen for the tasks of the cycle by adaptive GC threading */
+	MM_CycleState *cycleState = env->_cycleState;
+	uintptr_t dispatchRecordCount = (NULL == cycleState) ? 0 : cycleState->_dispatchRecordCount;
+
 	enterAtomicReportingBlock();
-	if(hasCycleEndInnerStanzas()) {
+	if(hasCycleEndInnerStanzas() || (0 != dispatchRecordCount)) {
 		writer->formatAndOutput(env, 0, "<cycle-end %s>", tagTemplate);
 		handleCycleEndInnerStanzas(hook, eventNum, eventData, 1);
+		for (uintptr_t i = 0; i < dispatchRecordCount; i++) {
+			MM_CycleState::DispatchRecord *record = &cycleState->_dispatchRecords[i];
+			writer->formatAndOutput(env, 1, "<dispatch task=\"%s\" estimatedbytes=\"%zu\" threads=\"%zu\" available=\"%zu\" />",
+					record->_taskName, record->_estimatedWork, record->_threadCount, record->_availableThreads);
+		}
 		writer->formatAndOutput(env, 0, "</cycle-end>");
 	} else {
 		writer->formatAndOutput(env, 0, "<cycle-end %s />", tagTemplate);
@@ -769,6 +788,17 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
 	}
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (0 != _extensions->allocationCacheRefillBatchCells) {
+		writer->formatAndOutput(env, 1, "<cache-refills batched=\"%zu\" spare=\"%zu\" returned=\"%zu\" />",
+				systemStats->_cacheRefillBatchCount, systemStats->_cacheRefillSpareCount, systemStats->_cacheRefillReturnedCount);
+	}
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+	if (0 != _extensions->allocationSamplingInterval) {
+		writer->formatAndOutput(env, 1, "<allocation-samples count=\"%zu\" interval=\"%zu\" />", systemStats->_allocationSampleCount, _extensions->allocationSamplingInterval);
+	}
+
 	if(0 != _extensions->bytesAllocatedMost){
 		const char *dots = "";
 		char escapedThreadName[128];
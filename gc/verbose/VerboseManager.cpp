@@ -34,6 +34,7 @@
 #include "VerboseWriterChain.hpp"
 #include "VerboseWriterHook.hpp"
 #include "VerboseWriterFileLogging.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
 #include "VerboseWriterFileLoggingBuffered.hpp"
 #include "VerboseWriterFileLoggingSynchronous.hpp"
 #include "VerboseWriterStreamOutput.hpp"
@@ -235,6 +236,10 @@ MM_VerboseManager::parseWriterType(MM_EnvironmentBase *env, char *filename, uint
 		return VERBOSE_WRITER_HOOK;
 	}
 
+	if (extensions->asyncLogging || extensions->binaryLogging) {
+		return VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS;
+	}
+
 	if (extensions->bufferedLogging) {
 		return VERBOSE_WRITER_FILE_LOGGING_BUFFERED;
 	}
@@ -315,6 +320,18 @@ MM_VerboseManager::createWriter(MM_EnvironmentBase *env, WriterType type, char *
 			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
 		}
 		break;
+	case VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS:
+		writer = MM_VerboseWriterFileLoggingAsynchronous::newInstance(env, this, filename, fileCount, iterations);
+		if (NULL == writer) {
+			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
+			if (NULL != writer) {
+				writer->isActive(true);
+				return writer;
+			}
+			/* if we failed to create a file stream and there is no stderr stream try to create a stderr stream */
+			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
+		}
+		break;
 
 	default:
 		return NULL;
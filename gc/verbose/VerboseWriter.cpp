@@ -35,13 +35,14 @@
 #define VERBOSEGC_HEADER "<?xml version=\"1.0\" ?>\n\n<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"%s\">\n\n"
 #define VERBOSEGC_FOOTER "</verbosegc>\n"
 
-MM_VerboseWriter::MM_VerboseWriter(WriterType type)
+MM_VerboseWriter::MM_VerboseWriter(WriterType type, bool defersFormatting)
 	: MM_Base()
 	,_nextWriter(NULL)
 	,_header(NULL)
 	,_footer(NULL)
 	,_type(type)
 	,_isActive(false)
+	,_defersFormatting(defersFormatting)
 {}
 
 const char*
@@ -24,6 +24,7 @@
 #define VERBOSEWRITER_HPP_
 
 #include "omrcfg.h"
+#include "omrstdarg.h"
 #include "modronbase.h"
 
 #include "Base.hpp"
@@ -35,7 +36,8 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS = 6
 } WriterType;
 
 /**
@@ -57,6 +59,7 @@ private:
 
 	WriterType _type;
 	bool _isActive;
+	bool _defersFormatting;
 
 	/*
 	 * Function members
@@ -69,6 +72,15 @@ public:
 
 	virtual void outputString(MM_EnvironmentBase *env, const char* string) = 0;
 
+	/**
+	 * Output one line, which the writer formats itself. Only called on writers that defer formatting,
+	 * instead of outputString().
+	 * @param indent[in] the indent level of the line
+	 * @param format[in] a string literal, which stays valid after the call
+	 * @param args[in] the arguments of the format
+	 */
+	virtual void outputFormatted(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args) {}
+
 	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations) = 0;
 
 	virtual void endOfCycle(MM_EnvironmentBase *env) = 0;
@@ -77,11 +89,13 @@ public:
 
 	MMINLINE WriterType getType(void) { return _type; }
 
+	MMINLINE bool defersFormatting(void) { return _defersFormatting; }
+
 	MMINLINE bool isActive(void) { return _isActive; }
 	MMINLINE void isActive(bool isActive) { _isActive = isActive; }
 
 protected:
-	MM_VerboseWriter(WriterType type);
+	MM_VerboseWriter(WriterType type, bool defersFormatting = false);
 
 	virtual void tearDown(MM_EnvironmentBase *env);
 
@@ -38,6 +38,8 @@ MM_VerboseWriterChain::MM_VerboseWriterChain()
 	: MM_Base()
 	,_buffer(NULL)
 	,_writers(NULL)
+	,_hasTextWriters(false)
+	,_hasDeferredFormattingWriters(false)
 {}
 
 MM_VerboseWriterChain *
@@ -62,12 +64,27 @@ MM_VerboseWriterChain::formatAndOutputV(MM_EnvironmentBase *env, uintptr_t inden
 	/* Ensure we have a  buffer. */
 	Assert_VGC_true(NULL != _buffer);
 
-	for (uintptr_t i = 0; i < indent; ++i) {
-		_buffer->add(env, INDENT_SPACER);
+	if (_hasDeferredFormattingWriters) {
+		MM_VerboseWriter* writer = _writers;
+		while (NULL != writer) {
+			if (writer->defersFormatting()) {
+				va_list argsCopy;
+				COPY_VA_LIST(argsCopy, args);
+				writer->outputFormatted(env, indent, format, argsCopy);
+				END_VA_LIST_COPY(argsCopy);
+			}
+			writer = writer->getNextWriter();
+		}
+	}
+
+	if (_hasTextWriters) {
+		for (uintptr_t i = 0; i < indent; ++i) {
+			_buffer->add(env, INDENT_SPACER);
+		}
+
+		_buffer->vprintf(env, format, args);
+		_buffer->add(env, "\n");
 	}
-	
-	_buffer->vprintf(env, format, args);
-	_buffer->add(env, "\n");
 }
 
 void
@@ -85,7 +102,9 @@ MM_VerboseWriterChain::flush(MM_EnvironmentBase *env)
 {
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
-		writer->outputString(env, _buffer->contents());
+		if (!writer->defersFormatting()) {
+			writer->outputString(env, _buffer->contents());
+		}
 		writer = writer->getNextWriter();
 	}
 	_buffer->reset();
@@ -131,6 +150,11 @@ MM_VerboseWriterChain::addWriter(MM_VerboseWriter* writer)
 {
 	writer->setNextWriter(_writers);
 	_writers = writer;
+	if (writer->defersFormatting()) {
+		_hasDeferredFormattingWriters = true;
+	} else {
+		_hasTextWriters = true;
+	}
 }
 
 void
@@ -36,7 +36,8 @@ class MM_VerboseWriter;
 
 /**
  * This class manages a list of writers. It formats and buffers output, flushing it
- * to the writers when asked.
+ * to the writers when asked. Writers that defer formatting are handed each line as
+ * its format string and arguments instead, so format strings must be literals.
  */
 class MM_VerboseWriterChain : public MM_Base
 {
@@ -45,6 +46,8 @@ protected:
 private:
 	MM_VerboseBuffer *_buffer;
 	MM_VerboseWriter *_writers;
+	bool _hasTextWriters; /**< true if a writer takes formatted text, otherwise nothing is formatted here */
+	bool _hasDeferredFormattingWriters; /**< true if a writer formats the lines itself */
 
 public:
 	static MM_VerboseWriterChain *newInstance(MM_EnvironmentBase *env);
@@ -34,8 +34,8 @@ enum {
 	rotating_files
 };
 
-MM_VerboseWriterFileLogging::MM_VerboseWriterFileLogging(MM_EnvironmentBase *env, MM_VerboseManager *manager, WriterType type)
-	:MM_VerboseWriter(type)
+MM_VerboseWriterFileLogging::MM_VerboseWriterFileLogging(MM_EnvironmentBase *env, MM_VerboseManager *manager, WriterType type, bool defersFormatting)
+	:MM_VerboseWriter(type, defersFormatting)
 	,_filename(NULL)
 	,_mode(single_file)
 	,_currentFile(0)
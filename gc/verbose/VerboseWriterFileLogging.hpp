@@ -65,7 +65,7 @@ public:
 	virtual void outputString(MM_EnvironmentBase *env, const char* string) = 0;
 
 protected:
-	MM_VerboseWriterFileLogging(MM_EnvironmentBase *env, MM_VerboseManager *manager, WriterType type);
+	MM_VerboseWriterFileLogging(MM_EnvironmentBase *env, MM_VerboseManager *manager, WriterType type, bool defersFormatting = false);
 
 	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
 	virtual void tearDown(MM_EnvironmentBase *env);
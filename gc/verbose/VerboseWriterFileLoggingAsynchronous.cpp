@@ -0,0 +1,728 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "hashtable_api.h"
+#include "omrutil.h"
+
+#include "modronapicore.hpp"
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+
+#include <string.h>
+
+/* how long the background thread sleeps before it looks for records that did not wake it, in milliseconds */
+#define VERBOSE_ASYNCHRONOUS_WAKEUP_MILLIS 100
+/* smallest ring buffer, large enough for typical stanzas */
+#define VERBOSE_ASYNCHRONOUS_MINIMUM_BUFFER_SIZE (16 * 1024)
+/* initial size of the buffer the background thread formats lines into, it grows for longer lines */
+#define VERBOSE_ASYNCHRONOUS_LINE_BUFFER_SIZE 512
+/* matches the spacer of MM_VerboseWriterChain */
+#define VERBOSE_ASYNCHRONOUS_INDENT_SPACER "  "
+
+MM_VerboseWriterFileLoggingAsynchronous::MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS, true)
+	,_omrVM(env->getOmrVM())
+	,_logFileStream(NULL)
+	,_buffer(NULL)
+	,_bufferSize(0)
+	,_reserved(0)
+	,_consumed(0)
+	,_droppingCycle(false)
+	,_droppedCycles(0)
+	,_droppedCyclesReported(0)
+	,_binary(env->getExtensions()->binaryLogging)
+	,_formatIds(NULL)
+	,_formatCount(0)
+	,_lineBuffer(NULL)
+	,_lineBufferSize(0)
+	,_monitor(NULL)
+	,_threadState(STATE_ERROR)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsynchronous instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsynchronous.
+ */
+MM_VerboseWriterFileLoggingAsynchronous *
+MM_VerboseWriterFileLoggingAsynchronous::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsynchronous *agent = (MM_VerboseWriterFileLoggingAsynchronous *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsynchronous), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsynchronous(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsynchronous instance: allocates the ring buffer, opens the
+ * first file and starts the background thread.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	_bufferSize = MM_Math::roundToFloor(sizeof(uint64_t), OMR_MAX(extensions->asyncLoggingBufferSize, VERBOSE_ASYNCHRONOUS_MINIMUM_BUFFER_SIZE));
+	_buffer = (uint8_t *)extensions->getForge()->allocate(_bufferSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _buffer) {
+		return false;
+	}
+	/* producers rely on free space being zeroed */
+	memset(_buffer, 0, _bufferSize);
+
+	if (!_binary) {
+		_lineBufferSize = VERBOSE_ASYNCHRONOUS_LINE_BUFFER_SIZE;
+		_lineBuffer = (char *)extensions->getForge()->allocate(_lineBufferSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _lineBuffer) {
+			return false;
+		}
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_VerboseWriterFileLoggingAsynchronous::_monitor")) {
+		_monitor = NULL;
+		return false;
+	}
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	return startThread(env);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingAsynchronous.
+ * Stops the background thread and writes the records it left in the buffer.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (NULL != _monitor) {
+		stopThread(env);
+
+		omrthread_monitor_enter(_monitor);
+		drain(env, true);
+		closeFile(env);
+		omrthread_monitor_exit(_monitor);
+
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+
+	if (NULL != _buffer) {
+		extensions->getForge()->free(_buffer);
+		_buffer = NULL;
+	}
+
+	if (NULL != _lineBuffer) {
+		extensions->getForge()->free(_lineBuffer);
+		_lineBuffer = NULL;
+	}
+
+	if (NULL != _formatIds) {
+		hashTableFree(_formatIds);
+		_formatIds = NULL;
+	}
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Start the background thread and wait until it runs.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::startThread(MM_EnvironmentBase *env)
+{
+	/* hold the monitor over start-up of the thread so that it can not notify us of its start-up state before we wait */
+	omrthread_monitor_enter(_monitor);
+	_threadState = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		threadProc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+	} else {
+		_threadState = STATE_ERROR;
+	}
+	bool success = (STATE_RUNNING == _threadState);
+	omrthread_monitor_exit(_monitor);
+
+	return success;
+}
+
+/**
+ * Tell the background thread to shut down and wait for it to exit.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::stopThread(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	while ((STATE_ERROR != _threadState) && (STATE_TERMINATED != _threadState)) {
+		_threadState = STATE_TERMINATION_REQUESTED;
+		omrthread_monitor_notify_all(_monitor);
+		omrthread_monitor_wait(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingAsynchronous::threadProc(void *info)
+{
+	MM_VerboseWriterFileLoggingAsynchronous *writer = (MM_VerboseWriterFileLoggingAsynchronous *)info;
+	/* This method will NOT return */
+	writer->threadEntryPoint();
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::threadEntryPoint()
+{
+	/* the thread does not touch the heap, so it does not attach to the VM */
+	MM_EnvironmentBase env(_omrVM);
+
+	omrthread_monitor_enter(_monitor);
+	_threadState = STATE_RUNNING;
+	omrthread_monitor_notify_all(_monitor);
+	while (STATE_TERMINATION_REQUESTED != _threadState) {
+		drain(&env, false);
+		omrthread_monitor_wait_timed(_monitor, VERBOSE_ASYNCHRONOUS_WAKEUP_MILLIS, 0);
+	}
+	_threadState = STATE_TERMINATED;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+MM_VerboseWriterFileLoggingAsynchronous::RecordHeader *
+MM_VerboseWriterFileLoggingAsynchronous::reserveRecord(MM_EnvironmentBase *env, uintptr_t length)
+{
+	uintptr_t recordSize = MM_Math::roundToCeiling(sizeof(uint64_t), sizeof(RecordHeader) + length);
+	uintptr_t reserved = 0;
+	uintptr_t needed = 0;
+
+	if (recordSize > _bufferSize) {
+		return NULL;
+	}
+
+	do {
+		/* read _consumed first so that it can not be ahead of _reserved; a stale value only underestimates the free space */
+		uintptr_t consumed = _consumed;
+		MM_AtomicOperations::readBarrier();
+		reserved = _reserved;
+		uintptr_t tail = _bufferSize - (reserved % _bufferSize);
+		/* a record never wraps, it skips the end of the buffer if it does not fit there */
+		needed = (recordSize > tail) ? (tail + recordSize) : recordSize;
+		if ((reserved - consumed + needed) > _bufferSize) {
+			return NULL;
+		}
+	} while (reserved != MM_AtomicOperations::lockCompareExchange(&_reserved, reserved, reserved + needed));
+
+	uint8_t *cursor = _buffer + (reserved % _bufferSize);
+	if (needed != recordSize) {
+		/* an end of the buffer too short for a header is skipped without a padding record */
+		uintptr_t tail = needed - recordSize;
+		if (tail >= sizeof(RecordHeader)) {
+			RecordHeader *padding = (RecordHeader *)cursor;
+			padding->length = (uint32_t)(tail - sizeof(RecordHeader));
+			MM_AtomicOperations::writeBarrier();
+			padding->type = RECORD_PADDING;
+		}
+		cursor = _buffer;
+	}
+
+	RecordHeader *header = (RecordHeader *)cursor;
+	header->length = (uint32_t)length;
+	return header;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::publishRecord(MM_EnvironmentBase *env, RecordHeader *header, uint32_t type)
+{
+	/* the consumer reads the payload only once it sees a non zero type */
+	MM_AtomicOperations::writeBarrier();
+	header->type = type;
+
+	/* wake the background thread early only when the buffer fills up, so that it does not compete with the GC threads for every line */
+	if ((_reserved - _consumed) > (_bufferSize / 2)) {
+		if (0 == omrthread_monitor_try_enter(_monitor)) {
+			omrthread_monitor_notify_all(_monitor);
+			omrthread_monitor_exit(_monitor);
+		}
+	}
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::enqueue(MM_EnvironmentBase *env, uint32_t type, const char *payload, uintptr_t length)
+{
+	RecordHeader *header = reserveRecord(env, length);
+	if (NULL == header) {
+		return false;
+	}
+	if (0 < length) {
+		memcpy(header + 1, payload, length);
+	}
+	publishRecord(env, header, type);
+	return true;
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::peekRecord(uintptr_t offset, uint32_t *type, uintptr_t *size)
+{
+	uintptr_t position = offset % _bufferSize;
+	uintptr_t tail = _bufferSize - position;
+
+	if (tail < sizeof(RecordHeader)) {
+		/* an end of the buffer too short for a header is skipped without a padding record */
+		*type = RECORD_PADDING;
+		*size = tail;
+		return true;
+	}
+
+	volatile RecordHeader *header = (volatile RecordHeader *)(_buffer + position);
+	*type = header->type;
+	if (0 == *type) {
+		/* a producer is still copying the record */
+		return false;
+	}
+	MM_AtomicOperations::readBarrier();
+	*size = MM_Math::roundToCeiling(sizeof(uint64_t), sizeof(RecordHeader) + header->length);
+	return true;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::consumeRecords(MM_EnvironmentBase *env, uintptr_t end, bool discard)
+{
+	while (_consumed != end) {
+		uintptr_t consumed = _consumed;
+		uintptr_t position = consumed % _bufferSize;
+		uint32_t type = 0;
+		uintptr_t recordSize = 0;
+		peekRecord(consumed, &type, &recordSize);
+
+		if (!discard) {
+			RecordHeader *header = (RecordHeader *)(_buffer + position);
+			if (RECORD_STANZA == type) {
+				writeText(env, (const char *)(header + 1), header->length);
+			} else if (RECORD_LINE == type) {
+				writeLine(env, (LineRecord *)(header + 1), header->length - sizeof(LineRecord));
+			}
+		}
+
+		/* hand the space back zeroed, producers rely on it */
+		memset(_buffer + position, 0, recordSize);
+		MM_AtomicOperations::writeBarrier();
+		_consumed = consumed + recordSize;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::drain(MM_EnvironmentBase *env, bool final)
+{
+	while (_consumed != _reserved) {
+		/* read before looking for the end of the cycle: all the records queued before a set flag belong to dropped cycles */
+		bool droppingCycle = _droppingCycle;
+		MM_AtomicOperations::readBarrier();
+
+		/* find the end of the oldest queued cycle */
+		uintptr_t end = _consumed;
+		uint32_t endType = 0;
+		while (end != _reserved) {
+			uint32_t type = 0;
+			uintptr_t recordSize = 0;
+			if (!peekRecord(end, &type, &recordSize)) {
+				if (final) {
+					omrthread_yield();
+					continue;
+				}
+				break;
+			}
+			end += recordSize;
+			if ((RECORD_END_OF_CYCLE == type) || (RECORD_END_OF_DROPPED_CYCLE == type)) {
+				endType = type;
+				break;
+			}
+		}
+
+		if (0 != endType) {
+			consumeRecords(env, end, RECORD_END_OF_DROPPED_CYCLE == endType);
+			writeDroppedCycles(env);
+			MM_VerboseWriterFileLogging::endOfCycle(env);
+		} else if (droppingCycle || final) {
+			/* free the space of a dropped cycle early, so that its end fits in the buffer */
+			consumeRecords(env, end, droppingCycle);
+			break;
+		} else {
+			/* wait for the cycle to complete */
+			break;
+		}
+	}
+
+	if (final) {
+		writeDroppedCycles(env);
+	}
+}
+
+/**
+ * Write bytes to the file, opening it if needed. XML that can not be written to a file goes to stderr.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeData(MM_EnvironmentBase *env, const void *data, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (NULL == _logFileStream) {
+		/* we open the file at the end of the cycle so can't have a final empty file at the end of a run */
+		openFile(env);
+	}
+
+	if (NULL != _logFileStream) {
+		omrfilestream_write(_logFileStream, data, (intptr_t)length);
+	} else if (!_binary) {
+		omrfilestream_write_text(OMRPORT_STREAM_ERR, (const char *)data, length, J9STR_CODE_PLATFORM_RAW);
+	}
+}
+
+/**
+ * Write XML text, framed as a TEXT record in a binary file.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeText(MM_EnvironmentBase *env, const char *text, uintptr_t length)
+{
+	if (_binary) {
+		VerboseGCBinaryRecordHeader header;
+		header.type = VERBOSEGC_BINARY_RECORD_TEXT;
+		header.length = (uint32_t)length;
+		writeData(env, &header, sizeof(header));
+	}
+	writeData(env, text, length);
+}
+
+/**
+ * Format a queued line and write it, or write it as a LINE record in a binary file.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeLine(MM_EnvironmentBase *env, LineRecord *line, uintptr_t argumentsLength)
+{
+	const uint8_t *arguments = (const uint8_t *)(line + 1);
+
+	if (_binary) {
+		writeBinaryLine(env, line, argumentsLength);
+	} else {
+		uintptr_t length = MM_VerboseBinaryFormat::formatLine(env->getPortLibrary(), _lineBuffer, _lineBufferSize, line->indent, line->format, arguments, argumentsLength);
+		if (length >= _lineBufferSize) {
+			MM_Forge *forge = env->getExtensions()->getForge();
+			uintptr_t lineBufferSize = MM_Math::roundToCeiling(VERBOSE_ASYNCHRONOUS_LINE_BUFFER_SIZE, length + 1);
+			char *lineBuffer = (char *)forge->allocate(lineBufferSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+			if (NULL == lineBuffer) {
+				/* the line is lost, but the log stays well formed as long as it was not an element */
+				return;
+			}
+			forge->free(_lineBuffer);
+			_lineBuffer = lineBuffer;
+			_lineBufferSize = lineBufferSize;
+			length = MM_VerboseBinaryFormat::formatLine(env->getPortLibrary(), _lineBuffer, _lineBufferSize, line->indent, line->format, arguments, argumentsLength);
+		}
+		writeData(env, _lineBuffer, length);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeBinaryLine(MM_EnvironmentBase *env, LineRecord *line, uintptr_t argumentsLength)
+{
+	uint32_t lineHeader[2];
+
+	if (NULL == _logFileStream) {
+		/* open the file first, the format ids belong to it */
+		openFile(env);
+	}
+	if (!getFormatId(env, line->format, &lineHeader[0])) {
+		return;
+	}
+	lineHeader[1] = (uint32_t)line->indent;
+
+	VerboseGCBinaryRecordHeader header;
+	header.type = VERBOSEGC_BINARY_RECORD_LINE;
+	header.length = (uint32_t)(sizeof(lineHeader) + argumentsLength);
+	writeData(env, &header, sizeof(header));
+	writeData(env, lineHeader, sizeof(lineHeader));
+	writeData(env, line + 1, argumentsLength);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::getFormatId(MM_EnvironmentBase *env, const char *format, uint32_t *id)
+{
+	if (NULL == _formatIds) {
+		return false;
+	}
+
+	FormatId query;
+	query.format = format;
+	FormatId *formatId = (FormatId *)hashTableFind(_formatIds, &query);
+	if (NULL == formatId) {
+		query.id = _formatCount;
+		formatId = (FormatId *)hashTableAdd(_formatIds, &query);
+		if (NULL == formatId) {
+			return false;
+		}
+		_formatCount += 1;
+
+		uintptr_t formatLength = strlen(format);
+		VerboseGCBinaryRecordHeader header;
+		header.type = VERBOSEGC_BINARY_RECORD_FORMAT;
+		header.length = (uint32_t)(sizeof(uint32_t) + formatLength);
+		writeData(env, &header, sizeof(header));
+		writeData(env, &formatId->id, sizeof(uint32_t));
+		writeData(env, format, formatLength);
+	}
+	*id = formatId->id;
+	return true;
+}
+
+uintptr_t
+MM_VerboseWriterFileLoggingAsynchronous::hashFormatId(void *entry, void *userData)
+{
+	return (uintptr_t)((FormatId *)entry)->format;
+}
+
+uintptr_t
+MM_VerboseWriterFileLoggingAsynchronous::equalFormatIds(void *leftEntry, void *rightEntry, void *userData)
+{
+	return ((FormatId *)leftEntry)->format == ((FormatId *)rightEntry)->format;
+}
+
+/**
+ * Log the number of cycles dropped since the last report, if any.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeDroppedCycles(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t droppedCycles = _droppedCycles;
+
+	if (droppedCycles != _droppedCyclesReported) {
+		char comment[64];
+		uintptr_t length = omrstr_printf(comment, sizeof(comment), "<!-- %zu verbose GC cycles dropped -->\n", droppedCycles - _droppedCyclesReported);
+		_droppedCyclesReported = droppedCycles;
+		writeText(env, comment, length);
+	}
+}
+
+/**
+ * Opens the file to log output to and prints the header.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::openFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileStream = omrfilestream_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(NULL == _logFileStream) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileStream = omrfilestream_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (NULL == _logFileStream) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	if (_binary) {
+		/* the formats are defined again in each file */
+		if (NULL != _formatIds) {
+			hashTableFree(_formatIds);
+		}
+		_formatIds = hashTableNew(OMRPORTLIB, "MM_VerboseWriterFileLoggingAsynchronous::_formatIds", 0, sizeof(FormatId), 0, 0, OMRMEM_CATEGORY_MM, hashFormatId, equalFormatIds, NULL, NULL);
+		_formatCount = 0;
+		writeData(env, VERBOSEGC_BINARY_MAGIC, VERBOSEGC_BINARY_MAGIC_LENGTH);
+	}
+
+	const char *header = getHeader(env);
+	writeText(env, header, strlen(header));
+
+	return true;
+}
+
+/**
+ * Prints the footer and closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(NULL != _logFileStream) {
+		const char *footer = getFooter(env);
+		writeText(env, footer, strlen(footer));
+		writeText(env, "\n", strlen("\n"));
+		omrfilestream_close(_logFileStream);
+		_logFileStream = NULL;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	if (!_droppingCycle && !enqueue(env, RECORD_STANZA, string, strlen(string))) {
+		/* the buffer is full, drop the rest of the cycle */
+		_droppingCycle = true;
+	}
+}
+
+/**
+ * Queue a line as its format and encoded arguments, to be formatted by the background thread. A format with a
+ * conversion that can not be encoded is formatted right away.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputFormatted(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	if (_droppingCycle) {
+		return;
+	}
+
+	RecordHeader *header = NULL;
+	uintptr_t argumentsLength = MM_VerboseBinaryFormat::getEncodedArgumentsLength(format, args);
+	if (UDATA_MAX != argumentsLength) {
+		header = reserveRecord(env, sizeof(LineRecord) + argumentsLength);
+		if (NULL != header) {
+			LineRecord *line = (LineRecord *)(header + 1);
+			line->format = format;
+			line->indent = indent;
+			MM_VerboseBinaryFormat::encodeArguments(format, args, (uint8_t *)(line + 1));
+			publishRecord(env, header, RECORD_LINE);
+		}
+	} else {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uintptr_t indentLength = indent * strlen(VERBOSE_ASYNCHRONOUS_INDENT_SPACER);
+		va_list argsCopy;
+		COPY_VA_LIST(argsCopy, args);
+		/* the length without a buffer counts the terminating NUL */
+		uintptr_t textLength = omrstr_vprintf(NULL, 0, format, argsCopy) - 1;
+		END_VA_LIST_COPY(argsCopy);
+		header = reserveRecord(env, indentLength + textLength + 1);
+		if (NULL != header) {
+			char *cursor = (char *)(header + 1);
+			for (uintptr_t i = 0; i < indent; ++i) {
+				memcpy(cursor, VERBOSE_ASYNCHRONOUS_INDENT_SPACER, strlen(VERBOSE_ASYNCHRONOUS_INDENT_SPACER));
+				cursor += strlen(VERBOSE_ASYNCHRONOUS_INDENT_SPACER);
+			}
+			COPY_VA_LIST(argsCopy, args);
+			omrstr_vprintf(cursor, textLength + 1, format, argsCopy);
+			END_VA_LIST_COPY(argsCopy);
+			/* replaces the terminating NUL */
+			cursor[textLength] = '\n';
+			publishRecord(env, header, RECORD_STANZA);
+		}
+	}
+
+	if (NULL == header) {
+		/* the buffer is full, drop the rest of the cycle */
+		_droppingCycle = true;
+	}
+}
+
+/**
+ * Queue the end of the cycle; the background thread writes the records of the cycle, or discards them if the
+ * cycle was dropped, and then rotates the file.
+ * If the end does not fit in the buffer the cycle is dropped and merged with the next one.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::endOfCycle(MM_EnvironmentBase *env)
+{
+	if (_droppingCycle) {
+		MM_AtomicOperations::add(&_droppedCycles, 1);
+		if (enqueue(env, RECORD_END_OF_DROPPED_CYCLE, NULL, 0)) {
+			_droppingCycle = false;
+		}
+	} else if (!enqueue(env, RECORD_END_OF_CYCLE, NULL, 0)) {
+		MM_AtomicOperations::add(&_droppedCycles, 1);
+		_droppingCycle = true;
+	}
+}
+
+/**
+ * Write all the queued records and close the file. Output after this reopens the file.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeStream(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	drain(env, true);
+	closeFile(env);
+	omrthread_monitor_exit(_monitor);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	/* the background thread keeps running, it only needs the file name and rotation settings */
+	omrthread_monitor_enter(_monitor);
+	drain(env, true);
+	closeFile(env);
+	bool result = MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles);
+	omrthread_monitor_exit(_monitor);
+
+	return result;
+}
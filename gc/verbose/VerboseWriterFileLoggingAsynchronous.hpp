@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_
+
+#include "omrcfg.h"
+#include "omrhashtable.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLogging.hpp"
+
+/**
+ * Output agent which directs verbosegc output to file from a background thread (-Xgc:asyncLogging).
+ *
+ * The writer defers formatting: each line is copied into a lock-free ring buffer as a record of its format
+ * string and encoded arguments (see MM_VerboseBinaryFormat), so the threads emitting verbose output neither
+ * format text nor block on the buffer or on file I/O. A background thread drains the buffer, formats the lines
+ * and does all the file I/O, including the rotation between files at the end of a cycle. The file holds the
+ * same XML as the synchronous writer would, or with -Xgc:binaryLogging the records of VerboseBinaryFormat.hpp,
+ * which the background thread writes without formatting the lines.
+ *
+ * An element may span several stanzas, so the background thread only writes complete cycles (the output
+ * between two calls to endOfCycle). When the buffer is full the rest of the cycle is dropped, the records of
+ * the cycle already queued are discarded and the number of dropped cycles is logged instead.
+ */
+class MM_VerboseWriterFileLoggingAsynchronous : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	typedef enum {
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_RUNNING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED
+	} ThreadState;
+
+	/* record types, a zero type marks a record still being copied */
+	static const uint32_t RECORD_STANZA = 1; /**< verbose GC text, an element may span several stanzas */
+	static const uint32_t RECORD_PADDING = 2; /**< fills the end of the buffer up to the next record */
+	static const uint32_t RECORD_END_OF_CYCLE = 3; /**< ends a cycle to write, and rotates the file */
+	static const uint32_t RECORD_END_OF_DROPPED_CYCLE = 4; /**< ends a cycle to discard, and rotates the file */
+	static const uint32_t RECORD_LINE = 5; /**< a LineRecord followed by the encoded arguments of the line */
+
+	typedef struct RecordHeader {
+		uint32_t type; /**< one of the record types, set last when the record is queued */
+		uint32_t length; /**< length of the payload that follows, in bytes */
+	} RecordHeader;
+
+	typedef struct LineRecord {
+		const char *format; /**< the format string literal */
+		uintptr_t indent; /**< the indent level of the line */
+	} LineRecord;
+
+	typedef struct FormatId {
+		const char *format; /**< the format string literal */
+		uint32_t id; /**< the id of its definition in the current binary file */
+	} FormatId;
+
+	OMR_VM *_omrVM; /**< the VM, used to create an environment for the background thread */
+	OMRFileStream *_logFileStream; /**< the filestream being written to */
+
+	uint8_t *_buffer; /**< the ring buffer, holding 8 byte aligned records of a RecordHeader and a payload */
+	uintptr_t _bufferSize; /**< size of the ring buffer in bytes, a multiple of 8 */
+	volatile uintptr_t _reserved; /**< bytes ever reserved by producers, the buffer offset is this modulo the buffer size */
+	volatile uintptr_t _consumed; /**< bytes ever consumed by the background thread */
+	volatile bool _droppingCycle; /**< true once a record of the current cycle did not fit in the buffer */
+	volatile uintptr_t _droppedCycles; /**< cycles dropped because the buffer was full */
+	uintptr_t _droppedCyclesReported; /**< dropped cycles already written to the file */
+
+	bool _binary; /**< true to write the binary format (-Xgc:binaryLogging) rather than XML */
+	J9HashTable *_formatIds; /**< FormatIds of the formats defined in the current binary file */
+	uint32_t _formatCount; /**< formats defined in the current binary file */
+	char *_lineBuffer; /**< the line being formatted by the background thread */
+	uintptr_t _lineBufferSize; /**< size of _lineBuffer in bytes */
+
+	omrthread_monitor_t _monitor; /**< protects the consumer side of the buffer and the file, and wakes the background thread */
+	volatile ThreadState _threadState; /**< state of the background thread */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsynchronous *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+
+	virtual void outputFormatted(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+
+	virtual void closeStream(MM_EnvironmentBase *env);
+
+	virtual bool reconfigure(MM_EnvironmentBase *env, const char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+protected:
+	MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env);
+	void closeFile(MM_EnvironmentBase *env);
+
+	bool startThread(MM_EnvironmentBase *env);
+	void stopThread(MM_EnvironmentBase *env);
+	static int J9THREAD_PROC threadProc(void *info);
+	void threadEntryPoint();
+
+	/**
+	 * Reserve room for a record without blocking. The caller copies the payload and then publishes the record.
+	 * @return the header of the record, or NULL if the buffer did not have room for it
+	 */
+	RecordHeader *reserveRecord(MM_EnvironmentBase *env, uintptr_t length);
+
+	/**
+	 * Publish a record whose payload was copied, so that the background thread can consume it.
+	 */
+	void publishRecord(MM_EnvironmentBase *env, RecordHeader *header, uint32_t type);
+
+	/**
+	 * Queue a record without blocking.
+	 * @return false if the buffer did not have room for the record, which was dropped
+	 */
+	bool enqueue(MM_EnvironmentBase *env, uint32_t type, const char *payload, uintptr_t length);
+
+	/**
+	 * Write the queued cycles to the file. The caller must own _monitor.
+	 * @param final true to also write an incomplete cycle, waiting for records still being copied into the buffer
+	 */
+	void drain(MM_EnvironmentBase *env, bool final);
+
+	/**
+	 * Get the type and size of the queued record at the given offset.
+	 * @return false if a producer is still copying the record
+	 */
+	bool peekRecord(uintptr_t offset, uint32_t *type, uintptr_t *size);
+
+	/**
+	 * Write or discard the queued records up to the given offset, and free their space.
+	 */
+	void consumeRecords(MM_EnvironmentBase *env, uintptr_t end, bool discard);
+
+	void writeData(MM_EnvironmentBase *env, const void *data, uintptr_t length);
+	void writeText(MM_EnvironmentBase *env, const char *text, uintptr_t length);
+	void writeLine(MM_EnvironmentBase *env, LineRecord *line, uintptr_t argumentsLength);
+	void writeBinaryLine(MM_EnvironmentBase *env, LineRecord *line, uintptr_t argumentsLength);
+	void writeDroppedCycles(MM_EnvironmentBase *env);
+
+	/**
+	 * Get the id of a format in the current binary file, defining the format in the file first if needed.
+	 * @return false if the format could not be recorded
+	 */
+	bool getFormatId(MM_EnvironmentBase *env, const char *format, uint32_t *id);
+
+	static uintptr_t hashFormatId(void *entry, void *userData);
+	static uintptr_t equalFormatIds(void *leftEntry, void *rightEntry, void *userData);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_ */
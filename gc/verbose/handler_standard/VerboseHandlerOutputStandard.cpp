@@ -304,6 +304,16 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+	if (0 != extensions->markingPrefetchDepth) {
+		writer->formatAndOutput(env, 1, "<prefetch-info depth=\"%zu\" fulldepth=\"%zu\" shortdepth=\"%zu\" />",
+				extensions->markingPrefetchDepth, markStats->_prefetchFullDepth, markStats->_prefetchShortDepth);
+	}
+	if (0 != markStats->_clearMarkMapStartTime) {
+		uint64_t clearDuration = 0;
+		getTimeDeltaInMicroSeconds(&clearDuration, markStats->_clearMarkMapStartTime, markStats->_clearMarkMapEndTime);
+		writer->formatAndOutput(env, 1, "<clear-markmap timems=\"%llu.%03.3llu\" bytes=\"%zu\" concurrentbytes=\"%zu\" />",
+				clearDuration / 1000, clearDuration % 1000, markStats->_clearMarkMapBytes, markStats->_clearMarkMapConcurrentBytes);
+	}
 
 	handleMarkEndInternal(env, eventData);
 
@@ -329,7 +339,14 @@ MM_VerboseHandlerOutputStandard::handleSweepEnd(J9HookInterface** hook, uintptr_
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
 
 	enterAtomicReportingBlock();
-	handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+	if (NULL != extensions->objectStartIndex) {
+		MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+		handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		writer->formatAndOutput(env, 1, "<object-start-index recorded=\"%zu\" />", sweepStats->_objectStartsRecorded);
+		handleGCOPOuterStanzaEnd(env);
+	} else {
+		handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+	}
 
 	handleSweepEndInternal(env, eventData);
 	exitAtomicReportingBlock();
@@ -419,6 +436,14 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 	if (event->cycleEnd) {
 		writer->formatAndOutput(env, 1, "<scavenger-info tenureage=\"%zu\" tenuremask=\"%4zx\" tiltratio=\"%zu\" />",
 				cycleScavengerStats->_tenureAge, cycleScavengerStats->getFlipHistory(0)->_tenureMask, cycleScavengerStats->_tiltRatio);
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		if (extensions->isConcurrentScavengerEnabled() && extensions->concurrentScavengerPacing) {
+			writer->formatAndOutput(env, 1, "<concurrent-pacing blocked=\"%s\" copyrate=\"%zu\" allocrate=\"%zu\" predictedcopy=\"%zu\" predictedtime=\"%zu\" predictedalloc=\"%zu\" threads=\"%zu\" survivorreserve=\"%zu\" />",
+					cycleScavengerStats->_pacingBlocked ? "true" : "false", cycleScavengerStats->_pacingCopyRate, cycleScavengerStats->_pacingAllocationRate,
+					cycleScavengerStats->_pacingPredictedCopyBytes, cycleScavengerStats->_pacingPredictedConcurrentTime, cycleScavengerStats->_pacingPredictedAllocationBytes,
+					cycleScavengerStats->_pacingBackgroundThreads, cycleScavengerStats->_pacingSurvivorReserve);
+		}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	}
 
 	if (0 != scavengerStats->_flipCount) {
@@ -437,6 +462,16 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	if (extensions->scavengerWorkStealing && ((0 != scavengerStats->_dequeScanCacheCount) || (0 != scavengerStats->_spillScanCacheCount))) {
+		writer->formatAndOutput(env, 1, "<work-stealing queued=\"%zu\" spilled=\"%zu\" stolen=\"%zu\" />",
+				scavengerStats->_dequeScanCacheCount, scavengerStats->_spillScanCacheCount, scavengerStats->_stealScanCacheCount);
+	}
+	if (extensions->scavengerHotFieldCopy && ((0 != scavengerStats->_hotFieldCopyCount) || (0 != scavengerStats->_hotFieldCacheMissCount))) {
+		writer->formatAndOutput(env, 1, "<hot-fields copied=\"%zu\" cachemisses=\"%zu\" />",
+				scavengerStats->_hotFieldCopyCount, scavengerStats->_hotFieldCacheMissCount);
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -865,7 +900,7 @@ MM_VerboseHandlerOutputStandard::outputMemType(MM_EnvironmentBase* env, uintptr_
 		bufPos += omrstr_printf(memInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos," macro-fragmented=\"%zu\"", (size_t) macroFragment);
 	}
 	bufPos += omrstr_printf(memInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, " />");
-	writer->formatAndOutput(env, indent, memInfoBuffer);
+	writer->formatAndOutput(env, indent, "%s", memInfoBuffer);
 }
 
 void
@@ -909,7 +944,7 @@ MM_VerboseHandlerOutputStandard::outputMemoryInfoInnerStanza(MM_EnvironmentBase
 			bufPos += omrstr_printf(tenureMemInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, " macro-fragmented=\"%zu\"", (size_t) stats->_macroFragmentedSize);
 		}
 		bufPos += omrstr_printf(tenureMemInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, ">");
-		writer->formatAndOutput(env, indent, tenureMemInfoBuffer);
+		writer->formatAndOutput(env, indent, "%s", tenureMemInfoBuffer);
 
 		outputMemType(env, indent + 1, "soa", (stats->_totalFreeTenureHeapSize - stats->_totalFreeLOAHeapSize), (stats->_totalTenureHeapSize - stats->_totalLOAHeapSize));
 		outputMemType(env, indent + 1, "loa", stats->_totalFreeLOAHeapSize, stats->_totalLOAHeapSize);
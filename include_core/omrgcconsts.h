@@ -222,6 +222,29 @@ struct ModronLnrlOptions {
 #define MMINLINE_DEBUG inline
 #endif /* OMR_OS_WINDOWS */
 
+/**
+ * Data cache line size assumed by the GC when aligning copy caches and issuing prefetches.
+ */
+#if defined(AIXPPC) || defined(LINUXPPC)
+#define OMR_GC_CACHE_LINE_SIZE 128
+#elif defined(J9ZOS390) || (defined(LINUX) && defined(S390))
+#define OMR_GC_CACHE_LINE_SIZE 256
+#else
+#define OMR_GC_CACHE_LINE_SIZE 64
+#endif
+
+/**
+ * Hint that the cache line containing address will be read soon. A prefetch never faults,
+ * so it may be issued for addresses that have not been validated.
+ */
+#if (__GNUC__ > 3) || (__GNUC__ == 3 && __GNUC_MINOR__ >= 1)
+#define MM_PREFETCH_READ(address) __builtin_prefetch((const void *)(address), 0, 3)
+#elif defined(AIXPPC) && (defined(__IBMC__) || defined(__IBMCPP__))
+#define MM_PREFETCH_READ(address) __dcbt((void *)(address))
+#else /* __GNUC__ */
+#define MM_PREFETCH_READ(address)
+#endif /* __GNUC__ */
+
 /**
  * Lightweight Non-Reentrant Locks (LWNR) Spinlock Support
  * We can't use spinlocks on platforms that do not support semaphores.
@@ -400,7 +423,8 @@ typedef enum {
 	SCAV_RATIO_TOO_LOW,
 	HEAP_RESIZE,
 	SATISFY_EXPAND,
-	FORCED_NURSERY_CONTRACT
+	FORCED_NURSERY_CONTRACT,
+	GC_RATIO_PREDICTED_TOO_LOW
 } ContractReason;
 
 typedef enum {
@@ -411,7 +435,8 @@ typedef enum {
 	SATISFY_COLLECTOR,
 	EXPAND_DESPERATE,
 	FORCED_NURSERY_EXPAND,
-	HINT_PREVIOUS_RUNS
+	HINT_PREVIOUS_RUNS,
+	GC_RATIO_PREDICTED_TOO_HIGH
 } ExpandReason;
 
 typedef enum {
@@ -0,0 +1,148 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Replay the global GCs of a verbose GC log through MM_HeapResizeModel (-Xgc:predictiveHeapSizing)
+ * and report the resize decisions next to the ones recorded in the log.
+ *
+ * The live bytes after each global GC and the GC/mutator times are taken from the log; the heap size is
+ * simulated, starting from the heap size after the first global GC and bounded by the maximum heap size
+ * (the largest logged heap size if the log has no initialized stanza).
+ * Free space is the simulated heap size less the logged live bytes. The GC times are replayed as logged
+ * and therefore do not react to the simulated heap size.
+ */
+
+#include "omr.h"
+#include "omrport.h"
+
+#include "HeapResizeModel.hpp"
+#include "verboseGCAnalyzer.hpp"
+
+/* MM_GCExtensionsBase defaults */
+#define SIMULATED_MINIMUM_FREE_PERCENT 30
+#define SIMULATED_MAXIMUM_FREE_PERCENT 60
+#define SIMULATED_CONTRACTION_GC_TIME_THRESHOLD 5
+#define SIMULATED_EXPANSION_GC_TIME_THRESHOLD 13
+#define SIMULATED_MODEL_WEIGHT 0.3
+#define SIMULATED_STABILIZATION_COUNT 2
+#define SIMULATED_MINIMUM_CONTRACTION 0.01
+#define SIMULATED_MAXIMUM_CONTRACTION 0.05
+
+static const char *
+getReasonAsString(HeapResizeModelReason reason)
+{
+	switch (reason) {
+	case HEAP_RESIZE_MODEL_GC_RATIO:
+		return "gc ratio";
+	case HEAP_RESIZE_MODEL_FREE_TOO_LOW:
+		return "free below minf";
+	case HEAP_RESIZE_MODEL_FREE_TOO_HIGH:
+		return "free above maxf";
+	default:
+		return "none";
+	}
+}
+
+/**
+ * Count the resizes of a sequence and how many of them reversed the direction of the previous one.
+ */
+static void
+countResize(intptr_t direction, uintptr_t *resizes, uintptr_t *reversals, intptr_t *lastDirection)
+{
+	if (0 != direction) {
+		*resizes += 1;
+		if ((0 != *lastDirection) && (direction != *lastDirection)) {
+			*reversals += 1;
+		}
+		*lastDirection = direction;
+	}
+}
+
+void
+simulateHeapResize(const VerboseGCLogAnalysis *analysis, OMRPortLibrary *portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+
+	MM_HeapResizeModel model;
+	uintptr_t maxHeapSize = (uintptr_t)((0 != analysis->maxHeapSize) ? analysis->maxHeapSize : analysis->largestHeapTotal);
+
+	uintptr_t loggedResizes = 0;
+	uintptr_t loggedReversals = 0;
+	intptr_t loggedDirection = 0;
+	for (std::vector<VerboseGCHeapResizeEvent>::const_iterator it = analysis->heapResizes.begin(); it != analysis->heapResizes.end(); ++it) {
+		if (("expand" == it->type) || ("contract" == it->type)) {
+			intptr_t direction = ("expand" == it->type) ? 1 : -1;
+			countResize(direction, &loggedResizes, &loggedReversals, &loggedDirection);
+		}
+	}
+
+	uintptr_t heapSize = 0;
+	uintptr_t globalGCs = 0;
+	uintptr_t simulatedResizes = 0;
+	uintptr_t simulatedReversals = 0;
+	intptr_t simulatedDirection = 0;
+
+	omrtty_printf("Predictive heap sizing replay\n");
+	omrtty_printf("   GC       Live(KB)       Heap(KB)   GC%%       Resize(KB)  Reason\n");
+	omrtty_printf("-------------------------------------------------------------------\n");
+
+	for (std::vector<VerboseGCGlobalSample>::const_iterator it = analysis->globalSamples.begin(); it != analysis->globalSamples.end(); ++it) {
+		uintptr_t loggedTotal = (uintptr_t)it->total;
+		uintptr_t loggedFree = (uintptr_t)it->free;
+		if ((0 == loggedTotal) || (loggedFree > loggedTotal)) {
+			continue;
+		}
+		uintptr_t liveBytes = loggedTotal - loggedFree;
+		if (0 == heapSize) {
+			heapSize = loggedTotal;
+		}
+		/* the logged live set may not fit in the simulated heap: grow it as an allocation failure would */
+		heapSize = OMR_MAX(heapSize, liveBytes);
+
+		intptr_t resize = model.predictResize(heapSize, heapSize - liveBytes, SIMULATED_MODEL_WEIGHT,
+			SIMULATED_CONTRACTION_GC_TIME_THRESHOLD, SIMULATED_EXPANSION_GC_TIME_THRESHOLD,
+			SIMULATED_MINIMUM_FREE_PERCENT, SIMULATED_MAXIMUM_FREE_PERCENT, SIMULATED_STABILIZATION_COUNT,
+			(uintptr_t)(heapSize * SIMULATED_MINIMUM_CONTRACTION));
+		if (0 < resize) {
+			resize = (intptr_t)OMR_MIN((uintptr_t)resize, (maxHeapSize > heapSize) ? (maxHeapSize - heapSize) : 0);
+		} else if (0 > resize) {
+			resize = -(intptr_t)OMR_MIN((uintptr_t)-resize, (uintptr_t)(heapSize * SIMULATED_MAXIMUM_CONTRACTION));
+		}
+		heapSize = (uintptr_t)((intptr_t)heapSize + resize);
+		countResize((0 < resize) ? 1 : ((0 > resize) ? -1 : 0), &simulatedResizes, &simulatedReversals, &simulatedDirection);
+
+		omrtty_printf("%5zu %14zu %14zu %5.1f %16zd  %s\n", globalGCs, liveBytes / 1024, heapSize / 1024,
+			model.getGCPercentage(), resize / 1024, (0 == resize) ? "" : getReasonAsString(model.getLastReason()));
+		globalGCs += 1;
+
+		if (it->ended) {
+			/* the model samples the GC once it has ended, after the resize decision, as MM_HeapResizeStats does */
+			model.recordCycle((uint64_t)(it->gcMillis * 1000.0) + 1, (uint64_t)(it->mutatorMillis * 1000.0) + 1, SIMULATED_MODEL_WEIGHT);
+		}
+	}
+
+	omrtty_printf("-------------------------------------------------------------------\n");
+	omrtty_printf("Global GCs : %zu\n", globalGCs);
+	omrtty_printf("Logged     : %zu resizes, %zu direction reversals\n", loggedResizes, loggedReversals);
+	omrtty_printf("Predictive : %zu resizes, %zu direction reversals, final heap %zu KB\n\n",
+		simulatedResizes, simulatedReversals, heapSize / 1024);
+}
@@ -0,0 +1,338 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "verboseGCAnalyzer.hpp"
+
+VerboseGCHistogram::VerboseGCHistogram()
+	: _count(0)
+	, _totalMillis(0.0)
+	, _minMillis(0.0)
+	, _maxMillis(0.0)
+{
+	memset(_counts, 0, sizeof(_counts));
+}
+
+void
+VerboseGCHistogram::add(double millis)
+{
+	if (millis < 0.0) {
+		millis = 0.0;
+	}
+	uint64_t micros = (uint64_t)(millis * 1000.0 + 0.5);
+	uintptr_t bucket = 0;
+	if (micros < VERBOSEGC_HISTOGRAM_SUB_BUCKETS) {
+		bucket = (uintptr_t)micros;
+	} else {
+		uintptr_t shift = 0;
+		while ((micros >> shift) >= (2 * VERBOSEGC_HISTOGRAM_SUB_BUCKETS)) {
+			shift += 1;
+		}
+		bucket = (shift * VERBOSEGC_HISTOGRAM_SUB_BUCKETS) + (uintptr_t)(micros >> shift);
+	}
+	_counts[bucket] += 1;
+
+	if ((0 == _count) || (millis < _minMillis)) {
+		_minMillis = millis;
+	}
+	if ((0 == _count) || (millis > _maxMillis)) {
+		_maxMillis = millis;
+	}
+	_count += 1;
+	_totalMillis += millis;
+}
+
+void
+VerboseGCHistogram::merge(const VerboseGCHistogram *other)
+{
+	if (0 == other->_count) {
+		return;
+	}
+	for (uintptr_t bucket = 0; bucket < VERBOSEGC_HISTOGRAM_BUCKETS; bucket++) {
+		_counts[bucket] += other->_counts[bucket];
+	}
+	if ((0 == _count) || (other->_minMillis < _minMillis)) {
+		_minMillis = other->_minMillis;
+	}
+	if ((0 == _count) || (other->_maxMillis > _maxMillis)) {
+		_maxMillis = other->_maxMillis;
+	}
+	_count += other->_count;
+	_totalMillis += other->_totalMillis;
+}
+
+double
+VerboseGCHistogram::getBucketLow(uintptr_t bucket)
+{
+	if (bucket < VERBOSEGC_HISTOGRAM_SUB_BUCKETS) {
+		return bucket / 1000.0;
+	}
+	uintptr_t shift = (bucket / VERBOSEGC_HISTOGRAM_SUB_BUCKETS) - 1;
+	uint64_t mantissa = bucket - (shift * VERBOSEGC_HISTOGRAM_SUB_BUCKETS);
+	return (double)(mantissa << shift) / 1000.0;
+}
+
+double
+VerboseGCHistogram::getBucketHigh(uintptr_t bucket)
+{
+	if (bucket < VERBOSEGC_HISTOGRAM_SUB_BUCKETS) {
+		return bucket / 1000.0;
+	}
+	uintptr_t shift = (bucket / VERBOSEGC_HISTOGRAM_SUB_BUCKETS) - 1;
+	uint64_t mantissa = bucket - (shift * VERBOSEGC_HISTOGRAM_SUB_BUCKETS);
+	return (double)(((mantissa + 1) << shift) - 1) / 1000.0;
+}
+
+double
+VerboseGCHistogram::getPercentile(double percentile) const
+{
+	if (0 == _count) {
+		return 0.0;
+	}
+	uint64_t rank = (uint64_t)((percentile / 100.0) * _count + 0.999999);
+	rank = OMR_MAX(OMR_MIN(rank, _count), (uint64_t)1);
+	uint64_t cumulative = 0;
+	for (uintptr_t bucket = 0; bucket < VERBOSEGC_HISTOGRAM_BUCKETS; bucket++) {
+		cumulative += _counts[bucket];
+		if (cumulative >= rank) {
+			return OMR_MAX(OMR_MIN(getBucketHigh(bucket), _maxMillis), _minMillis);
+		}
+	}
+	return _maxMillis;
+}
+
+static void
+mergeHistograms(VerboseGCHistogramMap *histograms, const VerboseGCHistogramMap *other)
+{
+	for (VerboseGCHistogramMap::const_iterator it = other->begin(); it != other->end(); ++it) {
+		(*histograms)[it->first].merge(&it->second);
+	}
+}
+
+void
+VerboseGCLogAnalysis::merge(const VerboseGCLogAnalysis *next)
+{
+	files += next->files;
+	failedFiles += next->failedFiles;
+	cycles += next->cycles;
+	droppedCycles += next->droppedCycles;
+	pauses.merge(&next->pauses);
+	mergeHistograms(&collections, &next->collections);
+	mergeHistograms(&phases, &next->phases);
+	mergeHistograms(&heapResizeTimes, &next->heapResizeTimes);
+	timeline.insert(timeline.end(), next->timeline.begin(), next->timeline.end());
+	heapResizes.insert(heapResizes.end(), next->heapResizes.begin(), next->heapResizes.end());
+	globalSamples.insert(globalSamples.end(), next->globalSamples.begin(), next->globalSamples.end());
+	if (0 == maxHeapSize) {
+		maxHeapSize = next->maxHeapSize;
+	}
+	largestHeapTotal = OMR_MAX(largestHeapTotal, next->largestHeapTotal);
+}
+
+bool
+VerboseGCAnalyzer::analyzeFile(const char *fileName, OMRPortLibrary *portLibrary)
+{
+	bool result = readVerboseGCLog(fileName, this, portLibrary);
+	_analysis->files += 1;
+	if (!result) {
+		_analysis->failedFiles += 1;
+	}
+	return result;
+}
+
+double
+VerboseGCAnalyzer::parseTimestamp(const char *timestamp)
+{
+	int year = 0;
+	unsigned int month = 0;
+	unsigned int day = 0;
+	unsigned int hour = 0;
+	unsigned int minute = 0;
+	unsigned int second = 0;
+	unsigned int millis = 0;
+	if ((NULL == timestamp)
+		|| (7 != sscanf(timestamp, "%d-%u-%uT%u:%u:%u.%u", &year, &month, &day, &hour, &minute, &second, &millis))
+		|| (0 == month) || (month > 12)
+	) {
+		return 0.0;
+	}
+
+	/* days since the epoch of a proleptic Gregorian date */
+	int y = year - ((month <= 2) ? 1 : 0);
+	int era = ((y >= 0) ? y : (y - 399)) / 400;
+	unsigned int yearOfEra = (unsigned int)(y - era * 400);
+	unsigned int dayOfYear = (153 * (month + ((month > 2) ? -3 : 9)) + 2) / 5 + day - 1;
+	unsigned int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+	double days = (double)era * 146097.0 + (double)dayOfEra - 719468.0;
+
+	return ((days * 86400.0) + (hour * 3600.0) + (minute * 60.0) + second) * 1000.0 + millis;
+}
+
+VerboseGCAnalyzer::ElementType
+VerboseGCAnalyzer::getElementType(const char *name)
+{
+	static const struct {
+		const char *name;
+		ElementType type;
+	} elements[] = {
+		{ "initialized", ELEMENT_INITIALIZED },
+		{ "attribute", ELEMENT_ATTRIBUTE },
+		{ "exclusive-start", ELEMENT_EXCLUSIVE_START },
+		{ "exclusive-end", ELEMENT_EXCLUSIVE_END },
+		{ "allocation-stats", ELEMENT_ALLOCATION_STATS },
+		{ "gc-end", ELEMENT_GC_END },
+		{ "gc-op", ELEMENT_GC_OP },
+		{ "heap-resize", ELEMENT_HEAP_RESIZE },
+		{ "mem-info", ELEMENT_MEM_INFO }
+	};
+
+	for (uintptr_t i = 0; i < sizeof(elements) / sizeof(elements[0]); i++) {
+		if (0 == strcmp(name, elements[i].name)) {
+			return elements[i].type;
+		}
+	}
+	return ELEMENT_OTHER;
+}
+
+static double
+getDouble(const char *value)
+{
+	return (NULL == value) ? 0.0 : strtod(value, NULL);
+}
+
+static uint64_t
+getUnsigned(const char *value)
+{
+	return (NULL == value) ? 0 : (uint64_t)strtoull(value, NULL, 0);
+}
+
+static const char *
+getString(const char *value)
+{
+	return (NULL == value) ? "" : value;
+}
+
+void
+VerboseGCAnalyzer::startElement(const char *name, const VerboseGCAttribute *attributes, uintptr_t attributeCount)
+{
+	ElementType type = getElementType(name);
+	ElementType parent = getParentType();
+
+#define ATTRIBUTE(attributeName) findAttribute(attributes, attributeCount, attributeName)
+	switch (type) {
+	case ELEMENT_ATTRIBUTE:
+		if ((ELEMENT_INITIALIZED == parent) && (0 == strcmp(getString(ATTRIBUTE("name")), "maxHeapSize"))) {
+			_analysis->maxHeapSize = getUnsigned(ATTRIBUTE("value"));
+		}
+		break;
+	case ELEMENT_EXCLUSIVE_START:
+		_timestampMillis = parseTimestamp(ATTRIBUTE("timestamp"));
+		_intervalMillis = getDouble(ATTRIBUTE("intervalms"));
+		_allocatedBytes = 0;
+		_heapTotal = 0;
+		_heapFree = 0;
+		_globalEnded = false;
+		_globalSample = -1;
+		break;
+	case ELEMENT_EXCLUSIVE_END:
+	{
+		double pauseMillis = getDouble(ATTRIBUTE("durationms"));
+		_analysis->cycles += 1;
+		_analysis->pauses.add(pauseMillis);
+		VerboseGCAllocationSample sample = { _timestampMillis, _intervalMillis, _allocatedBytes, pauseMillis, _heapTotal, _heapFree };
+		_analysis->timeline.push_back(sample);
+		if (-1 != _globalSample) {
+			_analysis->globalSamples[_globalSample].gcMillis = pauseMillis;
+			_analysis->globalSamples[_globalSample].ended = true;
+			_globalSample = -1;
+		}
+		break;
+	}
+	case ELEMENT_ALLOCATION_STATS:
+		_allocatedBytes += getUnsigned(ATTRIBUTE("totalBytes"));
+		break;
+	case ELEMENT_GC_END:
+		_analysis->collections[getString(ATTRIBUTE("type"))].add(getDouble(ATTRIBUTE("durationms")));
+		_globalEnded = (0 == strcmp(getString(ATTRIBUTE("type")), "global"));
+		break;
+	case ELEMENT_GC_OP:
+		_analysis->phases[getString(ATTRIBUTE("type"))].add(getDouble(ATTRIBUTE("timems")));
+		break;
+	case ELEMENT_HEAP_RESIZE:
+	{
+		VerboseGCHeapResizeEvent event;
+		event.timestampMillis = parseTimestamp(ATTRIBUTE("timestamp"));
+		event.type = getString(ATTRIBUTE("type"));
+		event.space = getString(ATTRIBUTE("space"));
+		event.amount = getUnsigned(ATTRIBUTE("amount"));
+		event.millis = getDouble(ATTRIBUTE("timems"));
+		event.reason = getString(ATTRIBUTE("reason"));
+		_analysis->heapResizeTimes[event.type].add(event.millis);
+		_analysis->heapResizes.push_back(event);
+		break;
+	}
+	case ELEMENT_MEM_INFO:
+	{
+		uint64_t total = getUnsigned(ATTRIBUTE("total"));
+		uint64_t free = getUnsigned(ATTRIBUTE("free"));
+		_analysis->largestHeapTotal = OMR_MAX(_analysis->largestHeapTotal, total);
+		if (ELEMENT_GC_END == parent) {
+			_heapTotal = total;
+			_heapFree = free;
+			if (_globalEnded) {
+				VerboseGCGlobalSample sample = { total, free, 0.0, _intervalMillis, false };
+				_analysis->globalSamples.push_back(sample);
+				_globalSample = (intptr_t)_analysis->globalSamples.size() - 1;
+				_globalEnded = false;
+			}
+		}
+		break;
+	}
+	default:
+		break;
+	}
+#undef ATTRIBUTE
+
+	if (_depth < MAX_DEPTH) {
+		_stack[_depth] = type;
+	}
+	_depth += 1;
+}
+
+void
+VerboseGCAnalyzer::endElement(const char *name)
+{
+	if (0 < _depth) {
+		_depth -= 1;
+	}
+}
+
+void
+VerboseGCAnalyzer::comment(const char *text)
+{
+	/* written by the asynchronous writer in place of the cycles it had to drop */
+	if (NULL != strstr(text, " verbose GC cycles dropped")) {
+		_analysis->droppedCycles += (uint64_t)strtoull(text, NULL, 10);
+	}
+}
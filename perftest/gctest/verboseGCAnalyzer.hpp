@@ -0,0 +1,247 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEGCANALYZER_HPP_)
+#define VERBOSEGCANALYZER_HPP_
+
+#include <stdio.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "omr.h"
+#include "omrport.h"
+
+#include "verboseGCStreamParser.hpp"
+
+/**
+ * Log-linear histogram of durations, with a bounded relative error and a fixed size whatever the number of
+ * samples. Durations are recorded in microseconds: below VERBOSEGC_HISTOGRAM_SUB_BUCKETS each microsecond has
+ * its own bucket, above it each power of two is split into VERBOSEGC_HISTOGRAM_SUB_BUCKETS buckets (6.25% wide).
+ */
+#define VERBOSEGC_HISTOGRAM_SUB_BUCKET_BITS 4
+#define VERBOSEGC_HISTOGRAM_SUB_BUCKETS (1 << VERBOSEGC_HISTOGRAM_SUB_BUCKET_BITS)
+#define VERBOSEGC_HISTOGRAM_BUCKETS (VERBOSEGC_HISTOGRAM_SUB_BUCKETS * (64 - VERBOSEGC_HISTOGRAM_SUB_BUCKET_BITS + 1))
+
+class VerboseGCHistogram
+{
+	/*
+	 * Data members
+	 */
+private:
+	uint64_t _counts[VERBOSEGC_HISTOGRAM_BUCKETS];
+	uint64_t _count;
+	double _totalMillis;
+	double _minMillis;
+	double _maxMillis;
+
+	/*
+	 * Function members
+	 */
+public:
+	void add(double millis);
+	void merge(const VerboseGCHistogram *other);
+
+	/**
+	 * @param percentile in ]0, 100]
+	 * @return the highest duration of the bucket holding the percentile, bounded by the maximum duration
+	 */
+	double getPercentile(double percentile) const;
+
+	uint64_t getCount() const { return _count; }
+	double getTotal() const { return _totalMillis; }
+	double getMin() const { return _minMillis; }
+	double getMax() const { return _maxMillis; }
+	double getMean() const { return (0 == _count) ? 0.0 : (_totalMillis / _count); }
+
+	uint64_t getBucketCount(uintptr_t bucket) const { return _counts[bucket]; }
+	static double getBucketLow(uintptr_t bucket);
+	static double getBucketHigh(uintptr_t bucket);
+
+	VerboseGCHistogram();
+};
+
+/**
+ * One mutator interval and the GC pause that ended it.
+ */
+typedef struct VerboseGCAllocationSample {
+	double timestampMillis; /**< start of the pause, in milliseconds since the epoch (in the time zone of the log) */
+	double intervalMillis; /**< mutator time since the previous pause */
+	uint64_t allocatedBytes; /**< bytes allocated during the interval */
+	double pauseMillis;
+	uint64_t heapTotal; /**< heap size after the pause, or 0 if no collection reported it */
+	uint64_t heapFree;
+} VerboseGCAllocationSample;
+
+typedef struct VerboseGCHeapResizeEvent {
+	double timestampMillis;
+	std::string type; /**< expand or contract */
+	std::string space;
+	uint64_t amount;
+	double millis;
+	std::string reason;
+} VerboseGCHeapResizeEvent;
+
+/**
+ * Heap occupancy after a global GC, replayed by simulateHeapResize().
+ */
+typedef struct VerboseGCGlobalSample {
+	uint64_t total;
+	uint64_t free;
+	double gcMillis; /**< duration of the pause of the GC, valid if ended */
+	double mutatorMillis; /**< mutator time before the pause */
+	bool ended; /**< true if the end of the pause was logged */
+} VerboseGCGlobalSample;
+
+typedef std::map<std::string, VerboseGCHistogram> VerboseGCHistogramMap;
+
+/**
+ * Everything gathered from one verbose GC log, or from the rotated files of a log once merged in order.
+ */
+class VerboseGCLogAnalysis
+{
+	/*
+	 * Data members
+	 */
+public:
+	std::string name;
+	uintptr_t files; /**< files analyzed */
+	uintptr_t failedFiles; /**< files that could not be read */
+	uint64_t cycles; /**< pauses logged */
+	uint64_t droppedCycles; /**< cycles dropped by the asynchronous writer */
+	VerboseGCHistogram pauses; /**< exclusive access durations */
+	VerboseGCHistogramMap collections; /**< gc-end durations by collection type */
+	VerboseGCHistogramMap phases; /**< gc-op durations by phase */
+	VerboseGCHistogramMap heapResizeTimes; /**< heap-resize durations by resize type */
+	std::vector<VerboseGCAllocationSample> timeline;
+	std::vector<VerboseGCHeapResizeEvent> heapResizes;
+	std::vector<VerboseGCGlobalSample> globalSamples;
+	uint64_t maxHeapSize; /**< from the initialized stanza, or 0 */
+	uint64_t largestHeapTotal; /**< largest heap size logged */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Append the analysis of the next file of the same log.
+	 */
+	void merge(const VerboseGCLogAnalysis *next);
+
+	VerboseGCLogAnalysis()
+		: files(0)
+		, failedFiles(0)
+		, cycles(0)
+		, droppedCycles(0)
+		, maxHeapSize(0)
+		, largestHeapTotal(0)
+	{
+	}
+};
+
+/**
+ * Gathers a VerboseGCLogAnalysis from the elements of a verbose GC log, in a single pass.
+ */
+class VerboseGCAnalyzer : public VerboseGCStreamParser
+{
+	/*
+	 * Data members
+	 */
+private:
+	typedef enum {
+		ELEMENT_OTHER = 0,
+		ELEMENT_INITIALIZED,
+		ELEMENT_ATTRIBUTE,
+		ELEMENT_EXCLUSIVE_START,
+		ELEMENT_EXCLUSIVE_END,
+		ELEMENT_ALLOCATION_STATS,
+		ELEMENT_GC_END,
+		ELEMENT_GC_OP,
+		ELEMENT_HEAP_RESIZE,
+		ELEMENT_MEM_INFO
+	} ElementType;
+
+	static const uintptr_t MAX_DEPTH = 32;
+
+	VerboseGCLogAnalysis *_analysis;
+	ElementType _stack[MAX_DEPTH]; /**< types of the open elements, up to MAX_DEPTH */
+	uintptr_t _depth;
+
+	/* state of the current pause */
+	double _timestampMillis;
+	double _intervalMillis;
+	uint64_t _allocatedBytes;
+	uint64_t _heapTotal;
+	uint64_t _heapFree;
+	bool _globalEnded; /**< a global gc-end was seen and its mem-info is expected */
+	intptr_t _globalSample; /**< index of the global sample of the pause, or -1 */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Analyze a verbose GC log file into the analysis.
+	 * @return false if the file could not be read
+	 */
+	bool analyzeFile(const char *fileName, OMRPortLibrary *portLibrary);
+
+	/**
+	 * @return milliseconds since the epoch of a verbose GC timestamp (yyyy-mm-ddThh:mm:ss.mmm), or 0 if malformed
+	 */
+	static double parseTimestamp(const char *timestamp);
+
+	VerboseGCAnalyzer(VerboseGCLogAnalysis *analysis)
+		: VerboseGCStreamParser()
+		, _analysis(analysis)
+		, _depth(0)
+		, _timestampMillis(0.0)
+		, _intervalMillis(0.0)
+		, _allocatedBytes(0)
+		, _heapTotal(0)
+		, _heapFree(0)
+		, _globalEnded(false)
+		, _globalSample(-1)
+	{
+	}
+
+protected:
+	virtual void startElement(const char *name, const VerboseGCAttribute *attributes, uintptr_t attributeCount);
+	virtual void endElement(const char *name);
+	virtual void comment(const char *text);
+
+private:
+	static ElementType getElementType(const char *name);
+	ElementType getParentType() const { return ((0 == _depth) || (_depth > MAX_DEPTH)) ? ELEMENT_OTHER : _stack[_depth - 1]; }
+};
+
+/**
+ * Replay the global GCs of an analysis through MM_HeapResizeModel (heapResizeSimulator.cpp).
+ */
+void simulateHeapResize(const VerboseGCLogAnalysis *analysis, OMRPortLibrary *portLibrary);
+
+/* Reports (verboseGCReport.cpp) */
+void printVerboseGCReport(const VerboseGCLogAnalysis *analysis, OMRPortLibrary *portLibrary);
+void writeVerboseGCCSV(FILE *file, const std::vector<VerboseGCLogAnalysis *> *analyses);
+void writeVerboseGCJSON(FILE *file, const std::vector<VerboseGCLogAnalysis *> *analyses);
+
+#endif /* VERBOSEGCANALYZER_HPP_ */
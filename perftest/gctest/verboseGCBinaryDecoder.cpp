@@ -0,0 +1,166 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Decode binary verbose GC logs (-Xgc:binaryLogging) into the equivalent XML log, see VerboseBinaryFormat.hpp.
+ *
+ * A log that was not closed is decoded up to its last complete record and given the closing verbosegc element.
+ */
+
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "omr.h"
+#include "omrport.h"
+
+#include "VerboseBinaryFormat.hpp"
+
+#include "verboseGCStreamParser.hpp"
+
+#define VERBOSEGC_BINARY_FOOTER "</verbosegc>"
+
+bool
+isVerboseGCBinaryLog(const char *fileName, OMRPortLibrary *portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	char magic[VERBOSEGC_BINARY_MAGIC_LENGTH];
+	bool result = false;
+
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0444);
+	if (-1 != fd) {
+		result = (VERBOSEGC_BINARY_MAGIC_LENGTH == omrfile_read(fd, magic, VERBOSEGC_BINARY_MAGIC_LENGTH))
+				&& (0 == memcmp(magic, VERBOSEGC_BINARY_MAGIC, VERBOSEGC_BINARY_MAGIC_LENGTH));
+		omrfile_close(fd);
+	}
+	return result;
+}
+
+/**
+ * Read a whole file.
+ * @return false if the file could not be read
+ */
+static bool
+readFile(const char *fileName, std::vector<uint8_t> *contents, OMRPortLibrary *portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+
+	int64_t fileLength = omrfile_length(fileName);
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0444);
+	if ((fileLength < 0) || (-1 == fd)) {
+		if (-1 != fd) {
+			omrfile_close(fd);
+		}
+		return false;
+	}
+
+	bool result = true;
+	contents->resize((size_t)fileLength);
+	int64_t offset = 0;
+	while (result && (offset < fileLength)) {
+		intptr_t bytesRead = omrfile_read(fd, &(*contents)[(size_t)offset], (intptr_t)(fileLength - offset));
+		if (bytesRead <= 0) {
+			result = false;
+		} else {
+			offset += bytesRead;
+		}
+	}
+	omrfile_close(fd);
+	return result;
+}
+
+bool
+decodeVerboseGCBinaryLog(const char *fileName, VerboseGCLogSink *sink, OMRPortLibrary *portLibrary)
+{
+	std::vector<uint8_t> contents;
+	if (!readFile(fileName, &contents, portLibrary)
+		|| (contents.size() < VERBOSEGC_BINARY_MAGIC_LENGTH)
+		|| (0 != memcmp(&contents[0], VERBOSEGC_BINARY_MAGIC, VERBOSEGC_BINARY_MAGIC_LENGTH))
+	) {
+		return false;
+	}
+
+	std::vector<std::string> formats;
+	std::vector<char> line(512);
+	bool closed = false;
+	uintptr_t length = contents.size();
+	uintptr_t offset = VERBOSEGC_BINARY_MAGIC_LENGTH;
+	while ((offset + sizeof(VerboseGCBinaryRecordHeader)) <= length) {
+		VerboseGCBinaryRecordHeader header;
+		memcpy(&header, &contents[offset], sizeof(header));
+		if ((offset + sizeof(header) + header.length) > length) {
+			/* truncated by an abrupt end of the process */
+			break;
+		}
+		offset += sizeof(header);
+		const uint8_t *payload = &contents[offset];
+
+		switch (header.type) {
+		case VERBOSEGC_BINARY_RECORD_TEXT:
+			sink->write((const char *)payload, header.length);
+			if ((header.length >= strlen(VERBOSEGC_BINARY_FOOTER)) && (0 == memcmp(payload, VERBOSEGC_BINARY_FOOTER, strlen(VERBOSEGC_BINARY_FOOTER)))) {
+				closed = true;
+			}
+			break;
+		case VERBOSEGC_BINARY_RECORD_FORMAT:
+		{
+			uint32_t id = 0;
+			if (header.length >= sizeof(id)) {
+				memcpy(&id, payload, sizeof(id));
+				if (id >= formats.size()) {
+					formats.resize(id + 1);
+				}
+				formats[id].assign((const char *)payload + sizeof(id), header.length - sizeof(id));
+			}
+			break;
+		}
+		case VERBOSEGC_BINARY_RECORD_LINE:
+		{
+			uint32_t lineHeader[2];
+			if (header.length >= sizeof(lineHeader)) {
+				memcpy(lineHeader, payload, sizeof(lineHeader));
+				if (lineHeader[0] < formats.size()) {
+					const char *format = formats[lineHeader[0]].c_str();
+					const uint8_t *arguments = payload + sizeof(lineHeader);
+					uintptr_t argumentsLength = header.length - sizeof(lineHeader);
+					uintptr_t lineLength = MM_VerboseBinaryFormat::formatLine(portLibrary, &line[0], line.size(), lineHeader[1], format, arguments, argumentsLength);
+					if (lineLength >= line.size()) {
+						line.resize(lineLength + 1);
+						lineLength = MM_VerboseBinaryFormat::formatLine(portLibrary, &line[0], line.size(), lineHeader[1], format, arguments, argumentsLength);
+					}
+					sink->write(&line[0], lineLength);
+				}
+			}
+			break;
+		}
+		default:
+			/* skip records of later versions of the format */
+			break;
+		}
+		offset += header.length;
+	}
+
+	if (!closed) {
+		sink->write(VERBOSEGC_BINARY_FOOTER "\n", strlen(VERBOSEGC_BINARY_FOOTER "\n"));
+	}
+	return true;
+}
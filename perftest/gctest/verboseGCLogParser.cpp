@@ -20,188 +20,311 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+/*
+ * Analyze verbose GC logs in a single streaming pass per file: pause percentiles and histograms, per
+ * collection and per phase durations, the allocation rate timeline, the heap resizes and a replay of the
+ * global GCs through the predictive heap sizing model.
+ *
+ * Usage: omrperfgctest [-threads <n>] [-csv <file>] [-json <file>] [-keep] [<log>...]
+ *        omrperfgctest -decode <log>
+ *
+ * Without log arguments the VerboseGC* files of the current directory are analyzed, then deleted unless
+ * -keep is given. The rotated files of a log (<log>.001, <log>.002, ...) are reported together, in order.
+ * Files are parsed on up to <n> threads (1 by default). -csv and -json write summaries for regression
+ * dashboards, see verboseGCReport.cpp. Binary logs (-Xgc:binaryLogging) are analyzed like XML logs; -decode
+ * prints the XML equivalent of a binary log instead, see verboseGCBinaryDecoder.cpp.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <algorithm>
+#include <string>
 #include <vector>
-#include <iterator>
-#include <numeric>
-#include <stdio.h>
-
-#include "pugixml.hpp"
 
 #include "omr.h"
 #include "omrport.h"
 #include "omrthread.h"
 
-const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
-const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
-const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
-const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
+#include "verboseGCAnalyzer.hpp"
+
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
 
-double getAvg(std::vector<double> v);
-void analyze(char* fileName, OMRPortLibrary portLibrary);
-
-int main(void)
+typedef struct VerboseGCFile {
+	std::string path;
+	std::string log; /**< path without the rotation sequence number */
+	uintptr_t sequence; /**< rotation sequence number, or 0 */
+	VerboseGCLogAnalysis *analysis;
+} VerboseGCFile;
+
+typedef struct AnalysisWork {
+	std::vector<VerboseGCFile> *files;
+	OMRPortLibrary *portLibrary;
+	omrthread_monitor_t monitor;
+	uintptr_t next; /**< index of the next file to analyze */
+	uintptr_t doneCount; /**< threads done */
+} AnalysisWork;
+
+static bool
+compareFiles(const VerboseGCFile &left, const VerboseGCFile &right)
 {
-	int32_t totalFiles = 0;
-	intptr_t rc = 0;
-	char resultBuffer[128];
-	uintptr_t rcFile;
-	uintptr_t handle;
-	OMRPortLibrary portLibrary;
+	int order = left.log.compare(right.log);
+	return (0 != order) ? (order < 0) : (left.sequence < right.sequence);
+}
 
-	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
-	if (0 != rc) {
-		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
-		return -1;
+/**
+ * Add a file, splitting the sequence number of a rotated file (.001, .002, ...) from the name of its log.
+ */
+static void
+addFile(std::vector<VerboseGCFile> *files, const char *path)
+{
+	VerboseGCFile file;
+	file.path = path;
+	file.log = path;
+	file.sequence = 0;
+	file.analysis = NULL;
+
+	const char *dot = strrchr(path, '.');
+	if ((NULL != dot) && (strlen(dot + 1) >= 3) && (strspn(dot + 1, "0123456789") == strlen(dot + 1))) {
+		file.log.assign(path, dot - path);
+		file.sequence = (uintptr_t)strtoul(dot + 1, NULL, 10);
 	}
+	files->push_back(file);
+}
 
-	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
-	if (0 != rc) {
-		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
-		return -1;
+static void
+analyzeFiles(AnalysisWork *work)
+{
+	for (;;) {
+		omrthread_monitor_enter(work->monitor);
+		uintptr_t index = work->next;
+		work->next += 1;
+		omrthread_monitor_exit(work->monitor);
+		if (index >= work->files->size()) {
+			break;
+		}
+
+		VerboseGCFile *file = &(*work->files)[index];
+		VerboseGCAnalyzer analyzer(file->analysis);
+		analyzer.analyzeFile(file->path.c_str(), work->portLibrary);
 	}
+}
 
-	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+static int J9THREAD_PROC
+analysisThread(void *entryArg)
+{
+	AnalysisWork *work = (AnalysisWork *)entryArg;
 
-	rcFile = handle = omrfile_findfirst(SRC_DIR, resultBuffer);
+	analyzeFiles(work);
 
-	if(rcFile == (uintptr_t)-1) {
-		fprintf(stderr, "omrfile_findfirst(SRC_DIR, resultBuffer), return code=%d\n", (int)rcFile);
-		return -1;
+	omrthread_monitor_enter(work->monitor);
+	work->doneCount += 1;
+	omrthread_monitor_notify_all(work->monitor);
+	omrthread_monitor_exit(work->monitor);
+
+	return 0;
+}
+
+/**
+ * Analyze the files on up to threadCount threads, including the current one.
+ * @return false if the files could not be analyzed
+ */
+static bool
+analyzeFilesInParallel(std::vector<VerboseGCFile> *files, uintptr_t threadCount, OMRPortLibrary *portLibrary)
+{
+	AnalysisWork work;
+	work.files = files;
+	work.portLibrary = portLibrary;
+	work.monitor = NULL;
+	work.next = 0;
+	work.doneCount = 0;
+
+	if (0 != omrthread_monitor_init_with_name(&work.monitor, 0, "verboseGCLogParser")) {
+		return false;
 	}
 
-	while ((uintptr_t)-1 != rcFile) {
-		if (strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) {
-			analyze(resultBuffer, portLibrary);
-			totalFiles++;
-			/* Clean up verbose log file */
-			omrfile_unlink(resultBuffer);
+	uintptr_t started = 0;
+	for (; (started + 1) < OMR_MIN(threadCount, files->size()); started++) {
+		omrthread_t handle = NULL;
+		if (0 != omrthread_create(&handle, 0, J9THREAD_PRIORITY_NORMAL, 0, analysisThread, &work)) {
+			break;
 		}
-		rcFile = omrfile_findnext(handle, resultBuffer);
-	}
-	if (handle != (uintptr_t)-1) {
-		omrfile_findclose(handle);
 	}
 
-	if(totalFiles < 1) {
-		omrtty_printf("Failed to find any verbose GC file to process!\n\n");
-	}
+	analyzeFiles(&work);
 
-	portLibrary.port_shutdown_library(&portLibrary);
-	omrthread_detach(NULL);
+	omrthread_monitor_enter(work.monitor);
+	while (work.doneCount < started) {
+		omrthread_monitor_wait(work.monitor);
+	}
+	omrthread_monitor_exit(work.monitor);
+	omrthread_monitor_destroy(work.monitor);
+	return true;
 }
 
-double
-getAvg(std::vector<double> v)
+static bool
+writeSummary(const char *fileName, void (*writer)(FILE *, const std::vector<VerboseGCLogAnalysis *> *), const std::vector<VerboseGCLogAnalysis *> *analyses)
 {
-	double sum = std::accumulate(v.begin(), v.end(), 0.0);
-	double avg = sum / v.size();
-	return avg;
+	FILE *file = fopen(fileName, "w");
+	if (NULL == file) {
+		fprintf(stderr, "Failed to open %s\n", fileName);
+		return false;
+	}
+	writer(file, analyses);
+	fclose(file);
+	return true;
 }
 
-void
-analyze(char* fileName, OMRPortLibrary portLibrary)
+static int
+printUsage(const char *program)
 {
-	std::vector<double> mark_values;
-	std::vector<double> sweep_values;
-	std::vector<double> expand_values;
-	std::vector<double> gcduration_values;
+	fprintf(stderr, "Usage: %s [-threads <n>] [-csv <file>] [-json <file>] [-keep] [<log>...]\n", program);
+	fprintf(stderr, "       %s -decode <log>\n", program);
+	return -1;
+}
 
-	pugi::xpath_node_set markTimes;
-	pugi::xpath_node_set sweepTimes;
-	pugi::xpath_node_set expandTimes;
-	pugi::xpath_node_set gcTimes;
+/**
+ * Writes the XML text of a decoded binary log to a file.
+ */
+class VerboseGCFileSink : public VerboseGCLogSink
+{
+private:
+	FILE *_file;
 
-	double maxMark = 0;
-	double minMark = 0;
-	double avgMark = 0;
+public:
+	virtual void write(const char *text, uintptr_t length) { fwrite(text, 1, length, _file); }
 
-	double maxSweep = 0;
-	double minSweep = 0;
-	double avgSweep = 0;
+	VerboseGCFileSink(FILE *file) : _file(file) {}
+};
 
-	double maxExpand = 0;
-	double minExpand = 0;
-	double avgExpand = 0;
+int main(int argc, char **argv)
+{
+	int32_t totalFiles = 0;
+	intptr_t rc = 0;
+	char resultBuffer[128];
+	uintptr_t rcFile;
+	uintptr_t handle;
+	OMRPortLibrary portLibrary;
+	const char *csvFile = NULL;
+	const char *jsonFile = NULL;
+	uintptr_t threadCount = 1;
+	bool keep = false;
+	const char *decodeFile = NULL;
+	std::vector<VerboseGCFile> files;
+
+	for (int i = 1; i < argc; i++) {
+		bool hasValue = (i + 1) < argc;
+		if ((0 == strcmp(argv[i], "-csv")) && hasValue) {
+			csvFile = argv[++i];
+		} else if ((0 == strcmp(argv[i], "-json")) && hasValue) {
+			jsonFile = argv[++i];
+		} else if ((0 == strcmp(argv[i], "-threads")) && hasValue) {
+			threadCount = (uintptr_t)strtoul(argv[++i], NULL, 10);
+			if (0 == threadCount) {
+				return printUsage(argv[0]);
+			}
+		} else if (0 == strcmp(argv[i], "-keep")) {
+			keep = true;
+		} else if ((0 == strcmp(argv[i], "-decode")) && hasValue) {
+			decodeFile = argv[++i];
+		} else if ('-' == argv[i][0]) {
+			return printUsage(argv[0]);
+		} else {
+			addFile(&files, argv[i]);
+		}
+	}
+	/* logs given as arguments are never deleted */
+	keep = keep || !files.empty();
 
-	double maxGCDuration = 0;
-	double minGCDuration = 0;
-	double avgGCDuration = 0;
+	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
+	}
 
-	pugi::xml_document doc;
-	pugi::xml_parse_result result = doc.load_file(fileName);
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
+	}
 
 	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
-	if(!result) {
-		omrtty_printf("Error loading file : %s\n", fileName);
-		return;
-	} else {
-		omrtty_printf("\nResults for : %s\n",fileName);
-	}
 
-	markTimes = doc.select_nodes(XPATH_GET_ALL_MARK_TIME);
-	for (pugi::xpath_node_set::const_iterator it = markTimes.begin(); it != markTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("timems").as_double();
-	    mark_values.push_back(value);
+	if (NULL != decodeFile) {
+		VerboseGCFileSink sink(stdout);
+		if (!decodeVerboseGCBinaryLog(decodeFile, &sink, &portLibrary)) {
+			fprintf(stderr, "%s is not a binary verbose GC log\n", decodeFile);
+			rc = -1;
+		}
+		portLibrary.port_shutdown_library(&portLibrary);
+		omrthread_detach(NULL);
+		return (int)rc;
 	}
 
-	sweepTimes = doc.select_nodes(XPATH_GET_ALL_SWEEP_TIME);
-	for (pugi::xpath_node_set::const_iterator it = sweepTimes.begin(); it != sweepTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("timems").as_double();
-	    sweep_values.push_back(value);
-	}
+	if (files.empty()) {
+		rcFile = handle = omrfile_findfirst(SRC_DIR, resultBuffer);
 
-	expandTimes = doc.select_nodes(XPATH_GET_ALL_EXPAND_TIME);
-	for (pugi::xpath_node_set::const_iterator it = expandTimes.begin(); it != expandTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("timems").as_double();
-	    expand_values.push_back(value);
-	}
+		if(rcFile == (uintptr_t)-1) {
+			fprintf(stderr, "omrfile_findfirst(SRC_DIR, resultBuffer), return code=%d\n", (int)rcFile);
+			return -1;
+		}
 
-	gcTimes = doc.select_nodes(XPATH_GET_TOTAL_GC_TIME);
-	for (pugi::xpath_node_set::const_iterator it = gcTimes.begin(); it != gcTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("durationms").as_double();
-	    gcduration_values.push_back(value);
+		while ((uintptr_t)-1 != rcFile) {
+			if (strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) {
+				addFile(&files, resultBuffer);
+			}
+			rcFile = omrfile_findnext(handle, resultBuffer);
+		}
+		if (handle != (uintptr_t)-1) {
+			omrfile_findclose(handle);
+		}
 	}
+	std::sort(files.begin(), files.end(), compareFiles);
 
-	if (!mark_values.empty()) {
-		maxMark = *std::max_element(mark_values.begin(), mark_values.end());
-		minMark = *std::min_element(mark_values.begin(), mark_values.end());
-		avgMark = getAvg(mark_values);
+	for (std::vector<VerboseGCFile>::iterator it = files.begin(); it != files.end(); ++it) {
+		it->analysis = new VerboseGCLogAnalysis();
 	}
-
-	if (!sweep_values.empty()) {
-		maxSweep = *std::max_element(sweep_values.begin(), sweep_values.end());
-		minSweep = *std::min_element(sweep_values.begin(), sweep_values.end());
-		avgSweep = getAvg(sweep_values);
+	if (!analyzeFilesInParallel(&files, threadCount, &portLibrary)) {
+		fprintf(stderr, "Failed to create the analysis monitor\n");
+		rc = -1;
 	}
 
-	if (!expand_values.empty()) {
-		maxExpand = *std::max_element(expand_values.begin(), expand_values.end());
-		minExpand = *std::min_element(expand_values.begin(), expand_values.end());
-		avgExpand = getAvg(expand_values);
+	/* the rotated files of a log are merged in order */
+	std::vector<VerboseGCLogAnalysis *> analyses;
+	for (std::vector<VerboseGCFile>::iterator it = files.begin(); it != files.end(); ++it) {
+		if (analyses.empty() || (0 != it->log.compare(analyses.back()->name))) {
+			analyses.push_back(new VerboseGCLogAnalysis());
+			analyses.back()->name = it->log;
+		}
+		analyses.back()->merge(it->analysis);
+		delete it->analysis;
+		it->analysis = NULL;
+		totalFiles++;
+		if (!keep) {
+			/* Clean up verbose log file */
+			omrfile_unlink(it->path.c_str());
+		}
 	}
 
-	if (!gcduration_values.empty()) {
-		maxGCDuration = *std::max_element(gcduration_values.begin(), gcduration_values.end());
-		minGCDuration = *std::min_element(gcduration_values.begin(), gcduration_values.end());
-		avgGCDuration = getAvg(gcduration_values);
+	for (std::vector<VerboseGCLogAnalysis *>::iterator it = analyses.begin(); it != analyses.end(); ++it) {
+		printVerboseGCReport(*it, &portLibrary);
+	}
+	if ((NULL != csvFile) && !writeSummary(csvFile, writeVerboseGCCSV, &analyses)) {
+		rc = -1;
+	}
+	if ((NULL != jsonFile) && !writeSummary(jsonFile, writeVerboseGCJSON, &analyses)) {
+		rc = -1;
+	}
+	for (std::vector<VerboseGCLogAnalysis *>::iterator it = analyses.begin(); it != analyses.end(); ++it) {
+		delete *it;
 	}
 
-	omrtty_printf("            Mark           Sweep          Expand        GCDuration\n");
-	omrtty_printf("-------------------------------------------------------------------\n");
-	omrtty_printf("Max     : %f        %f        %f        %f\n",
-						maxMark, maxSweep, maxExpand, maxGCDuration);
-
-	omrtty_printf("Min     : %f        %f        %f        %f\n",
-								minMark, minSweep, minExpand, minGCDuration);
+	if(totalFiles < 1) {
+		omrtty_printf("Failed to find any verbose GC file to process!\n\n");
+	}
 
-	omrtty_printf("Average : %f        %f        %f        %f\n\n",
-								avgMark, avgSweep, avgExpand, avgGCDuration);
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return (int)rc;
 }
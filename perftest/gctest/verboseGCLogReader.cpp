@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Read verbose GC logs in fixed size pieces. Binary logs are decoded to XML first.
+ */
+
+#include "omr.h"
+#include "omrport.h"
+
+#include "verboseGCStreamParser.hpp"
+
+#define VERBOSEGC_READ_SIZE (64 * 1024)
+
+bool
+readVerboseGCLog(const char *fileName, VerboseGCLogSink *sink, OMRPortLibrary *portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+
+	if (isVerboseGCBinaryLog(fileName, portLibrary)) {
+		return decodeVerboseGCBinaryLog(fileName, sink, portLibrary);
+	}
+
+	int64_t fileLength = omrfile_length(fileName);
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0444);
+	if ((fileLength < 0) || (-1 == fd)) {
+		if (-1 != fd) {
+			omrfile_close(fd);
+		}
+		return false;
+	}
+	uint8_t *buffer = (uint8_t *)omrmem_allocate_memory(VERBOSEGC_READ_SIZE, OMRMEM_CATEGORY_MM);
+	if (NULL == buffer) {
+		omrfile_close(fd);
+		return false;
+	}
+
+	bool result = true;
+	int64_t offset = 0;
+	while (result && (offset < fileLength)) {
+		/* omrfile_read() also fails at the end of the file, so read up to the length known beforehand */
+		intptr_t bytesRead = omrfile_read(fd, buffer, (intptr_t)OMR_MIN((int64_t)VERBOSEGC_READ_SIZE, fileLength - offset));
+		if (bytesRead <= 0) {
+			result = false;
+		} else {
+			sink->write((const char *)buffer, (uintptr_t)bytesRead);
+		}
+		offset += bytesRead;
+	}
+
+	omrmem_free_memory(buffer);
+	omrfile_close(fd);
+	return result;
+}
@@ -0,0 +1,327 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Reports of the analysis of verbose GC logs: a text report on the terminal, and CSV and JSON summaries for
+ * regression dashboards.
+ *
+ * The CSV summary has one row per duration metric of each log: the exclusive access pauses, the collections
+ * by type (gc-end), the phases (gc-op) and the heap resizes by type (heap-resize).
+ * The JSON summary also has the pause histogram, the allocation rate timeline (one point per pause) and the
+ * heap resize events.
+ */
+
+#include <string.h>
+
+#include "verboseGCAnalyzer.hpp"
+
+#define BYTES_PER_MB (1024.0 * 1024.0)
+
+static const double REPORTED_PERCENTILES[] = { 50.0, 90.0, 99.0, 99.9 };
+#define REPORTED_PERCENTILE_COUNT (sizeof(REPORTED_PERCENTILES) / sizeof(REPORTED_PERCENTILES[0]))
+
+/* upper bounds of the pause distribution of the text report, in milliseconds */
+static const double PAUSE_DISTRIBUTION_BOUNDS[] = { 0.1, 1.0, 10.0, 100.0, 1000.0 };
+#define PAUSE_DISTRIBUTION_BUCKETS ((sizeof(PAUSE_DISTRIBUTION_BOUNDS) / sizeof(PAUSE_DISTRIBUTION_BOUNDS[0])) + 1)
+
+/**
+ * @return the allocation rate of a mutator interval in MB/s, or 0 if the interval was not logged
+ */
+static double
+getAllocationRate(const VerboseGCAllocationSample *sample)
+{
+	if (sample->intervalMillis <= 0.0) {
+		return 0.0;
+	}
+	return ((double)sample->allocatedBytes / BYTES_PER_MB) / (sample->intervalMillis / 1000.0);
+}
+
+/**
+ * @return the timestamp of the first pause of the log, which the timeline and the heap resizes are relative to
+ */
+static double
+getStartTimestamp(const VerboseGCLogAnalysis *analysis)
+{
+	for (std::vector<VerboseGCAllocationSample>::const_iterator it = analysis->timeline.begin(); it != analysis->timeline.end(); ++it) {
+		if (0.0 != it->timestampMillis) {
+			return it->timestampMillis;
+		}
+	}
+	return 0.0;
+}
+
+static double
+getElapsed(double timestampMillis, double startMillis)
+{
+	return ((0.0 == timestampMillis) || (0.0 == startMillis)) ? 0.0 : (timestampMillis - startMillis);
+}
+
+static void
+printHistogramRow(OMRPortLibrary *portLibrary, const char *source, const char *type, const VerboseGCHistogram *histogram)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	char label[64];
+	omrstr_printf(label, sizeof(label), "%s %s", source, type);
+	omrtty_printf("%-24s %9llu %10.3f", label, histogram->getCount(), histogram->getMean());
+	for (uintptr_t i = 0; i < REPORTED_PERCENTILE_COUNT; i++) {
+		omrtty_printf(" %10.3f", histogram->getPercentile(REPORTED_PERCENTILES[i]));
+	}
+	omrtty_printf(" %10.3f\n", histogram->getMax());
+}
+
+static void
+printHistogramRows(OMRPortLibrary *portLibrary, const char *source, const VerboseGCHistogramMap *histograms)
+{
+	for (VerboseGCHistogramMap::const_iterator it = histograms->begin(); it != histograms->end(); ++it) {
+		printHistogramRow(portLibrary, source, it->first.c_str(), &it->second);
+	}
+}
+
+void
+printVerboseGCReport(const VerboseGCLogAnalysis *analysis, OMRPortLibrary *portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+
+	omrtty_printf("\nResults for : %s (%zu file%s)\n", analysis->name.c_str(), analysis->files, (1 == analysis->files) ? "" : "s");
+	if (0 != analysis->failedFiles) {
+		omrtty_printf("Error loading %zu file%s\n", analysis->failedFiles, (1 == analysis->failedFiles) ? "" : "s");
+	}
+	omrtty_printf("Cycles : %llu logged, %llu dropped\n\n", analysis->cycles, analysis->droppedCycles);
+
+	omrtty_printf("%-24s %9s %10s %10s %10s %10s %10s %10s\n", "Durations (ms)", "Count", "Mean", "P50", "P90", "P99", "P99.9", "Max");
+	omrtty_printf("-----------------------------------------------------------------------------------------------------\n");
+	printHistogramRow(portLibrary, "pause", "exclusive", &analysis->pauses);
+	printHistogramRows(portLibrary, "gc-end", &analysis->collections);
+	printHistogramRows(portLibrary, "gc-op", &analysis->phases);
+	printHistogramRows(portLibrary, "heap-resize", &analysis->heapResizeTimes);
+	omrtty_printf("\n");
+
+	uint64_t distribution[PAUSE_DISTRIBUTION_BUCKETS];
+	memset(distribution, 0, sizeof(distribution));
+	uint64_t allocatedBytes = 0;
+	double mutatorMillis = 0.0;
+	double peakRate = 0.0;
+	for (std::vector<VerboseGCAllocationSample>::const_iterator it = analysis->timeline.begin(); it != analysis->timeline.end(); ++it) {
+		uintptr_t bucket = 0;
+		while ((bucket < (PAUSE_DISTRIBUTION_BUCKETS - 1)) && (it->pauseMillis >= PAUSE_DISTRIBUTION_BOUNDS[bucket])) {
+			bucket += 1;
+		}
+		distribution[bucket] += 1;
+		allocatedBytes += it->allocatedBytes;
+		mutatorMillis += it->intervalMillis;
+		peakRate = OMR_MAX(peakRate, getAllocationRate(&*it));
+	}
+
+	omrtty_printf("Pause distribution : %9s %9s %9s %9s %9s %9s\n", "<0.1ms", "<1ms", "<10ms", "<100ms", "<1s", ">=1s");
+	omrtty_printf("                     %9llu %9llu %9llu %9llu %9llu %9llu\n\n",
+		distribution[0], distribution[1], distribution[2], distribution[3], distribution[4], distribution[5]);
+
+	double meanRate = (mutatorMillis > 0.0) ? (((double)allocatedBytes / BYTES_PER_MB) / (mutatorMillis / 1000.0)) : 0.0;
+	omrtty_printf("Allocation : %.3f MB in %.3f ms of mutator time, mean rate %.3f MB/s, peak rate %.3f MB/s\n",
+		(double)allocatedBytes / BYTES_PER_MB, mutatorMillis, meanRate, peakRate);
+
+	uintptr_t expansions = 0;
+	uintptr_t contractions = 0;
+	uint64_t expandedBytes = 0;
+	uint64_t contractedBytes = 0;
+	for (std::vector<VerboseGCHeapResizeEvent>::const_iterator it = analysis->heapResizes.begin(); it != analysis->heapResizes.end(); ++it) {
+		if ("expand" == it->type) {
+			expansions += 1;
+			expandedBytes += it->amount;
+		} else if ("contract" == it->type) {
+			contractions += 1;
+			contractedBytes += it->amount;
+		}
+	}
+	omrtty_printf("Heap resizes : %zu expansions (%llu KB), %zu contractions (%llu KB)\n\n",
+		expansions, expandedBytes / 1024, contractions, contractedBytes / 1024);
+
+	simulateHeapResize(analysis, portLibrary);
+}
+
+/**
+ * Write a CSV field, quoted if needed.
+ */
+static void
+writeCSVField(FILE *file, const char *value)
+{
+	if (NULL == strpbrk(value, ",\"\n\r")) {
+		fputs(value, file);
+	} else {
+		fputc('"', file);
+		for (const char *c = value; '\0' != *c; c++) {
+			if ('"' == *c) {
+				fputc('"', file);
+			}
+			fputc(*c, file);
+		}
+		fputc('"', file);
+	}
+}
+
+static void
+writeCSVRow(FILE *file, const VerboseGCLogAnalysis *analysis, const char *source, const char *type, const VerboseGCHistogram *histogram)
+{
+	writeCSVField(file, analysis->name.c_str());
+	fputc(',', file);
+	writeCSVField(file, source);
+	fputc(',', file);
+	writeCSVField(file, type);
+	fprintf(file, ",%llu,%.3f,%.3f,%.3f", (unsigned long long)histogram->getCount(), histogram->getTotal(), histogram->getMin(), histogram->getMean());
+	for (uintptr_t i = 0; i < REPORTED_PERCENTILE_COUNT; i++) {
+		fprintf(file, ",%.3f", histogram->getPercentile(REPORTED_PERCENTILES[i]));
+	}
+	fprintf(file, ",%.3f\n", histogram->getMax());
+}
+
+static void
+writeCSVRows(FILE *file, const VerboseGCLogAnalysis *analysis, const char *source, const VerboseGCHistogramMap *histograms)
+{
+	for (VerboseGCHistogramMap::const_iterator it = histograms->begin(); it != histograms->end(); ++it) {
+		writeCSVRow(file, analysis, source, it->first.c_str(), &it->second);
+	}
+}
+
+void
+writeVerboseGCCSV(FILE *file, const std::vector<VerboseGCLogAnalysis *> *analyses)
+{
+	fprintf(file, "log,source,type,count,totalms,minms,meanms,p50ms,p90ms,p99ms,p999ms,maxms\n");
+	for (std::vector<VerboseGCLogAnalysis *>::const_iterator it = analyses->begin(); it != analyses->end(); ++it) {
+		const VerboseGCLogAnalysis *analysis = *it;
+		writeCSVRow(file, analysis, "pause", "exclusive", &analysis->pauses);
+		writeCSVRows(file, analysis, "gc-end", &analysis->collections);
+		writeCSVRows(file, analysis, "gc-op", &analysis->phases);
+		writeCSVRows(file, analysis, "heap-resize", &analysis->heapResizeTimes);
+	}
+}
+
+static void
+writeJSONString(FILE *file, const char *value)
+{
+	fputc('"', file);
+	for (const unsigned char *c = (const unsigned char *)value; '\0' != *c; c++) {
+		if (('"' == *c) || ('\\' == *c)) {
+			fputc('\\', file);
+			fputc(*c, file);
+		} else if (*c < 0x20) {
+			fprintf(file, "\\u%04x", (unsigned int)*c);
+		} else {
+			fputc(*c, file);
+		}
+	}
+	fputc('"', file);
+}
+
+static void
+writeJSONHistogram(FILE *file, const VerboseGCHistogram *histogram, bool buckets)
+{
+	fprintf(file, "{\"count\": %llu, \"totalms\": %.3f, \"minms\": %.3f, \"meanms\": %.3f",
+		(unsigned long long)histogram->getCount(), histogram->getTotal(), histogram->getMin(), histogram->getMean());
+	fprintf(file, ", \"p50ms\": %.3f, \"p90ms\": %.3f, \"p99ms\": %.3f, \"p999ms\": %.3f, \"maxms\": %.3f",
+		histogram->getPercentile(50.0), histogram->getPercentile(90.0), histogram->getPercentile(99.0),
+		histogram->getPercentile(99.9), histogram->getMax());
+	if (buckets) {
+		/* the non empty buckets, as [lowest ms, highest ms, count] */
+		const char *separator = "";
+		fprintf(file, ", \"histogram\": [");
+		for (uintptr_t bucket = 0; bucket < VERBOSEGC_HISTOGRAM_BUCKETS; bucket++) {
+			uint64_t count = histogram->getBucketCount(bucket);
+			if (0 != count) {
+				fprintf(file, "%s[%.3f, %.3f, %llu]", separator, VerboseGCHistogram::getBucketLow(bucket),
+					VerboseGCHistogram::getBucketHigh(bucket), (unsigned long long)count);
+				separator = ", ";
+			}
+		}
+		fprintf(file, "]");
+	}
+	fprintf(file, "}");
+}
+
+static void
+writeJSONHistograms(FILE *file, const char *name, const VerboseGCHistogramMap *histograms)
+{
+	const char *separator = "";
+	fprintf(file, ",\n      \"%s\": {", name);
+	for (VerboseGCHistogramMap::const_iterator it = histograms->begin(); it != histograms->end(); ++it) {
+		fprintf(file, "%s\n        ", separator);
+		writeJSONString(file, it->first.c_str());
+		fprintf(file, ": ");
+		writeJSONHistogram(file, &it->second, false);
+		separator = ",";
+	}
+	fprintf(file, "\n      }");
+}
+
+static void
+writeJSONLog(FILE *file, const VerboseGCLogAnalysis *analysis)
+{
+	double startMillis = getStartTimestamp(analysis);
+
+	fprintf(file, "    {\n      \"name\": ");
+	writeJSONString(file, analysis->name.c_str());
+	fprintf(file, ",\n      \"files\": %zu,\n      \"failedFiles\": %zu", analysis->files, analysis->failedFiles);
+	fprintf(file, ",\n      \"cycles\": %llu,\n      \"droppedCycles\": %llu",
+		(unsigned long long)analysis->cycles, (unsigned long long)analysis->droppedCycles);
+	fprintf(file, ",\n      \"pauses\": ");
+	writeJSONHistogram(file, &analysis->pauses, true);
+	writeJSONHistograms(file, "collections", &analysis->collections);
+	writeJSONHistograms(file, "phases", &analysis->phases);
+	writeJSONHistograms(file, "heapResizeTimes", &analysis->heapResizeTimes);
+
+	/* one point per pause: [elapsed ms, mutator ms, allocated bytes, MB/s, pause ms, heap total, heap free] */
+	const char *separator = "";
+	fprintf(file, ",\n      \"allocationTimeline\": [");
+	for (std::vector<VerboseGCAllocationSample>::const_iterator it = analysis->timeline.begin(); it != analysis->timeline.end(); ++it) {
+		fprintf(file, "%s\n        [%.3f, %.3f, %llu, %.3f, %.3f, %llu, %llu]", separator,
+			getElapsed(it->timestampMillis, startMillis), it->intervalMillis, (unsigned long long)it->allocatedBytes,
+			getAllocationRate(&*it), it->pauseMillis, (unsigned long long)it->heapTotal, (unsigned long long)it->heapFree);
+		separator = ",";
+	}
+	fprintf(file, "\n      ]");
+
+	separator = "";
+	fprintf(file, ",\n      \"heapResizes\": [");
+	for (std::vector<VerboseGCHeapResizeEvent>::const_iterator it = analysis->heapResizes.begin(); it != analysis->heapResizes.end(); ++it) {
+		fprintf(file, "%s\n        {\"elapsedms\": %.3f, \"type\": ", separator, getElapsed(it->timestampMillis, startMillis));
+		writeJSONString(file, it->type.c_str());
+		fprintf(file, ", \"space\": ");
+		writeJSONString(file, it->space.c_str());
+		fprintf(file, ", \"amount\": %llu, \"timems\": %.3f, \"reason\": ", (unsigned long long)it->amount, it->millis);
+		writeJSONString(file, it->reason.c_str());
+		fprintf(file, "}");
+		separator = ",";
+	}
+	fprintf(file, "\n      ]\n    }");
+}
+
+void
+writeVerboseGCJSON(FILE *file, const std::vector<VerboseGCLogAnalysis *> *analyses)
+{
+	const char *separator = "";
+	fprintf(file, "{\n  \"logs\": [\n");
+	for (std::vector<VerboseGCLogAnalysis *>::const_iterator it = analyses->begin(); it != analyses->end(); ++it) {
+		fprintf(file, "%s", separator);
+		writeJSONLog(file, *it);
+		separator = ",\n";
+	}
+	fprintf(file, "\n  ]\n}\n");
+}
@@ -0,0 +1,253 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "verboseGCStreamParser.hpp"
+
+static bool
+isSpace(char c)
+{
+	return (' ' == c) || ('\t' == c) || ('\n' == c) || ('\r' == c);
+}
+
+/**
+ * Replace the predefined entities of a string in place.
+ */
+static void
+decodeEntities(char *string)
+{
+	static const struct {
+		const char *entity;
+		char character;
+	} entities[] = {
+		{ "&amp;", '&' },
+		{ "&lt;", '<' },
+		{ "&gt;", '>' },
+		{ "&quot;", '"' },
+		{ "&apos;", '\'' }
+	};
+
+	char *out = string;
+	for (char *in = string; '\0' != *in; in++) {
+		*out = *in;
+		if ('&' == *in) {
+			for (uintptr_t i = 0; i < sizeof(entities) / sizeof(entities[0]); i++) {
+				uintptr_t length = strlen(entities[i].entity);
+				if (0 == strncmp(in, entities[i].entity, length)) {
+					*out = entities[i].character;
+					in += length - 1;
+					break;
+				}
+			}
+		}
+		out += 1;
+	}
+	*out = '\0';
+}
+
+void
+VerboseGCStreamParser::write(const char *text, uintptr_t length)
+{
+	const char *cursor = text;
+	const char *end = text + length;
+
+	while (cursor < end) {
+		if (!_inTag) {
+			/* text content is ignored */
+			const char *open = (const char *)memchr(cursor, '<', end - cursor);
+			if (NULL == open) {
+				break;
+			}
+			_inTag = true;
+			_quote = 0;
+			_tag.clear();
+			cursor = open + 1;
+		} else {
+			const char *start = cursor;
+			bool closed = false;
+			/* comments and declarations may hold unbalanced quotes */
+			bool quoted = !(_tag.empty() ? ('!' == *cursor) : ('!' == _tag[0]));
+			while (cursor < end) {
+				char c = *cursor++;
+				if (0 != _quote) {
+					if (c == _quote) {
+						_quote = 0;
+					}
+				} else if ('>' == c) {
+					closed = true;
+					break;
+				} else if (quoted && (('"' == c) || ('\'' == c))) {
+					_quote = c;
+				}
+			}
+			_tag.append(start, (closed ? (cursor - 1) : cursor) - start);
+			if (closed) {
+				if (isTagComplete()) {
+					parseTag();
+					_inTag = false;
+				} else {
+					_tag.push_back('>');
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @return false if the '>' that was found is within a comment
+ */
+bool
+VerboseGCStreamParser::isTagComplete()
+{
+	uintptr_t length = _tag.length();
+	if ((length >= 3) && (0 == _tag.compare(0, 3, "!--"))) {
+		return (length >= 5) && ('-' == _tag[length - 1]) && ('-' == _tag[length - 2]);
+	}
+	return true;
+}
+
+void
+VerboseGCStreamParser::parseTag()
+{
+	char *tag = &_tag[0];
+	uintptr_t length = _tag.length();
+
+	if (0 == length) {
+		return;
+	}
+
+	switch (tag[0]) {
+	case '?':
+		/* processing instruction */
+		break;
+	case '!':
+		if ((length >= 5) && (0 == strncmp(tag, "!--", 3))) {
+			tag[length - 2] = '\0';
+			comment(tag + 3);
+		}
+		/* other declarations are ignored */
+		break;
+	case '/':
+	{
+		char *name = tag + 1;
+		char *nameEnd = name;
+		while (('\0' != *nameEnd) && !isSpace(*nameEnd)) {
+			nameEnd += 1;
+		}
+		*nameEnd = '\0';
+		endElement(name);
+		break;
+	}
+	default:
+	{
+		bool empty = false;
+		while ((length > 0) && isSpace(tag[length - 1])) {
+			length -= 1;
+		}
+		if ((length > 0) && ('/' == tag[length - 1])) {
+			empty = true;
+			length -= 1;
+		}
+		tag[length] = '\0';
+
+		char *name = tag;
+		char *cursor = name;
+		while (('\0' != *cursor) && !isSpace(*cursor)) {
+			cursor += 1;
+		}
+		if ('\0' != *cursor) {
+			*cursor++ = '\0';
+		}
+
+		_attributes.clear();
+		parseAttributes(cursor);
+		startElement(name, _attributes.empty() ? NULL : &_attributes[0], _attributes.size());
+		if (empty) {
+			endElement(name);
+		}
+		break;
+	}
+	}
+}
+
+/**
+ * Split the attributes of a start tag in place into _attributes.
+ */
+void
+VerboseGCStreamParser::parseAttributes(char *cursor)
+{
+	for (;;) {
+		while (isSpace(*cursor)) {
+			cursor += 1;
+		}
+		if ('\0' == *cursor) {
+			break;
+		}
+
+		char *name = cursor;
+		while (('\0' != *cursor) && ('=' != *cursor) && !isSpace(*cursor)) {
+			cursor += 1;
+		}
+		char *nameEnd = cursor;
+		while (isSpace(*cursor)) {
+			cursor += 1;
+		}
+		if ('=' != *cursor) {
+			/* malformed: an attribute without a value ends the tag */
+			break;
+		}
+		cursor += 1;
+		while (isSpace(*cursor)) {
+			cursor += 1;
+		}
+		char quote = *cursor;
+		if (('"' != quote) && ('\'' != quote)) {
+			break;
+		}
+		char *value = cursor + 1;
+		char *valueEnd = strchr(value, quote);
+		if (NULL == valueEnd) {
+			break;
+		}
+
+		*nameEnd = '\0';
+		*valueEnd = '\0';
+		if (NULL != strchr(value, '&')) {
+			decodeEntities(value);
+		}
+		VerboseGCAttribute attribute = { name, value };
+		_attributes.push_back(attribute);
+		cursor = valueEnd + 1;
+	}
+}
+
+const char *
+VerboseGCStreamParser::findAttribute(const VerboseGCAttribute *attributes, uintptr_t attributeCount, const char *name)
+{
+	for (uintptr_t i = 0; i < attributeCount; i++) {
+		if (0 == strcmp(attributes[i].name, name)) {
+			return attributes[i].value;
+		}
+	}
+	return NULL;
+}
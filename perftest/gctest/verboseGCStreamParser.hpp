@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEGCSTREAMPARSER_HPP_)
+#define VERBOSEGCSTREAMPARSER_HPP_
+
+#include <string>
+#include <vector>
+
+#include "omr.h"
+#include "omrport.h"
+
+/**
+ * Receives the XML text of a verbose GC log, in pieces of any size.
+ */
+class VerboseGCLogSink
+{
+public:
+	virtual void write(const char *text, uintptr_t length) = 0;
+	virtual ~VerboseGCLogSink() {}
+};
+
+/**
+ * Read a verbose GC log in fixed size pieces and pass its XML text to the sink.
+ * @return false if the file could not be read
+ */
+bool readVerboseGCLog(const char *fileName, VerboseGCLogSink *sink, OMRPortLibrary *portLibrary);
+
+/**
+ * @return true if the file starts with the magic bytes of a binary verbose GC log (-Xgc:binaryLogging)
+ */
+bool isVerboseGCBinaryLog(const char *fileName, OMRPortLibrary *portLibrary);
+
+/**
+ * Decode a binary verbose GC log and pass the equivalent XML text to the sink.
+ * @return false if the file could not be read or is not a binary verbose GC log
+ */
+bool decodeVerboseGCBinaryLog(const char *fileName, VerboseGCLogSink *sink, OMRPortLibrary *portLibrary);
+
+typedef struct VerboseGCAttribute {
+	const char *name;
+	const char *value;
+} VerboseGCAttribute;
+
+/**
+ * Streaming (SAX style) parser of the XML subset written by the verbose GC writers: elements, attributes,
+ * comments, declarations and processing instructions. Text content is ignored. The text may be split
+ * anywhere between two calls to write(); the memory used is bounded by the size of the largest tag.
+ */
+class VerboseGCStreamParser : public VerboseGCLogSink
+{
+	/*
+	 * Data members
+	 */
+private:
+	std::string _tag; /**< the tag being read, without its angle brackets */
+	bool _inTag; /**< true between the angle brackets of a tag */
+	char _quote; /**< the quote of the attribute value being read, or 0 */
+	std::vector<VerboseGCAttribute> _attributes;
+
+	/*
+	 * Function members
+	 */
+public:
+	virtual void write(const char *text, uintptr_t length);
+
+	VerboseGCStreamParser()
+		: _inTag(false)
+		, _quote(0)
+	{
+	}
+
+protected:
+	/**
+	 * Called for each start tag, and for each empty element tag before the matching endElement().
+	 * The strings are only valid during the call.
+	 */
+	virtual void startElement(const char *name, const VerboseGCAttribute *attributes, uintptr_t attributeCount) = 0;
+	virtual void endElement(const char *name) = 0;
+	virtual void comment(const char *text) {}
+
+	/**
+	 * @return the value of the named attribute, or NULL if there is none
+	 */
+	static const char *findAttribute(const VerboseGCAttribute *attributes, uintptr_t attributeCount, const char *name);
+
+private:
+	bool isTagComplete();
+	void parseTag();
+	void parseAttributes(char *cursor);
+};
+
+#endif /* VERBOSEGCSTREAMPARSER_HPP_ */